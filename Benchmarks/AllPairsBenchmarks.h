@@ -0,0 +1,65 @@
+//
+//  AllPairsBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef AllPairsBenchmarks_h
+#define AllPairsBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "AllPairs.h"
+
+#define BENCHMARK static inline void
+
+/// Mean out degree of the graphs
+#define ALL_PAIRS_BENCHMARK_DEGREE 8
+
+/// - Returns: The rows of a directed Erdős–Rényi graph of b->Size vertices, weighted from 1 to 1000
+static Csr *_Benchmark_AllPairsGraph(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000};
+    EdgeList *el = Generators_ErdosRenyi(b->Size, (double) ALL_PAIRS_BENCHMARK_DEGREE / (b->Size - 1), &options);
+    Csr *csr = Csr_FromEdgeList(el);
+    EdgeList_FreeEdgeList(el);
+    return csr;
+}
+
+/// Times the distances between every pair on every processor, per pair of the graph
+BENCHMARK AllPairs_FloydWarshall_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_AllPairsGraph(b);
+    const size_t pairs = (size_t) csr->Vertices * csr->Vertices;
+    uint64_t *distances = malloc(pairs * sizeof(uint64_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        AllPairs_FloydWarshall(csr, 0, distances);
+        Benchmark_StopSample(b, pairs);
+        _BenchmarkSink = (unsigned int) distances[pairs - 1];
+    }
+    free(distances);
+    Csr_FreeCsr(csr);
+}
+
+/// Times the reachability between every pair, per pair of the graph
+BENCHMARK AllPairs_TransitiveClosure_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_AllPairsGraph(b);
+    const size_t pairs = (size_t) csr->Vertices * csr->Vertices;
+    uint64_t *rows = malloc(csr->Vertices * ALL_PAIRS_ROW_WORDS(csr->Vertices) * sizeof(uint64_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        AllPairs_TransitiveClosure(csr, rows);
+        Benchmark_StopSample(b, pairs);
+        _BenchmarkSink = (unsigned int) rows[0];
+    }
+    free(rows);
+    Csr_FreeCsr(csr);
+}
+
+#endif /* AllPairsBenchmarks_h */
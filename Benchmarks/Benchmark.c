@@ -0,0 +1,173 @@
+//
+//  Benchmark.c
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Benchmark.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+
+#define BENCHMARK_LINE_SIZE 512
+
+static unsigned long long _Nanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long) now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+void Benchmark_Init(Benchmark *b, const char *name, unsigned int size, size_t samples)
+{
+    assert(b != NULL);
+    assert(samples > 0 && samples <= BENCHMARK_MAX_SAMPLES);
+    
+    strncpy(b->Name, name, BENCHMARK_NAME_SIZE - 1);
+    b->Name[BENCHMARK_NAME_SIZE - 1] = '\0';
+    b->Size = size;
+    b->Count = 0;
+    b->Target = samples;
+    b->Start = 0;
+}
+
+bool Benchmark_IsRunning(const Benchmark *b)
+{
+    return b->Count < b->Target;
+}
+
+void Benchmark_StartSample(Benchmark *b)
+{
+    b->Start = _Nanoseconds();
+}
+
+void Benchmark_StopSample(Benchmark *b, unsigned long operations)
+{
+    unsigned long long elapsed = _Nanoseconds() - b->Start;
+    assert(operations > 0);
+    assert(b->Count < b->Target);
+    b->Samples[b->Count++] = (double) elapsed / operations;
+}
+
+unsigned int Benchmark_Random(unsigned int *state)
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static int _CompareSamples(const void *a, const void *b)
+{
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+/// Nearest rank percentile of sorted samples
+static double _Percentile(const double *sorted, size_t count, double percentile)
+{
+    size_t rank = (size_t) (percentile / 100.0 * count + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+BenchmarkSummary Benchmark_Summarize(Benchmark *b)
+{
+    assert(b != NULL);
+    assert(b->Count > 0);
+    
+    qsort(b->Samples, b->Count, sizeof(double), _CompareSamples);
+    BenchmarkSummary summary =
+    {
+        .P50 = _Percentile(b->Samples, b->Count, 50),
+        .P90 = _Percentile(b->Samples, b->Count, 90),
+        .P99 = _Percentile(b->Samples, b->Count, 99),
+        .Min = b->Samples[0],
+        .Max = b->Samples[b->Count - 1],
+    };
+    summary.Throughput = summary.P50 > 0 ? 1e9 / summary.P50 : 0;
+    return summary;
+}
+
+static void _WriteField(OutputSink *sink, const char *name, double value)
+{
+    char number[32];
+    snprintf(number, sizeof(number), "%.2f", value);
+    OutputSink_WriteString(sink, ", \"");
+    OutputSink_WriteString(sink, name);
+    OutputSink_WriteString(sink, "\": ");
+    OutputSink_WriteString(sink, number);
+}
+
+void Benchmark_WriteJson(const Benchmark *b, BenchmarkSummary summary, OutputSink *sink)
+{
+    OutputSink_WriteString(sink, "{\"name\": \"");
+    OutputSink_WriteString(sink, b->Name);
+    OutputSink_WriteString(sink, "\", \"size\": ");
+    OutputSink_WriteInt(sink, b->Size);
+    OutputSink_WriteString(sink, ", \"samples\": ");
+    OutputSink_WriteInt(sink, b->Count);
+    _WriteField(sink, "p50_ns", summary.P50);
+    _WriteField(sink, "p90_ns", summary.P90);
+    _WriteField(sink, "p99_ns", summary.P99);
+    _WriteField(sink, "min_ns", summary.Min);
+    _WriteField(sink, "max_ns", summary.Max);
+    _WriteField(sink, "ops_per_sec", summary.Throughput);
+    OutputSink_WriteChar(sink, '}');
+}
+
+bool Benchmark_ReadBaseline(FILE *file, BenchmarkBaseline *baseline)
+{
+    assert(file != NULL);
+    assert(baseline != NULL);
+    
+    size_t capacity = 16;
+    baseline->Entries = malloc(capacity * sizeof(BenchmarkBaselineEntry));
+    baseline->Count = 0;
+    
+    char line[BENCHMARK_LINE_SIZE];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        // Only the fields compared against are read, the rest of the line is ignored
+        BenchmarkBaselineEntry entry;
+        const char *fields = strstr(line, "{\"name\": \"");
+        if (fields == NULL) continue;
+        if (sscanf(fields, "{\"name\": \"%63[^\"]\", \"size\": %u", entry.Name, &entry.Size) != 2) continue;
+        
+        const char *p50 = strstr(fields, "\"p50_ns\": ");
+        if (p50 == NULL || sscanf(p50, "\"p50_ns\": %lf", &entry.P50) != 1) continue;
+        
+        if (baseline->Count == capacity)
+        {
+            capacity *= 2;
+            baseline->Entries = realloc(baseline->Entries, capacity * sizeof(BenchmarkBaselineEntry));
+        }
+        baseline->Entries[baseline->Count++] = entry;
+    }
+    
+    return !ferror(file);
+}
+
+void Benchmark_FreeBaseline(BenchmarkBaseline *baseline)
+{
+    free(baseline->Entries);
+    baseline->Entries = NULL;
+    baseline->Count = 0;
+}
+
+const BenchmarkBaselineEntry *Benchmark_FindBaseline(const BenchmarkBaseline *baseline, const char *name, unsigned int size)
+{
+    for (size_t i = 0; i < baseline->Count; i++)
+    {
+        if (baseline->Entries[i].Size == size && strcmp(baseline->Entries[i].Name, name) == 0)
+        {
+            return &baseline->Entries[i];
+        }
+    }
+    return NULL;
+}
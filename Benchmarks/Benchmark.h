@@ -0,0 +1,100 @@
+//
+//  Benchmark.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "Util/OutputSink.h"
+
+#define BENCHMARK_MAX_SAMPLES 1000
+#define BENCHMARK_DEFAULT_SAMPLES 200
+#define BENCHMARK_NAME_SIZE 64
+
+/// Timings of one function at one problem size
+typedef struct
+{
+    char Name[BENCHMARK_NAME_SIZE];
+    
+    /// Vertices, edges or primitives the function was run on
+    unsigned int Size;
+    
+    /// Nanoseconds per operation of every sample
+    double Samples[BENCHMARK_MAX_SAMPLES];
+    size_t Count;
+    
+    /// Samples to take
+    size_t Target;
+    
+    /// Start of the sample being timed
+    unsigned long long Start;
+    
+} Benchmark;
+
+/// Percentiles of a benchmark, in nanoseconds per operation
+typedef struct
+{
+    double P50;
+    double P90;
+    double P99;
+    double Min;
+    double Max;
+    
+    /// Operations per second at the median
+    double Throughput;
+} BenchmarkSummary;
+
+/// A benchmark as recorded in a baseline file
+typedef struct
+{
+    char Name[BENCHMARK_NAME_SIZE];
+    unsigned int Size;
+    double P50;
+} BenchmarkBaselineEntry;
+
+typedef struct
+{
+    BenchmarkBaselineEntry *Entries;
+    size_t Count;
+} BenchmarkBaseline;
+
+/// Starts an empty benchmark
+void Benchmark_Init(Benchmark *b, const char *name, unsigned int size, size_t samples);
+
+/// - Returns: true while more samples are needed
+bool Benchmark_IsRunning(const Benchmark *b);
+
+/// Starts timing a sample. Setup done before this is not timed.
+void Benchmark_StartSample(Benchmark *b);
+
+/// Stops timing the sample, recording the time per operation
+/// - Parameters:
+///   - operations: how many calls of the benchmarked function the sample timed
+void Benchmark_StopSample(Benchmark *b, unsigned long operations);
+
+/// Sorts the samples and reads their percentiles
+BenchmarkSummary Benchmark_Summarize(Benchmark *b);
+
+/// Writes the summary as a single line JSON object
+void Benchmark_WriteJson(const Benchmark *b, BenchmarkSummary summary, OutputSink *sink);
+
+/// Reads a baseline written by Benchmark_WriteJson, one benchmark per line
+/// - Returns: false if the file could not be read
+bool Benchmark_ReadBaseline(FILE *file, BenchmarkBaseline *baseline);
+
+/// Frees the entries of the baseline
+void Benchmark_FreeBaseline(BenchmarkBaseline *baseline);
+
+/// Deterministic xorshift random numbers, so every run benchmarks the same graphs and scenes
+unsigned int Benchmark_Random(unsigned int *state);
+
+/// - Returns: The baseline entry with the same name and size, or NULL if it was not recorded
+const BenchmarkBaselineEntry *Benchmark_FindBaseline(const BenchmarkBaseline *baseline, const char *name, unsigned int size);
+
+#endif /* Benchmark_h */
@@ -0,0 +1,45 @@
+//
+//  BiconnectedBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef BiconnectedBenchmarks_h
+#define BiconnectedBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "Biconnected.h"
+
+#define BENCHMARK static inline void
+
+/// Mean degree of the searched graphs, sparse enough that the giant component has many bridges and cut vertices
+#define BICONNECTED_BENCHMARK_DEGREE 3
+
+/// Times the biconnected components, bridges and cut vertices, per edge of the graph
+BENCHMARK Biconnected_Components_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED};
+    EdgeList *el = Generators_ErdosRenyi(b->Size, (double) BICONNECTED_BENCHMARK_DEGREE / 2 / (b->Size - 1), &options);
+    Csr *out = Csr_FromEdgeList(el);
+    Csr *in = Csr_Transpose(out);
+    uint32_t *components = malloc(out->Count * sizeof(uint32_t));
+    bool *isArticulation = malloc(out->Vertices * sizeof(bool));
+    bool *isBridge = malloc(out->Count * sizeof(bool));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Biconnected_Components(out, in, components, isArticulation, isBridge);
+        Benchmark_StopSample(b, out->Count);
+    }
+    free(components);
+    free(isArticulation);
+    free(isBridge);
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(in);
+    EdgeList_FreeEdgeList(el);
+}
+
+#endif /* BiconnectedBenchmarks_h */
@@ -0,0 +1,96 @@
+//
+//  BvhBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef BvhBenchmarks_h
+#define BvhBenchmarks_h
+
+#include <math.h>
+#include <string.h>
+#include "GraphBenchmarks.h"
+#include "../Graph Theorist Sketchpad/Bvh/BvhTree.h"
+
+/// Scenes grow with their primitive count, keeping about one primitive per 16 bounding boxes of area
+static Rectangle _Benchmark_SceneBoundingBox(unsigned int primitives)
+{
+    float side = sqrtf((float) primitives) * 4 * BOUNDING_BOX_SIZE;
+    return (Rectangle) {0, 0, side, side};
+}
+
+static Vector2 _Benchmark_RandomPosition(unsigned int *state, Rectangle scene)
+{
+    return (Vector2)
+    {
+        scene.x + (Benchmark_Random(state) % 10000) / 10000.0f * scene.width,
+        scene.y + (Benchmark_Random(state) % 10000) / 10000.0f * scene.height,
+    };
+}
+
+/// Creates primitives scattered over the scene
+static Primitive *_Benchmark_CreateScene(unsigned int primitives, Rectangle scene)
+{
+    Primitive *scattered = malloc(primitives * sizeof(Primitive));
+    unsigned int state = BENCHMARK_SEED;
+    for (unsigned int i = 0; i < primitives; i++)
+    {
+        scattered[i] = Primitive_CreatePrimitive(_Benchmark_RandomPosition(&state, scene), i);
+    }
+    return scattered;
+}
+
+BENCHMARK BvhTree_CreateBvhTree_Benchmark(Benchmark *b)
+{
+    Rectangle scene = _Benchmark_SceneBoundingBox(b->Size);
+    Primitive *scattered = _Benchmark_CreateScene(b->Size, scene);
+    Primitive *primitives = malloc(b->Size * sizeof(Primitive));
+    
+    while (Benchmark_IsRunning(b))
+    {
+        // Creating the tree sorts the primitives, so every sample starts from the same order
+        memcpy(primitives, scattered, b->Size * sizeof(Primitive));
+        
+        Benchmark_StartSample(b);
+        BvhTree *bvht = BvhTree_CreateBvhTree(primitives, b->Size, scene);
+        Benchmark_StopSample(b, 1);
+        
+        BvhTree_FreeBvhTree(bvht);
+    }
+    
+    free(primitives);
+    free(scattered);
+}
+
+BENCHMARK BvhTree_CheckCollision_Benchmark(Benchmark *b)
+{
+    Rectangle scene = _Benchmark_SceneBoundingBox(b->Size);
+    Primitive *primitives = _Benchmark_CreateScene(b->Size, scene);
+    BvhTree *bvht = BvhTree_CreateBvhTree(primitives, b->Size, scene);
+    
+    // Queries the size of a vertex, like the cursor checks every frame
+    Rectangle queries[BENCHMARK_CALLS_PER_SAMPLE];
+    unsigned int state = ~BENCHMARK_SEED;
+    for (unsigned int i = 0; i < BENCHMARK_CALLS_PER_SAMPLE; i++)
+    {
+        queries[i] = Primitive_CreatePrimitive(_Benchmark_RandomPosition(&state, scene), 0).BoundingBox;
+    }
+    
+    while (Benchmark_IsRunning(b))
+    {
+        int hits = 0;
+        Benchmark_StartSample(b);
+        for (unsigned int i = 0; i < BENCHMARK_CALLS_PER_SAMPLE; i++)
+        {
+            hits += BvhTree_CheckCollision(bvht, queries[i]) != -1;
+        }
+        Benchmark_StopSample(b, BENCHMARK_CALLS_PER_SAMPLE);
+        _BenchmarkSink = hits;
+    }
+    
+    BvhTree_FreeBvhTree(bvht);
+    free(primitives);
+}
+
+#endif /* BvhBenchmarks_h */
@@ -0,0 +1,52 @@
+//
+//  CliqueBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef CliqueBenchmarks_h
+#define CliqueBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Clique.h"
+#include "ColoringBenchmarks.h"
+
+#define BENCHMARK static inline void
+
+static bool _Clique_Benchmark_Count(void *context, unsigned int thread, const uint32_t *clique, unsigned int size)
+{
+    return true;
+}
+
+/// Times the enumeration of every maximal clique of a random graph of a tenth of the possible edges on every processor,
+/// per vertex
+BENCHMARK Clique_Maximal_Benchmark(Benchmark *b)
+{
+    BitMatrix *m = _Coloring_RandomMatrix(b->Size, 0.1);
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Clique_Maximal(m, NULL, _Clique_Benchmark_Count, NULL);
+        Benchmark_StopSample(b, b->Size);
+    }
+    BitMatrix_FreeBitMatrix(m);
+}
+
+/// Times the largest clique of a random graph of half the possible edges on every processor, per vertex
+BENCHMARK Clique_Maximum_Benchmark(Benchmark *b)
+{
+    BitMatrix *m = _Coloring_RandomMatrix(b->Size, 0.5);
+    uint32_t *clique = malloc(b->Size * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Clique_Maximum(m, NULL, clique, NULL);
+        Benchmark_StopSample(b, b->Size);
+    }
+    free(clique);
+    BitMatrix_FreeBitMatrix(m);
+}
+
+#endif /* CliqueBenchmarks_h */
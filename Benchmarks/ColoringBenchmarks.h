@@ -0,0 +1,68 @@
+//
+//  ColoringBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ColoringBenchmarks_h
+#define ColoringBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Coloring.h"
+#include "Util/Random.h"
+
+#define BENCHMARK static inline void
+
+/// The packed adjacency of a random graph with each pair of vertices joined with the probability
+static BitMatrix *_Coloring_RandomMatrix(unsigned int n, double p)
+{
+    Random random;
+    Random_Seed(&random, BENCHMARK_SEED);
+    EdgeList *el = EdgeList_CreateEdgeList(n, 0);
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (VertexIndex v = u + 1; v < n; v++)
+        {
+            if (Random_Double(&random) < p) EdgeList_Add(el, u, v, 1);
+        }
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return m;
+}
+
+/// Times DSatur on a random graph of half the possible edges, per vertex
+BENCHMARK Coloring_DSatur_Benchmark(Benchmark *b)
+{
+    BitMatrix *m = _Coloring_RandomMatrix(b->Size, 0.5);
+    uint32_t *colors = malloc(b->Size * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Coloring_DSatur(m, colors);
+        Benchmark_StopSample(b, b->Size);
+    }
+    free(colors);
+    BitMatrix_FreeBitMatrix(m);
+}
+
+/// Times the chromatic number of a random graph of half the possible edges on every processor, per vertex
+BENCHMARK Coloring_Chromatic_Benchmark(Benchmark *b)
+{
+    BitMatrix *m = _Coloring_RandomMatrix(b->Size, 0.5);
+    uint32_t *colors = malloc(b->Size * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Coloring_Chromatic(m, NULL, colors, NULL);
+        Benchmark_StopSample(b, b->Size);
+    }
+    free(colors);
+    BitMatrix_FreeBitMatrix(m);
+}
+
+#endif /* ColoringBenchmarks_h */
@@ -0,0 +1,69 @@
+//
+//  DirectedBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef DirectedBenchmarks_h
+#define DirectedBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "Directed.h"
+
+#define BENCHMARK static inline void
+
+/// Mean out degree of the searched graphs, past the point a giant strong component forms among many small ones
+#define DIRECTED_BENCHMARK_DEGREE 2
+
+static EdgeList *_Directed_Generate(unsigned int vertices)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .IsDirected = true};
+    return Generators_ErdosRenyi(vertices, (double) DIRECTED_BENCHMARK_DEGREE / (vertices - 1), &options);
+}
+
+/// Times the strongly connected components, per edge of the graph
+BENCHMARK Directed_StronglyConnectedComponents_Benchmark(Benchmark *b)
+{
+    EdgeList *el = _Directed_Generate(b->Size);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Directed_StronglyConnectedComponents(csr, components);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(components);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Times the condensation, its topological order and its critical path, per edge of the graph
+BENCHMARK Directed_CriticalPath_Benchmark(Benchmark *b)
+{
+    EdgeList *el = _Directed_Generate(b->Size);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+    unsigned int count = Directed_StronglyConnectedComponents(csr, components);
+    VertexIndex *order = malloc(count * sizeof(VertexIndex));
+    uint64_t *lengths = malloc(count * sizeof(uint64_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        Csr *condensation = Directed_Condensation(csr, components, count);
+        Directed_TopologicalSort(condensation, order);
+        _BenchmarkSink = Directed_CriticalPath(condensation, order, lengths, NULL, NULL);
+        Csr_FreeCsr(condensation);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(components);
+    free(order);
+    free(lengths);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+#endif /* DirectedBenchmarks_h */
@@ -0,0 +1,50 @@
+//
+//  EulerBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef EulerBenchmarks_h
+#define EulerBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Euler.h"
+#include "Util/Random.h"
+
+#define BENCHMARK static inline void
+
+/// Edges of the walked graphs per vertex
+#define EULER_BENCHMARK_DEGREE 8
+
+/// Times the Euler circuit of a random closed walk through every vertex, walking each edge either way, per edge of the graph
+BENCHMARK Euler_Trail_Benchmark(Benchmark *b)
+{
+    Random random;
+    Random_Seed(&random, BENCHMARK_SEED);
+    EdgeList *el = EdgeList_CreateEdgeList(b->Size, (size_t) b->Size * EULER_BENCHMARK_DEGREE);
+    VertexIndex v = 0;
+    for (size_t e = 1; e < (size_t) b->Size * EULER_BENCHMARK_DEGREE; e++)
+    {
+        VertexIndex w = (VertexIndex) Random_Below(&random, b->Size);
+        EdgeList_Add(el, v, w, 1);
+        v = w;
+    }
+    EdgeList_Add(el, v, 0, 1);
+    Csr *out = Csr_FromEdgeList(el);
+    Csr *in = Csr_Transpose(out);
+    uint32_t *trail = malloc(out->Count * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Euler_Trail(out, in, trail, NULL);
+        Benchmark_StopSample(b, out->Count);
+    }
+    free(trail);
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(in);
+    EdgeList_FreeEdgeList(el);
+}
+
+#endif /* EulerBenchmarks_h */
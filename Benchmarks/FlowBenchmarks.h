@@ -0,0 +1,60 @@
+//
+//  FlowBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef FlowBenchmarks_h
+#define FlowBenchmarks_h
+
+#include "Benchmark.h"
+#include "Generators.h"
+#include "Flow.h"
+
+#define BENCHMARK static inline void
+
+/// Mean out degree of the networks, enough for the flow between two vertices to take many paths
+#define FLOW_BENCHMARK_DEGREE 8
+
+static FlowNetwork *_Flow_Generate(unsigned int vertices, const GeneratorOptions *options)
+{
+    EdgeList *el = Generators_ErdosRenyi(vertices, (double) FLOW_BENCHMARK_DEGREE / (vertices - 1), options);
+    Csr *csr = Csr_FromEdgeList(el);
+    FlowNetwork *network = Flow_CreateNetwork(csr);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return network;
+}
+
+/// Times a maximum flow from the first vertex to the last with capacities from 1 to 1000 by push relabel, per arc
+BENCHMARK Flow_PushRelabel_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000};
+    FlowNetwork *network = _Flow_Generate(b->Size, &options);
+    while (Benchmark_IsRunning(b))
+    {
+        Flow_Reset(network);
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Flow_PushRelabel(network, 0, b->Size - 1);
+        Benchmark_StopSample(b, network->Count);
+    }
+    Flow_FreeNetwork(network);
+}
+
+/// Times a maximum flow from the first vertex to the last with unit capacities by Dinic's algorithm, per arc
+BENCHMARK Flow_Dinic_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .IsDirected = true};
+    FlowNetwork *network = _Flow_Generate(b->Size, &options);
+    while (Benchmark_IsRunning(b))
+    {
+        Flow_Reset(network);
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Flow_Dinic(network, 0, b->Size - 1);
+        Benchmark_StopSample(b, network->Count);
+    }
+    Flow_FreeNetwork(network);
+}
+
+#endif /* FlowBenchmarks_h */
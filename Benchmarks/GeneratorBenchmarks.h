@@ -0,0 +1,66 @@
+//
+//  GeneratorBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef GeneratorBenchmarks_h
+#define GeneratorBenchmarks_h
+
+#include <math.h>
+#include "Benchmark.h"
+#include "Generators.h"
+
+#define BENCHMARK static inline void
+
+/// Mean degree of the generated graphs, so the edges grow linearly with the vertices
+#define GENERATOR_BENCHMARK_DEGREE 8
+
+/// Times generating one graph per sample, per edge generated
+static void _Benchmark_Generator(Benchmark *b, EdgeList *(*generate)(Benchmark *b, const GeneratorOptions *options))
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 32};
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        EdgeList *el = generate(b, &options);
+        Benchmark_StopSample(b, el->Count);
+        
+        _BenchmarkSink = (unsigned int) el->Count;
+        EdgeList_FreeEdgeList(el);
+        options.Seed++;
+    }
+}
+
+static EdgeList *_Benchmark_ErdosRenyi(Benchmark *b, const GeneratorOptions *options)
+{
+    return Generators_ErdosRenyi(b->Size, (double) GENERATOR_BENCHMARK_DEGREE / (b->Size - 1), options);
+}
+
+static EdgeList *_Benchmark_BarabasiAlbert(Benchmark *b, const GeneratorOptions *options)
+{
+    return Generators_BarabasiAlbert(b->Size, GENERATOR_BENCHMARK_DEGREE / 2, options);
+}
+
+static EdgeList *_Benchmark_RandomGeometric(Benchmark *b, const GeneratorOptions *options)
+{
+    return Generators_RandomGeometric(b->Size, sqrt(GENERATOR_BENCHMARK_DEGREE / (M_PI * b->Size)), options);
+}
+
+BENCHMARK Generators_ErdosRenyi_Benchmark(Benchmark *b)
+{
+    _Benchmark_Generator(b, _Benchmark_ErdosRenyi);
+}
+
+BENCHMARK Generators_BarabasiAlbert_Benchmark(Benchmark *b)
+{
+    _Benchmark_Generator(b, _Benchmark_BarabasiAlbert);
+}
+
+BENCHMARK Generators_RandomGeometric_Benchmark(Benchmark *b)
+{
+    _Benchmark_Generator(b, _Benchmark_RandomGeometric);
+}
+
+#endif /* GeneratorBenchmarks_h */
@@ -0,0 +1,144 @@
+//
+//  GraphBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef GraphBenchmarks_h
+#define GraphBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Graph.h"
+
+#define BENCHMARK static inline void
+#define BENCHMARK_SEED 0x9E3779B9u
+
+/// Calls timed per sample by the cheap benchmarks, so timer overhead does not dominate
+#define BENCHMARK_CALLS_PER_SAMPLE 1024
+
+/// Keeps the compiler from dropping the benchmarked calls
+static volatile unsigned int _BenchmarkSink;
+
+/// Edges a graph of the given number of vertices is benchmarked with
+static unsigned int _Benchmark_EdgeCount(unsigned int vertices)
+{
+    return 2 * vertices < GRAPH_MAX_SIZE ? 2 * vertices : GRAPH_MAX_SIZE;
+}
+
+/// Picks two distinct vertices
+static void _Benchmark_RandomEdge(unsigned int *state, unsigned int vertices, VertexIndex *v1, VertexIndex *v2)
+{
+    *v1 = Benchmark_Random(state) % vertices;
+    *v2 = (*v1 + 1 + Benchmark_Random(state) % (vertices - 1)) % vertices;
+}
+
+/// Creates a connected graph: a path through every vertex, then random weighted edges
+static Graph *_Benchmark_CreateGraph(unsigned int vertices, unsigned int edges)
+{
+    Graph *g = Graph_CreateGraph();
+    unsigned int state = BENCHMARK_SEED;
+    for (unsigned int v = 0; v < vertices; v++)
+    {
+        Graph_AddVertex(g);
+    }
+    for (unsigned int v = 1; v < vertices && g->Edges < edges; v++)
+    {
+        Graph_AddEdgeWeighted(g, v - 1, v, 1 + Benchmark_Random(&state) % 32);
+    }
+    while (g->Edges < edges)
+    {
+        VertexIndex v1, v2;
+        _Benchmark_RandomEdge(&state, vertices, &v1, &v2);
+        Graph_AddEdgeWeighted(g, v1, v2, 1 + Benchmark_Random(&state) % 32);
+    }
+    return g;
+}
+
+BENCHMARK Graph_AddEdgeWeighted_Benchmark(Benchmark *b)
+{
+    unsigned int edges = _Benchmark_EdgeCount(b->Size);
+    VertexIndex v1[GRAPH_MAX_SIZE], v2[GRAPH_MAX_SIZE];
+    unsigned int state = BENCHMARK_SEED;
+    for (unsigned int e = 0; e < edges; e++)
+    {
+        _Benchmark_RandomEdge(&state, b->Size, &v1[e], &v2[e]);
+    }
+    
+    while (Benchmark_IsRunning(b))
+    {
+        Graph *g = _Benchmark_CreateGraph(b->Size, 0);
+        
+        Benchmark_StartSample(b);
+        for (unsigned int e = 0; e < edges; e++)
+        {
+            Graph_AddEdgeWeighted(g, v1[e], v2[e], 1 + e);
+        }
+        Benchmark_StopSample(b, edges);
+        
+        Graph_FreeGraph(g);
+    }
+}
+
+BENCHMARK Graph_VertexDegree_Benchmark(Benchmark *b)
+{
+    Graph *g = _Benchmark_CreateGraph(b->Size, _Benchmark_EdgeCount(b->Size));
+    
+    while (Benchmark_IsRunning(b))
+    {
+        unsigned int degrees = 0;
+        Benchmark_StartSample(b);
+        for (unsigned int i = 0; i < BENCHMARK_CALLS_PER_SAMPLE; i++)
+        {
+            degrees += Graph_VertexDegree(g, i % b->Size);
+        }
+        Benchmark_StopSample(b, BENCHMARK_CALLS_PER_SAMPLE);
+        _BenchmarkSink = degrees;
+    }
+    
+    Graph_FreeGraph(g);
+}
+
+BENCHMARK Graph_EdgesShared_Benchmark(Benchmark *b)
+{
+    Graph *g = _Benchmark_CreateGraph(b->Size, _Benchmark_EdgeCount(b->Size));
+    VertexIndex v1[BENCHMARK_CALLS_PER_SAMPLE], v2[BENCHMARK_CALLS_PER_SAMPLE];
+    unsigned int state = BENCHMARK_SEED;
+    for (unsigned int i = 0; i < BENCHMARK_CALLS_PER_SAMPLE; i++)
+    {
+        _Benchmark_RandomEdge(&state, b->Size, &v1[i], &v2[i]);
+    }
+    
+    while (Benchmark_IsRunning(b))
+    {
+        unsigned int shared = 0;
+        Benchmark_StartSample(b);
+        for (unsigned int i = 0; i < BENCHMARK_CALLS_PER_SAMPLE; i++)
+        {
+            shared += Graph_EdgesShared(g, v1[i], v2[i]);
+        }
+        Benchmark_StopSample(b, BENCHMARK_CALLS_PER_SAMPLE);
+        _BenchmarkSink = shared;
+    }
+    
+    Graph_FreeGraph(g);
+}
+
+BENCHMARK Graph_MinSpanningTree_Benchmark(Benchmark *b)
+{
+    Graph *g = _Benchmark_CreateGraph(b->Size, _Benchmark_EdgeCount(b->Size));
+    EdgeIndex edges[GRAPH_MAX_SIZE];
+    
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        Graph_MinSpanningTree(g, edges);
+        Benchmark_StopSample(b, 1);
+        _BenchmarkSink = edges[0];
+    }
+    
+    Graph_FreeGraph(g);
+}
+
+#endif /* GraphBenchmarks_h */
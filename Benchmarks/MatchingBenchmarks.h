@@ -0,0 +1,99 @@
+//
+//  MatchingBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef MatchingBenchmarks_h
+#define MatchingBenchmarks_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "Matching.h"
+
+#define BENCHMARK static inline void
+
+/// Mean degree of the graphs, sparse enough that greedy matching leaves many vertices for the searches
+#define MATCHING_BENCHMARK_DEGREE 4
+
+/// A random graph between the even and the odd vertices of an even count of vertices
+static Csr *_Matching_RandomBipartite(unsigned int vertices, const GeneratorOptions *options)
+{
+    assert(vertices % 2 == 0);
+    EdgeList *el = Generators_RandomEdges(vertices, (size_t) vertices * MATCHING_BENCHMARK_DEGREE / 2, options);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        el->Sources[e] &= ~1u;
+        el->Targets[e] |= 1u;
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    EdgeList_FreeEdgeList(el);
+    return csr;
+}
+
+/// Times a maximum matching of a random bipartite graph by Hopcroft and Karp's algorithm, per edge
+BENCHMARK Matching_HopcroftKarp_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED};
+    Csr *csr = _Matching_RandomBipartite(b->Size, &options);
+    uint8_t *sides = malloc(b->Size);
+    uint32_t *mates = malloc(b->Size * sizeof(uint32_t));
+    uint32_t *edges = malloc(b->Size * sizeof(uint32_t));
+    Matching_Bipartition(csr, sides);
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Matching_HopcroftKarp(csr, sides, mates, edges);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(edges);
+    free(mates);
+    free(sides);
+    Csr_FreeCsr(csr);
+}
+
+/// Times a maximum matching of a random graph, full of odd cycles, by Edmonds' algorithm, per edge
+BENCHMARK Matching_Blossom_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED};
+    EdgeList *el = Generators_ErdosRenyi(b->Size, (double) MATCHING_BENCHMARK_DEGREE / (b->Size - 1), &options);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t *mates = malloc(b->Size * sizeof(uint32_t));
+    uint32_t *edges = malloc(b->Size * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Matching_Blossom(csr, mates, edges);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(edges);
+    free(mates);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Times the maximum matching of the least weight of a random bipartite graph with weights from 1 to 1000, per edge
+BENCHMARK Matching_Assignment_Benchmark(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000};
+    Csr *csr = _Matching_RandomBipartite(b->Size, &options);
+    uint8_t *sides = malloc(b->Size);
+    uint32_t *mates = malloc(b->Size * sizeof(uint32_t));
+    uint32_t *edges = malloc(b->Size * sizeof(uint32_t));
+    Matching_Bipartition(csr, sides);
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Matching_Assignment(csr, sides, mates, edges, NULL);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(edges);
+    free(mates);
+    free(sides);
+    Csr_FreeCsr(csr);
+}
+
+#endif /* MatchingBenchmarks_h */
@@ -0,0 +1,67 @@
+//
+//  ShortestPathsBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ShortestPathsBenchmarks_h
+#define ShortestPathsBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "ShortestPaths.h"
+
+#define BENCHMARK static inline void
+
+/// Mean out degree of the searched graphs
+#define SHORTEST_PATHS_BENCHMARK_DEGREE 8
+
+/// - Returns: The rows of a directed Erdős–Rényi graph of b->Size vertices, weighted from 1 to 1000
+static Csr *_Benchmark_ShortestPathsGraph(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000};
+    EdgeList *el = Generators_ErdosRenyi(b->Size, (double) SHORTEST_PATHS_BENCHMARK_DEGREE / (b->Size - 1), &options);
+    Csr *csr = Csr_FromEdgeList(el);
+    EdgeList_FreeEdgeList(el);
+    return csr;
+}
+
+/// Times the paths from vertex 0 on one thread, per edge of the graph
+BENCHMARK ShortestPaths_Dijkstra_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_ShortestPathsGraph(b);
+    uint64_t *distances = malloc(csr->Vertices * sizeof(uint64_t));
+    VertexIndex *predecessors = malloc(csr->Vertices * sizeof(VertexIndex));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        ShortestPaths_Dijkstra(csr, 0, distances, predecessors, NULL);
+        Benchmark_StopSample(b, csr->Count);
+        _BenchmarkSink = (unsigned int) distances[csr->Vertices - 1];
+    }
+    free(distances);
+    free(predecessors);
+    Csr_FreeCsr(csr);
+}
+
+/// Times the paths from vertex 0 on every processor, per edge of the graph
+BENCHMARK ShortestPaths_DeltaStepping_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_ShortestPathsGraph(b);
+    uint64_t *distances = malloc(csr->Vertices * sizeof(uint64_t));
+    VertexIndex *predecessors = malloc(csr->Vertices * sizeof(VertexIndex));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        ShortestPaths_DeltaStepping(csr, 0, 0, 0, distances, predecessors, NULL);
+        Benchmark_StopSample(b, csr->Count);
+        _BenchmarkSink = (unsigned int) distances[csr->Vertices - 1];
+    }
+    free(distances);
+    free(predecessors);
+    Csr_FreeCsr(csr);
+}
+
+#endif /* ShortestPathsBenchmarks_h */
@@ -0,0 +1,66 @@
+//
+//  TraversalBenchmarks.h
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef TraversalBenchmarks_h
+#define TraversalBenchmarks_h
+
+#include <stdlib.h>
+#include "Benchmark.h"
+#include "Generators.h"
+#include "Traversal.h"
+
+#define BENCHMARK static inline void
+
+/// Mean degree of the traversed graphs
+#define TRAVERSAL_BENCHMARK_DEGREE 8
+
+/// - Returns: The rows of an undirected Erdős–Rényi graph of b->Size vertices, both directions of each edge
+static Csr *_Benchmark_TraversalGraph(Benchmark *b)
+{
+    GeneratorOptions options = {.Seed = BENCHMARK_SEED};
+    EdgeList *el = Generators_ErdosRenyi(b->Size, (double) TRAVERSAL_BENCHMARK_DEGREE / 2 / (b->Size - 1), &options);
+    size_t count = el->Count;
+    for (size_t e = 0; e < count; e++)
+    {
+        EdgeList_Add(el, el->Targets[e], el->Sources[e], el->Weights[e]);
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    EdgeList_FreeEdgeList(el);
+    return csr;
+}
+
+/// Times a search from vertex 0 on every processor, per edge of the graph
+BENCHMARK Traversal_BreadthFirst_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_TraversalGraph(b);
+    uint32_t *levels = malloc(csr->Vertices * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Traversal_BreadthFirst(csr, csr, 0, 0, levels, NULL);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(levels);
+    Csr_FreeCsr(csr);
+}
+
+/// Times the components on every processor, per edge of the graph
+BENCHMARK Traversal_ConnectedComponents_Benchmark(Benchmark *b)
+{
+    Csr *csr = _Benchmark_TraversalGraph(b);
+    uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+    while (Benchmark_IsRunning(b))
+    {
+        Benchmark_StartSample(b);
+        _BenchmarkSink = Traversal_ConnectedComponents(csr, 0, components);
+        Benchmark_StopSample(b, csr->Count);
+    }
+    free(components);
+    Csr_FreeCsr(csr);
+}
+
+#endif /* TraversalBenchmarks_h */
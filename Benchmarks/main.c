@@ -0,0 +1,201 @@
+//
+//  main.c
+//  Benchmarks
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "Benchmark.h"
+#include "GraphBenchmarks.h"
+#include "GeneratorBenchmarks.h"
+#include "TraversalBenchmarks.h"
+#include "ShortestPathsBenchmarks.h"
+#include "AllPairsBenchmarks.h"
+#include "BiconnectedBenchmarks.h"
+#include "DirectedBenchmarks.h"
+#include "EulerBenchmarks.h"
+#include "ColoringBenchmarks.h"
+#include "CliqueBenchmarks.h"
+#include "FlowBenchmarks.h"
+#include "MatchingBenchmarks.h"
+
+// Without raylib only the graph library is benchmarked
+#ifndef BENCHMARKS_GRAPH_ONLY
+#include "BvhBenchmarks.h"
+#endif
+
+#define EXIT_USAGE 2
+#define EXIT_REGRESSION 3
+#define BENCHMARK_DEFAULT_THRESHOLD 0.25
+#define BENCHMARK_MAX_SIZES 5
+
+typedef struct
+{
+    const char *Name;
+    void (*Run)(Benchmark *b);
+    unsigned int Sizes[BENCHMARK_MAX_SIZES];
+} BenchmarkEntry;
+
+static const BenchmarkEntry _Benchmarks[] =
+{
+    { "Graph_AddEdgeWeighted", Graph_AddEdgeWeighted_Benchmark, {8, 16, 32, 64, GRAPH_MAX_SIZE} },
+    { "Graph_VertexDegree", Graph_VertexDegree_Benchmark, {8, 16, 32, 64, GRAPH_MAX_SIZE} },
+    { "Graph_EdgesShared", Graph_EdgesShared_Benchmark, {8, 16, 32, 64, GRAPH_MAX_SIZE} },
+    { "Graph_MinSpanningTree", Graph_MinSpanningTree_Benchmark, {8, 16, 32, 64, GRAPH_MAX_SIZE} },
+    { "Generators_ErdosRenyi", Generators_ErdosRenyi_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Generators_BarabasiAlbert", Generators_BarabasiAlbert_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Generators_RandomGeometric", Generators_RandomGeometric_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Traversal_BreadthFirst", Traversal_BreadthFirst_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Traversal_ConnectedComponents", Traversal_ConnectedComponents_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "ShortestPaths_Dijkstra", ShortestPaths_Dijkstra_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "ShortestPaths_DeltaStepping", ShortestPaths_DeltaStepping_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "AllPairs_FloydWarshall", AllPairs_FloydWarshall_Benchmark, {GRAPH_MAX_SIZE, 256, 384, 512, 768} },
+    { "AllPairs_TransitiveClosure", AllPairs_TransitiveClosure_Benchmark, {GRAPH_MAX_SIZE, 256, 384, 512, 768} },
+    { "Biconnected_Components", Biconnected_Components_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Directed_StronglyConnectedComponents", Directed_StronglyConnectedComponents_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Directed_CriticalPath", Directed_CriticalPath_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Euler_Trail", Euler_Trail_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Coloring_DSatur", Coloring_DSatur_Benchmark, {GRAPH_MAX_SIZE, 256, 512, 1024, 2048} },
+    { "Coloring_Chromatic", Coloring_Chromatic_Benchmark, {16, 24, 32, 40, 48} },
+    { "Clique_Maximal", Clique_Maximal_Benchmark, {GRAPH_MAX_SIZE, 256, 512, 1024, 2048} },
+    { "Clique_Maximum", Clique_Maximum_Benchmark, {GRAPH_MAX_SIZE, 160, 192, 224, 256} },
+    { "Flow_PushRelabel", Flow_PushRelabel_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Flow_Dinic", Flow_Dinic_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Matching_HopcroftKarp", Matching_HopcroftKarp_Benchmark, {1024, 8192, 32768, 65536, 262144} },
+    { "Matching_Blossom", Matching_Blossom_Benchmark, {1024, 8192, 65536, 262144, 1048576} },
+    { "Matching_Assignment", Matching_Assignment_Benchmark, {1024, 2048, 4096, 8192, 16384} },
+#ifndef BENCHMARKS_GRAPH_ONLY
+    { "BvhTree_CreateBvhTree", BvhTree_CreateBvhTree_Benchmark, {16, 64, 256, 1024, 4096} },
+    { "BvhTree_CheckCollision", BvhTree_CheckCollision_Benchmark, {16, 64, 256, 1024, 4096} },
+#endif
+};
+#define BENCHMARKS_COUNT (sizeof(_Benchmarks) / sizeof(_Benchmarks[0]))
+
+static void _Usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [-n samples] [-m filter] [-b baseline] [-t threshold] [-o output]\n", program);
+    fprintf(stderr, "  Times the graph core, generators, traversals, shortest paths, all pairs, biconnectivity, strong components, Euler trails, coloring, cliques, flows, matchings and Bvh hot paths across increasing sizes, printing JSON.\n");
+    fprintf(stderr, "  -n  samples per benchmark, default %d, at most %d\n", BENCHMARK_DEFAULT_SAMPLES, BENCHMARK_MAX_SAMPLES);
+    fprintf(stderr, "  -m  only run benchmarks whose name contains filter\n");
+    fprintf(stderr, "  -b  baseline JSON from an earlier run, medians slower by more than the threshold are regressions\n");
+    fprintf(stderr, "  -t  allowed slowdown against the baseline, default %.2f\n", BENCHMARK_DEFAULT_THRESHOLD);
+    fprintf(stderr, "  -o  write the JSON to a file instead of stdout, to record a new baseline\n");
+}
+
+/// Compares the median against the baseline, reporting to stderr
+/// - Returns: true if the median regressed past the threshold
+static bool _CompareBaseline(const Benchmark *b, BenchmarkSummary summary, const BenchmarkBaseline *baseline, double threshold)
+{
+    const BenchmarkBaselineEntry *entry = Benchmark_FindBaseline(baseline, b->Name, b->Size);
+    if (entry == NULL)
+    {
+        fprintf(stderr, "%s/%u: not in baseline\n", b->Name, b->Size);
+        return false;
+    }
+    
+    double change = entry->P50 > 0 ? summary.P50 / entry->P50 - 1 : 0;
+    bool isRegression = change > threshold;
+    fprintf(stderr, "%s/%u: %.2f ns -> %.2f ns (%+.1f%%)%s\n", b->Name, b->Size, entry->P50, summary.P50, change * 100,
+            isRegression ? " REGRESSION" : "");
+    return isRegression;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t samples = BENCHMARK_DEFAULT_SAMPLES;
+    const char *filter = NULL;
+    const char *baselinePath = NULL;
+    const char *outputPath = NULL;
+    double threshold = BENCHMARK_DEFAULT_THRESHOLD;
+    
+    int option;
+    while ((option = getopt(argc, argv, "n:m:b:t:o:h")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                samples = strtoul(optarg, NULL, 10);
+                if (samples < 1 || samples > BENCHMARK_MAX_SAMPLES)
+                {
+                    _Usage(argv[0]);
+                    return EXIT_USAGE;
+                }
+                break;
+            case 'm':
+                filter = optarg;
+                break;
+            case 'b':
+                baselinePath = optarg;
+                break;
+            case 't':
+                threshold = strtod(optarg, NULL);
+                break;
+            case 'o':
+                outputPath = optarg;
+                break;
+            default:
+                _Usage(argv[0]);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_USAGE;
+        }
+    }
+    
+    BenchmarkBaseline baseline = {};
+    if (baselinePath != NULL)
+    {
+        FILE *file = fopen(baselinePath, "r");
+        if (file == NULL || !Benchmark_ReadBaseline(file, &baseline))
+        {
+            perror(baselinePath);
+            return EXIT_FAILURE;
+        }
+        fclose(file);
+    }
+    
+    FILE *output = outputPath != NULL ? fopen(outputPath, "w") : stdout;
+    if (output == NULL)
+    {
+        perror(outputPath);
+        return EXIT_FAILURE;
+    }
+    
+    // One benchmark per line, so baselines can be read back without a JSON parser
+    OutputSink *out = OutputSink_CreateFileSink(output);
+    OutputSink_WriteString(out, "{\"benchmarks\": [");
+    bool isFirst = true;
+    int regressions = 0;
+    Benchmark *b = malloc(sizeof(Benchmark));
+    for (size_t i = 0; i < BENCHMARKS_COUNT; i++)
+    {
+        if (filter != NULL && strstr(_Benchmarks[i].Name, filter) == NULL) continue;
+        
+        for (int s = 0; s < BENCHMARK_MAX_SIZES; s++)
+        {
+            Benchmark_Init(b, _Benchmarks[i].Name, _Benchmarks[i].Sizes[s], samples);
+            _Benchmarks[i].Run(b);
+            BenchmarkSummary summary = Benchmark_Summarize(b);
+            
+            OutputSink_WriteString(out, isFirst ? "\n  " : ",\n  ");
+            Benchmark_WriteJson(b, summary, out);
+            OutputSink_Flush(out);
+            isFirst = false;
+            
+            if (baselinePath != NULL && _CompareBaseline(b, summary, &baseline, threshold)) regressions++;
+        }
+    }
+    OutputSink_WriteString(out, "\n]}\n");
+    OutputSink_FreeOutputSink(out);
+    free(b);
+    if (output != stdout) fclose(output);
+    Benchmark_FreeBaseline(&baseline);
+    
+    if (regressions > 0)
+    {
+        fprintf(stderr, "%d benchmarks regressed by more than %.0f%%\n", regressions, threshold * 100);
+        return EXIT_REGRESSION;
+    }
+    return EXIT_SUCCESS;
+}
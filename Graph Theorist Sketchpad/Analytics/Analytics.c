@@ -0,0 +1,280 @@
+//
+//  Analytics.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Analytics.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../Graph/Util/Counters.h"
+#include "../../Graph/Biconnected.h"
+#include "../../Graph/Directed.h"
+#include "../../Graph/Flow.h"
+#include "../../Graph/Matching.h"
+#include "../../Graph/ShortestPaths.h"
+
+/// Seconds the exact coloring and clique searches run for before settling for the best found
+#define ANALYTICS_SEARCH_TIME_LIMIT 5
+
+static void _RunMst(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    task->MstEdges[0] = MST_NO_EDGE;
+    if (task->Snapshot->Vertices < 2 || task->Snapshot->Edges < 1) return;
+    Graph_MinSpanningTree(task->Snapshot, task->MstEdges);
+}
+
+static void _RunComponents(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    task->ComponentCount = Graph_ConnectedComponents(task->Snapshot, task->Components);
+}
+
+static void _RunBridges(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    
+    // Vertices added since the snapshot are never cut vertices of it
+    memset(task->IsCutVertex, 0, sizeof(task->IsCutVertex));
+    Graph_BridgesAndCutVertices(task->Snapshot, task->Bridges, task->IsCutVertex);
+}
+
+static void _RunStrongComponents(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    
+    // Vertices added since the snapshot are in no component of it
+    memset(task->StrongComponents, 0xFF, sizeof(task->StrongComponents));
+    task->StrongComponentCount = Graph_StronglyConnectedComponents(task->Snapshot, task->StrongComponents);
+    task->IsAcyclic = Graph_CriticalPath(task->Snapshot, task->CriticalPath, &task->CriticalPathWeight);
+}
+
+static void _RunEuler(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    task->IsEulerDirected = true;
+    task->EulerWalk = Graph_EulerTrail(task->Snapshot, true, task->EulerTrail, &task->EulerStart);
+    if (task->EulerWalk != EULER_NONE) return;
+    task->IsEulerDirected = false;
+    task->EulerWalk = Graph_EulerTrail(task->Snapshot, false, task->EulerTrail, &task->EulerStart);
+}
+
+static void _RunColoring(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    
+    // Vertices added since the snapshot have no color yet
+    memset(task->Colors, 0xFF, sizeof(task->Colors));
+    ColoringOptions options = { .TimeLimit = ANALYTICS_SEARCH_TIME_LIMIT, .IsCancelRequested = &job->IsCancelRequested };
+    task->ColorCount = Graph_ChromaticNumber(task->Snapshot, &options, task->Colors, &task->IsColoringOptimal);
+}
+
+static void _RunClique(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    CliqueOptions options = { .TimeLimit = ANALYTICS_SEARCH_TIME_LIMIT, .IsCancelRequested = &job->IsCancelRequested };
+    task->CliqueSize = Graph_MaximumClique(task->Snapshot, &options, task->Clique, &task->IsCliqueOptimal);
+}
+
+static void _RunShortestPath(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    task->HasPath = Graph_ShortestPath(task->Snapshot, task->Source, task->Target, task->PathEdges);
+}
+
+static void _RunMinCut(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    Graph_MinCut(task->Snapshot, task->Source, task->Target, task->CutEdges, &task->CutFlow);
+}
+
+static void _RunMatching(WorkerJob *job)
+{
+    AnalyticsTask *task = job->Context;
+    task->MatchingCount = Graph_MaximumMatching(task->Snapshot, task->MatchingEdges, &task->IsMatchingBipartite,
+                                                &task->MatchingWeight);
+}
+
+static const WorkerJobFunction _AnalyticsKindToRun[ANALYTICS_KIND_COUNT] =
+{
+    [ANALYTICS_MST] = _RunMst,
+    [ANALYTICS_COMPONENTS] = _RunComponents,
+    [ANALYTICS_BRIDGES] = _RunBridges,
+    [ANALYTICS_STRONG_COMPONENTS] = _RunStrongComponents,
+    [ANALYTICS_EULER] = _RunEuler,
+    [ANALYTICS_COLORING] = _RunColoring,
+    [ANALYTICS_CLIQUE] = _RunClique,
+    [ANALYTICS_SHORTEST_PATH] = _RunShortestPath,
+    [ANALYTICS_MIN_CUT] = _RunMinCut,
+    [ANALYTICS_MATCHING] = _RunMatching,
+};
+
+static AnalyticsTask *_AnalyticsTask_CreateAnalyticsTask(AnalyticsKind kind, const Graph *g, VertexIndex source,
+                                                         VertexIndex target)
+{
+    AnalyticsTask *task = malloc(sizeof(AnalyticsTask));
+    Counters_Add(COUNTER_BYTES_ANALYTICS, sizeof(AnalyticsTask));
+    task->Job = WorkerJob_CreateWorkerJob(_AnalyticsKindToRun[kind], task);
+    task->Kind = kind;
+    task->Snapshot = Graph_Snapshot(g);
+    task->Version = g->Version;
+    task->Source = source;
+    task->Target = target;
+    task->NextRetired = NULL;
+    return task;
+}
+
+static void _AnalyticsTask_FreeAnalyticsTask(AnalyticsTask *task)
+{
+    if (task->Snapshot != NULL)
+    {
+        Graph_FreeGraph(task->Snapshot);
+    }
+    free(task);
+}
+
+Analytics *Analytics_CreateAnalytics(void)
+{
+    Analytics *a = malloc(sizeof(Analytics));
+    Counters_Add(COUNTER_BYTES_ANALYTICS, sizeof(Analytics));
+    a->Pool = WorkerPool_CreateWorkerPool(WorkerPool_DefaultThreadCount());
+    for (int kind = 0; kind < ANALYTICS_KIND_COUNT; kind++)
+    {
+        a->Pending[kind] = NULL;
+        a->Results[kind] = NULL;
+    }
+    a->Retired = NULL;
+    return a;
+}
+
+/// Cancels a task that may still be running, it is freed by a later poll once its worker lets go
+static void _Retire(Analytics *a, AnalyticsTask *task)
+{
+    WorkerJob_Cancel(&task->Job);
+    task->NextRetired = a->Retired;
+    a->Retired = task;
+}
+
+static void _FreeRetired(Analytics *a, bool force)
+{
+    AnalyticsTask **link = &a->Retired;
+    while (*link != NULL)
+    {
+        AnalyticsTask *task = *link;
+        if (!force && !WorkerJob_IsFinished(&task->Job))
+        {
+            link = &task->NextRetired;
+            continue;
+        }
+        *link = task->NextRetired;
+        _AnalyticsTask_FreeAnalyticsTask(task);
+    }
+}
+
+void Analytics_FreeAnalytics(Analytics *a)
+{
+    assert(a != NULL);
+    
+    Analytics_Reset(a);
+    
+    // Once the pool is joined, no worker holds a task
+    WorkerPool_FreeWorkerPool(a->Pool);
+    _FreeRetired(a, true);
+    free(a);
+}
+
+/// - Returns: If the task is of the current version of the graph and between the same vertices
+static bool _IsCurrent(const AnalyticsTask *task, const Graph *g, VertexIndex source, VertexIndex target)
+{
+    return task->Version == g->Version && task->Source == source && task->Target == target;
+}
+
+void Analytics_Request(Analytics *a, AnalyticsKind kind, const Graph *g)
+{
+    Analytics_RequestBetween(a, kind, g, 0, 0);
+}
+
+void Analytics_RequestBetween(Analytics *a, AnalyticsKind kind, const Graph *g, VertexIndex source, VertexIndex target)
+{
+    assert(a != NULL);
+    assert(g != NULL);
+    
+    AnalyticsTask *pending = a->Pending[kind];
+    if (pending != NULL)
+    {
+        if (_IsCurrent(pending, g, source, target)) return;
+        _Retire(a, pending);
+        a->Pending[kind] = NULL;
+    }
+    
+    AnalyticsTask *result = a->Results[kind];
+    if (result != NULL && _IsCurrent(result, g, source, target)) return;
+    
+    AnalyticsTask *task = _AnalyticsTask_CreateAnalyticsTask(kind, g, source, target);
+    a->Pending[kind] = task;
+    WorkerPool_Submit(a->Pool, &task->Job);
+}
+
+void Analytics_Poll(Analytics *a)
+{
+    assert(a != NULL);
+    
+    for (int kind = 0; kind < ANALYTICS_KIND_COUNT; kind++)
+    {
+        AnalyticsTask *pending = a->Pending[kind];
+        if (pending == NULL || !WorkerJob_IsFinished(&pending->Job)) continue;
+        
+        a->Pending[kind] = NULL;
+        if (atomic_load(&pending->Job.State) == WORKER_JOB_CANCELLED)
+        {
+            _AnalyticsTask_FreeAnalyticsTask(pending);
+            continue;
+        }
+        
+        // The snapshot is no longer needed once the result is in
+        Graph_FreeGraph(pending->Snapshot);
+        pending->Snapshot = NULL;
+        
+        if (a->Results[kind] != NULL)
+        {
+            _AnalyticsTask_FreeAnalyticsTask(a->Results[kind]);
+        }
+        a->Results[kind] = pending;
+    }
+    
+    _FreeRetired(a, false);
+}
+
+void Analytics_Reset(Analytics *a)
+{
+    assert(a != NULL);
+    
+    for (int kind = 0; kind < ANALYTICS_KIND_COUNT; kind++)
+    {
+        if (a->Pending[kind] != NULL)
+        {
+            _Retire(a, a->Pending[kind]);
+            a->Pending[kind] = NULL;
+        }
+        if (a->Results[kind] != NULL)
+        {
+            _AnalyticsTask_FreeAnalyticsTask(a->Results[kind]);
+            a->Results[kind] = NULL;
+        }
+    }
+}
+
+const AnalyticsTask *Analytics_Result(const Analytics *a, AnalyticsKind kind)
+{
+    assert(a != NULL);
+    return a->Results[kind];
+}
+
+bool Analytics_IsRunning(const Analytics *a, AnalyticsKind kind)
+{
+    assert(a != NULL);
+    return a->Pending[kind] != NULL;
+}
@@ -0,0 +1,146 @@
+//
+//  Analytics.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Analytics_h
+#define Analytics_h
+
+#include "../../Graph/Graph.h"
+#include "../../Graph/Euler.h"
+#include "../../Graph/Coloring.h"
+#include "../../Graph/Clique.h"
+#include "../../Graph/Util/WorkerPool.h"
+
+typedef enum
+{
+    ANALYTICS_MST,
+    ANALYTICS_COMPONENTS,
+    ANALYTICS_BRIDGES,
+    ANALYTICS_STRONG_COMPONENTS,
+    ANALYTICS_EULER,
+    ANALYTICS_COLORING,
+    ANALYTICS_CLIQUE,
+    ANALYTICS_SHORTEST_PATH,
+    ANALYTICS_MIN_CUT,
+    ANALYTICS_MATCHING,
+    ANALYTICS_KIND_COUNT,
+} AnalyticsKind;
+
+/// A single analysis of a snapshot of the graph, run on a worker thread
+typedef struct AnalyticsTask
+{
+    WorkerJob Job;
+    AnalyticsKind Kind;
+    
+    /// The graph as of Version. Only read by the job, and freed once the job is finished.
+    Graph *Snapshot;
+    unsigned long Version;
+    
+    /// The vertices the analysis is between, for the kinds that take two
+    VertexIndex Source;
+    VertexIndex Target;
+    
+    /// ANALYTICS_MST: the edges of the minimum spanning tree, terminated by MST_NO_EDGE
+    EdgeIndex MstEdges[GRAPH_MAX_SIZE];
+    
+    /// ANALYTICS_COMPONENTS: the connected components ignoring direction, and the component of each vertex
+    unsigned int ComponentCount;
+    unsigned int Components[GRAPH_MAX_SIZE];
+    
+    /// ANALYTICS_BRIDGES: the bridges ignoring direction, terminated by MST_NO_EDGE, and the cut vertices
+    EdgeIndex Bridges[GRAPH_MAX_SIZE];
+    bool IsCutVertex[GRAPH_MAX_SIZE];
+    
+    /// ANALYTICS_STRONG_COMPONENTS: the strongly connected components in topological order, and the component of each vertex or UINT_MAX.
+    /// If the graph is acyclic, the edges of its critical path, terminated by MST_NO_EDGE, and its weight.
+    unsigned int StrongComponentCount;
+    unsigned int StrongComponents[GRAPH_MAX_SIZE];
+    bool IsAcyclic;
+    EdgeIndex CriticalPath[GRAPH_MAX_SIZE];
+    unsigned long long CriticalPathWeight;
+    
+    /// ANALYTICS_EULER: a walk taking every edge once, following the direction of each edge if one does and walking them either
+    /// way otherwise, terminated by MST_NO_EDGE, and the vertex it starts at
+    EulerKind EulerWalk;
+    bool IsEulerDirected;
+    EdgeIndex EulerTrail[GRAPH_MAX_SIZE + 1];
+    VertexIndex EulerStart;
+    
+    /// ANALYTICS_COLORING: the fewest colors found for the vertices ignoring direction, the color of each vertex or UINT_MAX,
+    /// and if the search finished, proving no coloring uses fewer
+    unsigned int ColorCount;
+    unsigned int Colors[GRAPH_MAX_SIZE];
+    bool IsColoringOptimal;
+    
+    /// ANALYTICS_CLIQUE: the vertices of the largest clique found ignoring direction, and if the search finished, proving
+    /// no clique is larger
+    unsigned int CliqueSize;
+    VertexIndex Clique[GRAPH_MAX_SIZE];
+    bool IsCliqueOptimal;
+    
+    /// ANALYTICS_SHORTEST_PATH: if there is a path from Source to Target following the direction of each edge, and the edges
+    /// of a shortest one, terminated by MST_NO_EDGE
+    bool HasPath;
+    EdgeIndex PathEdges[GRAPH_MAX_SIZE];
+    
+    /// ANALYTICS_MIN_CUT: the edges of a minimum cut from Source to Target, terminated by MST_NO_EDGE, and the flow across it
+    EdgeIndex CutEdges[GRAPH_MAX_SIZE + 1];
+    unsigned long long CutFlow;
+    
+    /// ANALYTICS_MATCHING: the edges of a maximum matching ignoring direction, terminated by MST_NO_EDGE, the lightest one if
+    /// the graph is bipartite, and its total weight
+    EdgeIndex MatchingEdges[GRAPH_MAX_SIZE + 1];
+    unsigned int MatchingCount;
+    unsigned long long MatchingWeight;
+    bool IsMatchingBipartite;
+    
+    /// The next cancelled task waiting for its worker to let go of it
+    struct AnalyticsTask *NextRetired;
+} AnalyticsTask;
+
+/// Runs analyses of the graph off the main thread. Results are collected by polling once per frame, so the render loop
+/// never waits on a computation.
+typedef struct
+{
+    WorkerPool *Pool;
+    
+    /// The task in flight for each kind, if any
+    AnalyticsTask *Pending[ANALYTICS_KIND_COUNT];
+    
+    /// The latest completed task for each kind, if any
+    AnalyticsTask *Results[ANALYTICS_KIND_COUNT];
+    
+    /// Cancelled tasks that may still be running
+    AnalyticsTask *Retired;
+} Analytics;
+
+/// Creates the analytics and its worker threads
+Analytics *Analytics_CreateAnalytics(void);
+
+/// Cancels every task, waits for the workers to stop and frees the analytics
+void Analytics_FreeAnalytics(Analytics *a);
+
+/// Starts an analysis of the current graph, unless one for the current version is already running or complete.
+/// A running analysis of an older version is cancelled.
+void Analytics_Request(Analytics *a, AnalyticsKind kind, const Graph *g);
+
+/// Starts an analysis between two vertices of the current graph, unless one for the current version and the same vertices is
+/// already running or complete. A running analysis of an older version or other vertices is cancelled.
+void Analytics_RequestBetween(Analytics *a, AnalyticsKind kind, const Graph *g, VertexIndex source, VertexIndex target);
+
+/// Collects finished tasks. Call once per frame.
+void Analytics_Poll(Analytics *a);
+
+/// Cancels every task and drops every result, for when the graph is replaced
+void Analytics_Reset(Analytics *a);
+
+/// - Returns: The latest completed analysis of the kind, which may be of an older version of the graph, or NULL
+const AnalyticsTask *Analytics_Result(const Analytics *a, AnalyticsKind kind);
+
+/// - Returns: If an analysis of the kind is in flight
+bool Analytics_IsRunning(const Analytics *a, AnalyticsKind kind);
+
+#endif /* Analytics_h */
@@ -6,18 +6,28 @@
 //
 
 #include "BvhTree.h"
+#include "../../Graph/Util/Counters.h"
 
 #define IsLeaf(node) (node->Left == NULL && node->Right == NULL)
 #define NO_COLLISION -1
 
+/// The work of a single query, added to the counters once it is done
+typedef struct
+{
+    unsigned long long NodesVisited;
+    unsigned long long PrimitiveTests;
+} BvhQueryCounts;
+
 // DFS, check each bounding box and primitives if they exist
-int _CheckCollisionImpl(BvhNode *bvhn, Rectangle boundingBox)
+int _CheckCollisionImpl(BvhNode *bvhn, Rectangle boundingBox, BvhQueryCounts *counts)
 {
     if (bvhn == NULL)
     {
         return NO_COLLISION;
     }
     
+    counts->NodesVisited++;
+    
     // If the bounding boxes intersect, this node is a candidate for collision
     if (CheckCollisionRecs(bvhn->BoundingBox, boundingBox))
     {
@@ -27,6 +37,8 @@ int _CheckCollisionImpl(BvhNode *bvhn, Rectangle boundingBox)
             // Check each primitive in the leaf node
             for (size_t i = 0; i < bvhn->Size; i++)
             {
+                counts->PrimitiveTests++;
+                
                 // If the primitive intersects the bounding box, there is a collision
                 if (CheckCollisionRecs(bvhn->Primitives[i].BoundingBox, boundingBox))
                 {
@@ -34,13 +46,13 @@ int _CheckCollisionImpl(BvhNode *bvhn, Rectangle boundingBox)
                 }
             }
         }
-        int left = _CheckCollisionImpl(bvhn->Left, boundingBox);
+        int left = _CheckCollisionImpl(bvhn->Left, boundingBox, counts);
         if (left != NO_COLLISION)
         {
             return left;
         }
         
-        unsigned int right = _CheckCollisionImpl(bvhn->Right, boundingBox);
+        unsigned int right = _CheckCollisionImpl(bvhn->Right, boundingBox, counts);
         if (right != NO_COLLISION)
         {
             return right;
@@ -53,5 +65,12 @@ int _CheckCollisionImpl(BvhNode *bvhn, Rectangle boundingBox)
 int BvhTree_CheckCollision(const BvhTree *bvht, Rectangle boundingBox)
 {
     if (bvht == NULL) return -1;
-    return _CheckCollisionImpl(bvht->root, boundingBox);
+    
+    BvhQueryCounts counts = {0};
+    int vi = _CheckCollisionImpl(bvht->root, boundingBox, &counts);
+    
+    Counters_Add(COUNTER_BVH_QUERIES, 1);
+    Counters_Add(COUNTER_BVH_NODES_VISITED, counts.NodesVisited);
+    Counters_Add(COUNTER_BVH_PRIMITIVE_TESTS, counts.PrimitiveTests);
+    return vi;
 }
@@ -43,6 +43,22 @@ BvhTree *BvhTree_CreateBvhTree(Primitive *primitives, size_t size, Rectangle sce
 /// Recurisvely frees all memory of the Bvh Tree
 void BvhTree_FreeBvhTree(BvhTree *bvht);
 
+/// Inserts a primitive under the child that grows the least, refitting the bounding boxes on the way back up.
+/// The tree is not rebalanced, rebuild it with BvhTree_CreateBvhTree after many changes.
+void BvhTree_Insert(BvhTree *bvht, Primitive primitive);
+
+/// Removes every leaf entry of the primitive's vertex, only visiting nodes that collide with its bounding box,
+/// collapsing emptied nodes into their sibling and refitting the bounding boxes on the way back up.
+/// - Parameters:
+///  - primitive: The primitive as it was inserted
+void BvhTree_Remove(BvhTree *bvht, const Primitive *primitive);
+
+/// Moves a primitive to a new bounding box
+/// - Parameters:
+///  - old: The primitive as it was inserted
+///  - updated: The primitive of the same vertex at its new position
+void BvhTree_Update(BvhTree *bvht, const Primitive *old, Primitive updated);
+
 /// Checks if a boundingBox collides with any other boundingBox in the Bvh Tree
 /// - Returns: -1 if no collision, otherwise the VertexIndex
 int BvhTree_CheckCollision(const BvhTree *bvht, Rectangle boundingBox);
@@ -6,45 +6,37 @@
 //
 
 #include "BvhTree.h"
+#include "Util/BoundingBox.h"
 #include "Util/LongestAxis.h"
 #include <stdlib.h>
 #include <assert.h>
-#include <math.h>
+#include "../../Graph/Util/Counters.h"
+#include "../../Graph/Util/Profiler.h"
 
-/// Creates a new BvhNode. Requires two primitives in the list.
-static BvhNode *_BvhNode_CreateBvhNode(const Primitive *primitives, Rectangle boundingBox)
+/// Creates a new BvhNode holding the first two primitives of the list, or the only one.
+static BvhNode *_BvhNode_CreateBvhNode(const Primitive *primitives, size_t size, Rectangle boundingBox)
 {
     BvhNode *bvhn = malloc(sizeof(BvhNode));
+    Counters_Add(COUNTER_BYTES_BVH, sizeof(BvhNode));
     bvhn->BoundingBox   = boundingBox;
     bvhn->Left          = NULL;
     bvhn->Right         = NULL;
-    bvhn->Size          = 2;
-    bvhn->Primitives[0] = primitives[0];
-    bvhn->Primitives[1] = primitives[1];
+    bvhn->Size          = size < 2 ? size : 2;
+    for (size_t i = 0; i < bvhn->Size; i++)
+    {
+        bvhn->Primitives[i] = primitives[i];
+    }
     return bvhn;
 }
 
-/// - Returns: An expanded bounding box that encloses both a and b
-static Rectangle _ExpandBoundingBox(Rectangle a, Rectangle b)
-{
-    // Calculate the minimum and maximum x and y coordinates
-    float minX = fmin(a.x, b.x);
-    float minY = fmin(a.y, b.y);
-    int maxX = fmax(a.x + a.width, b.x + b.width);
-    int maxY = fmax(a.y + a.height, b.y + b.height);
-    
-    return (Rectangle) {.x = minX, .y = minY, .width = maxX - minX, .height = maxY - minY};
-}
-
 static BvhNode *_CreateBvhTreeImpl(Primitive *primitives, size_t size, Rectangle boundingBox)
 {
     if (size < 1) return NULL;
     
-    BvhNode *bvhn = _BvhNode_CreateBvhNode(primitives, boundingBox);
+    BvhNode *bvhn = _BvhNode_CreateBvhNode(primitives, size, boundingBox);
     
     if (size < 2)
     {
-        bvhn->Size = size;
         return bvhn;
     }
     
@@ -52,7 +44,7 @@ static BvhNode *_CreateBvhTreeImpl(Primitive *primitives, size_t size, Rectangle
     {
         Rectangle a = bvhn->Primitives[0].BoundingBox;
         Rectangle b = bvhn->Primitives[1].BoundingBox;
-        bvhn->BoundingBox = _ExpandBoundingBox(a,b);
+        bvhn->BoundingBox = BoundingBox_Expand(a,b);
         return bvhn;
     }
     
@@ -68,7 +60,7 @@ static BvhNode *_CreateBvhTreeImpl(Primitive *primitives, size_t size, Rectangle
     Rectangle left = medianPrimitive.BoundingBox;
     for (size_t i = 0; i <= median; i++)
     {
-        left = _ExpandBoundingBox(left, primitives[i].BoundingBox);
+        left = BoundingBox_Expand(left, primitives[i].BoundingBox);
     }
     
     // Calculate the right BoundingBox
@@ -76,7 +68,7 @@ static BvhNode *_CreateBvhTreeImpl(Primitive *primitives, size_t size, Rectangle
     Rectangle right = medianPrimitive.BoundingBox;
     for (size_t i = median + 1; i < size; i++)
     {
-        right = _ExpandBoundingBox(right, primitives[i].BoundingBox);
+        right = BoundingBox_Expand(right, primitives[i].BoundingBox);
     }
     
     // Recurse on the left and right primitives
@@ -88,8 +80,13 @@ static BvhNode *_CreateBvhTreeImpl(Primitive *primitives, size_t size, Rectangle
 
 BvhTree *BvhTree_CreateBvhTree(Primitive *primitives, size_t size, Rectangle sceneBoundingBox)
 {
+    unsigned long long start = Profiler_Now();
     BvhTree *bvht = malloc(sizeof(BvhTree));
     bvht->root = _CreateBvhTreeImpl(primitives, size, sceneBoundingBox);
+    
+    Counters_Add(COUNTER_BYTES_BVH, sizeof(BvhTree));
+    Counters_Add(COUNTER_BVH_REBUILDS, 1);
+    Counters_Add(COUNTER_BVH_REBUILD_NANOSECONDS, Profiler_Now() - start);
     return bvht;
 }
 
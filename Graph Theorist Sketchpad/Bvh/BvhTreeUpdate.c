@@ -0,0 +1,141 @@
+//
+//  BvhTreeUpdate.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "BvhTree.h"
+#include "Util/BoundingBox.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "../../Graph/Util/Counters.h"
+
+#define IsLeaf(node) (node->Left == NULL && node->Right == NULL)
+
+static BvhNode *_BvhNode_CreateLeaf(Primitive primitive)
+{
+    BvhNode *bvhn = malloc(sizeof(BvhNode));
+    Counters_Add(COUNTER_BYTES_BVH, sizeof(BvhNode));
+    bvhn->BoundingBox   = primitive.BoundingBox;
+    bvhn->Left          = NULL;
+    bvhn->Right         = NULL;
+    bvhn->Size          = 1;
+    bvhn->Primitives[0] = primitive;
+    return bvhn;
+}
+
+/// Shrinks or grows the bounding box of a node to exactly enclose its primitives or children
+static void _BvhNode_Refit(BvhNode *bvhn)
+{
+    if (!IsLeaf(bvhn))
+    {
+        bvhn->BoundingBox = BoundingBox_Expand(bvhn->Left->BoundingBox, bvhn->Right->BoundingBox);
+        return;
+    }
+    
+    bvhn->BoundingBox = bvhn->Primitives[0].BoundingBox;
+    for (size_t i = 1; i < bvhn->Size; i++)
+    {
+        bvhn->BoundingBox = BoundingBox_Expand(bvhn->BoundingBox, bvhn->Primitives[i].BoundingBox);
+    }
+}
+
+/// - Returns: How much the area of the node would grow to enclose the bounding box
+static float _Enlargement(const BvhNode *bvhn, Rectangle boundingBox)
+{
+    return BoundingBox_Area(BoundingBox_Expand(bvhn->BoundingBox, boundingBox)) - BoundingBox_Area(bvhn->BoundingBox);
+}
+
+static BvhNode *_InsertImpl(BvhNode *bvhn, Primitive primitive)
+{
+    if (bvhn == NULL) return _BvhNode_CreateLeaf(primitive);
+    
+    if (IsLeaf(bvhn))
+    {
+        if (bvhn->Size < 2)
+        {
+            bvhn->Primitives[bvhn->Size++] = primitive;
+            _BvhNode_Refit(bvhn);
+            return bvhn;
+        }
+        
+        // Split a full leaf, its primitives move down to the left and the new one goes to the right
+        BvhNode *left = malloc(sizeof(BvhNode));
+        Counters_Add(COUNTER_BYTES_BVH, sizeof(BvhNode));
+        *left = *bvhn;
+        bvhn->Left = left;
+        bvhn->Right = _BvhNode_CreateLeaf(primitive);
+        _BvhNode_Refit(bvhn);
+        return bvhn;
+    }
+    
+    if (_Enlargement(bvhn->Left, primitive.BoundingBox) <= _Enlargement(bvhn->Right, primitive.BoundingBox))
+    {
+        bvhn->Left = _InsertImpl(bvhn->Left, primitive);
+    }
+    else
+    {
+        bvhn->Right = _InsertImpl(bvhn->Right, primitive);
+    }
+    _BvhNode_Refit(bvhn);
+    return bvhn;
+}
+
+/// - Returns: The node that replaces bvhn, NULL if nothing is left under it
+static BvhNode *_RemoveImpl(BvhNode *bvhn, const Primitive *primitive)
+{
+    if (bvhn == NULL || !CheckCollisionRecs(bvhn->BoundingBox, primitive->BoundingBox)) return bvhn;
+    
+    if (IsLeaf(bvhn))
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < bvhn->Size; i++)
+        {
+            if (bvhn->Primitives[i].VertexIndex == primitive->VertexIndex) continue;
+            bvhn->Primitives[size++] = bvhn->Primitives[i];
+        }
+        bvhn->Size = size;
+        
+        if (size == 0)
+        {
+            free(bvhn);
+            return NULL;
+        }
+        _BvhNode_Refit(bvhn);
+        return bvhn;
+    }
+    
+    bvhn->Left = _RemoveImpl(bvhn->Left, primitive);
+    bvhn->Right = _RemoveImpl(bvhn->Right, primitive);
+    
+    // Collapse a node left with a single child into that child
+    if (bvhn->Left == NULL || bvhn->Right == NULL)
+    {
+        BvhNode *child = bvhn->Left != NULL ? bvhn->Left : bvhn->Right;
+        free(bvhn);
+        return child;
+    }
+    _BvhNode_Refit(bvhn);
+    return bvhn;
+}
+
+void BvhTree_Insert(BvhTree *bvht, Primitive primitive)
+{
+    assert(bvht != NULL);
+    bvht->root = _InsertImpl(bvht->root, primitive);
+}
+
+void BvhTree_Remove(BvhTree *bvht, const Primitive *primitive)
+{
+    assert(bvht != NULL);
+    assert(primitive != NULL);
+    bvht->root = _RemoveImpl(bvht->root, primitive);
+}
+
+void BvhTree_Update(BvhTree *bvht, const Primitive *old, Primitive updated)
+{
+    assert(old->VertexIndex == updated.VertexIndex);
+    BvhTree_Remove(bvht, old);
+    BvhTree_Insert(bvht, updated);
+}
@@ -0,0 +1,25 @@
+//
+//  BoundingBox.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "BoundingBox.h"
+#include <math.h>
+
+Rectangle BoundingBox_Expand(Rectangle a, Rectangle b)
+{
+    // Calculate the minimum and maximum x and y coordinates
+    float minX = fmin(a.x, b.x);
+    float minY = fmin(a.y, b.y);
+    int maxX = fmax(a.x + a.width, b.x + b.width);
+    int maxY = fmax(a.y + a.height, b.y + b.height);
+    
+    return (Rectangle) {.x = minX, .y = minY, .width = maxX - minX, .height = maxY - minY};
+}
+
+float BoundingBox_Area(Rectangle boundingBox)
+{
+    return boundingBox.width * boundingBox.height;
+}
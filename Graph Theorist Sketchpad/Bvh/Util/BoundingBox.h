@@ -0,0 +1,19 @@
+//
+//  BoundingBox.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef BoundingBox_h
+#define BoundingBox_h
+
+#include "raylib.h"
+
+/// - Returns: An expanded bounding box that encloses both a and b
+Rectangle BoundingBox_Expand(Rectangle a, Rectangle b);
+
+/// - Returns: The area of the bounding box
+float BoundingBox_Area(Rectangle boundingBox);
+
+#endif /* BoundingBox_h */
@@ -0,0 +1,114 @@
+//
+//  CommandQueue.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "CommandQueue.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "../../Graph/Util/Profiler.h"
+
+#define COMMAND_QUEUE_INITIAL_CAPACITY 16
+
+CommandQueue *CommandQueue_CreateCommandQueue(void)
+{
+    CommandQueue *q = malloc(sizeof(CommandQueue));
+    q->Commands = malloc(COMMAND_QUEUE_INITIAL_CAPACITY * sizeof(Command));
+    q->Count = 0;
+    q->Capacity = COMMAND_QUEUE_INITIAL_CAPACITY;
+    return q;
+}
+
+void CommandQueue_FreeCommandQueue(CommandQueue *q)
+{
+    assert(q != NULL);
+    free(q->Commands);
+    free(q);
+}
+
+static void _CommandQueue_Push(CommandQueue *q, Command command)
+{
+    if (q->Count == q->Capacity)
+    {
+        q->Capacity *= 2;
+        q->Commands = realloc(q->Commands, q->Capacity * sizeof(Command));
+    }
+    q->Commands[q->Count++] = command;
+}
+
+void CommandQueue_AddVertex(CommandQueue *q, Vector2 position, Color color)
+{
+    assert(q != NULL);
+    _CommandQueue_Push(q, (Command) {.Kind = COMMAND_ADD_VERTEX, .Position = position, .Color = color});
+}
+
+void CommandQueue_AddEdge(CommandQueue *q, VertexIndex v1, VertexIndex v2, short weight)
+{
+    assert(q != NULL);
+    _CommandQueue_Push(q, (Command) {.Kind = COMMAND_ADD_EDGE, .V1 = v1, .V2 = v2, .Weight = weight});
+}
+
+void CommandQueue_MoveVertex(CommandQueue *q, VertexIndex vi, Vector2 position)
+{
+    assert(q != NULL);
+    
+    // Only where the vertex ends up matters, the journal merges the moves of a drag anyway
+    if (q->Count > 0)
+    {
+        Command *last = &q->Commands[q->Count - 1];
+        if (last->Kind == COMMAND_MOVE_VERTEX && last->V1 == vi)
+        {
+            last->Position = position;
+            return;
+        }
+    }
+    _CommandQueue_Push(q, (Command) {.Kind = COMMAND_MOVE_VERTEX, .V1 = vi, .Position = position});
+}
+
+void CommandQueue_EndMove(CommandQueue *q)
+{
+    assert(q != NULL);
+    _CommandQueue_Push(q, (Command) {.Kind = COMMAND_END_MOVE});
+}
+
+size_t CommandQueue_Apply(CommandQueue *q, Journal *j, GraphSketch *gs)
+{
+    PROFILE_ZONE("CommandQueue_Apply");
+    assert(q != NULL);
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    bool isBatch = q->Count >= COMMAND_QUEUE_MIN_BATCH;
+    if (isBatch) GraphSketch_BeginBatch(gs);
+    
+    for (size_t i = 0; i < q->Count; i++)
+    {
+        const Command *command = &q->Commands[i];
+        switch (command->Kind)
+        {
+            case COMMAND_ADD_VERTEX:
+                Journal_AddVertex(j, gs, command->Position, command->Color);
+                break;
+            
+            case COMMAND_ADD_EDGE:
+                Journal_AddEdge(j, gs, command->V1, command->V2, command->Weight);
+                break;
+            
+            case COMMAND_MOVE_VERTEX:
+                Journal_MoveVertex(j, gs, command->V1, command->Position);
+                break;
+            
+            case COMMAND_END_MOVE:
+                Journal_EndMove(j);
+                break;
+        }
+    }
+    
+    if (isBatch) GraphSketch_EndBatch(gs, j->SceneBoundingBox);
+    
+    size_t applied = q->Count;
+    q->Count = 0;
+    return applied;
+}
@@ -0,0 +1,73 @@
+//
+//  CommandQueue.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef CommandQueue_h
+#define CommandQueue_h
+
+#include "../Journal/Journal.h"
+
+/// Queues at least this long are applied as one batch, rebuilding the Bvh Tree once instead of updating it per edit
+#define COMMAND_QUEUE_MIN_BATCH 8
+
+typedef enum
+{
+    COMMAND_ADD_VERTEX,
+    COMMAND_ADD_EDGE,
+    COMMAND_MOVE_VERTEX,
+    COMMAND_END_MOVE,
+} CommandKind;
+
+/// An edit waiting to be applied to the sketch
+typedef struct
+{
+    CommandKind Kind;
+    
+    /// The vertex moved, or the vertices of the edge added
+    VertexIndex V1;
+    VertexIndex V2;
+    
+    short Weight;
+    Color Color;
+    
+    /// Where the vertex is added or moved to
+    Vector2 Position;
+    
+} Command;
+
+/// Edits pushed during a frame, applied together through the journal
+typedef struct
+{
+    Command *Commands;
+    size_t Count;
+    size_t Capacity;
+    
+} CommandQueue;
+
+/// Creates an empty queue
+CommandQueue *CommandQueue_CreateCommandQueue(void);
+
+/// Frees the memory of the queue, dropping any command not applied
+void CommandQueue_FreeCommandQueue(CommandQueue *q);
+
+/// Queues a vertex centered at the position
+void CommandQueue_AddVertex(CommandQueue *q, Vector2 position, Color color);
+
+/// Queues an edge between two vertices, which may themselves still be queued
+void CommandQueue_AddEdge(CommandQueue *q, VertexIndex v1, VertexIndex v2, short weight);
+
+/// Queues a move of a vertex. A move of the vertex queued last is replaced rather than queued again.
+void CommandQueue_MoveVertex(CommandQueue *q, VertexIndex vi, Vector2 position);
+
+/// Queues the end of the current drag
+void CommandQueue_EndMove(CommandQueue *q);
+
+/// Applies every queued command in order through the journal and empties the queue. Queues of at least
+/// COMMAND_QUEUE_MIN_BATCH commands are applied in a GraphSketch batch, so the Bvh Tree is rebuilt once.
+/// - Returns: The number of commands applied
+size_t CommandQueue_Apply(CommandQueue *q, Journal *j, GraphSketch *gs);
+
+#endif /* CommandQueue_h */
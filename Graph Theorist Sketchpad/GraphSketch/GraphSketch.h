@@ -11,6 +11,7 @@
 #include "../Bvh/BvhTree.h"
 #include "../Bvh/Primitive/Primitive.h"
 #include "../../Graph/Graph.h"
+#include "../../Graph/Generators.h"
 
 #define GRAPH_VERTEX_RADIUS 20
 #define GRAPH_MAX_PRIMITIVES (GRAPH_MAX_SIZE*2)
@@ -65,6 +66,10 @@ typedef struct
     /// The mathematical representation of the graph
     Graph *Graph;
     
+    /// While in a batch, vertex changes leave the Bvh Tree stale until GraphSketch_EndBatch rebuilds it once
+    bool IsInBatch;
+    bool IsBvhTreeStale;
+    
 } GraphSketch;
 
 /// Draws an edge between two vertices via their primitives centroid
@@ -83,34 +88,61 @@ VertexIndex GraphSketch_AddVertex(GraphSketch *gs, Vector2 position, Color color
 /// Adds an edge between two vertices
 void GraphSketch_AddEdge(GraphSketch *gs, VertexIndex v1, VertexIndex v2, short weight);
 
+/// Undoes the last GraphSketch_AddVertex, removing its primitive from the Bvh Tree. The vertex must have no edges.
+void GraphSketch_RemoveLastVertex(GraphSketch *gs);
+
+/// Undoes the last GraphSketch_AddEdge
+/// - Parameters:
+///   - gs: the graph sketch
+///   - wasAdjacent: If the vertices of the edge were adjacent before it was added
+void GraphSketch_RemoveLastEdge(GraphSketch *gs, bool wasAdjacent);
+
+/// Centers a vertex at the position, moving its primitive in the Bvh Tree
+void GraphSketch_MoveVertex(GraphSketch *gs, VertexIndex vi, Vector2 position);
+
+/// Swaps the color of each of the first count vertices with its entry of colors, so calling it again swaps them back.
+/// Colors have nothing to do with the Bvh Tree or the graph, so the whole sketch is recolored in one pass.
+void GraphSketch_SwapVertexColors(GraphSketch *gs, Color *colors, unsigned int count);
+
 void GraphSketch_RefreshBvhTree(GraphSketch *gs, Rectangle sceneBoundingBox);
 
+/// Defers Bvh Tree work until GraphSketch_EndBatch. The Bvh Tree must not be queried while in a batch.
+void GraphSketch_BeginBatch(GraphSketch *gs);
+
+/// Rebuilds the Bvh Tree once if any vertex was added, removed or moved since GraphSketch_BeginBatch
+void GraphSketch_EndBatch(GraphSketch *gs, Rectangle sceneBoundingBox);
+
+/// Adds every vertex and edge of the list in one batch, after the vertices already in the sketch
+/// - Parameters:
+///   - positions: where each vertex goes in the unit square, scaled to the scene, or NULL for a circle
+void GraphSketch_AddEdgeList(GraphSketch *gs, const EdgeList *el, const GeneratorPoint *positions, Color color, Rectangle sceneBoundingBox);
+
+/// Saves the graph and the position, color and label of every vertex as a graph file with a checksum
+/// - Returns: false if the file could not be written
+bool GraphSketch_Save(const GraphSketch *gs, const char *path);
+
+/// Adds the graph of a graph file to an empty sketch in one batch, at its saved positions with its saved colors and labels.
+/// Files saved without a sketch are laid out in a circle in the given color.
+/// - Returns: false, with the reason in error, if the file is corrupt or has more than GRAPH_MAX_SIZE vertices or edges
+bool GraphSketch_Open(GraphSketch *gs, const char *path, Color color, Rectangle sceneBoundingBox, GraphLoadError *error);
+
 /// Reset to initial empty state
 void GraphSketch_Reset(GraphSketch *gs);
 
 /// Draws the drawable vertices
 void GraphSketch_DrawVertices(const GraphSketch *gs);
 
-/// Draws the graphs adjacency matrix
-/// - Parameters:
-///    - gs: the graph sketch
-///    - buffer: the string buffer to be used for the drawing
-void GraphSketch_DrawAdjMatrix(const GraphSketch *gs, StringBuffer buffer);
-
-/// Draws the graphs incidence matrix
-/// - Parameters:
-///    - gs: the graph sketch
-///    - buffer: the string buffer to be used for the drawing
-void GraphSketch_DrawIncidenceMatrix(const GraphSketch *gs, StringBuffer buffer);
-
 /// Draws all of the edges in the edge list
 void GraphSketch_DrawEdges(const GraphSketch *gs);
 
 /// Draws the degree of each vertex
 void GraphSketch_DrawDegrees(GraphSketch *gs);
 
-/// Draws the minimum spanning tree
-void GraphSketch_DrawMST(GraphSketch *gs);
+/// Draws the minimum spanning tree, or any other highlighted edges, with the vertices they join
+/// - Parameters:
+///    - gs: the graph sketch
+///    - edges: the edges of the tree, terminated by MST_NO_EDGE
+void GraphSketch_DrawMST(const GraphSketch *gs, const EdgeIndex edges[GRAPH_MAX_SIZE]);
 
 #endif /* GraphSketch_h */
 
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include "../../Graph/Util/Counters.h"
 
 DrawableVertex DrawableVertex_CreateDrawableVertex(const char* label, Color color, VertexIndex vi)
 {
@@ -33,9 +34,12 @@ DrawableEdge DrawableEdge_CreateDrawableEdge(Label label, VertexIndex v1, Vertex
 GraphSketch *GraphSketch_CreateGraphSketch(void)
 {
     GraphSketch *gs = malloc(sizeof(GraphSketch));
-    memset(gs->VertexIndexToDegreeMap, 0, GRAPH_MAX_SIZE);
+    Counters_Add(COUNTER_BYTES_GRAPH_SKETCH, sizeof(GraphSketch));
+    memset(gs->VertexIndexToDegreeMap, 0, sizeof(gs->VertexIndexToDegreeMap));
     gs->BvhTree = NULL;
     gs->Graph = Graph_CreateGraph();
+    gs->IsInBatch = false;
+    gs->IsBvhTreeStale = false;
     return gs;
 }
 
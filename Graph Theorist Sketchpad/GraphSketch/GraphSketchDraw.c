@@ -11,6 +11,7 @@
 #include "math.h"
 #include "raygui.h"
 #include "raymath.h"
+#include "../../Graph/Util/Profiler.h"
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
@@ -95,6 +96,7 @@ void DrawableEdge_Draw(const GraphSketch *gs, DrawableEdge de)
 
 void GraphSketch_DrawVertices(const GraphSketch *gs)
 {
+    PROFILE_ZONE("GraphSketch_DrawVertices");
     assert(gs != NULL);
     
     for (VertexIndex vi = 0; vi < gs->Graph->Vertices; vi++)
@@ -103,61 +105,9 @@ void GraphSketch_DrawVertices(const GraphSketch *gs)
     }
 }
 
-static void _DrawMatrix(StringBuffer buffer, Vector2 position)
-{
-    int column = 0;
-    int row = 0;
-    
-    char previousChar = ' ';
-    int spacing = 0;
-    
-    char *iter = buffer;
-    char text[2] = { *iter, '\0'};
-    
-    while (*iter != '\0')
-    {
-        if (*iter == '\n')
-        {
-            column = 0;
-            row++;
-            iter++;
-            previousChar = ' ';
-            continue;
-        }
-        if (*iter == ' ')
-        {
-            column++;
-            iter++;
-            previousChar = ' ';
-            continue;
-        }
-        text[0] = *iter;
-        spacing = previousChar != ' ' ? 6 : 0;
-        
-        DrawText(text, position.x + column*25 + spacing, position.y + row*15, 15, RAYWHITE);
-        previousChar = *iter;
-        iter++;
-    }
-}
-
-void GraphSketch_DrawAdjMatrix(const GraphSketch *gs, StringBuffer buffer)
-{
-    assert(gs != NULL);
-    _DrawMatrix(buffer, (Vector2){20,10});
-    GuiGroupBox((Rectangle) {10, 5, gs->Graph->Vertices * 25 + 10, gs->Graph->Vertices * 15 + 10},
-                "Adjacency Matrix");
-}
-
-void GraphSketch_DrawIncidenceMatrix(const GraphSketch *gs, StringBuffer buffer)
-{
-    assert(gs != NULL);
-    _DrawMatrix(buffer, (Vector2){20,10});
-    GuiGroupBox((Rectangle) {10, 5, gs->Graph->Edges * 25 + 10, gs->Graph->Vertices * 15 + 10},
-                "Incidence Matrix");
-}
-
 void GraphSketch_DrawEdges(const GraphSketch *gs)
 {
+    PROFILE_ZONE("GraphSketch_DrawEdges");
     assert(gs != NULL);
     
     for (int i = 0; i < gs->Graph->Edges; i++)
@@ -178,15 +128,16 @@ void GraphSketch_DrawDegrees(GraphSketch *gs)
     }
 }
 
-void GraphSketch_DrawMST(GraphSketch *gs)
+void GraphSketch_DrawMST(const GraphSketch *gs, const EdgeIndex edges[GRAPH_MAX_SIZE])
 {
-    if (gs->Graph->Vertices < 2 || gs->Graph->Edges < 1 ) return;
-    EdgeIndex edges[gs->Graph->Vertices];
-    Graph_MinSpanningTree(gs->Graph, edges);
+    assert(gs != NULL);
     
-    for (int i = 0; i < gs->Graph->Vertices; i++)
+    for (int i = 0; i < GRAPH_MAX_SIZE; i++)
     {
         if (edges[i] == MST_NO_EDGE) break;
+        
+        // The tree may be of an older version of the graph
+        if (edges[i] >= gs->Graph->Edges) continue;
         DrawableEdge de = gs->DrawableEdgeList[edges[i]];
         DrawableEdge_Draw(gs, de);
         DrawableVertex_Draw(&gs->IndexToDrawableVertexMap[de.V1], &gs->IndexToPrimitiveMap[de.V1]);
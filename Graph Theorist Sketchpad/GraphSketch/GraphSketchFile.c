@@ -0,0 +1,116 @@
+//
+//  GraphSketchFile.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "GraphSketch.h"
+#include <assert.h>
+#include <string.h>
+#include <limits.h>
+#include "../../Graph/GraphFile.h"
+
+_Static_assert(sizeof(Label) <= GRAPH_FILE_LABEL_SIZE, "labels must fit a graph file");
+
+bool GraphSketch_Save(const GraphSketch *gs, const char *path)
+{
+    assert(gs != NULL);
+    assert(path != NULL);
+    
+    unsigned int vertices = gs->Graph->Vertices;
+    float positions[GRAPH_MAX_SIZE][2];
+    uint32_t colors[GRAPH_MAX_SIZE];
+    char labels[GRAPH_MAX_SIZE][GRAPH_FILE_LABEL_SIZE] = {0};
+    for (VertexIndex v = 0; v < vertices; v++)
+    {
+        positions[v][0] = gs->IndexToPrimitiveMap[v].Centroid.x;
+        positions[v][1] = gs->IndexToPrimitiveMap[v].Centroid.y;
+        colors[v] = (uint32_t) ColorToInt(gs->IndexToDrawableVertexMap[v].Color);
+        memcpy(labels[v], gs->IndexToDrawableVertexMap[v].Label, sizeof(Label));
+    }
+    
+    EdgeList *el = EdgeList_FromGraph(gs->Graph);
+    Csr *csr = Csr_FromEdgeList(el);
+    GraphFileSketch sketch = { .Positions = positions[0], .Colors = colors, .Labels = labels };
+    bool isSaved = GraphFile_Write(path, csr, &sketch, true);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return isSaved;
+}
+
+static bool _Fail(GraphLoadError *error, const char *message)
+{
+    if (error != NULL)
+    {
+        error->Line = 0;
+        error->Message = message;
+    }
+    return false;
+}
+
+bool GraphSketch_Open(GraphSketch *gs, const char *path, Color color, Rectangle sceneBoundingBox, GraphLoadError *error)
+{
+    assert(gs != NULL);
+    assert(path != NULL);
+    assert(gs->Graph->Vertices == 0);
+    
+    GraphFile *file = GraphFile_Open(path, error);
+    if (file == NULL) return false;
+    
+    // Small enough to check every byte before the sketch trusts it
+    if (file->Csr.Vertices > GRAPH_MAX_SIZE || file->Csr.Count > GRAPH_MAX_SIZE)
+    {
+        GraphFile_Close(file);
+        return _Fail(error, "too large for the sketch");
+    }
+    if (!GraphFile_Verify(file, error))
+    {
+        GraphFile_Close(file);
+        return false;
+    }
+    
+    EdgeList *el = EdgeList_FromCsr(&file->Csr);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        if (el->Weights[e] > SHRT_MAX)
+        {
+            EdgeList_FreeEdgeList(el);
+            GraphFile_Close(file);
+            return _Fail(error, "weights must be at most SHRT_MAX in the sketch");
+        }
+    }
+    
+    const GraphFileSketch *sketch = &file->Sketch;
+    if (sketch->Positions == NULL)
+    {
+        GraphSketch_AddEdgeList(gs, el, NULL, color, sceneBoundingBox);
+    }
+    else
+    {
+        GraphSketch_BeginBatch(gs);
+        for (VertexIndex v = 0; v < el->Vertices; v++)
+        {
+            Vector2 position = { sketch->Positions[2 * v], sketch->Positions[2 * v + 1] };
+            GraphSketch_AddVertex(gs, position, sketch->Colors != NULL ? GetColor(sketch->Colors[v]) : color, sceneBoundingBox);
+        }
+        for (size_t e = 0; e < el->Count; e++)
+        {
+            GraphSketch_AddEdge(gs, el->Sources[e], el->Targets[e], (short) el->Weights[e]);
+        }
+        GraphSketch_EndBatch(gs, sceneBoundingBox);
+    }
+    
+    if (sketch->Labels != NULL)
+    {
+        for (VertexIndex v = 0; v < el->Vertices; v++)
+        {
+            memcpy(gs->IndexToDrawableVertexMap[v].Label, sketch->Labels[v], sizeof(Label));
+            gs->IndexToDrawableVertexMap[v].Label[sizeof(Label) - 1] = '\0';
+        }
+    }
+    
+    EdgeList_FreeEdgeList(el);
+    GraphFile_Close(file);
+    return true;
+}
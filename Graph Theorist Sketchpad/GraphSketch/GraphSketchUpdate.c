@@ -9,9 +9,13 @@
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+#include <math.h>
+#include "../../Graph/Util/Profiler.h"
 
 void GraphSketch_RefreshBvhTree(GraphSketch *gs, Rectangle sceneBoundingBox)
 {
+    PROFILE_ZONE("GraphSketch_RefreshBvhTree");
     if (gs->BvhTree != NULL)
     {
         BvhTree_FreeBvhTree(gs->BvhTree);
@@ -22,6 +26,32 @@ void GraphSketch_RefreshBvhTree(GraphSketch *gs, Rectangle sceneBoundingBox)
     gs->BvhTree = BvhTree_CreateBvhTree(primitives, gs->Graph->Vertices, sceneBoundingBox);
 }
 
+void GraphSketch_BeginBatch(GraphSketch *gs)
+{
+    assert(gs != NULL);
+    assert(!gs->IsInBatch);
+    gs->IsInBatch = true;
+}
+
+void GraphSketch_EndBatch(GraphSketch *gs, Rectangle sceneBoundingBox)
+{
+    assert(gs != NULL);
+    assert(gs->IsInBatch);
+    gs->IsInBatch = false;
+    if (!gs->IsBvhTreeStale) return;
+    
+    gs->IsBvhTreeStale = false;
+    if (gs->Graph->Vertices > 0)
+    {
+        GraphSketch_RefreshBvhTree(gs, sceneBoundingBox);
+    }
+    else if (gs->BvhTree != NULL)
+    {
+        BvhTree_FreeBvhTree(gs->BvhTree);
+        gs->BvhTree = NULL;
+    }
+}
+
 VertexIndex GraphSketch_AddVertex(GraphSketch *gs, Vector2 position, Color color, Rectangle sceneBoundingBox)
 {
     assert(gs != NULL);
@@ -32,8 +62,19 @@ VertexIndex GraphSketch_AddVertex(GraphSketch *gs, Vector2 position, Color color
     // Add a collideable at the given position
     gs->IndexToPrimitiveMap[vi] = Primitive_CreatePrimitive(position, vi);
     
-    // Re-create the Bvh Tree on every graph change
-    GraphSketch_RefreshBvhTree(gs, sceneBoundingBox);
+    // Create the Bvh Tree with the first vertex, every later one is inserted into it
+    if (gs->IsInBatch)
+    {
+        gs->IsBvhTreeStale = true;
+    }
+    else if (gs->BvhTree == NULL)
+    {
+        GraphSketch_RefreshBvhTree(gs, sceneBoundingBox);
+    }
+    else
+    {
+        BvhTree_Insert(gs->BvhTree, gs->IndexToPrimitiveMap[vi]);
+    }
     
     // Add a vertex to the display
     char numStr[4];
@@ -71,11 +112,97 @@ void GraphSketch_AddEdge(GraphSketch *gs, VertexIndex v1, VertexIndex v2, short
     gs->VertexIndexToDegreeMap[v2]++;
 }
 
+void GraphSketch_RemoveLastVertex(GraphSketch *gs)
+{
+    assert(gs != NULL);
+    assert(gs->Graph->Vertices > 0);
+    
+    VertexIndex vi = gs->Graph->Vertices - 1;
+    assert(gs->VertexIndexToDegreeMap[vi] == 0);
+    
+    if (gs->IsInBatch) gs->IsBvhTreeStale = true;
+    else BvhTree_Remove(gs->BvhTree, &gs->IndexToPrimitiveMap[vi]);
+    Graph_RemoveLastVertex(gs->Graph);
+}
+
+void GraphSketch_RemoveLastEdge(GraphSketch *gs, bool wasAdjacent)
+{
+    assert(gs != NULL);
+    assert(gs->Graph->Edges > 0);
+    
+    const DrawableEdge *de = &gs->DrawableEdgeList[gs->Graph->Edges - 1];
+    Graph_RemoveLastEdge(gs->Graph, de->V1, de->V2, wasAdjacent);
+    gs->VertexIndexToDegreeMap[de->V1]--;
+    gs->VertexIndexToDegreeMap[de->V2]--;
+}
+
+void GraphSketch_MoveVertex(GraphSketch *gs, VertexIndex vi, Vector2 position)
+{
+    assert(gs != NULL);
+    assert(vi < gs->Graph->Vertices);
+    
+    Primitive moved = Primitive_CreatePrimitive(position, vi);
+    if (gs->IsInBatch) gs->IsBvhTreeStale = true;
+    else BvhTree_Update(gs->BvhTree, &gs->IndexToPrimitiveMap[vi], moved);
+    gs->IndexToPrimitiveMap[vi] = moved;
+}
+
+void GraphSketch_SwapVertexColors(GraphSketch *gs, Color *colors, unsigned int count)
+{
+    assert(gs != NULL);
+    assert(colors != NULL);
+    assert(count <= gs->Graph->Vertices);
+    
+    for (VertexIndex vi = 0; vi < count; vi++)
+    {
+        Color color = gs->IndexToDrawableVertexMap[vi].Color;
+        gs->IndexToDrawableVertexMap[vi].Color = colors[vi];
+        colors[vi] = color;
+    }
+}
+
+void GraphSketch_AddEdgeList(GraphSketch *gs, const EdgeList *el, const GeneratorPoint *positions, Color color, Rectangle sceneBoundingBox)
+{
+    assert(gs != NULL);
+    assert(el != NULL);
+    assert(gs->Graph->Vertices + el->Vertices <= GRAPH_MAX_SIZE);
+    assert(gs->Graph->Edges + el->Count <= GRAPH_MAX_SIZE);
+    
+    // Keep whole vertices inside the scene
+    float margin = GRAPH_VERTEX_RADIUS;
+    float width = sceneBoundingBox.width - 2 * margin;
+    float height = sceneBoundingBox.height - 2 * margin;
+    
+    GraphSketch_BeginBatch(gs);
+    VertexIndex first = gs->Graph->Vertices;
+    for (VertexIndex v = 0; v < el->Vertices; v++)
+    {
+        GeneratorPoint point = {0.5f, 0.5f};
+        if (positions != NULL)
+        {
+            point = positions[v];
+        }
+        else
+        {
+            point.X += 0.45f * cosf(2 * PI * v / el->Vertices);
+            point.Y += 0.45f * sinf(2 * PI * v / el->Vertices);
+        }
+        Vector2 position = {sceneBoundingBox.x + margin + point.X * width, sceneBoundingBox.y + margin + point.Y * height};
+        GraphSketch_AddVertex(gs, position, color, sceneBoundingBox);
+    }
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        assert(el->Weights[e] <= SHRT_MAX);
+        GraphSketch_AddEdge(gs, first + el->Sources[e], first + el->Targets[e], (short) el->Weights[e]);
+    }
+    GraphSketch_EndBatch(gs, sceneBoundingBox);
+}
+
 void GraphSketch_Reset(GraphSketch *gs)
 {
     assert(gs != NULL);
     
-    memset(gs->VertexIndexToDegreeMap, 0, GRAPH_MAX_SIZE);
+    memset(gs->VertexIndexToDegreeMap, 0, sizeof(gs->VertexIndexToDegreeMap));
     
     BvhTree_FreeBvhTree(gs->BvhTree);
     gs->BvhTree = NULL;
@@ -0,0 +1,208 @@
+//
+//  InputLog.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "InputLog.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define INPUT_LOG_INITIAL_CAPACITY 256
+
+InputLog *InputLog_CreateInputLog(void)
+{
+    InputLog *log = malloc(sizeof(InputLog));
+    log->Events = malloc(INPUT_LOG_INITIAL_CAPACITY * sizeof(InputEvent));
+    log->Count = 0;
+    log->Capacity = INPUT_LOG_INITIAL_CAPACITY;
+    log->Frame = 0;
+    log->StartTime = 0;
+    log->HasStarted = false;
+    log->Cursor = 0;
+    return log;
+}
+
+void InputLog_FreeInputLog(InputLog *log)
+{
+    assert(log != NULL);
+    free(log->Events);
+    free(log);
+}
+
+static void _InputLog_Append(InputLog *log, InputEvent event)
+{
+    if (log->Count == log->Capacity)
+    {
+        log->Capacity *= 2;
+        log->Events = realloc(log->Events, log->Capacity * sizeof(InputEvent));
+    }
+    log->Events[log->Count++] = event;
+}
+
+void InputLog_BeginFrame(InputLog *log, uint64_t now)
+{
+    assert(log != NULL);
+    if (!log->HasStarted)
+    {
+        log->StartTime = now;
+        log->HasStarted = true;
+        return;
+    }
+    log->Frame++;
+}
+
+void InputLog_Record(InputLog *log, InputEventKind kind, int16_t x, int16_t y, uint32_t value, uint64_t now)
+{
+    assert(log != NULL);
+    assert(log->HasStarted);
+    assert(kind < INPUT_EVENT_KIND_COUNT);
+    
+    _InputLog_Append(log, (InputEvent)
+    {
+        .Kind = kind,
+        .Frame = log->Frame,
+        .Time = now - log->StartTime,
+        .X = x,
+        .Y = y,
+        .Value = value,
+    });
+}
+
+static bool _HasPosition(InputEventKind kind)
+{
+    return kind == INPUT_EVENT_MOUSE_MOVE || kind == INPUT_EVENT_MOUSE_PRESS || kind == INPUT_EVENT_VERTEX_COLOR ||
+           (kind >= INPUT_EVENT_MATRIX_SCROLL && kind <= INPUT_EVENT_MATRIX_ZOOM);
+}
+
+static bool _HasValue(InputEventKind kind)
+{
+    return kind == INPUT_EVENT_MODES || kind == INPUT_EVENT_COLOR || kind == INPUT_EVENT_WEIGHT ||
+           kind == INPUT_EVENT_VERTEX_COLOR || (kind >= INPUT_EVENT_MATRIX_SCROLL && kind <= INPUT_EVENT_MATRIX_ZOOM);
+}
+
+/// Writes 7 bits at a time, low bits first, setting the high bit of every byte but the last
+static void _WriteVarint(FILE *file, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        fputc((int) (value & 0x7F) | 0x80, file);
+        value >>= 7;
+    }
+    fputc((int) value, file);
+}
+
+static bool _ReadVarint(FILE *file, uint64_t *value)
+{
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        int byte = fgetc(file);
+        if (byte == EOF) return false;
+        *value |= (uint64_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+static void _WriteInt16(FILE *file, int16_t value)
+{
+    uint16_t bits = (uint16_t) value;
+    fputc(bits & 0xFF, file);
+    fputc(bits >> 8, file);
+}
+
+static bool _ReadInt16(FILE *file, int16_t *value)
+{
+    int low = fgetc(file);
+    int high = fgetc(file);
+    if (low == EOF || high == EOF) return false;
+    *value = (int16_t) (uint16_t) (low | high << 8);
+    return true;
+}
+
+bool InputLog_Write(const InputLog *log, FILE *file)
+{
+    assert(log != NULL);
+    assert(file != NULL);
+    
+    fwrite(INPUT_LOG_MAGIC, 1, strlen(INPUT_LOG_MAGIC), file);
+    fputc(INPUT_LOG_VERSION, file);
+    
+    uint32_t frame = 0;
+    uint64_t time = 0;
+    for (size_t i = 0; i < log->Count; i++)
+    {
+        const InputEvent *event = &log->Events[i];
+        fputc(event->Kind, file);
+        _WriteVarint(file, event->Frame - frame);
+        _WriteVarint(file, event->Time - time);
+        if (_HasPosition(event->Kind))
+        {
+            _WriteInt16(file, event->X);
+            _WriteInt16(file, event->Y);
+        }
+        if (_HasValue(event->Kind))
+        {
+            _WriteVarint(file, event->Value);
+        }
+        frame = event->Frame;
+        time = event->Time;
+    }
+    
+    return !ferror(file);
+}
+
+InputLog *InputLog_Read(FILE *file)
+{
+    assert(file != NULL);
+    
+    char magic[sizeof(INPUT_LOG_MAGIC) - 1];
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic)) return NULL;
+    if (memcmp(magic, INPUT_LOG_MAGIC, sizeof(magic)) != 0) return NULL;
+    if (fgetc(file) != INPUT_LOG_VERSION) return NULL;
+    
+    InputLog *log = InputLog_CreateInputLog();
+    uint32_t frame = 0;
+    uint64_t time = 0;
+    int kind;
+    while ((kind = fgetc(file)) != EOF)
+    {
+        InputEvent event = {.Kind = kind};
+        uint64_t frameDelta, timeDelta, value = 0;
+        bool isValid = kind < INPUT_EVENT_KIND_COUNT
+            && _ReadVarint(file, &frameDelta)
+            && _ReadVarint(file, &timeDelta)
+            && (!_HasPosition(kind) || (_ReadInt16(file, &event.X) && _ReadInt16(file, &event.Y)))
+            && (!_HasValue(kind) || _ReadVarint(file, &value));
+        if (!isValid)
+        {
+            InputLog_FreeInputLog(log);
+            return NULL;
+        }
+        
+        frame += frameDelta;
+        time += timeDelta;
+        event.Frame = frame;
+        event.Time = time;
+        event.Value = (uint32_t) value;
+        _InputLog_Append(log, event);
+    }
+    
+    return log;
+}
+
+const InputEvent *InputLog_Next(InputLog *log, uint32_t frame)
+{
+    assert(log != NULL);
+    if (log->Cursor == log->Count || log->Events[log->Cursor].Frame > frame) return NULL;
+    return &log->Events[log->Cursor++];
+}
+
+bool InputLog_IsFinished(const InputLog *log)
+{
+    assert(log != NULL);
+    return log->Cursor == log->Count;
+}
@@ -0,0 +1,128 @@
+//
+//  InputLog.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef InputLog_h
+#define InputLog_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define INPUT_LOG_MAGIC "GTSI"
+#define INPUT_LOG_VERSION 1
+
+typedef enum
+{
+    /// The mouse moved to X, Y
+    INPUT_EVENT_MOUSE_MOVE,
+    
+    /// The left mouse button was pressed on the sketch at X, Y
+    INPUT_EVENT_MOUSE_PRESS,
+    
+    INPUT_EVENT_UNDO,
+    INPUT_EVENT_REDO,
+    INPUT_EVENT_CLEAR,
+    
+    /// The editing modes and view options changed, Value holds them as bits
+    INPUT_EVENT_MODES,
+    
+    /// The vertex color changed, Value holds it as 0xRRGGBBAA
+    INPUT_EVENT_COLOR,
+    
+    /// The edge weight changed to Value
+    INPUT_EVENT_WEIGHT,
+    
+    /// The recording stopped
+    INPUT_EVENT_END,
+    
+    /// Vertex X takes color Value as 0xRRGGBBAA once the colors are applied. Kinds from here on are numbered after
+    /// INPUT_EVENT_END, so recordings made before they were added read the same.
+    INPUT_EVENT_VERTEX_COLOR,
+    
+    /// The colors of the INPUT_EVENT_VERTEX_COLOR events before it were applied to the vertices as one edit
+    INPUT_EVENT_APPLY_COLORS,
+    
+    /// The mouse wheel turned by Value, the bits of a float, over the matrix views at X, Y. The three kinds follow the
+    /// order of MatrixViewWheel.
+    INPUT_EVENT_MATRIX_SCROLL,
+    INPUT_EVENT_MATRIX_SCROLL_SIDEWAYS,
+    INPUT_EVENT_MATRIX_ZOOM,
+    
+    /// The sketch was replaced with the one saved at the sketch path
+    INPUT_EVENT_OPEN,
+    
+    INPUT_EVENT_KIND_COUNT,
+} InputEventKind;
+
+/// A single input, in the frame it was handled in
+typedef struct
+{
+    InputEventKind Kind;
+    
+    /// The frame the event was handled in, counted from 0
+    uint32_t Frame;
+    
+    /// Microseconds since the recording started
+    uint64_t Time;
+    
+    /// Mouse position, in whole pixels
+    int16_t X;
+    int16_t Y;
+    
+    uint32_t Value;
+} InputEvent;
+
+/// A recording of the inputs of a session. Events are stored in the order they were handled, and written as a magic,
+/// a version and then one event after another: its kind, the frames and microseconds since the previous event as
+/// variable length integers, and only the payload its kind uses.
+typedef struct
+{
+    InputEvent *Events;
+    size_t Count;
+    size_t Capacity;
+    
+    /// While recording, the frame events are stamped with and when the first frame began
+    uint32_t Frame;
+    uint64_t StartTime;
+    bool HasStarted;
+    
+    /// While replaying, the next event to hand out
+    size_t Cursor;
+    
+} InputLog;
+
+/// Creates an empty log, ready to record from frame 0
+InputLog *InputLog_CreateInputLog(void);
+
+/// Frees the memory of the log
+void InputLog_FreeInputLog(InputLog *log);
+
+/// Starts recording the next frame. The first call starts frame 0.
+/// - Parameters:
+///   - now: microseconds on a monotonic clock
+void InputLog_BeginFrame(InputLog *log, uint64_t now);
+
+/// Appends an event stamped with the current frame, and the microseconds since the first frame began
+void InputLog_Record(InputLog *log, InputEventKind kind, int16_t x, int16_t y, uint32_t value, uint64_t now);
+
+/// Writes the log in its binary format
+/// - Returns: false if the file could not be written
+bool InputLog_Write(const InputLog *log, FILE *file);
+
+/// Reads a log written by InputLog_Write
+/// - Returns: The log, or NULL if the file is not a log or is truncated
+InputLog *InputLog_Read(FILE *file);
+
+/// Hands out the next event of the frame while replaying
+/// - Returns: The event, or NULL once every event of the frame has been handed out
+const InputEvent *InputLog_Next(InputLog *log, uint32_t frame);
+
+/// - Returns: If every event has been replayed
+bool InputLog_IsFinished(const InputLog *log);
+
+#endif /* InputLog_h */
@@ -0,0 +1,224 @@
+//
+//  Journal.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Journal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../../Graph/Util/Counters.h"
+
+#define JOURNAL_INITIAL_CAPACITY 64
+
+Journal *Journal_CreateJournal(Rectangle sceneBoundingBox)
+{
+    Journal *j = malloc(sizeof(Journal));
+    j->Records = malloc(JOURNAL_INITIAL_CAPACITY * sizeof(JournalRecord));
+    Counters_Add(COUNTER_BYTES_JOURNAL, sizeof(Journal) + JOURNAL_INITIAL_CAPACITY * sizeof(JournalRecord));
+    j->Count = 0;
+    j->Capacity = JOURNAL_INITIAL_CAPACITY;
+    j->Cursor = 0;
+    j->SceneBoundingBox = sceneBoundingBox;
+    return j;
+}
+
+static void _JournalRecord_Free(JournalRecord *record)
+{
+    if (record->Kind == JOURNAL_CLEAR)
+    {
+        GraphSketch_FreeGraphSketch(record->Swapped);
+        record->Swapped = NULL;
+    }
+    else if (record->Kind == JOURNAL_RECOLOR)
+    {
+        free(record->Colors);
+        record->Colors = NULL;
+    }
+}
+
+void Journal_FreeJournal(Journal *j)
+{
+    assert(j != NULL);
+    for (size_t i = 0; i < j->Count; i++)
+    {
+        _JournalRecord_Free(&j->Records[i]);
+    }
+    free(j->Records);
+    free(j);
+}
+
+/// Drops every record that could be redone and appends the new one
+static void _Journal_Push(Journal *j, JournalRecord record)
+{
+    for (size_t i = j->Cursor; i < j->Count; i++)
+    {
+        _JournalRecord_Free(&j->Records[i]);
+    }
+    j->Count = j->Cursor;
+    
+    Journal_EndMove(j);
+    
+    if (j->Count == j->Capacity)
+    {
+        j->Capacity *= 2;
+        j->Records = realloc(j->Records, j->Capacity * sizeof(JournalRecord));
+        Counters_Add(COUNTER_BYTES_JOURNAL, j->Capacity * sizeof(JournalRecord));
+    }
+    j->Records[j->Count++] = record;
+    j->Cursor = j->Count;
+}
+
+VertexIndex Journal_AddVertex(Journal *j, GraphSketch *gs, Vector2 position, Color color)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    VertexIndex vi = GraphSketch_AddVertex(gs, position, color, j->SceneBoundingBox);
+    _Journal_Push(j, (JournalRecord) {.Kind = JOURNAL_ADD_VERTEX, .V1 = vi, .Color = color, .From = position});
+    return vi;
+}
+
+void Journal_AddEdge(Journal *j, GraphSketch *gs, VertexIndex v1, VertexIndex v2, short weight)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    bool wasAdjacent = Graph_IsAdjacent(gs->Graph, v1, v2);
+    GraphSketch_AddEdge(gs, v1, v2, weight);
+    _Journal_Push(j, (JournalRecord) {.Kind = JOURNAL_ADD_EDGE, .V1 = v1, .V2 = v2, .Weight = weight, .WasAdjacent = wasAdjacent});
+}
+
+void Journal_MoveVertex(Journal *j, GraphSketch *gs, VertexIndex vi, Vector2 position)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    Vector2 from = gs->IndexToPrimitiveMap[vi].Centroid;
+    if (from.x == position.x && from.y == position.y) return;
+    
+    GraphSketch_MoveVertex(gs, vi, position);
+    
+    // Merge into the drag in progress
+    JournalRecord *last = j->Cursor > 0 ? &j->Records[j->Cursor - 1] : NULL;
+    if (last != NULL && last->Kind == JOURNAL_MOVE_VERTEX && last->IsOpen && last->V1 == vi)
+    {
+        last->To = position;
+        return;
+    }
+    
+    _Journal_Push(j, (JournalRecord) {.Kind = JOURNAL_MOVE_VERTEX, .V1 = vi, .From = from, .To = position});
+    j->Records[j->Cursor - 1].IsOpen = true;
+}
+
+void Journal_EndMove(Journal *j)
+{
+    assert(j != NULL);
+    if (j->Cursor > 0)
+    {
+        j->Records[j->Cursor - 1].IsOpen = false;
+    }
+}
+
+void Journal_Clear(Journal *j, GraphSketch *gs)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    if (gs->Graph->Vertices == 0) return;
+    
+    // Hand the whole sketch to the record, and start over with an empty one
+    GraphSketch *cleared = malloc(sizeof(GraphSketch));
+    Counters_Add(COUNTER_BYTES_JOURNAL, sizeof(GraphSketch));
+    *cleared = *gs;
+    memset(gs->VertexIndexToDegreeMap, 0, sizeof(gs->VertexIndexToDegreeMap));
+    gs->BvhTree = NULL;
+    gs->Graph = Graph_CreateGraph();
+    
+    _Journal_Push(j, (JournalRecord) {.Kind = JOURNAL_CLEAR, .Swapped = cleared});
+}
+
+void Journal_Recolor(Journal *j, GraphSketch *gs, const Color *colors)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    assert(colors != NULL);
+    
+    const unsigned int count = gs->Graph->Vertices;
+    if (count == 0) return;
+    
+    Color *swapped = malloc(count * sizeof(Color));
+    Counters_Add(COUNTER_BYTES_JOURNAL, count * sizeof(Color));
+    memcpy(swapped, colors, count * sizeof(Color));
+    GraphSketch_SwapVertexColors(gs, swapped, count);
+    
+    _Journal_Push(j, (JournalRecord) {.Kind = JOURNAL_RECOLOR, .Colors = swapped, .ColorCount = count});
+}
+
+static void _GraphSketch_Swap(GraphSketch *a, GraphSketch *b)
+{
+    GraphSketch temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+const JournalRecord *Journal_Undo(Journal *j, GraphSketch *gs)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    if (j->Cursor == 0) return NULL;
+    
+    JournalRecord *record = &j->Records[--j->Cursor];
+    record->IsOpen = false;
+    switch (record->Kind)
+    {
+        case JOURNAL_ADD_VERTEX:
+            GraphSketch_RemoveLastVertex(gs);
+            break;
+        case JOURNAL_ADD_EDGE:
+            GraphSketch_RemoveLastEdge(gs, record->WasAdjacent);
+            break;
+        case JOURNAL_MOVE_VERTEX:
+            GraphSketch_MoveVertex(gs, record->V1, record->From);
+            break;
+        case JOURNAL_CLEAR:
+            _GraphSketch_Swap(gs, record->Swapped);
+            break;
+        case JOURNAL_RECOLOR:
+            GraphSketch_SwapVertexColors(gs, record->Colors, record->ColorCount);
+            break;
+    }
+    return record;
+}
+
+const JournalRecord *Journal_Redo(Journal *j, GraphSketch *gs)
+{
+    assert(j != NULL);
+    assert(gs != NULL);
+    
+    if (j->Cursor == j->Count) return NULL;
+    
+    JournalRecord *record = &j->Records[j->Cursor++];
+    switch (record->Kind)
+    {
+        case JOURNAL_ADD_VERTEX:
+            GraphSketch_AddVertex(gs, record->From, record->Color, j->SceneBoundingBox);
+            break;
+        case JOURNAL_ADD_EDGE:
+            GraphSketch_AddEdge(gs, record->V1, record->V2, record->Weight);
+            break;
+        case JOURNAL_MOVE_VERTEX:
+            GraphSketch_MoveVertex(gs, record->V1, record->To);
+            break;
+        case JOURNAL_CLEAR:
+            _GraphSketch_Swap(gs, record->Swapped);
+            break;
+        case JOURNAL_RECOLOR:
+            GraphSketch_SwapVertexColors(gs, record->Colors, record->ColorCount);
+            break;
+    }
+    return record;
+}
@@ -0,0 +1,105 @@
+//
+//  Journal.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Journal_h
+#define Journal_h
+
+#include "../GraphSketch/GraphSketch.h"
+
+typedef enum
+{
+    JOURNAL_ADD_VERTEX,
+    JOURNAL_ADD_EDGE,
+    JOURNAL_MOVE_VERTEX,
+    JOURNAL_CLEAR,
+    JOURNAL_RECOLOR,
+} JournalRecordKind;
+
+/// A single edit to a graph sketch, holding just enough to apply and revert it in O(1)
+typedef struct
+{
+    JournalRecordKind Kind;
+    
+    /// The vertex added or moved, or the vertices of the edge added
+    VertexIndex V1;
+    VertexIndex V2;
+    
+    /// The weight of the edge added
+    short Weight;
+    
+    /// If V1 was adjacent to V2 before the edge was added
+    bool WasAdjacent;
+    
+    /// A move that is still being dragged, later moves of the same vertex are merged into it
+    bool IsOpen;
+    
+    /// The color of the vertex added
+    Color Color;
+    
+    /// Where the vertex was added, or moved from and to
+    Vector2 From;
+    Vector2 To;
+    
+    /// The other side of a clear. The cleared sketch while applied, the empty one while reverted.
+    GraphSketch *Swapped;
+    
+    /// The other side of a recolor of the first ColorCount vertices. The colors before it while applied, after it while reverted.
+    Color *Colors;
+    unsigned int ColorCount;
+    
+} JournalRecord;
+
+/// An undo/redo history of edits. Records before Cursor are applied, records from Cursor on can be redone.
+typedef struct
+{
+    JournalRecord *Records;
+    size_t Count;
+    size_t Capacity;
+    size_t Cursor;
+    
+    /// The scene vertices are added in, used to create the Bvh Tree when redoing the first vertex
+    Rectangle SceneBoundingBox;
+    
+} Journal;
+
+/// Creates an empty journal
+Journal *Journal_CreateJournal(Rectangle sceneBoundingBox);
+
+/// Frees the memory of the journal and every sketch held by its records
+void Journal_FreeJournal(Journal *j);
+
+/// Adds a vertex to the sketch and records it, dropping everything that could be redone
+/// - Returns: The index of the added vertex
+VertexIndex Journal_AddVertex(Journal *j, GraphSketch *gs, Vector2 position, Color color);
+
+/// Adds an edge to the sketch and records it, dropping everything that could be redone
+void Journal_AddEdge(Journal *j, GraphSketch *gs, VertexIndex v1, VertexIndex v2, short weight);
+
+/// Moves a vertex and records it. Consecutive moves of the same vertex are merged until Journal_EndMove,
+/// so undoing a drag puts the vertex back where the drag started.
+void Journal_MoveVertex(Journal *j, GraphSketch *gs, VertexIndex vi, Vector2 position);
+
+/// Ends the current drag, the next move starts a new record
+void Journal_EndMove(Journal *j);
+
+/// Clears the sketch and records it. The cleared sketch is kept whole, so undoing a clear is a swap rather than a rebuild.
+void Journal_Clear(Journal *j, GraphSketch *gs);
+
+/// Recolors every vertex of the sketch at once and records it, so a single undo brings every previous color back
+/// - Parameters:
+///   - colors: the new color of each vertex of the sketch
+void Journal_Recolor(Journal *j, GraphSketch *gs, const Color *colors);
+
+/// Reverts the last applied record
+/// - Returns: The record reverted, or NULL if there is nothing to undo
+const JournalRecord *Journal_Undo(Journal *j, GraphSketch *gs);
+
+/// Applies the last reverted record again
+/// - Returns: The record applied, or NULL if there is nothing to redo
+const JournalRecord *Journal_Redo(Journal *j, GraphSketch *gs);
+
+#endif /* Journal_h */
@@ -0,0 +1,566 @@
+//
+//  MatrixView.c
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "MatrixView.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <math.h>
+#include "raygui.h"
+#include "raymath.h"
+#include "../../Graph/Util/Profiler.h"
+#include "../../Graph/Util/Counters.h"
+#include "../../Graph/AllPairs.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/// Amount of cells scrolled per mouse wheel step at zoom 1
+#define SCROLL_SPEED 3
+
+MatrixView *MatrixView_CreateMatrixView(MatrixViewKind kind)
+{
+    MatrixView *mv = malloc(sizeof(MatrixView));
+    Counters_Add(COUNTER_BYTES_MATRIX_VIEW, sizeof(MatrixView));
+    mv->Kind = kind;
+    mv->Scroll = (Vector2) {0, 0};
+    mv->Zoom = 1.0f;
+    mv->Rows = 0;
+    mv->Columns = 0;
+    mv->CachedVersion = 0;
+    mv->Bounds = MATRIX_VIEW_MAX_BOUNDS;
+    mv->IsCacheLoaded = false;
+    mv->IsCacheValid = false;
+    mv->Values = NULL;
+    mv->ValuesVersion = 0;
+    mv->IsValuesValid = false;
+    return mv;
+}
+
+void MatrixView_FreeMatrixView(MatrixView *mv)
+{
+    assert(mv != NULL);
+    if (mv->IsCacheLoaded)
+    {
+        UnloadRenderTexture(mv->Cache);
+    }
+    free(mv->Values);
+    free(mv);
+}
+
+void MatrixView_Invalidate(MatrixView *mv)
+{
+    assert(mv != NULL);
+    mv->IsCacheValid = false;
+    mv->IsValuesValid = false;
+}
+
+/// - Returns: true if the cells are found from the whole graph instead of read from its matrices
+static bool _IsDerived(const MatrixView *mv)
+{
+    return mv->Kind == MATRIX_VIEW_DISTANCE || mv->Kind == MATRIX_VIEW_REACHABILITY;
+}
+
+/// Finds the distances or reachability between every two vertices again if the graph changed since they were found
+static void _UpdateValues(MatrixView *mv, const Graph *g)
+{
+    if (!_IsDerived(mv) || (mv->IsValuesValid && mv->ValuesVersion == g->Version)) return;
+    PROFILE_ZONE("MatrixView_UpdateValues");
+    
+    if (mv->Values == NULL)
+    {
+        mv->Values = malloc(GRAPH_MAX_SIZE * GRAPH_MAX_SIZE * sizeof(uint64_t));
+        Counters_Add(COUNTER_BYTES_MATRIX_VIEW, GRAPH_MAX_SIZE * GRAPH_MAX_SIZE * sizeof(uint64_t));
+    }
+    
+    if (mv->Kind == MATRIX_VIEW_DISTANCE)
+    {
+        Graph_AllPairsShortestPaths(g, mv->Values);
+    }
+    else
+    {
+        uint64_t rows[GRAPH_MAX_SIZE * ALL_PAIRS_ROW_WORDS(GRAPH_MAX_SIZE)];
+        Graph_TransitiveClosure(g, rows);
+        for (VertexIndex u = 0; u < g->Vertices; u++)
+        {
+            for (VertexIndex v = 0; v < g->Vertices; v++)
+            {
+                mv->Values[u * g->Vertices + v] = AllPairs_IsReachable(rows, g->Vertices, u, v);
+            }
+        }
+    }
+    
+    mv->ValuesVersion = g->Version;
+    mv->IsValuesValid = true;
+    mv->IsCacheValid = false;
+}
+
+static float _CellWidth(const MatrixView *mv)
+{
+    return MATRIX_VIEW_CELL_WIDTH * mv->Zoom;
+}
+
+static float _CellHeight(const MatrixView *mv)
+{
+    return MATRIX_VIEW_CELL_HEIGHT * mv->Zoom;
+}
+
+/// - Returns: The area inside the bounds that cells are drawn in
+static Rectangle _Body(Rectangle bounds)
+{
+    return (Rectangle)
+    {
+        .x = bounds.x + MATRIX_VIEW_PADDING,
+        .y = bounds.y + MATRIX_VIEW_PADDING,
+        .width = bounds.width - 2 * MATRIX_VIEW_PADDING,
+        .height = bounds.height - 2 * MATRIX_VIEW_PADDING
+    };
+}
+
+/// - Returns: The zoom at which the entire matrix fits in the largest view, or 1 if it already fits
+static float _MinZoom(const MatrixView *mv)
+{
+    Rectangle body = _Body(MATRIX_VIEW_MAX_BOUNDS);
+    float fitX = body.width / (MAX(mv->Columns, 1) * MATRIX_VIEW_CELL_WIDTH);
+    float fitY = body.height / (MAX(mv->Rows, 1) * MATRIX_VIEW_CELL_HEIGHT);
+    return MIN(1.0f, MIN(fitX, fitY));
+}
+
+MatrixViewMode MatrixView_Mode(const MatrixView *mv)
+{
+    assert(mv != NULL);
+    float cellSize = MIN(_CellWidth(mv), _CellHeight(mv));
+    if (cellSize >= MATRIX_VIEW_TEXT_MIN_CELL_HEIGHT) return MATRIX_VIEW_MODE_TEXT;
+    if (cellSize >= MATRIX_VIEW_HEAT_MAP_MAX_CELL_SIZE) return MATRIX_VIEW_MODE_SPARSE;
+    return MATRIX_VIEW_MODE_HEAT_MAP;
+}
+
+void MatrixView_HandleWheel(MatrixView *mv, Vector2 mousePosition, float wheel, MatrixViewWheel action)
+{
+    assert(mv != NULL);
+    
+    if (wheel == 0 || !CheckCollisionPointRec(mousePosition, mv->Bounds)) return;
+    
+    if (action == MATRIX_VIEW_WHEEL_ZOOM)
+    {
+        // Zoom around the cell under the mouse
+        Rectangle body = _Body(mv->Bounds);
+        Vector2 cell =
+        {
+            mv->Scroll.x + (mousePosition.x - body.x) / _CellWidth(mv),
+            mv->Scroll.y + (mousePosition.y - body.y) / _CellHeight(mv)
+        };
+        mv->Zoom = Clamp(mv->Zoom * (wheel > 0 ? 1.25f : 0.8f), _MinZoom(mv), MATRIX_VIEW_MAX_ZOOM);
+        mv->Scroll.x = cell.x - (mousePosition.x - body.x) / _CellWidth(mv);
+        mv->Scroll.y = cell.y - (mousePosition.y - body.y) / _CellHeight(mv);
+    }
+    else if (action == MATRIX_VIEW_WHEEL_SCROLL_SIDEWAYS)
+    {
+        mv->Scroll.x -= wheel * SCROLL_SPEED / mv->Zoom;
+    }
+    else
+    {
+        mv->Scroll.y -= wheel * SCROLL_SPEED / mv->Zoom;
+    }
+    
+    mv->IsCacheValid = false;
+}
+
+/// - Returns: The text of a cell, valid until the next call
+static const char *_CellText(const MatrixView *mv, const Graph *g, unsigned int row, unsigned int column)
+{
+    switch (mv->Kind)
+    {
+        case MATRIX_VIEW_ADJACENCY:
+            return TextFormat("%d", g->AdjMatrix[row][column]);
+        case MATRIX_VIEW_INCIDENCE:
+            return TextFormat("%d", g->IncidenceMatrix[row][column]);
+        case MATRIX_VIEW_DISTANCE:
+        case MATRIX_VIEW_REACHABILITY:
+        {
+            uint64_t value = mv->Values[row * mv->Columns + column];
+            return value == SHORTEST_PATHS_UNREACHED ? "-" : TextFormat("%llu", (unsigned long long) value);
+        }
+    }
+    return "";
+}
+
+/// Finds the range of cells at least partially inside the body
+static void _VisibleCells(const MatrixView *mv, Rectangle body, unsigned int *firstRow, unsigned int *lastRow,
+                          unsigned int *firstColumn, unsigned int *lastColumn)
+{
+    *firstRow = mv->Scroll.y;
+    *firstColumn = mv->Scroll.x;
+    *lastRow = MIN(mv->Rows, *firstRow + (unsigned int) ceilf(body.height / _CellHeight(mv)) + 1);
+    *lastColumn = MIN(mv->Columns, *firstColumn + (unsigned int) ceilf(body.width / _CellWidth(mv)) + 1);
+}
+
+/// Clears a single cell back to the background
+static void _ClearCell(const MatrixView *mv, unsigned int row, unsigned int column)
+{
+    const float cellWidth = _CellWidth(mv);
+    const float cellHeight = _CellHeight(mv);
+    DrawRectangleRec((Rectangle) { (column - mv->Scroll.x) * cellWidth, (row - mv->Scroll.y) * cellHeight, cellWidth, cellHeight }, BLACK);
+}
+
+/// Clears every visible cell of a row back to the background
+static void _ClearRow(const MatrixView *mv, Rectangle body, unsigned int row)
+{
+    DrawRectangleRec((Rectangle) { 0, (row - mv->Scroll.y) * _CellHeight(mv), body.width, _CellHeight(mv) }, BLACK);
+}
+
+/// Clears every visible cell of a column back to the background
+static void _ClearColumn(const MatrixView *mv, Rectangle body, unsigned int column)
+{
+    DrawRectangleRec((Rectangle) { (column - mv->Scroll.x) * _CellWidth(mv), 0, _CellWidth(mv), body.height }, BLACK);
+}
+
+/// Draws the number of a single cell over whatever was previously drawn there
+static void _DrawTextCell(const MatrixView *mv, const Graph *g, unsigned int row, unsigned int column)
+{
+    const float cellHeight = _CellHeight(mv);
+    float x = (column - mv->Scroll.x) * _CellWidth(mv);
+    float y = (row - mv->Scroll.y) * cellHeight;
+    _ClearCell(mv, row, column);
+    DrawText(_CellText(mv, g, row, column), x, y, cellHeight, RAYWHITE);
+}
+
+/// Draws the number of every visible cell, reading the values straight from the graph
+static void _DrawTextCells(const MatrixView *mv, const Graph *g, Rectangle body)
+{
+    unsigned int firstRow, lastRow, firstColumn, lastColumn;
+    _VisibleCells(mv, body, &firstRow, &lastRow, &firstColumn, &lastColumn);
+    
+    for (unsigned int row = firstRow; row < lastRow; row++)
+    {
+        for (unsigned int column = firstColumn; column < lastColumn; column++)
+        {
+            _DrawTextCell(mv, g, row, column);
+        }
+    }
+}
+
+typedef void (*MatrixViewCellCallback)(const MatrixView*, Rectangle, unsigned int, unsigned int, int, void*);
+
+/// Calls draw for every non zero cell an edge contributes to the matrix
+static void _ForEachNonZeroCellOfEdge(const MatrixView *mv, const GraphSketch *gs, Rectangle body, EdgeIndex e,
+                                      MatrixViewCellCallback draw, void *context)
+{
+    const DrawableEdge *de = &gs->DrawableEdgeList[e];
+    if (mv->Kind == MATRIX_VIEW_ADJACENCY)
+    {
+        draw(mv, body, de->V1, de->V2, 1, context);
+        return;
+    }
+    draw(mv, body, de->V1, e, gs->Graph->IncidenceMatrix[de->V1][e], context);
+    
+    // Self loops only have a single entry in their column
+    if (de->V1 != de->V2)
+    {
+        draw(mv, body, de->V2, e, gs->Graph->IncidenceMatrix[de->V2][e], context);
+    }
+}
+
+/// Calls draw for every non zero cell of the matrix, walking the edge list instead of every cell.
+/// Of distances, every pair with a path is drawn.
+static void _ForEachNonZeroCell(const MatrixView *mv, const GraphSketch *gs, Rectangle body,
+                                MatrixViewCellCallback draw, void *context)
+{
+    if (_IsDerived(mv))
+    {
+        const uint64_t none = mv->Kind == MATRIX_VIEW_DISTANCE ? SHORTEST_PATHS_UNREACHED : 0;
+        for (unsigned int row = 0; row < mv->Rows; row++)
+        {
+            for (unsigned int column = 0; column < mv->Columns; column++)
+            {
+                if (mv->Values[row * mv->Columns + column] != none) draw(mv, body, row, column, 1, context);
+            }
+        }
+        return;
+    }
+    
+    for (EdgeIndex e = 0; e < gs->Graph->Edges; e++)
+    {
+        _ForEachNonZeroCellOfEdge(mv, gs, body, e, draw, context);
+    }
+}
+
+static void _DrawBlock(const MatrixView *mv, Rectangle body, unsigned int row, unsigned int column, int value, void *_)
+{
+    const float cellWidth = _CellWidth(mv);
+    const float cellHeight = _CellHeight(mv);
+    float x = (column - mv->Scroll.x) * cellWidth;
+    float y = (row - mv->Scroll.y) * cellHeight;
+    if (x + cellWidth < 0 || y + cellHeight < 0 || x > body.width || y > body.height) return;
+    
+    Rectangle block = { x, y, MAX(cellWidth - 1, 1), MAX(cellHeight - 1, 1) };
+    DrawRectangleRec(block, value > 0 ? RAYWHITE : SKYBLUE);
+}
+
+typedef struct
+{
+    unsigned int *Bins;
+    unsigned int Width;
+    unsigned int Height;
+    unsigned int MaxBin;
+} HeatMap;
+
+static void _BinCell(const MatrixView *mv, Rectangle body, unsigned int row, unsigned int column, int _, void *context)
+{
+    HeatMap *hm = context;
+    float x = (column - mv->Scroll.x) * _CellWidth(mv);
+    float y = (row - mv->Scroll.y) * _CellHeight(mv);
+    if (x < 0 || y < 0 || x >= hm->Width || y >= hm->Height) return;
+    
+    unsigned int *bin = &hm->Bins[(unsigned int) y * hm->Width + (unsigned int) x];
+    (*bin)++;
+    hm->MaxBin = MAX(hm->MaxBin, *bin);
+}
+
+/// Bins every non zero cell into the pixel it falls on, coloring pixels from blue (sparse) to red (dense)
+static void _DrawHeatMap(const MatrixView *mv, const GraphSketch *gs, Rectangle body)
+{
+    HeatMap hm = { .Width = body.width, .Height = body.height, .MaxBin = 0 };
+    hm.Bins = calloc(hm.Width * hm.Height, sizeof(unsigned int));
+    Counters_Add(COUNTER_BYTES_MATRIX_VIEW, hm.Width * hm.Height * sizeof(unsigned int));
+    
+    _ForEachNonZeroCell(mv, gs, body, _BinCell, &hm);
+    
+    const float scale = log1pf(hm.MaxBin);
+    for (unsigned int y = 0; y < hm.Height; y++)
+    {
+        for (unsigned int x = 0; x < hm.Width; x++)
+        {
+            unsigned int bin = hm.Bins[y * hm.Width + x];
+            if (bin == 0) continue;
+            float density = log1pf(bin) / scale;
+            DrawRectangle(x, y, 1, 1, ColorFromHSV(240 * (1 - density), 1, 1));
+        }
+    }
+    
+    free(hm.Bins);
+}
+
+/// Redraws the visible cells into the cache texture
+static void _RenderCache(MatrixView *mv, const GraphSketch *gs)
+{
+    PROFILE_ZONE("MatrixView_RenderCache");
+    Rectangle body = _Body(mv->Bounds);
+    
+    BeginTextureMode(mv->Cache);
+    ClearBackground(BLACK);
+    switch (MatrixView_Mode(mv))
+    {
+        case MATRIX_VIEW_MODE_TEXT:
+            _DrawTextCells(mv, gs->Graph, body);
+            break;
+        case MATRIX_VIEW_MODE_SPARSE:
+            _ForEachNonZeroCell(mv, gs, body, _DrawBlock, NULL);
+            break;
+        case MATRIX_VIEW_MODE_HEAT_MAP:
+            _DrawHeatMap(mv, gs, body);
+            break;
+    }
+    EndTextureMode();
+    
+    mv->IsCacheValid = true;
+}
+
+/// Redraws the visible cells of a single change
+static void _PatchTextCells(const MatrixView *mv, const Graph *g, Rectangle body, const GraphChange *change)
+{
+    unsigned int firstRow, lastRow, firstColumn, lastColumn;
+    _VisibleCells(mv, body, &firstRow, &lastRow, &firstColumn, &lastColumn);
+    
+    switch (change->Kind)
+    {
+        case GRAPH_CHANGE_ADD_VERTEX:
+            // A new vertex is a new row of both matrices, and a new column of the adjacency matrix
+            if (change->V1 >= firstRow && change->V1 < lastRow)
+            {
+                for (unsigned int column = firstColumn; column < lastColumn; column++)
+                {
+                    _DrawTextCell(mv, g, change->V1, column);
+                }
+            }
+            if (mv->Kind == MATRIX_VIEW_ADJACENCY && change->V1 >= firstColumn && change->V1 < lastColumn)
+            {
+                for (unsigned int row = firstRow; row < lastRow; row++)
+                {
+                    _DrawTextCell(mv, g, row, change->V1);
+                }
+            }
+            break;
+            
+        case GRAPH_CHANGE_ADD_EDGE:
+            // A new edge is a single adjacency entry, or a new column of the incidence matrix
+            if (mv->Kind == MATRIX_VIEW_ADJACENCY)
+            {
+                if (change->V1 >= firstRow && change->V1 < lastRow && change->V2 >= firstColumn && change->V2 < lastColumn)
+                {
+                    _DrawTextCell(mv, g, change->V1, change->V2);
+                }
+                break;
+            }
+            if (change->E >= firstColumn && change->E < lastColumn)
+            {
+                for (unsigned int row = firstRow; row < lastRow; row++)
+                {
+                    _DrawTextCell(mv, g, row, change->E);
+                }
+            }
+            break;
+            
+        case GRAPH_CHANGE_REMOVE_VERTEX:
+            // Only the last vertex is removed, its row (and adjacency column) is now past the end of the matrix
+            _ClearRow(mv, body, change->V1);
+            if (mv->Kind == MATRIX_VIEW_ADJACENCY) _ClearColumn(mv, body, change->V1);
+            break;
+            
+        case GRAPH_CHANGE_REMOVE_EDGE:
+            // Only the last edge is removed, its incidence column is now past the end of the matrix
+            if (mv->Kind == MATRIX_VIEW_INCIDENCE)
+            {
+                _ClearColumn(mv, body, change->E);
+                break;
+            }
+            if (change->V1 >= firstRow && change->V1 < lastRow && change->V2 >= firstColumn && change->V2 < lastColumn)
+            {
+                _DrawTextCell(mv, g, change->V1, change->V2);
+            }
+            break;
+    }
+}
+
+/// Redraws the blocks of a single change
+static void _PatchSparseCells(const MatrixView *mv, const GraphSketch *gs, Rectangle body, const GraphChange *change)
+{
+    const Graph *g = gs->Graph;
+    switch (change->Kind)
+    {
+        case GRAPH_CHANGE_ADD_EDGE:
+            _ForEachNonZeroCellOfEdge(mv, gs, body, change->E, _DrawBlock, NULL);
+            break;
+            
+        case GRAPH_CHANGE_REMOVE_EDGE:
+            if (mv->Kind == MATRIX_VIEW_INCIDENCE)
+            {
+                _ClearColumn(mv, body, change->E);
+                break;
+            }
+            
+            // A parallel edge keeps the vertices adjacent
+            _ClearCell(mv, change->V1, change->V2);
+            if (change->V1 < g->Vertices && change->V2 < g->Vertices && g->AdjMatrix[change->V1][change->V2])
+            {
+                _DrawBlock(mv, body, change->V1, change->V2, 1, NULL);
+            }
+            break;
+            
+        // Vertices are only added or removed without edges, which have no blocks
+        case GRAPH_CHANGE_ADD_VERTEX:
+        case GRAPH_CHANGE_REMOVE_VERTEX:
+            break;
+    }
+}
+
+/// Redraws only the cells touched by the graph changes since the cache was drawn
+/// - Returns: false if the changes can not be patched, and the whole cache must be redrawn
+static bool _PatchCache(MatrixView *mv, const GraphSketch *gs)
+{
+    PROFILE_ZONE("MatrixView_PatchCache");
+    const Graph *g = gs->Graph;
+    const MatrixViewMode mode = MatrixView_Mode(mv);
+    
+    // Heat map bins can not be updated in place, and any edge may change every distance
+    if (mode == MATRIX_VIEW_MODE_HEAT_MAP || _IsDerived(mv)) return false;
+    
+    if (mv->CachedVersion > g->Version) return false;
+    for (unsigned long version = mv->CachedVersion + 1; version <= g->Version; version++)
+    {
+        if (Graph_ChangeAt(g, version) == NULL) return false;
+    }
+    
+    Rectangle body = _Body(mv->Bounds);
+    BeginTextureMode(mv->Cache);
+    for (unsigned long version = mv->CachedVersion + 1; version <= g->Version; version++)
+    {
+        const GraphChange *change = Graph_ChangeAt(g, version);
+        if (mode == MATRIX_VIEW_MODE_TEXT)
+        {
+            _PatchTextCells(mv, g, body, change);
+        }
+        else
+        {
+            _PatchSparseCells(mv, gs, body, change);
+        }
+    }
+    EndTextureMode();
+    
+    return true;
+}
+
+void MatrixView_Draw(MatrixView *mv, const GraphSketch *gs)
+{
+    assert(mv != NULL);
+    assert(gs != NULL);
+    
+    mv->Rows = gs->Graph->Vertices;
+    mv->Columns = mv->Kind == MATRIX_VIEW_INCIDENCE ? gs->Graph->Edges : gs->Graph->Vertices;
+    _UpdateValues(mv, gs->Graph);
+    
+    // Shrink the view around the matrix when it fits on screen
+    const Rectangle maxBounds = MATRIX_VIEW_MAX_BOUNDS;
+    Rectangle bounds = maxBounds;
+    bounds.width = MIN(maxBounds.width, mv->Columns * _CellWidth(mv) + 2 * MATRIX_VIEW_PADDING);
+    bounds.height = MIN(maxBounds.height, mv->Rows * _CellHeight(mv) + 2 * MATRIX_VIEW_PADDING);
+    if (bounds.width != mv->Bounds.width || bounds.height != mv->Bounds.height)
+    {
+        mv->Bounds = bounds;
+        mv->IsCacheValid = false;
+    }
+    
+    // Never scroll past the last page of cells
+    Rectangle body = _Body(mv->Bounds);
+    Vector2 scroll =
+    {
+        Clamp(mv->Scroll.x, 0, MAX(0, mv->Columns - body.width / _CellWidth(mv))),
+        Clamp(mv->Scroll.y, 0, MAX(0, mv->Rows - body.height / _CellHeight(mv)))
+    };
+    if (scroll.x != mv->Scroll.x || scroll.y != mv->Scroll.y)
+    {
+        mv->Scroll = scroll;
+        mv->IsCacheValid = false;
+    }
+    
+    if (!mv->IsCacheLoaded)
+    {
+        mv->Cache = LoadRenderTexture(maxBounds.width, maxBounds.height);
+        mv->IsCacheLoaded = true;
+        mv->IsCacheValid = false;
+    }
+    
+    // Only the cells touched since the last draw are redrawn, while the view is hidden nothing is
+    if (mv->IsCacheValid && mv->CachedVersion != gs->Graph->Version && !_PatchCache(mv, gs))
+    {
+        mv->IsCacheValid = false;
+    }
+    
+    if (!mv->IsCacheValid)
+    {
+        _RenderCache(mv, gs);
+    }
+    mv->CachedVersion = gs->Graph->Version;
+    
+    // Render textures are stored upside down, so the top rows of the texture are at the bottom
+    const float textureHeight = mv->Cache.texture.height;
+    Rectangle source = { 0, textureHeight - body.height, body.width, -body.height };
+    DrawTextureRec(mv->Cache.texture, source, (Vector2) { body.x, body.y }, WHITE);
+    
+    const char *titles[] = { "Adjacency Matrix", "Incidence Matrix", "Distance Matrix", "Reachability Matrix" };
+    const char *title = titles[mv->Kind];
+    GuiGroupBox(mv->Bounds, TextFormat("%s (%u x %u)", title, mv->Rows, mv->Columns));
+}
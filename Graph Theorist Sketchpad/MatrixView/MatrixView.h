@@ -0,0 +1,116 @@
+//
+//  MatrixView.h
+//  Graph Theorist Sketchpad
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef MatrixView_h
+#define MatrixView_h
+
+#include "../GraphSketch/GraphSketch.h"
+
+#define MATRIX_VIEW_CELL_WIDTH 25
+#define MATRIX_VIEW_CELL_HEIGHT 15
+#define MATRIX_VIEW_PADDING 10
+#define MATRIX_VIEW_MIN_ZOOM 0.01f
+#define MATRIX_VIEW_MAX_ZOOM 2.0f
+
+/// Cells smaller than this (in pixels) are drawn as blocks instead of numbers
+#define MATRIX_VIEW_TEXT_MIN_CELL_HEIGHT 10
+
+/// Cells smaller than this (in pixels) are binned into a heat map
+#define MATRIX_VIEW_HEAT_MAP_MAX_CELL_SIZE 1.0f
+
+/// The largest area of the screen a matrix view may cover
+#define MATRIX_VIEW_MAX_BOUNDS ((Rectangle) {.x = 10, .y = 5, .width = 580, .height = 435})
+
+typedef enum
+{
+    MATRIX_VIEW_ADJACENCY,
+    MATRIX_VIEW_INCIDENCE,
+    
+    /// The total weight of a shortest path from each vertex to each other, - if there is none
+    MATRIX_VIEW_DISTANCE,
+    
+    /// 1 where a path of at least one edge leads from a vertex to another
+    MATRIX_VIEW_REACHABILITY,
+} MatrixViewKind;
+
+typedef enum
+{
+    /// Every visible cell is drawn as a number
+    MATRIX_VIEW_MODE_TEXT,
+    
+    /// Only non zero cells are drawn, as colored blocks
+    MATRIX_VIEW_MODE_SPARSE,
+    
+    /// Non zero cells are binned per pixel and colored by density
+    MATRIX_VIEW_MODE_HEAT_MAP,
+} MatrixViewMode;
+
+/// What a turn of the mouse wheel does to the view
+typedef enum
+{
+    MATRIX_VIEW_WHEEL_SCROLL,
+    
+    /// Shift is held
+    MATRIX_VIEW_WHEEL_SCROLL_SIDEWAYS,
+    
+    /// Control is held
+    MATRIX_VIEW_WHEEL_ZOOM,
+} MatrixViewWheel;
+
+/// A scrollable, zoomable window over the adjacency or incidence matrix of a graph sketch, or the distances and reachability
+/// between its vertices. Only the visible cells are drawn. Graph changes since the last draw are patched into the cached texture
+/// cell by cell, every other frame just blits it. A single edge can change every distance, so those are found again and redrawn.
+typedef struct
+{
+    MatrixViewKind Kind;
+    
+    /// The top left visible cell, in cells
+    Vector2 Scroll;
+    
+    /// Scale of a cell relative to MATRIX_VIEW_CELL_WIDTH x MATRIX_VIEW_CELL_HEIGHT
+    float Zoom;
+    
+    /// Dimensions of the matrix at the last draw
+    unsigned int Rows;
+    unsigned int Columns;
+    
+    /// The bounds the view was last drawn in, used for hit testing input
+    Rectangle Bounds;
+    
+    /// The visible cells as of CachedVersion of the graph
+    RenderTexture2D Cache;
+    unsigned long CachedVersion;
+    bool IsCacheLoaded;
+    bool IsCacheValid;
+    
+    /// The cells of distance and reachability views as of ValuesVersion of the graph, Rows x Columns row major
+    uint64_t *Values;
+    unsigned long ValuesVersion;
+    bool IsValuesValid;
+    
+} MatrixView;
+
+/// Creates a new matrix view scrolled to the top left at zoom 1. The cache texture is loaded on first draw.
+MatrixView *MatrixView_CreateMatrixView(MatrixViewKind kind);
+
+/// Frees the memory of the matrix view and its cache texture. Must be called before the window is closed.
+void MatrixView_FreeMatrixView(MatrixView *mv);
+
+/// Marks the cached cells as stale, so they are all redrawn (and distances found again) from the graph on the next draw.
+/// Only needed when the graph is replaced, changes to the same graph are picked up through its version.
+void MatrixView_Invalidate(MatrixView *mv);
+
+/// Scrolls down by a turn of the mouse wheel, sideways, or zooms around the cell under the mouse, when the mouse is over the view
+void MatrixView_HandleWheel(MatrixView *mv, Vector2 mousePosition, float wheel, MatrixViewWheel action);
+
+/// - Returns: How cells are drawn at the current zoom
+MatrixViewMode MatrixView_Mode(const MatrixView *mv);
+
+/// Draws the visible cells of the matrix
+void MatrixView_Draw(MatrixView *mv, const GraphSketch *gs);
+
+#endif /* MatrixView_h */
@@ -9,16 +9,28 @@
 #include <raylib.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include <string.h>
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"
+#include "../../Graph/Util/Profiler.h"
+#include "../../Graph/Util/Counters.h"
 #define HAS_COLLISION(ret) (ret >= 0)
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
 
 SceneController *SceneController_CreateSceneController(void)
 {
     SceneController *sc = malloc(sizeof(SceneController));
     
-    sc->AdjMatrixDumpBuffer[0] = '\0';
-    sc->IncidenceMatrixDumpBuffer[0] = '\0';
+    sc->Journal = Journal_CreateJournal(GRAPH_SKETCH_BOUNDING_BOX);
+    sc->Commands = CommandQueue_CreateCommandQueue();
+    sc->Analytics = Analytics_CreateAnalytics();
+    sc->AdjMatrixView = MatrixView_CreateMatrixView(MATRIX_VIEW_ADJACENCY);
+    sc->IncidenceMatrixView = MatrixView_CreateMatrixView(MATRIX_VIEW_INCIDENCE);
+    sc->DistanceMatrixView = MatrixView_CreateMatrixView(MATRIX_VIEW_DISTANCE);
+    sc->ReachabilityMatrixView = MatrixView_CreateMatrixView(MATRIX_VIEW_REACHABILITY);
     sc->VertexWeightInputBuffer[0] = '1';
     sc->VertexWeightInputBuffer[1] = '\0';
     
@@ -33,19 +45,49 @@ SceneController *SceneController_CreateSceneController(void)
     sc->ShowBvhTree = false;
     sc->ShowAdjMatrix = false;
     sc->ShowIncidenceMatrix = false;
+    sc->ShowDistanceMatrix = false;
+    sc->ShowReachability = false;
     sc->ShowVertices = true;
     sc->ShowEdges = true;
     sc->ShowDirection = true;
     sc->ShowDegrees = false;
     sc->ShowMST = false;
+    sc->ShowShortestPath = false;
+    sc->ShowBridges = false;
+    sc->ShowStrongComponents = false;
+    sc->ShowEuler = false;
+    sc->ShowColoring = false;
+    sc->ShowClique = false;
+    sc->ShowMinCut = false;
+    sc->ShowMatching = false;
+    sc->ShowProfiler = false;
+    sc->ShowCounters = false;
     
     sc->VertexColor = RAYWHITE;
     
+    sc->PathEndpointCount = 0;
+    
+    sc->EulerVersion = 0;
+    sc->EulerFrame = 0;
+    
+    sc->MousePosition = (Vector2) {0, 0};
+    sc->Recording = NULL;
+    sc->RecordedModes = 0;
+    sc->RecordedColor = BLANK;
+    sc->RecordedWeight = 0;
+    
     return sc;
 }
 
 void SceneController_FreeSceneController(SceneController *sc)
 {
+    Journal_FreeJournal(sc->Journal);
+    CommandQueue_FreeCommandQueue(sc->Commands);
+    Analytics_FreeAnalytics(sc->Analytics);
+    MatrixView_FreeMatrixView(sc->AdjMatrixView);
+    MatrixView_FreeMatrixView(sc->IncidenceMatrixView);
+    MatrixView_FreeMatrixView(sc->DistanceMatrixView);
+    MatrixView_FreeMatrixView(sc->ReachabilityMatrixView);
     free(sc);
 }
 
@@ -61,18 +103,288 @@ static Rectangle _MouseBoundingBox(SceneController *sc, Vector2 mousePosition)
 static int _CheckMouseCollision(SceneController *sc, GraphSketch *gs)
 {
     if (gs->BvhTree == NULL) return -1;
-    Rectangle mouseBoundingBox = _MouseBoundingBox(sc, GetMousePosition());
+    Rectangle mouseBoundingBox = _MouseBoundingBox(sc, sc->MousePosition);
     int vi = BvhTree_CheckCollision(gs->BvhTree, mouseBoundingBox);
     return vi;
 }
 
+/// The modes and view options recorded as bits of INPUT_EVENT_MODES, in bit order
+#define SCENE_CONTROLLER_MODE_COUNT 23
+static void _SceneController_Modes(SceneController *sc, bool *modes[SCENE_CONTROLLER_MODE_COUNT])
+{
+    bool *all[SCENE_CONTROLLER_MODE_COUNT] =
+    {
+        &sc->IsInVertexCreationMode, &sc->IsInEdgeCreationMode, &sc->IsInVertexMoveMode,
+        &sc->ShowBvhTree, &sc->ShowAdjMatrix, &sc->ShowIncidenceMatrix, &sc->ShowVertices, &sc->ShowEdges,
+        &sc->ShowDirection, &sc->ShowDegrees, &sc->ShowMST, &sc->ShowProfiler, &sc->ShowCounters,
+        &sc->ShowShortestPath, &sc->ShowDistanceMatrix, &sc->ShowReachability, &sc->ShowBridges,
+        &sc->ShowStrongComponents, &sc->ShowEuler, &sc->ShowColoring, &sc->ShowClique, &sc->ShowMinCut,
+        &sc->ShowMatching,
+    };
+    memcpy(modes, all, sizeof(all));
+}
+
+/// The highlights drawn in place of the sketch, at most one at a time, in the order of the highlight combo box
+#define SCENE_CONTROLLER_HIGHLIGHT_COUNT 9
+#define SCENE_CONTROLLER_HIGHLIGHT_NAMES "No Highlight;Show MST;Shortest Path;Bridges;Strong Components;Euler Trail;Coloring;Max Clique;Min Cut;Matching"
+static void _SceneController_Highlights(SceneController *sc, bool *highlights[SCENE_CONTROLLER_HIGHLIGHT_COUNT])
+{
+    bool *all[SCENE_CONTROLLER_HIGHLIGHT_COUNT] = {
+        &sc->ShowMST, &sc->ShowShortestPath, &sc->ShowBridges, &sc->ShowStrongComponents, &sc->ShowEuler,
+        &sc->ShowColoring, &sc->ShowClique, &sc->ShowMinCut, &sc->ShowMatching,
+    };
+    memcpy(highlights, all, sizeof(all));
+}
+
+/// The matrix views, at most one shown at a time as they cover the same area, in the order of the matrix combo box
+#define SCENE_CONTROLLER_MATRIX_COUNT 4
+#define SCENE_CONTROLLER_MATRIX_NAMES "No Matrix;Adjacency Matrix;Incidence Matrix;Distance Matrix;Reachability"
+static void _SceneController_Matrices(SceneController *sc, bool *shows[SCENE_CONTROLLER_MATRIX_COUNT],
+                                      MatrixView *views[SCENE_CONTROLLER_MATRIX_COUNT])
+{
+    bool *allShows[SCENE_CONTROLLER_MATRIX_COUNT] =
+    {
+        &sc->ShowAdjMatrix, &sc->ShowIncidenceMatrix, &sc->ShowDistanceMatrix, &sc->ShowReachability,
+    };
+    MatrixView *allViews[SCENE_CONTROLLER_MATRIX_COUNT] =
+    {
+        sc->AdjMatrixView, sc->IncidenceMatrixView, sc->DistanceMatrixView, sc->ReachabilityMatrixView,
+    };
+    memcpy(shows, allShows, sizeof(allShows));
+    memcpy(views, allViews, sizeof(allViews));
+}
+
+/// Draws a combo box choosing at most one of the options, the first of the names choosing none
+static void _SceneController_ChooseOne(Rectangle bounds, const char *names, bool *options[], int count)
+{
+    int chosen = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (*options[i]) chosen = i + 1;
+    }
+    GuiComboBox(bounds, names, &chosen);
+    for (int i = 0; i < count; i++)
+    {
+        *options[i] = chosen == i + 1;
+    }
+}
+
+static void _SceneController_Record(SceneController *sc, InputEventKind kind, uint32_t value)
+{
+    if (sc->Recording == NULL) return;
+    int16_t x = sc->MousePosition.x;
+    int16_t y = sc->MousePosition.y;
+    InputLog_Record(sc->Recording, kind, x, y, value, Profiler_Now() / 1000);
+}
+
+/// Colors the vertices with AppliedColors as one edit
+static void _SceneController_RecolorVertices(SceneController *sc, GraphSketch *gs)
+{
+    _SceneController_Record(sc, INPUT_EVENT_APPLY_COLORS, 0);
+    SceneController_ApplyCommands(sc, gs);
+    Journal_Recolor(sc->Journal, gs, sc->AppliedColors);
+}
+
+void SceneController_BeginFrame(SceneController *sc, Vector2 mousePosition)
+{
+    assert(sc != NULL);
+    if (sc->Recording == NULL)
+    {
+        sc->MousePosition = mousePosition;
+        return;
+    }
+    
+    InputLog_BeginFrame(sc->Recording, Profiler_Now() / 1000);
+    
+    // The GUI changed these while the last frame was drawn, they apply from this frame on
+    bool *modes[SCENE_CONTROLLER_MODE_COUNT];
+    _SceneController_Modes(sc, modes);
+    uint32_t bits = 0;
+    for (int i = 0; i < SCENE_CONTROLLER_MODE_COUNT; i++) bits |= (uint32_t) *modes[i] << i;
+    if (bits != sc->RecordedModes)
+    {
+        sc->RecordedModes = bits;
+        _SceneController_Record(sc, INPUT_EVENT_MODES, bits);
+    }
+    
+    if (ColorToInt(sc->VertexColor) != ColorToInt(sc->RecordedColor))
+    {
+        sc->RecordedColor = sc->VertexColor;
+        _SceneController_Record(sc, INPUT_EVENT_COLOR, (uint32_t) ColorToInt(sc->VertexColor));
+    }
+    
+    int weight = TextToInteger(sc->VertexWeightInputBuffer);
+    if (weight != sc->RecordedWeight)
+    {
+        sc->RecordedWeight = weight;
+        _SceneController_Record(sc, INPUT_EVENT_WEIGHT, (uint32_t) weight);
+    }
+    
+    // Whole pixels, so the recorded session sees the same positions the replay does
+    mousePosition = (Vector2) {roundf(mousePosition.x), roundf(mousePosition.y)};
+    if (mousePosition.x != sc->MousePosition.x || mousePosition.y != sc->MousePosition.y)
+    {
+        sc->MousePosition = mousePosition;
+        _SceneController_Record(sc, INPUT_EVENT_MOUSE_MOVE, 0);
+    }
+}
+
+/// Picks the vertex under the mouse as the source of the shortest path and the minimum cut, or as their target once a source is picked
+/// - Returns: false if the mouse is not on a vertex
+static bool _SceneController_PickPathEndpoint(SceneController *sc, GraphSketch *gs)
+{
+    if (gs->BvhTree == NULL || sc->MousePosition.x >= GUI_BOUNDING_BOX.x) return false;
+    
+    Rectangle mouseBoundingBox = EDGE_CREATION_BOUNDING_BOX(sc->MousePosition);
+    int vi = BvhTree_CheckCollision(gs->BvhTree, mouseBoundingBox);
+    if (!HAS_COLLISION(vi)) return false;
+    
+    if (sc->PathEndpointCount == 1)
+    {
+        sc->PathTarget = vi;
+        sc->PathEndpointCount = 2;
+    }
+    else
+    {
+        sc->PathSource = vi;
+        sc->PathEndpointCount = 1;
+    }
+    return true;
+}
+
+void SceneController_HandlePress(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    _SceneController_Record(sc, INPUT_EVENT_MOUSE_PRESS, 0);
+    
+    // While the shortest path or the minimum cut is shown, clicking a vertex picks an endpoint instead of editing
+    if ((sc->ShowShortestPath || sc->ShowMinCut) && !sc->IsInEdgeCreationState && !sc->IsInVertexMoveState &&
+        _SceneController_PickPathEndpoint(sc, gs))
+    {
+        return;
+    }
+    
+    if (sc->IsInEdgeCreationMode)
+    {
+        SceneController_CreateEdge(sc, gs);
+    }
+    
+    else if (sc->IsInVertexCreationMode)
+    {
+        SceneController_CreateVertex(sc, gs);
+    }
+    
+    else if (sc->IsInVertexMoveMode)
+    {
+        SceneController_MoveVertex(sc, gs);
+    }
+}
+
+void SceneController_TurnWheel(SceneController *sc, float wheel, MatrixViewWheel action)
+{
+    assert(sc != NULL);
+    
+    uint32_t bits;
+    memcpy(&bits, &wheel, sizeof(bits));
+    _SceneController_Record(sc, INPUT_EVENT_MATRIX_SCROLL + action, bits);
+    
+    bool *matrixShows[SCENE_CONTROLLER_MATRIX_COUNT];
+    MatrixView *matrixViews[SCENE_CONTROLLER_MATRIX_COUNT];
+    _SceneController_Matrices(sc, matrixShows, matrixViews);
+    for (int i = 0; i < SCENE_CONTROLLER_MATRIX_COUNT; i++)
+    {
+        if (*matrixShows[i]) MatrixView_HandleWheel(matrixViews[i], sc->MousePosition, wheel, action);
+    }
+}
+
+void SceneController_ReplayEvent(SceneController *sc, GraphSketch *gs, const InputEvent *event)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    assert(event != NULL);
+    
+    switch (event->Kind)
+    {
+        case INPUT_EVENT_MOUSE_MOVE:
+            sc->MousePosition = (Vector2) {event->X, event->Y};
+            break;
+        
+        case INPUT_EVENT_MOUSE_PRESS:
+            sc->MousePosition = (Vector2) {event->X, event->Y};
+            SceneController_HandlePress(sc, gs);
+            break;
+        
+        case INPUT_EVENT_UNDO:
+            SceneController_Undo(sc, gs);
+            break;
+        
+        case INPUT_EVENT_REDO:
+            SceneController_Redo(sc, gs);
+            break;
+        
+        case INPUT_EVENT_CLEAR:
+            SceneController_ClearAll(sc, gs);
+            break;
+        
+        case INPUT_EVENT_MODES:
+        {
+            bool *modes[SCENE_CONTROLLER_MODE_COUNT];
+            _SceneController_Modes(sc, modes);
+            for (int i = 0; i < SCENE_CONTROLLER_MODE_COUNT; i++) *modes[i] = event->Value >> i & 1;
+            break;
+        }
+        
+        case INPUT_EVENT_COLOR:
+            sc->VertexColor = GetColor(event->Value);
+            break;
+        
+        case INPUT_EVENT_WEIGHT:
+            snprintf(sc->VertexWeightInputBuffer, sizeof(sc->VertexWeightInputBuffer), "%d", (int) event->Value);
+            break;
+        
+        case INPUT_EVENT_VERTEX_COLOR:
+            if (event->X >= 0 && event->X < GRAPH_MAX_SIZE) sc->AppliedColors[event->X] = GetColor(event->Value);
+            break;
+        
+        case INPUT_EVENT_APPLY_COLORS:
+            _SceneController_RecolorVertices(sc, gs);
+            break;
+        
+        case INPUT_EVENT_MATRIX_SCROLL:
+        case INPUT_EVENT_MATRIX_SCROLL_SIDEWAYS:
+        case INPUT_EVENT_MATRIX_ZOOM:
+        {
+            float wheel;
+            memcpy(&wheel, &event->Value, sizeof(wheel));
+            sc->MousePosition = (Vector2) {event->X, event->Y};
+            SceneController_TurnWheel(sc, wheel, event->Kind - INPUT_EVENT_MATRIX_SCROLL);
+            break;
+        }
+        
+        case INPUT_EVENT_OPEN:
+            SceneController_Open(sc, gs);
+            break;
+        
+        default:
+            break;
+    }
+}
+
+void SceneController_ApplyCommands(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    CommandQueue_Apply(sc->Commands, sc->Journal, gs);
+}
+
 void SceneController_CreateEdge(SceneController *sc, GraphSketch *gs)
 {
     assert(sc != NULL);
     assert(gs != NULL);
     assert(sc->IsInEdgeCreationMode);
     if (gs->BvhTree == NULL) return;
-    if (GetMousePosition().x >= GUI_BOUNDING_BOX.x) return;
+    if (sc->MousePosition.x >= GUI_BOUNDING_BOX.x) return;
     
     int vi = _CheckMouseCollision(sc, gs);
     if (!HAS_COLLISION(vi))
@@ -95,10 +407,8 @@ void SceneController_CreateEdge(SceneController *sc, GraphSketch *gs)
     VertexIndex v1 = sc->EdgeCreationStateOriginVertexIndex;
     VertexIndex v2 = vi;
     int weight = TextToInteger(sc->VertexWeightInputBuffer);
-    GraphSketch_AddEdge(gs, v1, v2, weight == 0 ? 1 : weight);
+    CommandQueue_AddEdge(sc->Commands, v1, v2, weight == 0 ? 1 : weight);
     
-    Graph_DumpAdjMatrix(gs->Graph, sc->AdjMatrixDumpBuffer);
-    Graph_DumpIncidenceMatrix(gs->Graph, sc->IncidenceMatrixDumpBuffer);
     sc->IsInEdgeCreationState = false;
     GuiUnlock();
 }
@@ -114,12 +424,10 @@ void SceneController_CreateVertex(SceneController *sc, GraphSketch *gs)
     // No vertices on top of each other
     if (HAS_COLLISION(vi)) return;
     
-    Vector2 mousePosition = GetMousePosition();
+    Vector2 mousePosition = sc->MousePosition;
     if (mousePosition.x < (GRAPH_SKETCH_BOUNDING_BOX.width - GRAPH_VERTEX_RADIUS))
     {
-        GraphSketch_AddVertex(gs, mousePosition, sc->VertexColor, GRAPH_SKETCH_BOUNDING_BOX);
-        Graph_DumpAdjMatrix(gs->Graph, sc->AdjMatrixDumpBuffer);
-        Graph_DumpIncidenceMatrix(gs->Graph, sc->IncidenceMatrixDumpBuffer);
+        CommandQueue_AddVertex(sc->Commands, mousePosition, sc->VertexColor);
     }
 }
 
@@ -129,7 +437,7 @@ void SceneController_MoveVertex(SceneController *sc, GraphSketch *gs)
     assert(gs != NULL);
     assert(sc->IsInVertexMoveMode);
     
-    if (GetMousePosition().x + GRAPH_VERTEX_RADIUS >= GUI_BOUNDING_BOX.x)
+    if (sc->MousePosition.x + GRAPH_VERTEX_RADIUS >= GUI_BOUNDING_BOX.x)
     {
         return;
     }
@@ -137,12 +445,8 @@ void SceneController_MoveVertex(SceneController *sc, GraphSketch *gs)
     if (sc->IsInVertexMoveState)
     {
         
-        // Reset bounding box position
-        Primitive p = gs->IndexToPrimitiveMap[sc->VertexMoveStateIndex];
-        gs->IndexToPrimitiveMap[sc->VertexMoveStateIndex] = Primitive_CreatePrimitive(p.Centroid, p.VertexIndex);
-        
-        // Reset BVH tree with new pos
-        GraphSketch_RefreshBvhTree(gs, SCENE_BOUNDING_BOX);
+        // The vertex has followed the mouse through the journal, dropping it ends the drag
+        CommandQueue_EndMove(sc->Commands);
         
         // Unlock GUI
         sc->IsInVertexMoveState = false;
@@ -158,16 +462,381 @@ void SceneController_MoveVertex(SceneController *sc, GraphSketch *gs)
     GuiLock();
 }
 
+#ifndef PROFILER_DISABLED
+/// Draws the time of the last frames as bars, and the zones the last frame spent the most time in
+static void _SceneController_DrawProfiler(void)
+{
+    const ProfilerFrames *frames = Profiler_Frames();
+    if (frames->Count == 0) return;
+    
+    const Rectangle bounds = PROFILER_OVERLAY_BOUNDING_BOX;
+    const float barHeight = 40;
+    DrawRectangleRec(bounds, Fade(BLACK, 0.7f));
+    
+    // Bars are scaled so a frame at the target frame rate reaches half way
+    double maxDuration = 0;
+    double totalDuration = 0;
+    unsigned long shown = MIN(frames->Count, PROFILER_FRAME_HISTORY);
+    for (unsigned long i = 0; i < shown; i++)
+    {
+        unsigned long frame = frames->Count - shown + i;
+        double duration = frames->Durations[frame % PROFILER_FRAME_HISTORY] / 1e6;
+        float height = MIN(barHeight, duration / (2 * PROFILER_OVERLAY_TARGET_MS) * barHeight);
+        DrawRectangle(bounds.x + 5 + i * 2, bounds.y + 5 + barHeight - height, 2, height,
+                      duration > PROFILER_OVERLAY_TARGET_MS ? RED : GREEN);
+        maxDuration = MAX(maxDuration, duration);
+        totalDuration += duration;
+    }
+    DrawLine(bounds.x + 5, bounds.y + 5 + barHeight / 2, bounds.x + bounds.width - 5, bounds.y + 5 + barHeight / 2, GRAY);
+    
+    int y = bounds.y + barHeight + 10;
+    DrawText(TextFormat("frame %.2f ms avg  %.2f ms max", totalDuration / shown, maxDuration), bounds.x + 5, y, 10, RAYWHITE);
+    for (size_t z = 0; z < frames->ZoneCount && z < PROFILER_OVERLAY_ZONES; z++)
+    {
+        y += 10;
+        DrawText(TextFormat("%s %.2f ms", frames->Zones[z].Name, frames->Zones[z].Total / 1e6), bounds.x + 5, y, 10, LIGHTGRAY);
+    }
+}
+#endif
+
+/// - Returns: numerator / denominator, or 0 if nothing was counted
+static double _CounterAverage(CounterKind numerator, CounterKind denominator)
+{
+    unsigned long long count = Counters_Get(denominator);
+    return count == 0 ? 0 : (double) Counters_Get(numerator) / count;
+}
+
+/// Draws the performance counters accumulated since startup
+static void _SceneController_DrawCounters(void)
+{
+    const Rectangle bounds = COUNTERS_HUD_BOUNDING_BOX;
+    DrawRectangleRec(bounds, Fade(BLACK, 0.7f));
+    
+    const unsigned long long bytes = Counters_Get(COUNTER_BYTES_GRAPH) + Counters_Get(COUNTER_BYTES_BVH)
+        + Counters_Get(COUNTER_BYTES_GRAPH_SKETCH) + Counters_Get(COUNTER_BYTES_JOURNAL)
+        + Counters_Get(COUNTER_BYTES_ANALYTICS) + Counters_Get(COUNTER_BYTES_MATRIX_VIEW);
+    
+    // TextFormat reuses a handful of buffers, so each line is drawn before the next is formatted
+    int y = bounds.y + 5;
+    DrawText(TextFormat("bvh queries %llu  %.1f nodes  %.1f tests", Counters_Get(COUNTER_BVH_QUERIES),
+                        _CounterAverage(COUNTER_BVH_NODES_VISITED, COUNTER_BVH_QUERIES),
+                        _CounterAverage(COUNTER_BVH_PRIMITIVE_TESTS, COUNTER_BVH_QUERIES)), bounds.x + 5, y, 10, RAYWHITE);
+    y += 11;
+    DrawText(TextFormat("bvh rebuilds %llu  %.3f ms each", Counters_Get(COUNTER_BVH_REBUILDS),
+                        _CounterAverage(COUNTER_BVH_REBUILD_NANOSECONDS, COUNTER_BVH_REBUILDS) / 1e6), bounds.x + 5, y, 10, RAYWHITE);
+    y += 11;
+    DrawText(TextFormat("degree queries %llu  %.1f edges", Counters_Get(COUNTER_DEGREE_QUERIES),
+                        _CounterAverage(COUNTER_DEGREE_EDGES_SCANNED, COUNTER_DEGREE_QUERIES)), bounds.x + 5, y, 10, RAYWHITE);
+    y += 11;
+    DrawText(TextFormat("mst computations %llu", Counters_Get(COUNTER_MST_COMPUTATIONS)), bounds.x + 5, y, 10, RAYWHITE);
+    y += 11;
+    DrawText(TextFormat("allocated %.1f KB  graph %.1f KB  bvh %.1f KB", bytes / 1024.0,
+                        Counters_Get(COUNTER_BYTES_GRAPH) / 1024.0, Counters_Get(COUNTER_BYTES_BVH) / 1024.0),
+             bounds.x + 5, y, 10, RAYWHITE);
+}
+
+/// Draws the vertices, the picked endpoints and the shortest path between them of the latest analysis
+static void _SceneController_DrawShortestPath(SceneController *sc, GraphSketch *gs)
+{
+    // Undo may have taken an endpoint away
+    if (sc->PathEndpointCount > 0 && sc->PathSource >= gs->Graph->Vertices) sc->PathEndpointCount = 0;
+    if (sc->PathEndpointCount > 1 && sc->PathTarget >= gs->Graph->Vertices) sc->PathEndpointCount = 1;
+    
+    const bool isPath = sc->PathEndpointCount == 2;
+    if (isPath) Analytics_RequestBetween(sc->Analytics, ANALYTICS_SHORTEST_PATH, gs->Graph, sc->PathSource, sc->PathTarget);
+    
+    // The analysis may be of an older version of the graph, but a path between other endpoints is never drawn
+    const AnalyticsTask *path = Analytics_Result(sc->Analytics, ANALYTICS_SHORTEST_PATH);
+    if (path != NULL && (path->Source != sc->PathSource || path->Target != sc->PathTarget)) path = NULL;
+    
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (isPath && path != NULL && path->HasPath) GraphSketch_DrawMST(gs, path->PathEdges);
+    
+    const VertexIndex endpoints[2] = { sc->PathSource, sc->PathTarget };
+    for (unsigned int i = 0; i < sc->PathEndpointCount; i++)
+    {
+        DrawCircleLinesV(gs->IndexToPrimitiveMap[endpoints[i]].Centroid, GRAPH_VERTEX_RADIUS + 4, i == 0 ? GREEN : RED);
+    }
+    
+    const char *status = "Click a vertex to start the shortest path";
+    if (sc->PathEndpointCount == 1) status = "Click a vertex to end the shortest path";
+    else if (isPath && path == NULL) status = "Finding the path...";
+    else if (isPath && !path->HasPath) status = TextFormat("No path from v%u to v%u", sc->PathSource, sc->PathTarget);
+    if (!isPath || path == NULL || !path->HasPath) DrawText(status, 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
+/// Draws the vertices, the picked endpoints and the minimum cut between them of the latest analysis
+static void _SceneController_DrawMinCut(SceneController *sc, GraphSketch *gs)
+{
+    // Undo may have taken an endpoint away
+    if (sc->PathEndpointCount > 0 && sc->PathSource >= gs->Graph->Vertices) sc->PathEndpointCount = 0;
+    if (sc->PathEndpointCount > 1 && sc->PathTarget >= gs->Graph->Vertices) sc->PathEndpointCount = 1;
+    
+    const bool isCut = sc->PathEndpointCount == 2 && sc->PathSource != sc->PathTarget;
+    if (isCut) Analytics_RequestBetween(sc->Analytics, ANALYTICS_MIN_CUT, gs->Graph, sc->PathSource, sc->PathTarget);
+    
+    // The analysis may be of an older version of the graph, but a cut between other endpoints is never drawn
+    const AnalyticsTask *cut = Analytics_Result(sc->Analytics, ANALYTICS_MIN_CUT);
+    if (cut != NULL && (cut->Source != sc->PathSource || cut->Target != sc->PathTarget)) cut = NULL;
+    
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (isCut && cut != NULL) GraphSketch_DrawMST(gs, cut->CutEdges);
+    
+    const VertexIndex endpoints[2] = { sc->PathSource, sc->PathTarget };
+    for (unsigned int i = 0; i < sc->PathEndpointCount; i++)
+    {
+        DrawCircleLinesV(gs->IndexToPrimitiveMap[endpoints[i]].Centroid, GRAPH_VERTEX_RADIUS + 4, i == 0 ? GREEN : RED);
+    }
+    
+    const char *status = "Click a vertex to start the cut";
+    if (sc->PathEndpointCount == 1) status = "Click a vertex to end the cut";
+    else if (sc->PathEndpointCount == 2 && !isCut) status = "Click two different vertices to cut between";
+    else if (isCut && cut == NULL) status = "Cutting...";
+    else if (isCut) status = TextFormat("Max flow from v%u to v%u = %llu", sc->PathSource, sc->PathTarget, cut->CutFlow);
+    DrawText(status, 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
+/// Draws the vertices and the edges of the maximum matching of the latest analysis, the lightest one when the graph is bipartite
+static void _SceneController_DrawMatching(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_MATCHING, gs->Graph);
+    const AnalyticsTask *matching = Analytics_Result(sc->Analytics, ANALYTICS_MATCHING);
+    
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (matching == NULL) return;
+    GraphSketch_DrawMST(gs, matching->MatchingEdges);
+    
+    const char *status = "Maximum matching of %u edges";
+    if (matching->IsMatchingBipartite) status = "Assignment of %u pairs, total weight %llu";
+    DrawText(TextFormat(status, matching->MatchingCount, matching->MatchingWeight), 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
+/// Draws the bridges of the latest analysis over the vertices, ringing the cut vertices
+static void _SceneController_DrawBridges(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_BRIDGES, gs->Graph);
+    const AnalyticsTask *bridges = Analytics_Result(sc->Analytics, ANALYTICS_BRIDGES);
+    
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (bridges == NULL) return;
+    GraphSketch_DrawMST(gs, bridges->Bridges);
+    
+    // The analysis may be of an older version of the graph
+    for (VertexIndex v = 0; v < gs->Graph->Vertices; v++)
+    {
+        if (bridges->IsCutVertex[v]) DrawCircleLinesV(gs->IndexToPrimitiveMap[v].Centroid, GRAPH_VERTEX_RADIUS + 4, RED);
+    }
+}
+
+/// A color for each class of a numbering, golden angle steps of hue keep neighboring numbers apart
+static Color _SceneController_ClassColor(unsigned int i)
+{
+    return ColorFromHSV(fmodf(i * 137.5f, 360.0f), 0.7f, 0.95f);
+}
+
+/// Draws each vertex in the color of its strongly connected component of the latest analysis, with the critical path
+/// over the edges if the graph is acyclic
+static void _SceneController_DrawStrongComponents(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_STRONG_COMPONENTS, gs->Graph);
+    const AnalyticsTask *strong = Analytics_Result(sc->Analytics, ANALYTICS_STRONG_COMPONENTS);
+    
+    if (sc->ShowEdges) GraphSketch_DrawEdges(gs);
+    if (strong != NULL && strong->IsAcyclic) GraphSketch_DrawMST(gs, strong->CriticalPath);
+    
+    for (VertexIndex v = 0; sc->ShowVertices && v < gs->Graph->Vertices; v++)
+    {
+        DrawableVertex dv = gs->IndexToDrawableVertexMap[v];
+        unsigned int component = strong != NULL ? strong->StrongComponents[v] : UINT_MAX;
+        if (component != UINT_MAX) dv.Color = _SceneController_ClassColor(component);
+        DrawableVertex_Draw(&dv, &gs->IndexToPrimitiveMap[v]);
+    }
+    
+    if (strong == NULL) return;
+    const char *status = TextFormat("Strong components = %u   Critical path weight = %llu", strong->StrongComponentCount,
+                                    strong->CriticalPathWeight);
+    if (!strong->IsAcyclic) status = TextFormat("Strong components = %u   No critical path, the graph has a cycle",
+                                                strong->StrongComponentCount);
+    DrawText(status, 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
+/// Frames each edge of the Euler trail is drawn for before the next, and edges worth of frames the whole trail stays up
+#define SCENE_CONTROLLER_EULER_FRAMES_PER_EDGE 20
+#define SCENE_CONTROLLER_EULER_PAUSE 3
+
+/// Draws the Euler trail of the latest analysis one edge at a time over the sketch, from the vertex ringed in green to the one
+/// ringed in yellow. The trail is only found again when the graph changes.
+static void _SceneController_DrawEuler(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_EULER, gs->Graph);
+    const AnalyticsTask *euler = Analytics_Result(sc->Analytics, ANALYTICS_EULER);
+    
+    if (sc->ShowEdges) GraphSketch_DrawEdges(gs);
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (euler == NULL) return;
+    
+    if (euler->EulerWalk == EULER_NONE)
+    {
+        DrawText("No walk takes every edge once", 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+        return;
+    }
+    
+    if (euler->Version != sc->EulerVersion)
+    {
+        sc->EulerVersion = euler->Version;
+        sc->EulerFrame = 0;
+    }
+    unsigned int length = 0;
+    while (euler->EulerTrail[length] != MST_NO_EDGE) length++;
+    const unsigned int frames = (length + SCENE_CONTROLLER_EULER_PAUSE) * SCENE_CONTROLLER_EULER_FRAMES_PER_EDGE;
+    sc->EulerFrame = (sc->EulerFrame + 1) % frames;
+    unsigned int shown = sc->EulerFrame / SCENE_CONTROLLER_EULER_FRAMES_PER_EDGE;
+    if (shown > length) shown = length;
+    
+    // The edges walked so far, and the vertex the walk is at. The trail may be of an older version of the graph.
+    EdgeIndex walked[GRAPH_MAX_SIZE + 1];
+    VertexIndex at = euler->EulerStart;
+    for (unsigned int i = 0; i < shown; i++)
+    {
+        const EdgeIndex e = euler->EulerTrail[i];
+        walked[i] = e;
+        if (e >= gs->Graph->Edges) continue;
+        const DrawableEdge de = gs->DrawableEdgeList[e];
+        at = de.V1 == at ? de.V2 : de.V1;
+    }
+    walked[shown] = MST_NO_EDGE;
+    GraphSketch_DrawMST(gs, walked);
+    
+    const VertexIndex ends[2] = { euler->EulerStart, at };
+    const Color colors[2] = { GREEN, YELLOW };
+    for (int i = 0; i < 2; i++)
+    {
+        if (ends[i] >= gs->Graph->Vertices) continue;
+        DrawCircleLinesV(gs->IndexToPrimitiveMap[ends[i]].Centroid, GRAPH_VERTEX_RADIUS + 4, colors[i]);
+    }
+    
+    DrawText(TextFormat("Euler %s %s direction, edge %u of %u", euler->EulerWalk == EULER_CIRCUIT ? "circuit" : "trail",
+                        euler->IsEulerDirected ? "following" : "ignoring", shown, length),
+             10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
+/// Draws each vertex in the color the latest coloring gives it, without changing the sketch until the coloring is applied
+static void _SceneController_DrawColoring(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_COLORING, gs->Graph);
+    const AnalyticsTask *coloring = Analytics_Result(sc->Analytics, ANALYTICS_COLORING);
+    
+    if (sc->ShowEdges) GraphSketch_DrawEdges(gs);
+    for (VertexIndex v = 0; sc->ShowVertices && v < gs->Graph->Vertices; v++)
+    {
+        DrawableVertex dv = gs->IndexToDrawableVertexMap[v];
+        unsigned int color = coloring != NULL ? coloring->Colors[v] : UINT_MAX;
+        if (color != UINT_MAX) dv.Color = _SceneController_ClassColor(color);
+        DrawableVertex_Draw(&dv, &gs->IndexToPrimitiveMap[v]);
+    }
+    
+    const char *status = "Coloring...";
+    if (coloring != NULL && coloring->IsColoringOptimal) status = TextFormat("Chromatic number = %u", coloring->ColorCount);
+    else if (coloring != NULL) status = TextFormat("At most %u colors, the search ran out of time", coloring->ColorCount);
+    if (Analytics_IsRunning(sc->Analytics, ANALYTICS_COLORING)) status = TextFormat("%s   Coloring...", status);
+    if (coloring != NULL || Analytics_IsRunning(sc->Analytics, ANALYTICS_COLORING))
+    {
+        DrawText(status, 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+    }
+}
+
+/// Draws the edges of the largest clique of the latest analysis over the vertices, ringing its vertices
+static void _SceneController_DrawClique(SceneController *sc, GraphSketch *gs)
+{
+    Analytics_Request(sc->Analytics, ANALYTICS_CLIQUE, gs->Graph);
+    const AnalyticsTask *clique = Analytics_Result(sc->Analytics, ANALYTICS_CLIQUE);
+    
+    if (sc->ShowVertices) GraphSketch_DrawVertices(gs);
+    if (clique == NULL) return;
+    
+    // The clique may be of an older version of the graph
+    bool isInClique[GRAPH_MAX_SIZE] = {0};
+    for (unsigned int i = 0; i < clique->CliqueSize; i++)
+    {
+        const VertexIndex v = clique->Clique[i];
+        if (v >= gs->Graph->Vertices) continue;
+        isInClique[v] = true;
+    }
+    EdgeIndex edges[GRAPH_MAX_SIZE];
+    unsigned int count = 0;
+    for (EdgeIndex e = 0; e < gs->Graph->Edges; e++)
+    {
+        const DrawableEdge de = gs->DrawableEdgeList[e];
+        if (de.V1 != de.V2 && isInClique[de.V1] && isInClique[de.V2]) edges[count++] = e;
+    }
+    if (count < GRAPH_MAX_SIZE) edges[count] = MST_NO_EDGE;
+    GraphSketch_DrawMST(gs, edges);
+    for (VertexIndex v = 0; v < gs->Graph->Vertices; v++)
+    {
+        if (isInClique[v]) DrawCircleLinesV(gs->IndexToPrimitiveMap[v].Centroid, GRAPH_VERTEX_RADIUS + 4, YELLOW);
+    }
+    
+    const char *status = TextFormat("Maximum clique = %u", clique->CliqueSize);
+    if (!clique->IsCliqueOptimal) status = TextFormat("Clique of %u, the search ran out of time", clique->CliqueSize);
+    DrawText(status, 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+}
+
 void SceneController_DrawScene(SceneController *sc, GraphSketch *gs)
 {
+    PROFILE_ZONE("SceneController_DrawScene");
     assert(sc != NULL);
     assert(gs != NULL);
     
-    const Vector2 mousePosition = GetMousePosition();
+    const Vector2 mousePosition = sc->MousePosition;
+    
+    // Derived structures catch up with the edits of the frame once, before anything is drawn from them
+    SceneController_ApplyCommands(sc, gs);
+    
+    Analytics_Poll(sc->Analytics);
     
     if (sc->ShowMST)
     {
-        GraphSketch_DrawMST(gs);
+        // Draw the latest tree while a newer one is computed
+        Analytics_Request(sc->Analytics, ANALYTICS_MST, gs->Graph);
+        const AnalyticsTask *mst = Analytics_Result(sc->Analytics, ANALYTICS_MST);
+        if (mst != NULL) GraphSketch_DrawMST(gs, mst->MstEdges);
+        
+        if (Analytics_IsRunning(sc->Analytics, ANALYTICS_MST))
+        {
+            DrawText("Computing MST...", 10, GUI_BOUNDING_BOX.height - 20, 10, GRAY);
+        }
+    }
+    else if (sc->ShowShortestPath)
+    {
+        _SceneController_DrawShortestPath(sc, gs);
+    }
+    else if (sc->ShowBridges)
+    {
+        _SceneController_DrawBridges(sc, gs);
+    }
+    else if (sc->ShowStrongComponents)
+    {
+        _SceneController_DrawStrongComponents(sc, gs);
+    }
+    else if (sc->ShowEuler)
+    {
+        _SceneController_DrawEuler(sc, gs);
+    }
+    else if (sc->ShowColoring)
+    {
+        _SceneController_DrawColoring(sc, gs);
+    }
+    else if (sc->ShowClique)
+    {
+        _SceneController_DrawClique(sc, gs);
+    }
+    else if (sc->ShowMinCut)
+    {
+        _SceneController_DrawMinCut(sc, gs);
+    }
+    else if (sc->ShowMatching)
+    {
+        _SceneController_DrawMatching(sc, gs);
     }
     else
     {
@@ -191,27 +860,52 @@ void SceneController_DrawScene(SceneController *sc, GraphSketch *gs)
         }
     }
     
-    if (sc->ShowAdjMatrix) GraphSketch_DrawAdjMatrix(gs, sc->AdjMatrixDumpBuffer);
-    
-    if (sc->ShowIncidenceMatrix) GraphSketch_DrawIncidenceMatrix(gs, sc->IncidenceMatrixDumpBuffer);
+    bool *matrixShows[SCENE_CONTROLLER_MATRIX_COUNT];
+    MatrixView *matrixViews[SCENE_CONTROLLER_MATRIX_COUNT];
+    _SceneController_Matrices(sc, matrixShows, matrixViews);
+    for (int i = 0; i < SCENE_CONTROLLER_MATRIX_COUNT; i++)
+    {
+        if (*matrixShows[i]) MatrixView_Draw(matrixViews[i], gs);
+    }
     
     if (sc->ShowDegrees) GraphSketch_DrawDegrees(gs);
     
-    char text[25] = "";
-    sprintf(text, "|V| = %u   |E| = %u", gs->Graph->Vertices, gs->Graph->Edges);
+#ifndef PROFILER_DISABLED
+    if (sc->ShowProfiler) _SceneController_DrawProfiler();
+#endif
+    
+    if (sc->ShowCounters) _SceneController_DrawCounters();
+    
+    // The count of the latest finished version, it only lags for the frame the analysis takes
+    Analytics_Request(sc->Analytics, ANALYTICS_COMPONENTS, gs->Graph);
+    const AnalyticsTask *components = Analytics_Result(sc->Analytics, ANALYTICS_COMPONENTS);
+    char text[64] = "";
+    sprintf(text, "|V| = %u   |E| = %u   Components = %u", gs->Graph->Vertices, gs->Graph->Edges,
+            components != NULL ? components->ComponentCount : 0);
     DrawText(text, GUI_BOUNDING_BOX.x - MeasureText(text, 15) - 10, 10, 15, RAYWHITE);
     
     DrawRectangleRec(GUI_BOUNDING_BOX, Fade(LIGHTGRAY, 0.3f));
     GuiCheckBox((Rectangle){ 630, 15, 20, 20 }, "Show BVH Tree", &sc->ShowBvhTree);
-    GuiCheckBox((Rectangle){ 630, 45, 20, 20 }, "Show Adjacency Matrix", &sc->ShowAdjMatrix);
-    GuiCheckBox((Rectangle){ 630, 75, 20, 20 }, "Show Vertices", &sc->ShowVertices);
-    GuiCheckBox((Rectangle){ 630, 105, 20, 20 }, "Show Incidence Matrix", &sc->ShowIncidenceMatrix);
-    GuiCheckBox((Rectangle){ 630, 135, 20, 20 }, "Show Edges", &sc->ShowEdges);
-    GuiCheckBox((Rectangle){ 630, 165, 20, 20 }, "Show Degrees", &sc->ShowDegrees);
-    GuiCheckBox((Rectangle){ 630, 195, 20, 20 }, "Show MST", &sc->ShowMST);
+    GuiCheckBox((Rectangle){ 630, 45, 20, 20 }, "Show Vertices", &sc->ShowVertices);
+    GuiCheckBox((Rectangle){ 630, 75, 20, 20 }, "Show Edges", &sc->ShowEdges);
+    GuiCheckBox((Rectangle){ 630, 105, 20, 20 }, "Show Degrees", &sc->ShowDegrees);
+    
+    // One matrix at a time is drawn over the sketch
+    _SceneController_ChooseOne((Rectangle){ 630, 135, 140, 20 }, SCENE_CONTROLLER_MATRIX_NAMES, matrixShows,
+                               SCENE_CONTROLLER_MATRIX_COUNT);
     
-    GuiColorPicker((Rectangle){ 630, 230, 100, 50 }, "", &sc->VertexColor);
+    // One highlight at a time is drawn in place of the sketch
+    bool *highlights[SCENE_CONTROLLER_HIGHLIGHT_COUNT];
+    _SceneController_Highlights(sc, highlights);
+    _SceneController_ChooseOne((Rectangle){ 630, 165, 140, 20 }, SCENE_CONTROLLER_HIGHLIGHT_NAMES, highlights,
+                               SCENE_CONTROLLER_HIGHLIGHT_COUNT);
     
+    GuiColorPicker((Rectangle){ 630, 200, 100, 50 }, "", &sc->VertexColor);
+    
+    if (sc->ShowColoring && GuiButton((Rectangle){ 630, 260, 140, 20 }, "Apply Colors"))
+    {
+        SceneController_ApplyColoring(sc, gs);
+    }
     
     GuiGroupBox((Rectangle){ 630, 290, 140, 30 }, "Weight");
     if (GuiTextBox((Rectangle){ 635, 295, 130, 20 }, sc->VertexWeightInputBuffer, 3, sc->IsInEditWeightMode))
@@ -283,16 +977,124 @@ void SceneController_DrawScene(SceneController *sc, GraphSketch *gs)
     {
         if (mousePosition.x + GRAPH_VERTEX_RADIUS < GUI_BOUNDING_BOX.x)
         {
-            gs->IndexToPrimitiveMap[sc->VertexMoveStateIndex].Centroid = GetMousePosition();
+            CommandQueue_MoveVertex(sc->Commands, sc->VertexMoveStateIndex, mousePosition);
         }
     }
 }
 
+/// The sketch now holds a different graph, whose versions have nothing to do with the cached ones
+static void _SceneController_GraphReplaced(SceneController *sc)
+{
+    Analytics_Reset(sc->Analytics);
+    sc->PathEndpointCount = 0;
+    sc->EulerVersion = 0;
+    sc->EulerFrame = 0;
+    MatrixView_Invalidate(sc->AdjMatrixView);
+    MatrixView_Invalidate(sc->IncidenceMatrixView);
+    MatrixView_Invalidate(sc->DistanceMatrixView);
+    MatrixView_Invalidate(sc->ReachabilityMatrixView);
+}
+
 void SceneController_ClearAll(SceneController *sc, GraphSketch *gs)
 {
     assert(sc != NULL);
     assert(gs != NULL);
-    GraphSketch_Reset(gs);
-    sc->AdjMatrixDumpBuffer[0] = '\0';
-    sc->IncidenceMatrixDumpBuffer[0] = '\0';
+    _SceneController_Record(sc, INPUT_EVENT_CLEAR, 0);
+    SceneController_ApplyCommands(sc, gs);
+    Journal_Clear(sc->Journal, gs);
+    _SceneController_GraphReplaced(sc);
+}
+
+void SceneController_ApplyColoring(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    SceneController_ApplyCommands(sc, gs);
+    
+    // A coloring of an older version may be missing vertices, or color neighbors alike
+    const AnalyticsTask *coloring = Analytics_Result(sc->Analytics, ANALYTICS_COLORING);
+    if (coloring == NULL || coloring->Version != gs->Graph->Version) return;
+    
+    for (VertexIndex v = 0; v < gs->Graph->Vertices; v++)
+    {
+        sc->AppliedColors[v] = _SceneController_ClassColor(coloring->Colors[v]);
+        if (sc->Recording == NULL) continue;
+        InputLog_Record(sc->Recording, INPUT_EVENT_VERTEX_COLOR, (int16_t) v, 0, (uint32_t) ColorToInt(sc->AppliedColors[v]),
+                        Profiler_Now() / 1000);
+    }
+    _SceneController_RecolorVertices(sc, gs);
+}
+
+/// Drops an edge creation in progress and drops a moving vertex where it is, so only whole edits are undone
+static void _SceneController_EndEditStates(SceneController *sc)
+{
+    if (sc->IsInVertexMoveState)
+    {
+        Journal_EndMove(sc->Journal);
+        sc->IsInVertexMoveState = false;
+    }
+    sc->IsInEdgeCreationState = false;
+    GuiUnlock();
+}
+
+void SceneController_Undo(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    _SceneController_Record(sc, INPUT_EVENT_UNDO, 0);
+    SceneController_ApplyCommands(sc, gs);
+    _SceneController_EndEditStates(sc);
+    
+    const JournalRecord *record = Journal_Undo(sc->Journal, gs);
+    if (record != NULL && record->Kind == JOURNAL_CLEAR) _SceneController_GraphReplaced(sc);
+}
+
+void SceneController_Redo(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    _SceneController_Record(sc, INPUT_EVENT_REDO, 0);
+    SceneController_ApplyCommands(sc, gs);
+    _SceneController_EndEditStates(sc);
+    
+    const JournalRecord *record = Journal_Redo(sc->Journal, gs);
+    if (record != NULL && record->Kind == JOURNAL_CLEAR) _SceneController_GraphReplaced(sc);
+}
+
+void SceneController_Save(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    assert(sc->SketchPath != NULL);
+    SceneController_ApplyCommands(sc, gs);
+    
+    if (GraphSketch_Save(gs, sc->SketchPath)) TraceLog(LOG_INFO, "Saved the sketch to %s", sc->SketchPath);
+    else TraceLog(LOG_WARNING, "Could not save the sketch to %s", sc->SketchPath);
+}
+
+void SceneController_Open(SceneController *sc, GraphSketch *gs)
+{
+    assert(sc != NULL);
+    assert(gs != NULL);
+    assert(sc->SketchPath != NULL);
+    _SceneController_Record(sc, INPUT_EVENT_OPEN, 0);
+    SceneController_ApplyCommands(sc, gs);
+    _SceneController_EndEditStates(sc);
+    
+    GraphSketch *opened = GraphSketch_CreateGraphSketch();
+    GraphLoadError error = {};
+    if (!GraphSketch_Open(opened, sc->SketchPath, sc->VertexColor, GRAPH_SKETCH_BOUNDING_BOX, &error))
+    {
+        TraceLog(LOG_WARNING, "Could not open %s: %s", sc->SketchPath, error.Message);
+        GraphSketch_FreeGraphSketch(opened);
+        return;
+    }
+    
+    // Opening clears the sketch first, so undoing the clear brings the previous sketch back
+    Journal_Clear(sc->Journal, gs);
+    GraphSketch empty = *gs;
+    *gs = *opened;
+    *opened = empty;
+    GraphSketch_FreeGraphSketch(opened);
+    _SceneController_GraphReplaced(sc);
 }
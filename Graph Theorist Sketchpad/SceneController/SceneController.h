@@ -9,12 +9,21 @@
 #define SceneController_h
 
 #include "../GraphSketch/GraphSketch.h"
+#include "../MatrixView/MatrixView.h"
+#include "../Analytics/Analytics.h"
+#include "../Journal/Journal.h"
+#include "../CommandQueue/CommandQueue.h"
+#include "../InputLog/InputLog.h"
 
 #define SCENE_BOUNDING_BOX ((Rectangle){.x = 0, .y = 0, .width = 800, .height = 450})
 #define GRAPH_SKETCH_BOUNDING_BOX ((Rectangle) {.x = 0, .y = 0, .width = 600, .height = SCENE_BOUNDING_BOX.height })
 #define GUI_BOUNDING_BOX ((Rectangle) {.x = 600, .y = 0, .width = SCENE_BOUNDING_BOX.width - 600, .height = SCENE_BOUNDING_BOX.height})
 #define EDGE_CREATION_BOUNDING_BOX(pos) Primitive_CreatePrimitiveWithSize(pos, 0, 10).BoundingBox;
 #define VERTEX_CREATION_BOUNDING_BOX(pos) Primitive_CreatePrimitiveWithSize(pos, 0, GRAPH_VERTEX_RADIUS*3).BoundingBox;
+#define PROFILER_OVERLAY_BOUNDING_BOX ((Rectangle) {.x = 10, .y = 10, .width = 250, .height = 105})
+#define PROFILER_OVERLAY_TARGET_MS (1000.0 / 60)
+#define PROFILER_OVERLAY_ZONES 4
+#define COUNTERS_HUD_BOUNDING_BOX ((Rectangle) {.x = 10, .y = 120, .width = 250, .height = 65})
 
 typedef struct
 {
@@ -35,33 +44,99 @@ typedef struct
     bool ShowBvhTree;
     bool ShowAdjMatrix;
     bool ShowIncidenceMatrix;
+    bool ShowDistanceMatrix;
+    bool ShowReachability;
     bool ShowVertices;
     bool ShowEdges;
     bool ShowDirection;
     bool ShowDegrees;
     bool ShowMST;
+    bool ShowShortestPath;
+    bool ShowBridges;
+    bool ShowStrongComponents;
+    bool ShowEuler;
+    bool ShowColoring;
+    bool ShowClique;
+    bool ShowMinCut;
+    bool ShowMatching;
+    bool ShowProfiler;
+    bool ShowCounters;
     
     // Color options
     Color VertexColor;
     
-    // Output dumps
-    StringBuffer AdjMatrixDumpBuffer;
-    StringBuffer IncidenceMatrixDumpBuffer;
+    // Undo/redo history of every edit
+    Journal *Journal;
+    
+    // Edits of the frame, applied together when the scene is drawn
+    CommandQueue *Commands;
+    
+    // Background analyses of the graph
+    Analytics *Analytics;
+    
+    // Matrix views
+    MatrixView *AdjMatrixView;
+    MatrixView *IncidenceMatrixView;
+    MatrixView *DistanceMatrixView;
+    MatrixView *ReachabilityMatrixView;
+    
     char VertexWeightInputBuffer[3];
     
+    // Endpoints of the shortest path and the minimum cut, picked by clicking vertices while either is shown
+    unsigned int PathEndpointCount;
+    VertexIndex PathSource;
+    VertexIndex PathTarget;
+    
+    // Frames the Euler trail of EulerVersion of the graph has been animated for, one more edge is drawn every few frames
+    unsigned long EulerVersion;
+    unsigned int EulerFrame;
+    
+    // The color each vertex takes once the coloring is applied, recorded one vertex at a time before the edit
+    Color AppliedColors[GRAPH_MAX_SIZE];
+    
+    // Where the sketch is saved to and opened from
+    const char *SketchPath;
+    
+    // Mouse position the frame is handled with, live or replayed
+    Vector2 MousePosition;
+    
+    // Inputs of the session, NULL when not recording
+    InputLog *Recording;
+    
+    // Last recorded modes, color and weight, so only changes are recorded
+    uint32_t RecordedModes;
+    Color RecordedColor;
+    int RecordedWeight;
+    
 } SceneController;
 
 /// Creates a new scene controller
 SceneController *SceneController_CreateSceneController(void);
 
-/// Frees memory of the scene controller
+/// Frees memory of the scene controller. Must be called before the window is closed.
 void SceneController_FreeSceneController(SceneController *sc);
 
+/// Starts handling a frame of live input at the mouse position, recording what changed since the last frame
+void SceneController_BeginFrame(SceneController *sc, Vector2 mousePosition);
+
+/// Handles a left click at the mouse position with the current editing mode
+void SceneController_HandlePress(SceneController *sc, GraphSketch *gs);
+
+/// Scrolls or zooms the shown matrix views under the mouse by a turn of the mouse wheel
+void SceneController_TurnWheel(SceneController *sc, float wheel, MatrixViewWheel action);
+
+/// Applies a recorded input in place of the live one
+void SceneController_ReplayEvent(SceneController *sc, GraphSketch *gs, const InputEvent *event);
+
+/// Applies the queued edits of the frame as one batch. Called when the scene is drawn, and before anything that
+/// needs the sketch up to date.
+void SceneController_ApplyCommands(SceneController *sc, GraphSketch *gs);
+
 /// Determines if the mouse position is on a vertex, if so, caches the vertex and enters the Edge Creation State, waiting for a
-/// following vertex to be selected so an edge can be made.
+/// following vertex to be selected so an edge can be queued.
 void SceneController_CreateEdge(SceneController *sc, GraphSketch *gs);
 
-/// Creates a vertex at mouse positiion if not on top of another vertex
+/// Queues a vertex at mouse positiion if not on top of another vertex
 void SceneController_CreateVertex(SceneController *sc, GraphSketch *gs);
 
 void SceneController_MoveVertex(SceneController *sc, GraphSketch *gs);
@@ -69,7 +144,23 @@ void SceneController_MoveVertex(SceneController *sc, GraphSketch *gs);
 /// Draws the GUI and GraphSketch
 void SceneController_DrawScene(SceneController *sc, GraphSketch *gs);
 
+/// Colors the vertices with the coloring of the latest analysis as one edit that can be undone, if it is of the current graph
+void SceneController_ApplyColoring(SceneController *sc, GraphSketch *gs);
+
 /// Clears everything from the graph sketch
 void SceneController_ClearAll(SceneController *sc, GraphSketch *gs);
 
+/// Reverts the last edit, leaving any edge creation or vertex move in progress
+void SceneController_Undo(SceneController *sc, GraphSketch *gs);
+
+/// Applies the last reverted edit again
+void SceneController_Redo(SceneController *sc, GraphSketch *gs);
+
+/// Saves the sketch as a graph file at SketchPath
+void SceneController_Save(SceneController *sc, GraphSketch *gs);
+
+/// Replaces the sketch with the one saved at SketchPath, as a clear that can be undone. A replay opens the file at its own
+/// SketchPath, so it should be given the sketch the recorded session opened.
+void SceneController_Open(SceneController *sc, GraphSketch *gs);
+
 #endif /* SceneController_h */
@@ -7,12 +7,144 @@
 
 #include <raylib.h>
 #include "SceneController/SceneController.h"
+#include "raygui.h"
+#include "../Graph/Util/Profiler.h"
+#include "../Graph/Util/Counters.h"
+#include "../Graph/GraphFile.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-int main(void)
+#define PROFILER_TRACE_PATH "trace.json"
+
+/// Where the sketch is saved and opened from when no file is given
+#define SKETCH_PATH "sketch" GRAPH_FILE_EXTENSION
+
+/// Set to a file, or - for stderr, to dump the performance counters on exit
+#define COUNTERS_PATH_VARIABLE "SKETCHPAD_COUNTERS"
+
+#ifndef PROFILER_DISABLED
+/// Saves every zone still recorded as a Chrome trace
+static void _WriteTrace(void)
+{
+    FILE *file = fopen(PROFILER_TRACE_PATH, "w");
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "Could not open %s", PROFILER_TRACE_PATH);
+        return;
+    }
+    OutputSink *sink = OutputSink_CreateFileSink(file);
+    Profiler_WriteTrace(sink);
+    OutputSink_FreeOutputSink(sink);
+    fclose(file);
+    TraceLog(LOG_INFO, "Saved profiler trace to %s", PROFILER_TRACE_PATH);
+}
+#endif
+
+static void _WriteCounters(const char *path)
+{
+    FILE *file = strcmp(path, "-") == 0 ? stderr : fopen(path, "w");
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "Could not open %s", path);
+        return;
+    }
+    OutputSink *sink = OutputSink_CreateFileSink(file);
+    Counters_Write(sink);
+    OutputSink_FreeOutputSink(sink);
+    if (file != stderr) fclose(file);
+}
+
+static void _Usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [-r file | -p file] [sketch]\n", program);
+    fprintf(stderr, "  Opens the sketch if it exists, control + s saves to it and control + o opens it again, default %s\n", SKETCH_PATH);
+    fprintf(stderr, "  -r  record the mouse, mode and edit inputs of the session to file\n");
+    fprintf(stderr, "  -p  replay a recording as fast as possible, then print the frame times and exit\n");
+    fprintf(stderr, "      give it the sketch the recorded session opened, a replay opens it where the session did\n");
+}
+
+static InputLog *_ReadRecording(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Could not open %s\n", path);
+        return NULL;
+    }
+    InputLog *log = InputLog_Read(file);
+    fclose(file);
+    if (log == NULL) fprintf(stderr, "%s is not an input recording\n", path);
+    return log;
+}
+
+static void _WriteRecording(const InputLog *log, const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL || !InputLog_Write(log, file))
+    {
+        TraceLog(LOG_WARNING, "Could not save the input recording to %s", path);
+    }
+    if (file != NULL) fclose(file);
+}
+
+static int _CompareDurations(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *) a;
+    unsigned long long y = *(const unsigned long long *) b;
+    return (x > y) - (x < y);
+}
+
+/// Prints the total and per frame times of a replay
+static void _ReportReplay(unsigned long long *durations, size_t frames)
+{
+    if (frames == 0) return;
+    
+    unsigned long long total = 0;
+    for (size_t i = 0; i < frames; i++) total += durations[i];
+    qsort(durations, frames, sizeof(unsigned long long), _CompareDurations);
+    
+    printf("frames %zu\n", frames);
+    printf("total  %.3f ms\n", total / 1e6);
+    printf("mean   %.3f ms\n", total / 1e6 / frames);
+    printf("p50    %.3f ms\n", durations[frames / 2] / 1e6);
+    printf("p99    %.3f ms\n", durations[(frames * 99) / 100] / 1e6);
+    printf("max    %.3f ms\n", durations[frames - 1] / 1e6);
+}
+
+int main(int argc, char *argv[])
 {
+    const char *recordPath = NULL;
+    const char *replayPath = NULL;
+    int option;
+    while ((option = getopt(argc, argv, "r:p:h")) != -1)
+    {
+        switch (option)
+        {
+            case 'r':
+                recordPath = optarg;
+                break;
+            case 'p':
+                replayPath = optarg;
+                break;
+            default:
+                _Usage(argv[0]);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (optind + 1 < argc || (recordPath != NULL && replayPath != NULL))
+    {
+        _Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    InputLog *replay = NULL;
+    if (replayPath != NULL && (replay = _ReadRecording(replayPath)) == NULL) return EXIT_FAILURE;
     
     SceneController *sc = SceneController_CreateSceneController();
     GraphSketch *gs = GraphSketch_CreateGraphSketch();
+    if (recordPath != NULL) sc->Recording = InputLog_CreateInputLog();
+    sc->SketchPath = optind < argc ? argv[optind] : SKETCH_PATH;
     
     InitWindow(
                SCENE_BOUNDING_BOX.width,
@@ -20,34 +152,102 @@ int main(void)
                "Graph Theorist Sketchpad - Benjamin Schreiber"
                );
     
-    SetTargetFPS(60);
+    // A replay runs uncapped, so the frame times are the work done and not the wait for the next frame
+    SetTargetFPS(replay != NULL ? 0 : 60);
+    
+    unsigned long long *replayDurations = NULL;
+    size_t replayFrames = 0;
+    if (replay != NULL)
+    {
+        uint32_t lastFrame = replay->Count > 0 ? replay->Events[replay->Count - 1].Frame : 0;
+        replayDurations = malloc((lastFrame + 1) * sizeof(unsigned long long));
+    }
+    
+    // A sketch named on the command line is opened on the first frame, one that does not exist yet is created on save. A
+    // replay opens it when the recording does.
+    bool isOpenPending = optind < argc && access(sc->SketchPath, F_OK) == 0;
     
     // Main game loop
     while (!WindowShouldClose())
     {
+        PROFILE_BEGIN_FRAME();
         
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        if (replay != NULL)
         {
-            if (GetMousePosition().x < GUI_BOUNDING_BOX.x && sc->IsInEditWeightMode)
+            unsigned long long frameStart = Profiler_Now();
+            
+            // The GUI is driven by the recorded modes instead of the live mouse
+            const InputEvent *event;
+            while ((event = InputLog_Next(replay, (uint32_t) replayFrames)) != NULL)
             {
-                sc->IsInEditWeightMode = false;
-                continue;
+                SceneController_ReplayEvent(sc, gs, event);
             }
+            GuiLock();
+            
+            BeginDrawing();
+            SceneController_DrawScene(sc, gs);
+            ClearBackground(BLACK);
+            PROFILE_END_FRAME();
+            EndDrawing();
             
-            if (sc->IsInEdgeCreationMode)
+            replayDurations[replayFrames++] = Profiler_Now() - frameStart;
+            if (InputLog_IsFinished(replay)) break;
+            continue;
+        }
+        
+        SceneController_BeginFrame(sc, GetMousePosition());
+        
+        if (isOpenPending)
+        {
+            SceneController_Open(sc, gs);
+            isOpenPending = false;
+        }
+        
+#ifndef PROFILER_DISABLED
+        // F3 shows the frame time overlay, F2 saves the recorded zones
+        if (IsKeyPressed(KEY_F3)) sc->ShowProfiler = !sc->ShowProfiler;
+        if (IsKeyPressed(KEY_F2)) _WriteTrace();
+#endif
+        
+        // F4 shows the performance counters
+        if (IsKeyPressed(KEY_F4)) sc->ShowCounters = !sc->ShowCounters;
+        
+        // Undo on control + z, redo on control + shift + z or control + y
+        if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_LEFT_SUPER))
+        {
+            if (IsKeyPressed(KEY_Y) || (IsKeyPressed(KEY_Z) && IsKeyDown(KEY_LEFT_SHIFT)))
             {
-                SceneController_CreateEdge(sc, gs);
+                SceneController_Redo(sc, gs);
             }
-            
-            else if (sc->IsInVertexCreationMode)
+            else if (IsKeyPressed(KEY_Z))
             {
-                SceneController_CreateVertex(sc, gs);
+                SceneController_Undo(sc, gs);
             }
             
-            else if (sc->IsInVertexMoveMode)
+            // Save on control + s, open the saved sketch again on control + o
+            if (IsKeyPressed(KEY_S)) SceneController_Save(sc, gs);
+            if (IsKeyPressed(KEY_O)) SceneController_Open(sc, gs);
+        }
+        
+        // The mouse wheel scrolls the matrix views, sideways with shift held, and zooms them with control held
+        float wheel = GetMouseWheelMove();
+        if (wheel != 0)
+        {
+            MatrixViewWheel action = MATRIX_VIEW_WHEEL_SCROLL;
+            if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_LEFT_SUPER)) action = MATRIX_VIEW_WHEEL_ZOOM;
+            else if (IsKeyDown(KEY_LEFT_SHIFT)) action = MATRIX_VIEW_WHEEL_SCROLL_SIDEWAYS;
+            SceneController_TurnWheel(sc, wheel, action);
+        }
+        
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        {
+            if (sc->MousePosition.x < GUI_BOUNDING_BOX.x && sc->IsInEditWeightMode)
             {
-                SceneController_MoveVertex(sc, gs);
+                sc->IsInEditWeightMode = false;
+                continue;
             }
+            
+            SceneController_HandlePress(sc, gs);
         }
         
         BeginDrawing();
@@ -56,13 +256,33 @@ int main(void)
         
         ClearBackground(BLACK);
         
+        // Waiting for the next frame is not part of it
+        PROFILE_END_FRAME();
+        
         EndDrawing();
     }
     
-    CloseWindow();
+    if (sc->Recording != NULL)
+    {
+        InputLog_Record(sc->Recording, INPUT_EVENT_END, 0, 0, 0, Profiler_Now() / 1000);
+        _WriteRecording(sc->Recording, recordPath);
+        InputLog_FreeInputLog(sc->Recording);
+    }
+    
+    if (replay != NULL)
+    {
+        _ReportReplay(replayDurations, replayFrames);
+        free(replayDurations);
+        InputLog_FreeInputLog(replay);
+    }
     
     SceneController_FreeSceneController(sc);
     GraphSketch_FreeGraphSketch(gs);
     
+    const char *countersPath = getenv(COUNTERS_PATH_VARIABLE);
+    if (countersPath != NULL) _WriteCounters(countersPath);
+    
+    CloseWindow();
+    
     return 0;
 }
@@ -0,0 +1,251 @@
+//
+//  AllPairs.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "AllPairs.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Util/Parallel.h"
+#include "Util/Profiler.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/// No path found yet. Half the range of each width, so the sum of two never overflows and is never shorter than either.
+#define ALL_PAIRS_NARROW_NONE (UINT32_MAX / 2)
+#define ALL_PAIRS_WIDE_NONE (UINT64_MAX / 2)
+
+typedef struct
+{
+    /// Vertices * Vertices distances, row major, of uint32_t when IsNarrow and uint64_t otherwise
+    void *Matrix;
+    bool IsNarrow;
+    size_t Vertices;
+    size_t Blocks;
+    unsigned int Threads;
+    ParallelBarrier Barrier;
+} _FloydWarshall;
+
+/// The inner loops have no branches and their rows never overlap, so they compile to vector minimums
+static inline void _MinPlusNarrow(uint32_t *restrict row, const uint32_t *restrict through, uint32_t via, size_t count)
+{
+    for (size_t j = 0; j < count; j++)
+    {
+        uint32_t distance = via + through[j];
+        row[j] = distance < row[j] ? distance : row[j];
+    }
+}
+
+static inline void _MinPlusWide(uint64_t *restrict row, const uint64_t *restrict through, uint64_t via, size_t count)
+{
+    for (size_t j = 0; j < count; j++)
+    {
+        uint64_t distance = via + through[j];
+        row[j] = distance < row[j] ? distance : row[j];
+    }
+}
+
+/// Shortens the distances from i to the columns from first up to last through k
+static inline void _FloydWarshall_Relax(const _FloydWarshall *fw, size_t i, size_t k, size_t first, size_t last)
+{
+    const size_t n = fw->Vertices;
+    if (fw->IsNarrow)
+    {
+        uint32_t *matrix = fw->Matrix;
+        uint32_t via = matrix[i * n + k];
+        if (via != ALL_PAIRS_NARROW_NONE) _MinPlusNarrow(matrix + i * n + first, matrix + k * n + first, via, last - first);
+        return;
+    }
+    uint64_t *matrix = fw->Matrix;
+    uint64_t via = matrix[i * n + k];
+    if (via != ALL_PAIRS_WIDE_NONE) _MinPlusWide(matrix + i * n + first, matrix + k * n + first, via, last - first);
+}
+
+/// Relaxes the tile at block row ib and block column jb through the vertices of block kb one at a time,
+/// for the tiles of round kb that read themselves
+static void _FloydWarshall_Tile(const _FloydWarshall *fw, size_t ib, size_t jb, size_t kb)
+{
+    const size_t n = fw->Vertices;
+    const size_t iEnd = MIN((ib + 1) * ALL_PAIRS_TILE, n);
+    const size_t jEnd = MIN((jb + 1) * ALL_PAIRS_TILE, n);
+    const size_t kEnd = MIN((kb + 1) * ALL_PAIRS_TILE, n);
+    for (size_t k = kb * ALL_PAIRS_TILE; k < kEnd; k++)
+    {
+        for (size_t i = ib * ALL_PAIRS_TILE; i < iEnd; i++)
+        {
+            // The distance from k to itself is 0, so its own row never changes
+            if (i != k) _FloydWarshall_Relax(fw, i, k, jb * ALL_PAIRS_TILE, jEnd);
+        }
+    }
+}
+
+/// Relaxes the tile at block row ib and block column jb through block kb, whose tiles in its row and column are settled,
+/// so the vertices of kb can be taken in any order. Each slab of ALL_PAIRS_MICRO_TILE rows of the tile in the row of kb
+/// is read by every row of the tile while it is still in L1.
+static void _FloydWarshall_MinPlus(const _FloydWarshall *fw, size_t ib, size_t jb, size_t kb)
+{
+    const size_t n = fw->Vertices;
+    const size_t iEnd = MIN((ib + 1) * ALL_PAIRS_TILE, n);
+    const size_t jEnd = MIN((jb + 1) * ALL_PAIRS_TILE, n);
+    const size_t kEnd = MIN((kb + 1) * ALL_PAIRS_TILE, n);
+    for (size_t kk = kb * ALL_PAIRS_TILE; kk < kEnd; kk += ALL_PAIRS_MICRO_TILE)
+    {
+        for (size_t i = ib * ALL_PAIRS_TILE; i < iEnd; i++)
+        {
+            for (size_t k = kk; k < MIN(kk + ALL_PAIRS_MICRO_TILE, kEnd); k++)
+            {
+                _FloydWarshall_Relax(fw, i, k, jb * ALL_PAIRS_TILE, jEnd);
+            }
+        }
+    }
+}
+
+static void _FloydWarshall_Thread(void *context, unsigned int thread)
+{
+    _FloydWarshall *fw = context;
+    const size_t blocks = fw->Blocks;
+    for (size_t kb = 0; kb < blocks; kb++)
+    {
+        // The diagonal tile only reads itself
+        if (thread == 0) _FloydWarshall_Tile(fw, kb, kb, kb);
+        ParallelBarrier_Wait(&fw->Barrier);
+
+        // The tiles in the row and column of the diagonal read themselves and the diagonal
+        for (size_t t = thread; t < 2 * blocks; t += fw->Threads)
+        {
+            size_t b = t / 2;
+            if (b == kb) continue;
+            if (t % 2 == 0) _FloydWarshall_Tile(fw, kb, b, kb);
+            else _FloydWarshall_Tile(fw, b, kb, kb);
+        }
+        ParallelBarrier_Wait(&fw->Barrier);
+
+        // Every other tile only reads the row and column, so they are independent of each other
+        for (size_t t = thread; t < blocks * blocks; t += fw->Threads)
+        {
+            size_t ib = t / blocks;
+            size_t jb = t % blocks;
+            if (ib != kb && jb != kb) _FloydWarshall_MinPlus(fw, ib, jb, kb);
+        }
+        ParallelBarrier_Wait(&fw->Barrier);
+    }
+}
+
+void AllPairs_FloydWarshall(const Csr *csr, unsigned int threads, uint64_t *distances)
+{
+    PROFILE_ZONE("AllPairs_FloydWarshall");
+    assert(csr != NULL && distances != NULL);
+
+    const size_t n = csr->Vertices;
+    if (n == 0) return;
+
+    unsigned int maxWeight = 0;
+    for (uint64_t i = 0; i < csr->Count; i++) maxWeight = MAX(maxWeight, csr->Weights[i]);
+
+    _FloydWarshall fw =
+    {
+        .IsNarrow = (uint64_t) maxWeight * (n - 1) < ALL_PAIRS_NARROW_NONE,
+        .Vertices = n,
+        .Blocks = (n + ALL_PAIRS_TILE - 1) / ALL_PAIRS_TILE,
+    };
+    fw.Threads = (unsigned int) MIN(Parallel_ThreadCount(threads), fw.Blocks * fw.Blocks);
+
+    // Wide distances are found in place
+    fw.Matrix = fw.IsNarrow ? malloc(n * n * sizeof(uint32_t)) : distances;
+    uint32_t *narrow = fw.Matrix;
+    for (size_t i = 0; i < n * n; i++)
+    {
+        if (fw.IsNarrow) narrow[i] = ALL_PAIRS_NARROW_NONE;
+        else distances[i] = ALL_PAIRS_WIDE_NONE;
+    }
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        if (fw.IsNarrow) narrow[u * n + u] = 0;
+        else distances[u * n + u] = 0;
+
+        // The lightest of parallel edges
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            size_t cell = u * n + csr->Targets[i];
+            if (csr->Targets[i] == u) continue;
+            if (fw.IsNarrow) narrow[cell] = MIN(narrow[cell], csr->Weights[i]);
+            else distances[cell] = MIN(distances[cell], csr->Weights[i]);
+        }
+    }
+
+    ParallelBarrier_Init(&fw.Barrier, fw.Threads);
+    Parallel_Run(fw.Threads, _FloydWarshall_Thread, &fw);
+    ParallelBarrier_Destroy(&fw.Barrier);
+
+    for (size_t i = 0; i < n * n; i++)
+    {
+        if (fw.IsNarrow) distances[i] = narrow[i] == ALL_PAIRS_NARROW_NONE ? SHORTEST_PATHS_UNREACHED : narrow[i];
+        else if (distances[i] == ALL_PAIRS_WIDE_NONE) distances[i] = SHORTEST_PATHS_UNREACHED;
+    }
+    if (fw.IsNarrow) free(narrow);
+}
+
+static inline void _OrRow(uint64_t *restrict row, const uint64_t *restrict through, size_t words)
+{
+    for (size_t w = 0; w < words; w++)
+    {
+        row[w] |= through[w];
+    }
+}
+
+void AllPairs_TransitiveClosure(const Csr *csr, uint64_t *rows)
+{
+    PROFILE_ZONE("AllPairs_TransitiveClosure");
+    assert(csr != NULL && rows != NULL);
+
+    const size_t n = csr->Vertices;
+    const size_t words = ALL_PAIRS_ROW_WORDS(n);
+    memset(rows, 0, n * words * sizeof(uint64_t));
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            rows[u * words + csr->Targets[i] / 64] |= 1ull << (csr->Targets[i] % 64);
+        }
+    }
+
+    // After round k every row holds the vertices it reaches through the first k vertices, 64 columns per or
+    for (size_t k = 0; k < n; k++)
+    {
+        const uint64_t *through = rows + k * words;
+        const uint64_t bit = 1ull << (k % 64);
+        for (size_t i = 0; i < n; i++)
+        {
+            uint64_t *row = rows + i * words;
+            if (i != k && (row[k / 64] & bit)) _OrRow(row, through, words);
+        }
+    }
+}
+
+void Graph_AllPairsShortestPaths(const Graph *g, uint64_t *distances)
+{
+    PROFILE_ZONE("Graph_AllPairsShortestPaths");
+    assert(g != NULL && distances != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    AllPairs_FloydWarshall(csr, 1, distances);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+void Graph_TransitiveClosure(const Graph *g, uint64_t *rows)
+{
+    PROFILE_ZONE("Graph_TransitiveClosure");
+    assert(g != NULL && rows != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    AllPairs_TransitiveClosure(csr, rows);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
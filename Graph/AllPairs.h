@@ -0,0 +1,55 @@
+//
+//  AllPairs.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef AllPairs_h
+#define AllPairs_h
+
+#include <stdint.h>
+#include "Csr.h"
+#include "ShortestPaths.h"
+
+/// Rows and columns of the tiles Floyd–Warshall settles one round at a time, three of them fit in L2
+#define ALL_PAIRS_TILE 128
+
+/// Rows of the tile in the row of a round that every row of another tile reads before moving on, they fit in L1
+#define ALL_PAIRS_MICRO_TILE 16
+
+/// Words in each row of a transitive closure
+#define ALL_PAIRS_ROW_WORDS(vertices) (((size_t) (vertices) + 63) / 64)
+
+/// Blocked Floyd–Warshall, following the direction of each edge. Each round settles the diagonal tile, then the tiles of its row
+/// and column, then every other tile as a min plus product of the two, split between the threads. Distances are kept in 32 bits
+/// when the longest possible path fits, so the inner loops compare twice as many at a time.
+/// - Parameters:
+///   - threads: the threads to settle tiles on, 0 for one per processor
+///   - distances: Vertices * Vertices entries, row major, set to the total weight of a shortest path from the row to the column,
+///                or SHORTEST_PATHS_UNREACHED
+void AllPairs_FloydWarshall(const Csr *csr, unsigned int threads, uint64_t *distances);
+
+/// Warshall's algorithm on rows of bits, or'ing the row of each vertex into the rows that reach it
+/// - Parameters:
+///   - rows: Vertices rows of ALL_PAIRS_ROW_WORDS(Vertices) words, set so bit v of row u is set if a path of at least one edge
+///           leads from u to v. A vertex only reaches itself through a cycle or a self loop.
+void AllPairs_TransitiveClosure(const Csr *csr, uint64_t *rows);
+
+/// - Returns: true if from reaches to in the rows of a transitive closure
+static inline bool AllPairs_IsReachable(const uint64_t *rows, unsigned int vertices, VertexIndex from, VertexIndex to)
+{
+    return rows[from * ALL_PAIRS_ROW_WORDS(vertices) + to / 64] >> (to % 64) & 1;
+}
+
+/// The shortest distances between every two vertices of the graph, following the direction of each edge
+/// - Parameters:
+///   - distances: Vertices * Vertices entries, see AllPairs_FloydWarshall
+void Graph_AllPairsShortestPaths(const Graph *g, uint64_t *distances);
+
+/// The vertices each vertex of the graph reaches, following the direction of each edge
+/// - Parameters:
+///   - rows: Vertices rows of ALL_PAIRS_ROW_WORDS(Vertices) words, see AllPairs_TransitiveClosure
+void Graph_TransitiveClosure(const Graph *g, uint64_t *rows);
+
+#endif /* AllPairs_h */
@@ -0,0 +1,149 @@
+//
+//  Biconnected.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Biconnected.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Profiler.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/// The order of a vertex the search has not reached
+#define BICONNECTED_UNVISITED UINT32_MAX
+
+/// The edge the root of a search was reached through
+#define BICONNECTED_NO_EDGE UINT32_MAX
+
+/// A vertex on the path of the depth first search
+typedef struct
+{
+    VertexIndex Vertex;
+    
+    /// The edge the vertex was reached through, which is not taken back. A parallel edge has its own index, so it is.
+    uint32_t ParentEdge;
+    
+    /// The next of the out entries and then the in entries of the vertex to look at
+    uint64_t Next;
+} _Frame;
+
+unsigned int Biconnected_Components(const Csr *out, const Csr *in, uint32_t *components, bool *isArticulation, bool *isBridge)
+{
+    PROFILE_ZONE("Biconnected_Components");
+    assert(out != NULL && in != NULL && components != NULL);
+    assert(out->Vertices == in->Vertices && out->Count == in->Count);
+    
+    const unsigned int n = out->Vertices;
+    uint32_t *order = malloc(n * sizeof(uint32_t));
+    uint32_t *low = malloc(n * sizeof(uint32_t));
+    _Frame *path = malloc(n * sizeof(_Frame));
+    
+    // Every edge other than a self loop is pushed once, from the later of its vertices in the search
+    uint32_t *edges = malloc(out->Count * sizeof(uint32_t));
+    size_t edgeCount = 0;
+    
+    for (VertexIndex v = 0; v < n; v++) order[v] = BICONNECTED_UNVISITED;
+    for (uint64_t e = 0; e < out->Count; e++) components[e] = BICONNECTED_NO_COMPONENT;
+    if (isArticulation != NULL) for (VertexIndex v = 0; v < n; v++) isArticulation[v] = false;
+    if (isBridge != NULL) for (uint64_t e = 0; e < out->Count; e++) isBridge[e] = false;
+    
+    uint32_t time = 0;
+    unsigned int count = 0;
+    for (VertexIndex root = 0; root < n; root++)
+    {
+        if (order[root] != BICONNECTED_UNVISITED) continue;
+        order[root] = low[root] = time++;
+        path[0] = (_Frame) { .Vertex = root, .ParentEdge = BICONNECTED_NO_EDGE, .Next = 0 };
+        size_t depth = 1;
+        unsigned int rootChildren = 0;
+        
+        while (depth > 0)
+        {
+            _Frame *frame = &path[depth - 1];
+            const VertexIndex v = frame->Vertex;
+            const uint64_t outDegree = out->Offsets[v + 1] - out->Offsets[v];
+            const uint64_t inDegree = in->Offsets[v + 1] - in->Offsets[v];
+            
+            if (frame->Next < outDegree + inDegree)
+            {
+                const uint64_t i = frame->Next++;
+                const uint64_t entry = i < outDegree ? out->Offsets[v] + i : in->Offsets[v] + i - outDegree;
+                const VertexIndex w = i < outDegree ? out->Targets[entry] : in->Targets[entry];
+                const uint32_t e = i < outDegree ? out->Edges[entry] : in->Edges[entry];
+                
+                if (w == v)
+                {
+                    // A self loop is in both rows of its vertex
+                    if (components[e] == BICONNECTED_NO_COMPONENT) components[e] = count++;
+                }
+                else if (order[w] == BICONNECTED_UNVISITED)
+                {
+                    edges[edgeCount++] = e;
+                    order[w] = low[w] = time++;
+                    path[depth++] = (_Frame) { .Vertex = w, .ParentEdge = e, .Next = 0 };
+                    if (v == root) rootChildren++;
+                }
+                else if (e != frame->ParentEdge && order[w] < order[v])
+                {
+                    // Without cross edges, an earlier neighbor is an ancestor. A later one is a descendant that already pushed the edge.
+                    edges[edgeCount++] = e;
+                    low[v] = MIN(low[v], order[w]);
+                }
+                continue;
+            }
+            
+            // v is finished, its parent learns how far up its subtree reaches
+            const uint32_t treeEdge = frame->ParentEdge;
+            if (--depth == 0) break;
+            const VertexIndex parent = path[depth - 1].Vertex;
+            low[parent] = MIN(low[parent], low[v]);
+            if (low[v] < order[parent]) continue;
+            
+            // Nothing below v reaches above the parent, so the edges pushed since the tree edge are a component
+            if (isArticulation != NULL && parent != root) isArticulation[parent] = true;
+            if (isBridge != NULL && low[v] > order[parent]) isBridge[treeEdge] = true;
+            uint32_t e;
+            do
+            {
+                e = edges[--edgeCount];
+                components[e] = count;
+            } while (e != treeEdge);
+            count++;
+        }
+        
+        if (isArticulation != NULL && rootChildren > 1) isArticulation[root] = true;
+    }
+    
+    free(order);
+    free(low);
+    free(path);
+    free(edges);
+    return count;
+}
+
+unsigned int Graph_BridgesAndCutVertices(const Graph *g, EdgeIndex bridges[GRAPH_MAX_SIZE], bool isCutVertex[GRAPH_MAX_SIZE])
+{
+    PROFILE_ZONE("Graph_BridgesAndCutVertices");
+    assert(g != NULL && bridges != NULL && isCutVertex != NULL);
+    
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *out = Csr_FromEdgeList(el);
+    Csr *in = Csr_Transpose(out);
+    uint32_t components[GRAPH_MAX_SIZE];
+    bool isBridge[GRAPH_MAX_SIZE];
+    unsigned int count = Biconnected_Components(out, in, components, isCutVertex, isBridge);
+    Csr_FreeCsr(in);
+    Csr_FreeCsr(out);
+    EdgeList_FreeEdgeList(el);
+    
+    int length = 0;
+    for (EdgeIndex e = 0; e < g->Edges; e++)
+    {
+        if (isBridge[e]) bridges[length++] = e;
+    }
+    bridges[length] = MST_NO_EDGE;
+    return count;
+}
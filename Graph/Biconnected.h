@@ -0,0 +1,38 @@
+//
+//  Biconnected.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Biconnected_h
+#define Biconnected_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+/// The component of an edge before it is assigned one, never left in the result
+#define BICONNECTED_NO_COMPONENT UINT32_MAX
+
+/// Tarjan and Hopcroft's low points, ignoring the direction of each edge. The depth first search keeps its path on an explicit
+/// stack, so paths of millions of vertices are searched without recursion, in O(V + E). Parallel edges are separate edges,
+/// so two of them between the same vertices are never bridges, and a self loop is a biconnected component of its own that cuts
+/// nothing.
+/// - Parameters:
+///   - out: the edges leaving each vertex
+///   - in: the edges entering each vertex, Csr_Transpose(out)
+///   - components: Count entries indexed by the edge index of each entry, set to the biconnected component of the edge,
+///                 numbered from 0 in the order the search finishes them
+///   - isArticulation: Vertices entries, set for the vertices whose removal disconnects their component, or NULL
+///   - isBridge: Count entries indexed by edge index, set for the edges whose removal disconnects their component, or NULL
+/// - Returns: The biconnected components
+unsigned int Biconnected_Components(const Csr *out, const Csr *in, uint32_t *components, bool *isArticulation, bool *isBridge);
+
+/// The bridges and cut vertices of the graph, ignoring the direction of each edge
+/// - Parameters:
+///   - bridges: set to the bridges in the order of their EdgeIndex, terminated by MST_NO_EDGE
+///   - isCutVertex: Vertices entries, set for the vertices whose removal disconnects their component
+/// - Returns: The biconnected components
+unsigned int Graph_BridgesAndCutVertices(const Graph *g, EdgeIndex bridges[GRAPH_MAX_SIZE], bool isCutVertex[GRAPH_MAX_SIZE]);
+
+#endif /* Biconnected_h */
@@ -0,0 +1,44 @@
+//
+//  BitMatrix.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "BitMatrix.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Counters.h"
+#include "Util/Profiler.h"
+
+BitMatrix *BitMatrix_FromCsr(const Csr *csr)
+{
+    PROFILE_ZONE("BitMatrix_FromCsr");
+    assert(csr != NULL);
+
+    BitMatrix *m = malloc(sizeof(BitMatrix));
+    m->Vertices = csr->Vertices;
+    m->Words = BITSET_WORDS(csr->Vertices);
+    m->Rows = calloc(csr->Vertices * m->Words, sizeof(uint64_t));
+    assert(m->Rows != NULL || csr->Vertices == 0);
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(BitMatrix) + csr->Vertices * m->Words * sizeof(uint64_t));
+
+    for (VertexIndex u = 0; u < csr->Vertices; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            const VertexIndex v = csr->Targets[i];
+            if (u == v) continue;
+            Bitset_Add(m->Rows + u * m->Words, v);
+            Bitset_Add(m->Rows + v * m->Words, u);
+        }
+    }
+    return m;
+}
+
+void BitMatrix_FreeBitMatrix(BitMatrix *m)
+{
+    assert(m != NULL);
+    free(m->Rows);
+    free(m);
+}
@@ -0,0 +1,97 @@
+//
+//  BitMatrix.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef BitMatrix_h
+#define BitMatrix_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+/// Words in a set of the vertices of a graph
+#define BITSET_WORDS(vertices) (((size_t) (vertices) + 63) / 64)
+
+/// The adjacency of a graph packed one bit per pair, ignoring the direction of each edge and self loops. Each row is a set of
+/// neighbors, so the neighbors two vertices share, or those of a vertex among candidates, are found 64 at a time.
+typedef struct
+{
+    unsigned int Vertices;
+
+    /// Words in each row
+    size_t Words;
+
+    /// Vertices rows of Words words, bit v of row u set if u and v are adjacent
+    uint64_t *Rows;
+} BitMatrix;
+
+/// Creates the packed adjacency of the rows in O(V^2 / 64 + E)
+BitMatrix *BitMatrix_FromCsr(const Csr *csr);
+
+/// Frees the memory of the matrix
+void BitMatrix_FreeBitMatrix(BitMatrix *m);
+
+/// - Returns: The neighbors of the vertex
+static inline const uint64_t *BitMatrix_Row(const BitMatrix *m, VertexIndex v)
+{
+    return m->Rows + v * m->Words;
+}
+
+static inline bool Bitset_Has(const uint64_t *set, size_t i)
+{
+    return set[i / 64] >> (i % 64) & 1;
+}
+
+static inline void Bitset_Add(uint64_t *set, size_t i)
+{
+    set[i / 64] |= 1ull << (i % 64);
+}
+
+static inline void Bitset_Remove(uint64_t *set, size_t i)
+{
+    set[i / 64] &= ~(1ull << (i % 64));
+}
+
+/// - Returns: The members of the set
+static inline size_t Bitset_Count(const uint64_t *set, size_t words)
+{
+    size_t count = 0;
+    for (size_t w = 0; w < words; w++) count += __builtin_popcountll(set[w]);
+    return count;
+}
+
+/// - Returns: The members of both sets
+static inline size_t Bitset_CountAnd(const uint64_t *a, const uint64_t *b, size_t words)
+{
+    size_t count = 0;
+    for (size_t w = 0; w < words; w++) count += __builtin_popcountll(a[w] & b[w]);
+    return count;
+}
+
+/// - Returns: If the sets share a member
+static inline bool Bitset_Intersects(const uint64_t *a, const uint64_t *b, size_t words)
+{
+    for (size_t w = 0; w < words; w++)
+    {
+        if (a[w] & b[w]) return true;
+    }
+    return false;
+}
+
+/// - Returns: The first member of the set at or after from, or words * 64 if there is none
+static inline size_t Bitset_Next(const uint64_t *set, size_t words, size_t from)
+{
+    size_t w = from / 64;
+    if (w >= words) return words * 64;
+    uint64_t word = set[w] & (~0ull << (from % 64));
+    while (word == 0)
+    {
+        if (++w == words) return words * 64;
+        word = set[w];
+    }
+    return w * 64 + __builtin_ctzll(word);
+}
+
+#endif /* BitMatrix_h */
@@ -0,0 +1,594 @@
+//
+//  Clique.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Clique.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Util/Parallel.h"
+#include "Util/Profiler.h"
+
+/// The end of a bucket of the degeneracy order
+#define CLIQUE_NONE UINT32_MAX
+
+/// Branches searched between looks at the clock and the cancellation flag
+#define CLIQUE_CHECK_INTERVAL 1024
+
+unsigned int Clique_DegeneracyOrder(const BitMatrix *m, VertexIndex *order)
+{
+    PROFILE_ZONE("Clique_DegeneracyOrder");
+    assert(m != NULL && order != NULL);
+
+    // A bucket of the vertices left with each degree, as doubly linked lists, so a vertex moves down a bucket in O(1)
+    const unsigned int n = m->Vertices;
+    const size_t words = m->Words;
+    uint32_t *degrees = malloc(n * sizeof(uint32_t));
+    uint32_t *heads = malloc((n + 1) * sizeof(uint32_t));
+    uint32_t *next = malloc(n * sizeof(uint32_t));
+    uint32_t *previous = malloc(n * sizeof(uint32_t));
+    uint64_t *isLeft = malloc(words * sizeof(uint64_t));
+    for (unsigned int d = 0; d <= n; d++) heads[d] = CLIQUE_NONE;
+    for (size_t w = 0; w < words; w++) isLeft[w] = ~0ull;
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        degrees[v] = (uint32_t) Bitset_Count(BitMatrix_Row(m, v), words);
+        next[v] = heads[degrees[v]];
+        previous[v] = CLIQUE_NONE;
+        if (heads[degrees[v]] != CLIQUE_NONE) previous[heads[degrees[v]]] = v;
+        heads[degrees[v]] = v;
+    }
+
+    unsigned int degeneracy = 0;
+    unsigned int d = 0;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        // Taking out a vertex lowers the degrees of its neighbors by one, so the lowest degree drops by at most one
+        while (heads[d] == CLIQUE_NONE) d++;
+        const VertexIndex v = heads[d];
+        heads[d] = next[v];
+        if (next[v] != CLIQUE_NONE) previous[next[v]] = CLIQUE_NONE;
+        if (d > degeneracy) degeneracy = d;
+        order[i] = v;
+        Bitset_Remove(isLeft, v);
+
+        const uint64_t *row = BitMatrix_Row(m, v);
+        for (size_t w = 0; w < words; w++)
+        {
+            for (uint64_t word = row[w] & isLeft[w]; word != 0; word &= word - 1)
+            {
+                const VertexIndex u = (VertexIndex) (w * 64 + __builtin_ctzll(word));
+                if (previous[u] != CLIQUE_NONE) next[previous[u]] = next[u];
+                else heads[degrees[u]] = next[u];
+                if (next[u] != CLIQUE_NONE) previous[next[u]] = previous[u];
+
+                degrees[u]--;
+                next[u] = heads[degrees[u]];
+                previous[u] = CLIQUE_NONE;
+                if (heads[degrees[u]] != CLIQUE_NONE) previous[heads[degrees[u]]] = u;
+                heads[degrees[u]] = u;
+            }
+        }
+        if (d > 0) d--;
+    }
+
+    free(degrees);
+    free(heads);
+    free(next);
+    free(previous);
+    free(isLeft);
+    return degeneracy;
+}
+
+/// When the search stops, shared by the threads of both searches
+typedef struct
+{
+    atomic_bool IsStopped;
+    unsigned long long Deadline;
+    atomic_bool *IsCancelRequested;
+} _CliqueStop;
+
+static void _CliqueStop_Init(_CliqueStop *stop, const CliqueOptions *options)
+{
+    atomic_init(&stop->IsStopped, false);
+    stop->Deadline = options->TimeLimit > 0 ? Profiler_Now() + (unsigned long long) (options->TimeLimit * 1e9) : 0;
+    stop->IsCancelRequested = options->IsCancelRequested;
+}
+
+static bool _CliqueStop_IsStopped(_CliqueStop *stop, unsigned long long *nodes)
+{
+    if (++*nodes % CLIQUE_CHECK_INTERVAL == 0)
+    {
+        bool isCancelled = stop->IsCancelRequested != NULL && atomic_load_explicit(stop->IsCancelRequested, memory_order_relaxed);
+        if (isCancelled || (stop->Deadline != 0 && Profiler_Now() > stop->Deadline)) atomic_store(&stop->IsStopped, true);
+    }
+    return atomic_load_explicit(&stop->IsStopped, memory_order_relaxed);
+}
+
+/// The state every thread of the enumeration shares
+typedef struct
+{
+    const BitMatrix *Matrix;
+    const VertexIndex *Order;
+
+    /// The place of each vertex in the degeneracy order
+    uint32_t *Positions;
+    unsigned int Degeneracy;
+    unsigned int MaxDegree;
+
+    CliqueFunction Found;
+    void *Context;
+    _CliqueStop Stop;
+    atomic_size_t NextTask;
+    atomic_ullong Count;
+} _Maximal;
+
+/// The neighbors of the vertex of the top level branch a thread is on, relabeled from 0
+typedef struct
+{
+    _Maximal *Shared;
+    unsigned int Thread;
+
+    /// The vertex each label stands for, and the neighbors of each label among them in rows of Words words
+    uint32_t *Vertices;
+    uint64_t *Rows;
+    size_t Words;
+
+    /// The candidates, the vertices already tried and the branches left of each level, Words words each
+    uint64_t *Levels;
+
+    /// The clique of the branch, the vertex of the top level branch first
+    uint32_t *Clique;
+
+    unsigned long long Nodes;
+    unsigned long long Count;
+} _MaximalSearch;
+
+/// Grows the clique by each candidate that is not a neighbor of the pivot, as the cliques with the pivot or one of its
+/// neighbors are found from the pivot's branch or from a branch below this one
+/// - Returns: false once the enumeration is stopped
+static bool _MaximalSearch_Branch(_MaximalSearch *s, unsigned int level, unsigned int size)
+{
+    _Maximal *c = s->Shared;
+    if (_CliqueStop_IsStopped(&c->Stop, &s->Nodes)) return false;
+
+    const size_t words = s->Words;
+    uint64_t *candidates = s->Levels + level * 3 * words;
+    uint64_t *tried = candidates + words;
+    uint64_t *branches = tried + words;
+
+    // A clique is maximal once nothing could be added to it, tried or not
+    if (!Bitset_Intersects(candidates, candidates, words))
+    {
+        if (Bitset_Intersects(tried, tried, words)) return true;
+        s->Count++;
+        if (c->Found(c->Context, s->Thread, s->Clique, size)) return true;
+        atomic_store(&c->Stop.IsStopped, true);
+        return false;
+    }
+
+    // The pivot with the most candidates as neighbors leaves the fewest branches
+    size_t pivot = 0, most = 0;
+    bool hasPivot = false;
+    for (size_t w = 0; w < words; w++)
+    {
+        for (uint64_t word = candidates[w] | tried[w]; word != 0; word &= word - 1)
+        {
+            const size_t u = w * 64 + __builtin_ctzll(word);
+            const size_t shared = Bitset_CountAnd(candidates, s->Rows + u * words, words);
+            if (!hasPivot || shared > most)
+            {
+                pivot = u;
+                most = shared;
+                hasPivot = true;
+            }
+        }
+    }
+    const uint64_t *pivotRow = s->Rows + pivot * words;
+    for (size_t w = 0; w < words; w++) branches[w] = candidates[w] & ~pivotRow[w];
+
+    uint64_t *nextCandidates = branches + words;
+    uint64_t *nextTried = nextCandidates + words;
+    for (size_t w = 0; w < words; w++)
+    {
+        for (uint64_t word = branches[w]; word != 0; word &= word - 1)
+        {
+            const size_t v = w * 64 + __builtin_ctzll(word);
+            const uint64_t *row = s->Rows + v * words;
+            for (size_t x = 0; x < words; x++)
+            {
+                nextCandidates[x] = candidates[x] & row[x];
+                nextTried[x] = tried[x] & row[x];
+            }
+            s->Clique[size] = s->Vertices[v];
+            if (!_MaximalSearch_Branch(s, level + 1, size + 1)) return false;
+            Bitset_Remove(candidates, v);
+            Bitset_Add(tried, v);
+        }
+    }
+    return true;
+}
+
+/// Searches the cliques whose earliest vertex in the degeneracy order is the vertex, among its neighbors
+static bool _MaximalSearch_Vertex(_MaximalSearch *s, VertexIndex v)
+{
+    _Maximal *c = s->Shared;
+    const BitMatrix *m = c->Matrix;
+    const uint64_t *row = BitMatrix_Row(m, v);
+
+    unsigned int degree = 0;
+    for (size_t u = Bitset_Next(row, m->Words, 0); u < m->Vertices; u = Bitset_Next(row, m->Words, u + 1))
+    {
+        s->Vertices[degree++] = (uint32_t) u;
+    }
+    const size_t words = BITSET_WORDS(degree);
+    s->Words = words;
+    memset(s->Rows, 0, degree * words * sizeof(uint64_t));
+    for (unsigned int i = 0; i < degree; i++)
+    {
+        const uint64_t *neighbors = BitMatrix_Row(m, s->Vertices[i]);
+        for (unsigned int j = i + 1; j < degree; j++)
+        {
+            if (!Bitset_Has(neighbors, s->Vertices[j])) continue;
+            Bitset_Add(s->Rows + i * words, j);
+            Bitset_Add(s->Rows + j * words, i);
+        }
+    }
+
+    // Neighbors after the vertex are candidates, those before it had their own branch already
+    uint64_t *candidates = s->Levels;
+    uint64_t *tried = candidates + words;
+    memset(candidates, 0, 2 * words * sizeof(uint64_t));
+    for (unsigned int i = 0; i < degree; i++)
+    {
+        Bitset_Add(c->Positions[s->Vertices[i]] > c->Positions[v] ? candidates : tried, i);
+    }
+    s->Clique[0] = v;
+    return _MaximalSearch_Branch(s, 0, 1);
+}
+
+static void _Maximal_Thread(void *context, unsigned int thread)
+{
+    _Maximal *c = context;
+    const size_t words = BITSET_WORDS(c->MaxDegree);
+    _MaximalSearch s =
+    {
+        .Shared = c,
+        .Thread = thread,
+        .Vertices = malloc((c->MaxDegree + 1) * sizeof(uint32_t)),
+        .Rows = malloc((c->MaxDegree + 1) * (words + 1) * sizeof(uint64_t)),
+
+        // Every level adds a candidate to the clique, and there are at most the degeneracy of them
+        .Levels = malloc((c->Degeneracy + 2) * 3 * (words + 1) * sizeof(uint64_t)),
+        .Clique = malloc((c->Degeneracy + 2) * sizeof(uint32_t)),
+    };
+
+    size_t task;
+    while ((task = atomic_fetch_add(&c->NextTask, 1)) < c->Matrix->Vertices)
+    {
+        if (!_MaximalSearch_Vertex(&s, c->Order[task])) break;
+    }
+    atomic_fetch_add(&c->Count, s.Count);
+
+    free(s.Vertices);
+    free(s.Rows);
+    free(s.Levels);
+    free(s.Clique);
+}
+
+unsigned long long Clique_Maximal(const BitMatrix *m, const CliqueOptions *options, CliqueFunction found, void *context)
+{
+    PROFILE_ZONE("Clique_Maximal");
+    assert(m != NULL && found != NULL);
+
+    const CliqueOptions defaults = {};
+    if (options == NULL) options = &defaults;
+    const unsigned int n = m->Vertices;
+    if (n == 0) return 0;
+
+    VertexIndex *order = malloc(n * sizeof(VertexIndex));
+    _Maximal c =
+    {
+        .Matrix = m,
+        .Order = order,
+        .Positions = malloc(n * sizeof(uint32_t)),
+        .Degeneracy = Clique_DegeneracyOrder(m, order),
+        .Found = found,
+        .Context = context,
+    };
+    _CliqueStop_Init(&c.Stop, options);
+    atomic_init(&c.NextTask, 0);
+    atomic_init(&c.Count, 0);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        c.Positions[order[i]] = i;
+        unsigned int degree = (unsigned int) Bitset_Count(BitMatrix_Row(m, order[i]), m->Words);
+        if (degree > c.MaxDegree) c.MaxDegree = degree;
+    }
+
+    const unsigned int threads = Parallel_ThreadCount(options->Threads);
+    Parallel_Run(threads < n ? threads : n, _Maximal_Thread, &c);
+
+    free(order);
+    free(c.Positions);
+    return atomic_load(&c.Count);
+}
+
+/// The buffers of one level of the maximum clique search
+typedef struct
+{
+    uint64_t *Candidates;
+
+    /// The candidates in order of their color, with colors too low to beat the best clique left out
+    uint32_t *Order;
+    uint32_t *Colors;
+} _MaximumLevel;
+
+/// The state every thread of the maximum clique search shares
+typedef struct
+{
+    /// The graph relabeled in reverse degeneracy order, so greedy coloring takes the densest vertices first
+    const BitMatrix *Matrix;
+    const VertexIndex *Labels;
+    unsigned int Degeneracy;
+    unsigned int MaxDegree;
+
+    /// The size of the best clique, only larger ones replace it
+    atomic_uint Best;
+    uint32_t *BestClique;
+    pthread_mutex_t Mutex;
+
+    _CliqueStop Stop;
+
+    /// The branches from the root, searched from the last, and the place of each vertex among them
+    _MaximumLevel Root;
+    unsigned int RootCount;
+    uint32_t *Positions;
+    atomic_uint NextTask;
+} _Maximum;
+
+typedef struct
+{
+    _Maximum *Shared;
+
+    /// Levels allocated as the search first reaches them
+    _MaximumLevel *Levels;
+    uint64_t *Uncolored;
+    uint64_t *Class;
+    uint32_t *Clique;
+    unsigned long long Nodes;
+} _MaximumSearch;
+
+/// Colors the candidates greedily, each color class taking the first candidate that has no neighbor in it yet
+/// - Parameters:
+///   - least: the lowest color worth branching on, candidates of lower colors are left out of the order
+/// - Returns: The candidates in the order
+static unsigned int _Maximum_ColorSort(const BitMatrix *m, const uint64_t *candidates, unsigned int least, uint64_t *uncolored,
+                                       uint64_t *class, uint32_t *order, uint32_t *colors)
+{
+    const size_t words = m->Words;
+    memcpy(uncolored, candidates, words * sizeof(uint64_t));
+    unsigned int count = 0;
+    size_t first = Bitset_Next(uncolored, words, 0);
+    for (unsigned int color = 1; first < m->Vertices; color++)
+    {
+        memcpy(class + first / 64, uncolored + first / 64, (words - first / 64) * sizeof(uint64_t));
+        for (size_t v = first; v < m->Vertices; v = Bitset_Next(class, words, v + 1))
+        {
+            Bitset_Remove(uncolored, v);
+            const uint64_t *row = BitMatrix_Row(m, (VertexIndex) v);
+            for (size_t w = v / 64; w < words; w++) class[w] &= ~row[w];
+            if (color < least) continue;
+            order[count] = (uint32_t) v;
+            colors[count++] = color;
+        }
+        first = Bitset_Next(uncolored, words, first);
+    }
+    return count;
+}
+
+static void _Maximum_Offer(_Maximum *c, const uint32_t *clique, unsigned int size)
+{
+    pthread_mutex_lock(&c->Mutex);
+    if (size > atomic_load(&c->Best))
+    {
+        for (unsigned int i = 0; i < size; i++) c->BestClique[i] = c->Labels[clique[i]];
+        atomic_store(&c->Best, size);
+    }
+    pthread_mutex_unlock(&c->Mutex);
+}
+
+static _MaximumLevel *_MaximumSearch_Level(_MaximumSearch *s, unsigned int level)
+{
+    _MaximumLevel *l = &s->Levels[level];
+    if (l->Candidates != NULL) return l;
+    const _Maximum *c = s->Shared;
+    l->Candidates = malloc(c->Matrix->Words * sizeof(uint64_t));
+    l->Order = malloc((c->MaxDegree + 1) * sizeof(uint32_t));
+    l->Colors = malloc((c->MaxDegree + 1) * sizeof(uint32_t));
+    return l;
+}
+
+/// Branches on the candidates of the level from the highest color down, until the colors left cannot beat the best clique
+static void _MaximumSearch_Branch(_MaximumSearch *s, unsigned int level, unsigned int size)
+{
+    _Maximum *c = s->Shared;
+    const BitMatrix *m = c->Matrix;
+    _MaximumLevel *l = &s->Levels[level];
+    const unsigned int best = atomic_load_explicit(&c->Best, memory_order_relaxed);
+    const unsigned int least = best >= size ? best - size + 1 : 1;
+    unsigned int count = _Maximum_ColorSort(m, l->Candidates, least, s->Uncolored, s->Class, l->Order, l->Colors);
+
+    for (unsigned int i = count; i-- > 0;)
+    {
+        if (_CliqueStop_IsStopped(&c->Stop, &s->Nodes)) return;
+        if (size + l->Colors[i] <= atomic_load_explicit(&c->Best, memory_order_relaxed)) return;
+
+        const uint32_t v = l->Order[i];
+        const uint64_t *row = BitMatrix_Row(m, v);
+        _MaximumLevel *next = _MaximumSearch_Level(s, level + 1);
+        bool isEmpty = true;
+        for (size_t w = 0; w < m->Words; w++)
+        {
+            next->Candidates[w] = l->Candidates[w] & row[w];
+            isEmpty &= next->Candidates[w] == 0;
+        }
+        s->Clique[size] = v;
+        if (isEmpty) _Maximum_Offer(c, s->Clique, size + 1);
+        else _MaximumSearch_Branch(s, level + 1, size + 1);
+        Bitset_Remove(l->Candidates, v);
+    }
+}
+
+static void _Maximum_Thread(void *context, unsigned int thread)
+{
+    (void) thread;
+    _Maximum *c = context;
+    const size_t words = c->Matrix->Words;
+    _MaximumSearch s =
+    {
+        .Shared = c,
+        .Levels = calloc(c->Degeneracy + 3, sizeof(_MaximumLevel)),
+        .Uncolored = malloc(words * sizeof(uint64_t)),
+        .Class = malloc(words * sizeof(uint64_t)),
+        .Clique = malloc((c->Degeneracy + 2) * sizeof(uint32_t)),
+    };
+
+    // Each branch from the root has the vertices before it in the root order as candidates
+    unsigned int task;
+    while ((task = atomic_fetch_add(&c->NextTask, 1)) < c->RootCount)
+    {
+        const unsigned int i = c->RootCount - 1 - task;
+        if (1 + c->Root.Colors[i] <= atomic_load(&c->Best) || atomic_load(&c->Stop.IsStopped)) break;
+
+        const uint32_t v = c->Root.Order[i];
+        const uint64_t *row = BitMatrix_Row(c->Matrix, v);
+        _MaximumLevel *l = _MaximumSearch_Level(&s, 1);
+        memset(l->Candidates, 0, words * sizeof(uint64_t));
+        bool isEmpty = true;
+        for (size_t u = Bitset_Next(row, words, 0); u < c->Matrix->Vertices; u = Bitset_Next(row, words, u + 1))
+        {
+            if (c->Positions[u] >= i) continue;
+            Bitset_Add(l->Candidates, u);
+            isEmpty = false;
+        }
+        s.Clique[0] = v;
+        if (isEmpty) _Maximum_Offer(c, s.Clique, 1);
+        else _MaximumSearch_Branch(&s, 1, 1);
+    }
+
+    for (unsigned int level = 0; level < c->Degeneracy + 3; level++)
+    {
+        free(s.Levels[level].Candidates);
+        free(s.Levels[level].Order);
+        free(s.Levels[level].Colors);
+    }
+    free(s.Levels);
+    free(s.Uncolored);
+    free(s.Class);
+    free(s.Clique);
+}
+
+unsigned int Clique_Maximum(const BitMatrix *m, const CliqueOptions *options, uint32_t *clique, bool *isOptimal)
+{
+    PROFILE_ZONE("Clique_Maximum");
+    assert(m != NULL && clique != NULL);
+
+    const CliqueOptions defaults = {};
+    if (options == NULL) options = &defaults;
+    const unsigned int n = m->Vertices;
+    if (isOptimal != NULL) *isOptimal = true;
+    if (n == 0) return 0;
+
+    // The last vertex taken out of the degeneracy order is in the densest core, so it gets the first label
+    VertexIndex *labels = malloc(n * sizeof(VertexIndex));
+    uint32_t *relabeled = malloc(n * sizeof(uint32_t));
+    const unsigned int degeneracy = Clique_DegeneracyOrder(m, labels);
+    for (unsigned int i = 0; i < n / 2; i++)
+    {
+        VertexIndex v = labels[i];
+        labels[i] = labels[n - 1 - i];
+        labels[n - 1 - i] = v;
+    }
+    for (unsigned int i = 0; i < n; i++) relabeled[labels[i]] = i;
+
+    BitMatrix ordered = { .Vertices = n, .Words = m->Words, .Rows = calloc(n * m->Words, sizeof(uint64_t)) };
+    unsigned int maxDegree = 0;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        const uint64_t *row = BitMatrix_Row(m, labels[i]);
+        unsigned int degree = 0;
+        for (size_t u = Bitset_Next(row, m->Words, 0); u < n; u = Bitset_Next(row, m->Words, u + 1), degree++)
+        {
+            Bitset_Add(ordered.Rows + i * m->Words, relabeled[u]);
+        }
+        if (degree > maxDegree) maxDegree = degree;
+    }
+
+    _Maximum c =
+    {
+        .Matrix = &ordered,
+        .Labels = labels,
+        .Degeneracy = degeneracy,
+        .MaxDegree = maxDegree,
+        .BestClique = clique,
+        .Root =
+        {
+            .Candidates = malloc(m->Words * sizeof(uint64_t)),
+            .Order = malloc(n * sizeof(uint32_t)),
+            .Colors = malloc(n * sizeof(uint32_t)),
+        },
+        .Positions = relabeled,
+    };
+    atomic_init(&c.Best, 0);
+    atomic_init(&c.NextTask, 0);
+    pthread_mutex_init(&c.Mutex, NULL);
+    _CliqueStop_Init(&c.Stop, options);
+
+    // Every vertex is a branch from the root
+    uint64_t *uncolored = malloc(m->Words * sizeof(uint64_t));
+    uint64_t *class = malloc(m->Words * sizeof(uint64_t));
+    memset(c.Root.Candidates, 0, m->Words * sizeof(uint64_t));
+    for (VertexIndex v = 0; v < n; v++) Bitset_Add(c.Root.Candidates, v);
+    c.RootCount = _Maximum_ColorSort(&ordered, c.Root.Candidates, 1, uncolored, class, c.Root.Order, c.Root.Colors);
+    for (unsigned int i = 0; i < c.RootCount; i++) c.Positions[c.Root.Order[i]] = i;
+    free(uncolored);
+    free(class);
+
+    const unsigned int threads = Parallel_ThreadCount(options->Threads);
+    Parallel_Run(threads < n ? threads : n, _Maximum_Thread, &c);
+
+    // No clique is larger than the degeneracy plus one, so reaching it proves the clique largest even when stopped
+    const unsigned int best = atomic_load(&c.Best);
+    if (isOptimal != NULL) *isOptimal = !atomic_load(&c.Stop.IsStopped) || best == degeneracy + 1;
+
+    pthread_mutex_destroy(&c.Mutex);
+    free(c.Root.Candidates);
+    free(c.Root.Order);
+    free(c.Root.Colors);
+    free(ordered.Rows);
+    free(labels);
+    free(relabeled);
+    return best;
+}
+
+unsigned int Graph_MaximumClique(const Graph *g, const CliqueOptions *options, VertexIndex clique[GRAPH_MAX_SIZE],
+                                 bool *isOptimal)
+{
+    PROFILE_ZONE("Graph_MaximumClique");
+    assert(g != NULL && clique != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    uint32_t found[GRAPH_MAX_SIZE];
+    unsigned int size = Clique_Maximum(m, options, found, isOptimal);
+    for (unsigned int i = 0; i < size; i++) clique[i] = found[i];
+    BitMatrix_FreeBitMatrix(m);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return size;
+}
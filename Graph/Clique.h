@@ -0,0 +1,70 @@
+//
+//  Clique.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Clique_h
+#define Clique_h
+
+#include <stdatomic.h>
+#include "BitMatrix.h"
+
+/// Receives each maximal clique as it is found. The vertices are only valid during the call.
+/// - Parameters:
+///   - context: passed through from Clique_Maximal
+///   - thread: the thread that found the clique, from 0 up to the threads searching, so totals can be kept per thread
+///     without locking. Different threads call at the same time.
+/// - Returns: false to stop the enumeration
+typedef bool (*CliqueFunction)(void *context, unsigned int thread, const uint32_t *clique, unsigned int size);
+
+/// When and where the clique searches stop
+typedef struct
+{
+    /// The threads to search top level branches on, 0 for one per processor
+    unsigned int Threads;
+
+    /// Seconds to search for, 0 for no limit
+    double TimeLimit;
+
+    /// Set by another thread to stop the search, or NULL
+    atomic_bool *IsCancelRequested;
+} CliqueOptions;
+
+/// Matula and Beck's smallest last ordering, repeatedly taking out the vertex of the fewest neighbors left, in O(V^2 / 64)
+/// - Parameters:
+///   - order: Vertices entries, set to the vertices in the order they were taken out
+/// - Returns: The degeneracy, no vertex has more neighbors after it in the order
+unsigned int Clique_DegeneracyOrder(const BitMatrix *m, VertexIndex *order);
+
+/// Bron and Kerbosch's enumeration of every maximal clique, pivoting as Tomita, Tanaka and Takahashi do on the vertex with
+/// the most candidates as neighbors. Following Eppstein, Löffler and Strash, the outer loop takes each vertex in degeneracy
+/// order with its later neighbors as candidates, so every branch is on the neighbors of one vertex, relabeled into sets of
+/// no more words than its degree. The threads take these top level branches one at a time, and cliques are handed to the
+/// function as they are found, so none are kept.
+/// - Parameters:
+///   - options: threads, time limit and cancellation, or NULL to search on every processor until done
+/// - Returns: The cliques handed to the function
+unsigned long long Clique_Maximal(const BitMatrix *m, const CliqueOptions *options, CliqueFunction found, void *context);
+
+/// The largest clique, by San Segundo's bitset branch and bound. The candidates of each branch are colored greedily one color
+/// class at a time, and since a clique takes at most one vertex per color, no branch with fewer colors left than the best
+/// clique needs is searched. The branches from the root are shared between the threads, which share the best clique.
+/// - Parameters:
+///   - options: see Clique_Maximal, or NULL
+///   - clique: set to the vertices of the clique, at most the degeneracy plus one of them
+///   - isOptimal: set to false if the search was stopped before it proved the clique largest, or NULL
+/// - Returns: The size of the clique
+unsigned int Clique_Maximum(const BitMatrix *m, const CliqueOptions *options, uint32_t *clique, bool *isOptimal);
+
+/// The largest clique of the graph, ignoring the direction of each edge and self loops
+/// - Parameters:
+///   - options: see Clique_Maximal, or NULL
+///   - clique: set to the vertices of the clique
+///   - isOptimal: see Clique_Maximum, or NULL
+/// - Returns: The size of the clique
+unsigned int Graph_MaximumClique(const Graph *g, const CliqueOptions *options, VertexIndex clique[GRAPH_MAX_SIZE],
+                                 bool *isOptimal);
+
+#endif /* Clique_h */
@@ -0,0 +1,405 @@
+//
+//  Coloring.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Coloring.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Util/Parallel.h"
+#include "Util/Profiler.h"
+
+/// The color of a vertex not colored yet
+#define COLORING_NONE UINT32_MAX
+
+/// Nodes searched between looks at the clock and the cancellation flag
+#define COLORING_CHECK_INTERVAL 1024
+
+/// Subtrees split off per thread, so threads that finish early find more work
+#define COLORING_TASKS_PER_THREAD 8
+
+/// The deepest the tree is split at
+#define COLORING_MAX_SPLIT_DEPTH 8
+
+unsigned int Coloring_DSatur(const BitMatrix *m, uint32_t *colors)
+{
+    PROFILE_ZONE("Coloring_DSatur");
+    assert(m != NULL && colors != NULL);
+
+    // No vertex needs more colors than there are vertices, so the colors around each vertex fit in a row of its own
+    const unsigned int n = m->Vertices;
+    const size_t words = m->Words;
+    uint64_t *neighborColors = calloc(n * words, sizeof(uint64_t));
+    uint32_t *saturation = calloc(n, sizeof(uint32_t));
+    uint32_t *degrees = malloc(n * sizeof(uint32_t));
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        colors[v] = COLORING_NONE;
+        degrees[v] = (uint32_t) Bitset_Count(BitMatrix_Row(m, v), words);
+    }
+
+    unsigned int used = 0;
+    for (unsigned int step = 0; step < n; step++)
+    {
+        VertexIndex v = n;
+        for (VertexIndex u = 0; u < n; u++)
+        {
+            if (colors[u] != COLORING_NONE) continue;
+            if (v == n || saturation[u] > saturation[v] || (saturation[u] == saturation[v] && degrees[u] > degrees[v])) v = u;
+        }
+
+        // The lowest color missing from the row
+        const uint64_t *around = neighborColors + v * words;
+        size_t w = 0;
+        while (around[w] == ~0ull) w++;
+        const uint32_t color = (uint32_t) (w * 64 + __builtin_ctzll(~around[w]));
+        colors[v] = color;
+        if (color + 1 > used) used = color + 1;
+
+        const uint64_t *row = BitMatrix_Row(m, v);
+        for (size_t u = Bitset_Next(row, words, 0); u < n; u = Bitset_Next(row, words, u + 1))
+        {
+            uint64_t *other = neighborColors + u * words;
+            if (colors[u] != COLORING_NONE || Bitset_Has(other, color)) continue;
+            Bitset_Add(other, color);
+            saturation[u]++;
+        }
+    }
+
+    free(neighborColors);
+    free(saturation);
+    free(degrees);
+    return used;
+}
+
+/// The state every thread of the exact search shares
+typedef struct
+{
+    const BitMatrix *Matrix;
+
+    /// Colors of the best coloring found, only fewer colors replace it
+    atomic_uint Best;
+    uint32_t *BestColors;
+    pthread_mutex_t Mutex;
+
+    /// The size of a clique, no coloring uses fewer colors, so reaching it ends the search
+    unsigned int LowerBound;
+
+    /// Set once the time is up or the search is cancelled, the best coloring is then not proven optimal
+    atomic_bool IsStopped;
+    unsigned long long Deadline;
+    atomic_bool *IsCancelRequested;
+
+    /// Partial colorings of Vertices entries each, whose subtrees the threads search
+    uint32_t *Tasks;
+    size_t TaskCount;
+    size_t TaskCapacity;
+    unsigned int SplitDepth;
+    atomic_size_t NextTask;
+} _Chromatic;
+
+/// A path from the root of the tree, one per thread
+typedef struct
+{
+    _Chromatic *Shared;
+    uint32_t *Colors;
+
+    /// The vertices of each color, Used of them in use
+    uint64_t *Classes;
+    unsigned int Used;
+
+    uint64_t *Uncolored;
+    unsigned int Colored;
+
+    /// Split the tree at SplitDepth into tasks, rather than searching past it
+    bool IsSplitting;
+    unsigned long long Nodes;
+} _Search;
+
+static void _Search_Init(_Search *s, _Chromatic *c)
+{
+    const unsigned int n = c->Matrix->Vertices;
+    s->Shared = c;
+    s->Colors = malloc(n * sizeof(uint32_t));
+    s->Classes = calloc(n * c->Matrix->Words, sizeof(uint64_t));
+    s->Uncolored = calloc(c->Matrix->Words, sizeof(uint64_t));
+    s->IsSplitting = false;
+    s->Nodes = 0;
+}
+
+static void _Search_Free(_Search *s)
+{
+    free(s->Colors);
+    free(s->Classes);
+    free(s->Uncolored);
+}
+
+/// Starts the path at a partial coloring, whose colors are numbered from 0 without gaps
+static void _Search_Restore(_Search *s, const uint32_t *colors)
+{
+    const BitMatrix *m = s->Shared->Matrix;
+    memcpy(s->Colors, colors, m->Vertices * sizeof(uint32_t));
+    memset(s->Classes, 0, m->Vertices * m->Words * sizeof(uint64_t));
+    memset(s->Uncolored, 0, m->Words * sizeof(uint64_t));
+    s->Used = 0;
+    s->Colored = 0;
+    for (VertexIndex v = 0; v < m->Vertices; v++)
+    {
+        if (colors[v] == COLORING_NONE)
+        {
+            Bitset_Add(s->Uncolored, v);
+            continue;
+        }
+        Bitset_Add(s->Classes + colors[v] * m->Words, v);
+        if (colors[v] + 1 > s->Used) s->Used = colors[v] + 1;
+        s->Colored++;
+    }
+}
+
+static bool _Chromatic_IsStopped(_Chromatic *c, _Search *s)
+{
+    if (++s->Nodes % COLORING_CHECK_INTERVAL == 0)
+    {
+        bool isCancelled = c->IsCancelRequested != NULL && atomic_load_explicit(c->IsCancelRequested, memory_order_relaxed);
+        if (isCancelled || (c->Deadline != 0 && Profiler_Now() > c->Deadline)) atomic_store(&c->IsStopped, true);
+    }
+    return atomic_load_explicit(&c->IsStopped, memory_order_relaxed);
+}
+
+/// Keeps the coloring of the path if it uses fewer colors than the best
+static void _Chromatic_Offer(_Chromatic *c, const _Search *s)
+{
+    pthread_mutex_lock(&c->Mutex);
+    if (s->Used < atomic_load(&c->Best))
+    {
+        memcpy(c->BestColors, s->Colors, c->Matrix->Vertices * sizeof(uint32_t));
+        atomic_store(&c->Best, s->Used);
+    }
+    pthread_mutex_unlock(&c->Mutex);
+}
+
+static void _Chromatic_AddTask(_Chromatic *c, const uint32_t *colors)
+{
+    const unsigned int n = c->Matrix->Vertices;
+    if (c->TaskCount == c->TaskCapacity)
+    {
+        c->TaskCapacity = c->TaskCapacity == 0 ? 64 : c->TaskCapacity * 2;
+        c->Tasks = realloc(c->Tasks, c->TaskCapacity * n * sizeof(uint32_t));
+    }
+    memcpy(c->Tasks + c->TaskCount++ * n, colors, n * sizeof(uint32_t));
+}
+
+/// Colors the uncolored vertex with the most colors among its neighbors next, ties going to the most uncolored neighbors
+/// - Returns: The vertex, with the colors it can take in allowed
+static VertexIndex _Search_Choose(const _Search *s, uint64_t *allowed)
+{
+    const BitMatrix *m = s->Shared->Matrix;
+    const size_t words = m->Words;
+    VertexIndex best = m->Vertices;
+    unsigned int bestSaturation = 0;
+    size_t bestDegree = 0;
+    for (size_t v = Bitset_Next(s->Uncolored, words, 0); v < m->Vertices; v = Bitset_Next(s->Uncolored, words, v + 1))
+    {
+        const uint64_t *row = BitMatrix_Row(m, (VertexIndex) v);
+        unsigned int saturation = 0;
+        for (unsigned int color = 0; color < s->Used; color++)
+        {
+            saturation += Bitset_Intersects(s->Classes + color * words, row, words);
+        }
+        size_t degree = Bitset_CountAnd(row, s->Uncolored, words);
+        if (best == m->Vertices || saturation > bestSaturation || (saturation == bestSaturation && degree > bestDegree))
+        {
+            best = (VertexIndex) v;
+            bestSaturation = saturation;
+            bestDegree = degree;
+        }
+
+        // Every color is taken around it, nothing is more saturated
+        if (saturation == s->Used) break;
+    }
+
+    memset(allowed, 0, BITSET_WORDS(s->Used + 1) * sizeof(uint64_t));
+    const uint64_t *row = BitMatrix_Row(m, best);
+    for (unsigned int color = 0; color < s->Used; color++)
+    {
+        if (!Bitset_Intersects(s->Classes + color * words, row, words)) Bitset_Add(allowed, color);
+    }
+    return best;
+}
+
+/// Searches the subtree of the path. Recursion is at most one level per vertex, and exact coloring is only practical on
+/// graphs small enough for that.
+static void _Search_Branch(_Search *s, unsigned int depth)
+{
+    _Chromatic *c = s->Shared;
+    const BitMatrix *m = c->Matrix;
+    if (_Chromatic_IsStopped(c, s)) return;
+
+    const unsigned int best = atomic_load_explicit(&c->Best, memory_order_relaxed);
+    if (s->Used >= best || best <= c->LowerBound) return;
+    if (s->Colored == m->Vertices)
+    {
+        _Chromatic_Offer(c, s);
+        return;
+    }
+    if (s->IsSplitting && depth == c->SplitDepth)
+    {
+        _Chromatic_AddTask(c, s->Colors);
+        return;
+    }
+
+    uint64_t allowed[BITSET_WORDS(s->Used + 1)];
+    const VertexIndex v = _Search_Choose(s, allowed);
+    Bitset_Remove(s->Uncolored, v);
+    s->Colored++;
+
+    for (size_t color = Bitset_Next(allowed, BITSET_WORDS(s->Used + 1), 0); color < s->Used;
+         color = Bitset_Next(allowed, BITSET_WORDS(s->Used + 1), color + 1))
+    {
+        uint64_t *class = s->Classes + color * m->Words;
+        s->Colors[v] = (uint32_t) color;
+        Bitset_Add(class, v);
+        _Search_Branch(s, depth + 1);
+        Bitset_Remove(class, v);
+    }
+
+    // A new color, while it still beats the best
+    if (s->Used + 1 < atomic_load_explicit(&c->Best, memory_order_relaxed))
+    {
+        uint64_t *class = s->Classes + s->Used * m->Words;
+        s->Colors[v] = s->Used;
+        Bitset_Add(class, v);
+        s->Used++;
+        _Search_Branch(s, depth + 1);
+        s->Used--;
+        Bitset_Remove(class, v);
+    }
+
+    s->Colors[v] = COLORING_NONE;
+    Bitset_Add(s->Uncolored, v);
+    s->Colored--;
+}
+
+static void _Chromatic_Thread(void *context, unsigned int thread)
+{
+    (void) thread;
+    _Chromatic *c = context;
+    _Search s;
+    _Search_Init(&s, c);
+    size_t task;
+    while ((task = atomic_fetch_add(&c->NextTask, 1)) < c->TaskCount)
+    {
+        _Search_Restore(&s, c->Tasks + task * c->Matrix->Vertices);
+        _Search_Branch(&s, c->SplitDepth);
+        if (atomic_load(&c->IsStopped)) break;
+    }
+    _Search_Free(&s);
+}
+
+/// Grows a clique from the vertex of the highest degree, adding the candidate with the most neighbors among the candidates
+/// - Returns: The size of the clique, with its vertices colored from 0
+static unsigned int _Chromatic_GreedyClique(const BitMatrix *m, uint32_t *colors)
+{
+    const size_t words = m->Words;
+    uint64_t *candidates = malloc(words * sizeof(uint64_t));
+    for (size_t w = 0; w < words; w++) candidates[w] = ~0ull;
+    if (m->Vertices % 64 != 0) candidates[words - 1] = (1ull << (m->Vertices % 64)) - 1;
+
+    unsigned int size = 0;
+    while (Bitset_Next(candidates, words, 0) < m->Vertices)
+    {
+        VertexIndex best = m->Vertices;
+        size_t bestDegree = 0;
+        for (size_t v = Bitset_Next(candidates, words, 0); v < m->Vertices; v = Bitset_Next(candidates, words, v + 1))
+        {
+            size_t degree = Bitset_CountAnd(BitMatrix_Row(m, (VertexIndex) v), candidates, words);
+            if (best == m->Vertices || degree > bestDegree)
+            {
+                best = (VertexIndex) v;
+                bestDegree = degree;
+            }
+        }
+        colors[best] = size++;
+        const uint64_t *row = BitMatrix_Row(m, best);
+        for (size_t w = 0; w < words; w++) candidates[w] &= row[w];
+    }
+    free(candidates);
+    return size;
+}
+
+unsigned int Coloring_Chromatic(const BitMatrix *m, const ColoringOptions *options, uint32_t *colors, bool *isOptimal)
+{
+    PROFILE_ZONE("Coloring_Chromatic");
+    assert(m != NULL && colors != NULL);
+
+    const ColoringOptions defaults = {};
+    if (options == NULL) options = &defaults;
+    const unsigned int n = m->Vertices;
+
+    _Chromatic c =
+    {
+        .Matrix = m,
+        .BestColors = colors,
+        .Deadline = options->TimeLimit > 0 ? Profiler_Now() + (unsigned long long) (options->TimeLimit * 1e9) : 0,
+        .IsCancelRequested = options->IsCancelRequested,
+    };
+    atomic_init(&c.Best, Coloring_DSatur(m, colors));
+    atomic_init(&c.IsStopped, false);
+    atomic_init(&c.NextTask, 0);
+    pthread_mutex_init(&c.Mutex, NULL);
+
+    // Colors of a clique can be fixed, any coloring is a renaming of one that agrees on them
+    uint32_t *root = malloc(n * sizeof(uint32_t));
+    for (VertexIndex v = 0; v < n; v++) root[v] = COLORING_NONE;
+    c.LowerBound = n > 0 ? _Chromatic_GreedyClique(m, root) : 0;
+
+    // Deepen the split until there are enough subtrees to share, or the split itself finished the search
+    const unsigned int threads = Parallel_ThreadCount(options->Threads);
+    _Search s;
+    _Search_Init(&s, &c);
+    s.IsSplitting = threads > 1;
+    c.SplitDepth = threads > 1 ? 1 : 0;
+    for (;;)
+    {
+        c.TaskCount = 0;
+        _Search_Restore(&s, root);
+        if (!s.IsSplitting) _Chromatic_AddTask(&c, root);
+        else _Search_Branch(&s, 0);
+        if (!s.IsSplitting || c.TaskCount >= threads * COLORING_TASKS_PER_THREAD || c.TaskCount == 0 ||
+            c.SplitDepth == COLORING_MAX_SPLIT_DEPTH || atomic_load(&c.IsStopped)) break;
+        c.SplitDepth++;
+    }
+    _Search_Free(&s);
+
+    if (c.TaskCount > 0 && !atomic_load(&c.IsStopped))
+    {
+        Parallel_Run((unsigned int) (c.TaskCount < threads ? c.TaskCount : threads), _Chromatic_Thread, &c);
+    }
+    if (isOptimal != NULL) *isOptimal = !atomic_load(&c.IsStopped) || atomic_load(&c.Best) <= c.LowerBound;
+
+    pthread_mutex_destroy(&c.Mutex);
+    free(c.Tasks);
+    free(root);
+    return atomic_load(&c.Best);
+}
+
+unsigned int Graph_ChromaticNumber(const Graph *g, const ColoringOptions *options, unsigned int colors[GRAPH_MAX_SIZE],
+                                   bool *isOptimal)
+{
+    PROFILE_ZONE("Graph_ChromaticNumber");
+    assert(g != NULL && colors != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    uint32_t found[GRAPH_MAX_SIZE];
+    unsigned int count = Coloring_Chromatic(m, options, found, isOptimal);
+    for (VertexIndex v = 0; v < g->Vertices; v++) colors[v] = found[v];
+    BitMatrix_FreeBitMatrix(m);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return count;
+}
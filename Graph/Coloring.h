@@ -0,0 +1,54 @@
+//
+//  Coloring.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Coloring_h
+#define Coloring_h
+
+#include <stdatomic.h>
+#include "BitMatrix.h"
+
+/// When and where the exact search stops
+typedef struct
+{
+    /// The threads to search subtrees on, 0 for one per processor
+    unsigned int Threads;
+
+    /// Seconds to search for, 0 for no limit
+    double TimeLimit;
+
+    /// Set by another thread to stop the search, or NULL
+    atomic_bool *IsCancelRequested;
+} ColoringOptions;
+
+/// Brélaz's DSatur, coloring the vertex whose neighbors have the most distinct colors next with the lowest color none of them
+/// have, ties going to the vertex of the highest degree, in O(V^2). Adjacent vertices never share a color.
+/// - Parameters:
+///   - colors: Vertices entries, set to the color of each vertex, numbered from 0
+/// - Returns: The colors used, an upper bound of the chromatic number
+unsigned int Coloring_DSatur(const BitMatrix *m, uint32_t *colors);
+
+/// The chromatic number by branch and bound, starting from a DSatur coloring and a greedy clique whose vertices each get
+/// their own color. Every branch colors the most saturated vertex with each color no neighbor has, or a new one while that
+/// still beats the best coloring, testing each color class against the row of the vertex 64 vertices at a time. The top of
+/// the tree is split into subtrees that the threads take one at a time, sharing the best coloring so each prunes with it.
+/// - Parameters:
+///   - options: threads, time limit and cancellation, or NULL to search on every processor until done
+///   - colors: Vertices entries, set to the color of each vertex of the best coloring found
+///   - isOptimal: set to false if the search was stopped before it proved the coloring optimal, or NULL
+/// - Returns: The colors used, the chromatic number when optimal
+unsigned int Coloring_Chromatic(const BitMatrix *m, const ColoringOptions *options, uint32_t *colors, bool *isOptimal);
+
+/// The chromatic number of the graph, ignoring the direction of each edge and self loops
+/// - Parameters:
+///   - options: see Coloring_Chromatic, or NULL
+///   - colors: set to the color of each vertex, numbered from 0
+///   - isOptimal: see Coloring_Chromatic, or NULL
+/// - Returns: The colors used
+unsigned int Graph_ChromaticNumber(const Graph *g, const ColoringOptions *options, unsigned int colors[GRAPH_MAX_SIZE],
+                                   bool *isOptimal);
+
+#endif /* Coloring_h */
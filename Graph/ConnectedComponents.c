@@ -0,0 +1,46 @@
+//
+//  ConnectedComponents.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Graph.h"
+#include <assert.h>
+
+#define NO_COMPONENT (unsigned int)(-1)
+
+unsigned int Graph_ConnectedComponents(const Graph *g, unsigned int components[GRAPH_MAX_SIZE])
+{
+    assert(g != NULL);
+    
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        components[v] = NO_COMPONENT;
+    }
+    
+    unsigned int count = 0;
+    VertexIndex stack[GRAPH_MAX_SIZE];
+    for (VertexIndex root = 0; root < g->Vertices; root++)
+    {
+        if (components[root] != NO_COMPONENT) continue;
+        
+        // Depth first search from the root, following edges both ways
+        unsigned int size = 0;
+        components[root] = count;
+        stack[size++] = root;
+        while (size > 0)
+        {
+            VertexIndex v = stack[--size];
+            for (VertexIndex u = 0; u < g->Vertices; u++)
+            {
+                if (components[u] != NO_COMPONENT) continue;
+                if (!g->AdjMatrix[v][u] && !g->AdjMatrix[u][v]) continue;
+                components[u] = count;
+                stack[size++] = u;
+            }
+        }
+        count++;
+    }
+    return count;
+}
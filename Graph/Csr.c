@@ -0,0 +1,135 @@
+//
+//  Csr.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Csr.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Util/Counters.h"
+
+static Csr *_Csr_CreateCsr(unsigned int vertices, uint64_t count)
+{
+    Csr *csr = malloc(sizeof(Csr));
+    csr->Vertices = vertices;
+    csr->Count = count;
+    csr->Offsets = calloc((size_t) vertices + 1, sizeof(uint64_t));
+    csr->Targets = malloc(count * sizeof(VertexIndex));
+    csr->Weights = malloc(count * sizeof(unsigned int));
+    csr->Edges = malloc(count * sizeof(uint32_t));
+    csr->IsOwned = true;
+    assert(csr->Offsets != NULL && (count == 0 || (csr->Targets != NULL && csr->Weights != NULL && csr->Edges != NULL)));
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(Csr) + ((size_t) vertices + 1) * sizeof(uint64_t) +
+                 count * (sizeof(VertexIndex) + sizeof(unsigned int) + sizeof(uint32_t)));
+    return csr;
+}
+
+Csr *Csr_FromEdgeList(const EdgeList *el)
+{
+    assert(el != NULL);
+    if (el->Count >= UINT32_MAX) return NULL;
+    
+    Csr *csr = _Csr_CreateCsr(el->Vertices, el->Count);
+    
+    // A counting sort by source, stable so each row keeps the order of the list
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        assert(el->Sources[e] < el->Vertices && el->Targets[e] < el->Vertices);
+        csr->Offsets[el->Sources[e] + 1]++;
+    }
+    for (unsigned int v = 0; v < el->Vertices; v++)
+    {
+        csr->Offsets[v + 1] += csr->Offsets[v];
+    }
+    
+    uint64_t *next = malloc(((size_t) el->Vertices + 1) * sizeof(uint64_t));
+    memcpy(next, csr->Offsets, ((size_t) el->Vertices + 1) * sizeof(uint64_t));
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        uint64_t i = next[el->Sources[e]]++;
+        csr->Targets[i] = el->Targets[e];
+        csr->Weights[i] = el->Weights[e];
+        csr->Edges[i] = (uint32_t) e;
+    }
+    free(next);
+    return csr;
+}
+
+Csr *Csr_Transpose(const Csr *csr)
+{
+    assert(csr != NULL);
+    
+    Csr *transpose = _Csr_CreateCsr(csr->Vertices, csr->Count);
+    for (uint64_t i = 0; i < csr->Count; i++)
+    {
+        transpose->Offsets[csr->Targets[i] + 1]++;
+    }
+    for (unsigned int v = 0; v < csr->Vertices; v++)
+    {
+        transpose->Offsets[v + 1] += transpose->Offsets[v];
+    }
+    
+    // Visiting the sources in order leaves each row sorted by source
+    uint64_t *next = malloc(((size_t) csr->Vertices + 1) * sizeof(uint64_t));
+    memcpy(next, transpose->Offsets, ((size_t) csr->Vertices + 1) * sizeof(uint64_t));
+    for (unsigned int v = 0; v < csr->Vertices; v++)
+    {
+        for (uint64_t i = csr->Offsets[v]; i < csr->Offsets[v + 1]; i++)
+        {
+            uint64_t j = next[csr->Targets[i]]++;
+            transpose->Targets[j] = v;
+            transpose->Weights[j] = csr->Weights[i];
+            transpose->Edges[j] = csr->Edges[i];
+        }
+    }
+    free(next);
+    return transpose;
+}
+
+VertexIndex Csr_VertexOfEntry(const Csr *csr, uint64_t entry)
+{
+    assert(csr != NULL);
+    VertexIndex low = 0, high = csr->Vertices;
+    while (low < high)
+    {
+        VertexIndex middle = low + (high - low) / 2;
+        if (csr->Offsets[middle] < entry) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+void Csr_FreeCsr(Csr *csr)
+{
+    assert(csr != NULL);
+    if (csr->IsOwned)
+    {
+        free(csr->Offsets);
+        free(csr->Targets);
+        free(csr->Weights);
+        free(csr->Edges);
+    }
+    free(csr);
+}
+
+EdgeList *EdgeList_FromCsr(const Csr *csr)
+{
+    assert(csr != NULL);
+    
+    EdgeList *el = EdgeList_CreateEdgeList(csr->Vertices, csr->Count);
+    el->Count = csr->Count;
+    for (unsigned int v = 0; v < csr->Vertices; v++)
+    {
+        for (uint64_t i = csr->Offsets[v]; i < csr->Offsets[v + 1]; i++)
+        {
+            uint32_t e = csr->Edges[i];
+            el->Sources[e] = v;
+            el->Targets[e] = csr->Targets[i];
+            el->Weights[e] = csr->Weights[i];
+        }
+    }
+    return el;
+}
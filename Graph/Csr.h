@@ -0,0 +1,56 @@
+//
+//  Csr.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Csr_h
+#define Csr_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "EdgeList.h"
+
+/// Compressed sparse rows of a directed graph of any size. The edges leaving vertex v are the entries from Offsets[v] up to
+/// Offsets[v + 1], in the order of the edge list they came from. Each array is laid out as it is stored in a graph file,
+/// so a mapped file is read in place.
+typedef struct
+{
+    unsigned int Vertices;
+    
+    /// Entries in Targets, Weights and Edges
+    uint64_t Count;
+    
+    /// Vertices + 1 entries
+    uint64_t *Offsets;
+    
+    VertexIndex *Targets;
+    unsigned int *Weights;
+    
+    /// The index in the edge list each entry came from, which is its EdgeIndex in a Graph
+    uint32_t *Edges;
+    
+    /// The arrays are owned by the Csr, rather than by a mapped file
+    bool IsOwned;
+} Csr;
+
+/// Creates the rows of the edges of the list in O(V + E), each edge leaving its source
+/// - Returns: The rows, or NULL if the list has UINT32_MAX edges or more
+Csr *Csr_FromEdgeList(const EdgeList *el);
+
+/// Creates the rows of the edges entering each vertex in O(V + E), each entry holding the source of the edge,
+/// its weight and its edge index
+Csr *Csr_Transpose(const Csr *csr);
+
+/// - Returns: The first vertex whose row starts at or after the entry, so threads can share the rows by their edges
+VertexIndex Csr_VertexOfEntry(const Csr *csr, uint64_t entry);
+
+/// Frees the memory of the rows
+void Csr_FreeCsr(Csr *csr);
+
+/// Creates the edge list the rows came from, in its order
+EdgeList *EdgeList_FromCsr(const Csr *csr);
+
+#endif /* Csr_h */
@@ -0,0 +1,288 @@
+//
+//  Directed.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Directed.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Profiler.h"
+
+/// The search has reached the vertex
+#define DIRECTED_VISITED 0x1
+
+/// No edge from the vertex or the vertices after it in the search leads back before it, so far
+#define DIRECTED_ROOT 0x2
+
+/// The component of the vertex is found
+#define DIRECTED_DONE 0x4
+
+/// The component of a vertex before it is found
+#define DIRECTED_NO_COMPONENT UINT32_MAX
+
+/// A vertex on the path of the depth first search
+typedef struct
+{
+    VertexIndex Vertex;
+
+    /// The next entry of the row of the vertex to look at
+    uint64_t Next;
+} _Frame;
+
+unsigned int Directed_StronglyConnectedComponents(const Csr *csr, uint32_t *components)
+{
+    PROFILE_ZONE("Directed_StronglyConnectedComponents");
+    assert(csr != NULL && components != NULL);
+
+    // Until its component is found, components holds the index of each vertex in the search, lowered to the lowest index
+    // of a vertex still on the stack that it reaches
+    const unsigned int n = csr->Vertices;
+    uint8_t *flags = calloc(n, sizeof(uint8_t));
+    _Frame *path = malloc(n * sizeof(_Frame));
+    VertexIndex *stack = malloc(n * sizeof(VertexIndex));
+    size_t stackCount = 0;
+
+    uint32_t index = 0;
+    unsigned int count = 0;
+    for (VertexIndex root = 0; root < n; root++)
+    {
+        if (flags[root] != 0) continue;
+        components[root] = index++;
+        flags[root] = DIRECTED_VISITED | DIRECTED_ROOT;
+        stack[stackCount++] = root;
+        path[0] = (_Frame) { .Vertex = root, .Next = csr->Offsets[root] };
+        size_t depth = 1;
+
+        while (depth > 0)
+        {
+            _Frame *frame = &path[depth - 1];
+            const VertexIndex v = frame->Vertex;
+            if (frame->Next < csr->Offsets[v + 1])
+            {
+                const VertexIndex w = csr->Targets[frame->Next++];
+                if (flags[w] == 0)
+                {
+                    components[w] = index++;
+                    flags[w] = DIRECTED_VISITED | DIRECTED_ROOT;
+                    stack[stackCount++] = w;
+                    path[depth++] = (_Frame) { .Vertex = w, .Next = csr->Offsets[w] };
+                }
+                else if (!(flags[w] & DIRECTED_DONE) && components[w] < components[v])
+                {
+                    components[v] = components[w];
+                    flags[v] &= ~DIRECTED_ROOT;
+                }
+                continue;
+            }
+
+            // Every edge of v is searched. A root takes the vertices above it on the stack as its component.
+            depth--;
+            if (flags[v] & DIRECTED_ROOT)
+            {
+                VertexIndex w;
+                do
+                {
+                    w = stack[--stackCount];
+                    components[w] = count;
+                    flags[w] |= DIRECTED_DONE;
+                } while (w != v);
+                count++;
+            }
+            else
+            {
+                const VertexIndex parent = path[depth - 1].Vertex;
+                if (components[v] < components[parent])
+                {
+                    components[parent] = components[v];
+                    flags[parent] &= ~DIRECTED_ROOT;
+                }
+            }
+        }
+    }
+
+    // A component is found after every component it reaches, so the order it was found in is reversed
+    for (VertexIndex v = 0; v < n; v++) components[v] = count - 1 - components[v];
+
+    free(flags);
+    free(path);
+    free(stack);
+    return count;
+}
+
+Csr *Directed_Condensation(const Csr *csr, const uint32_t *components, unsigned int count)
+{
+    PROFILE_ZONE("Directed_Condensation");
+    assert(csr != NULL && components != NULL);
+
+    // A counting sort of the vertices by component, so the edges of each component are looked at together
+    const unsigned int n = csr->Vertices;
+    uint32_t *starts = calloc((size_t) count + 1, sizeof(uint32_t));
+    VertexIndex *members = malloc(n * sizeof(VertexIndex));
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        assert(components[v] < count);
+        starts[components[v] + 1]++;
+    }
+    for (unsigned int c = 0; c < count; c++) starts[c + 1] += starts[c];
+    uint32_t *next = malloc(count * sizeof(uint32_t));
+    for (unsigned int c = 0; c < count; c++) next[c] = starts[c];
+    for (VertexIndex v = 0; v < n; v++) members[next[components[v]]++] = v;
+
+    // The component each other component was last joined from, and the entry of the edge that joined them
+    uint32_t *joinedFrom = next;
+    uint32_t *entries = malloc(count * sizeof(uint32_t));
+    for (unsigned int c = 0; c < count; c++) joinedFrom[c] = DIRECTED_NO_COMPONENT;
+
+    EdgeList *el = EdgeList_CreateEdgeList(count, 0);
+    uint32_t *kept = malloc(csr->Count * sizeof(uint32_t));
+    for (unsigned int c = 0; c < count; c++)
+    {
+        for (uint32_t m = starts[c]; m < starts[c + 1]; m++)
+        {
+            const VertexIndex u = members[m];
+            for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+            {
+                const uint32_t d = components[csr->Targets[i]];
+                if (d == c) continue;
+                if (joinedFrom[d] != c)
+                {
+                    joinedFrom[d] = c;
+                    entries[d] = (uint32_t) el->Count;
+                    kept[el->Count] = csr->Edges[i];
+                    EdgeList_Add(el, c, d, csr->Weights[i]);
+                }
+                else if (csr->Weights[i] > el->Weights[entries[d]])
+                {
+                    el->Weights[entries[d]] = csr->Weights[i];
+                    kept[entries[d]] = csr->Edges[i];
+                }
+            }
+        }
+    }
+
+    // The list is already in the order of its sources, so each entry of the rows is the edge of the list at the same index
+    Csr *condensation = Csr_FromEdgeList(el);
+    for (uint64_t i = 0; i < condensation->Count; i++) condensation->Edges[i] = kept[i];
+
+    free(starts);
+    free(members);
+    free(next);
+    free(entries);
+    free(kept);
+    EdgeList_FreeEdgeList(el);
+    return condensation;
+}
+
+bool Directed_TopologicalSort(const Csr *csr, VertexIndex *order)
+{
+    PROFILE_ZONE("Directed_TopologicalSort");
+    assert(csr != NULL && order != NULL);
+
+    const unsigned int n = csr->Vertices;
+    uint32_t *inDegrees = calloc(n, sizeof(uint32_t));
+    for (uint64_t i = 0; i < csr->Count; i++) inDegrees[csr->Targets[i]]++;
+
+    // The order doubles as the queue, the vertices before head have had their edges removed
+    size_t tail = 0;
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        if (inDegrees[v] == 0) order[tail++] = v;
+    }
+    for (size_t head = 0; head < tail; head++)
+    {
+        const VertexIndex u = order[head];
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            if (--inDegrees[csr->Targets[i]] == 0) order[tail++] = csr->Targets[i];
+        }
+    }
+
+    free(inDegrees);
+    return tail == n;
+}
+
+VertexIndex Directed_CriticalPath(const Csr *csr, const VertexIndex *order, uint64_t *lengths, VertexIndex *predecessors,
+                                  uint32_t *edges)
+{
+    PROFILE_ZONE("Directed_CriticalPath");
+    assert(csr != NULL && order != NULL && lengths != NULL);
+
+    const unsigned int n = csr->Vertices;
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        lengths[v] = 0;
+        if (predecessors != NULL) predecessors[v] = v;
+        if (edges != NULL) edges[v] = DIRECTED_NO_EDGE;
+    }
+
+    // Every edge entering a vertex is relaxed before any edge leaves it
+    VertexIndex end = 0;
+    for (size_t k = 0; k < n; k++)
+    {
+        const VertexIndex u = order[k];
+        if (lengths[u] > lengths[end]) end = u;
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            const VertexIndex w = csr->Targets[i];
+            const uint64_t length = lengths[u] + csr->Weights[i];
+            if (length <= lengths[w]) continue;
+            lengths[w] = length;
+            if (predecessors != NULL) predecessors[w] = u;
+            if (edges != NULL) edges[w] = csr->Edges[i];
+        }
+    }
+    return end;
+}
+
+unsigned int Graph_StronglyConnectedComponents(const Graph *g, unsigned int components[GRAPH_MAX_SIZE])
+{
+    PROFILE_ZONE("Graph_StronglyConnectedComponents");
+    assert(g != NULL && components != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t found[GRAPH_MAX_SIZE];
+    unsigned int count = Directed_StronglyConnectedComponents(csr, found);
+    for (VertexIndex v = 0; v < g->Vertices; v++) components[v] = found[v];
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return count;
+}
+
+bool Graph_CriticalPath(const Graph *g, EdgeIndex path[GRAPH_MAX_SIZE], unsigned long long *weight)
+{
+    PROFILE_ZONE("Graph_CriticalPath");
+    assert(g != NULL && path != NULL && weight != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    VertexIndex order[GRAPH_MAX_SIZE];
+    bool isAcyclic = Directed_TopologicalSort(csr, order);
+
+    int length = 0;
+    *weight = 0;
+    if (isAcyclic && g->Vertices > 0)
+    {
+        uint64_t lengths[GRAPH_MAX_SIZE];
+        VertexIndex predecessors[GRAPH_MAX_SIZE];
+        uint32_t edges[GRAPH_MAX_SIZE];
+        VertexIndex v = Directed_CriticalPath(csr, order, lengths, predecessors, edges);
+        *weight = lengths[v];
+
+        // Walked back from its end, then reversed
+        for (; edges[v] != DIRECTED_NO_EDGE; v = predecessors[v]) path[length++] = edges[v];
+        for (int i = 0; i < length / 2; i++)
+        {
+            EdgeIndex e = path[i];
+            path[i] = path[length - 1 - i];
+            path[length - 1 - i] = e;
+        }
+    }
+    path[length] = MST_NO_EDGE;
+
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return isAcyclic;
+}
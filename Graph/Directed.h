@@ -0,0 +1,63 @@
+//
+//  Directed.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Directed_h
+#define Directed_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+/// The edge before a vertex no path enters
+#define DIRECTED_NO_EDGE UINT32_MAX
+
+/// Pearce's space efficient variant of Tarjan's algorithm, one index per vertex doubling as its low link and component,
+/// with the depth first search on an explicit stack so paths of any length are searched without recursion, in O(V + E).
+/// - Parameters:
+///   - components: Vertices entries, set to the strongly connected component of each vertex. Components are numbered in
+///                 topological order, every edge between two of them leads from the lower to the higher.
+/// - Returns: The strongly connected components
+unsigned int Directed_StronglyConnectedComponents(const Csr *csr, uint32_t *components);
+
+/// The condensation, one vertex per strongly connected component and one edge between each two components any edge joins,
+/// in O(V + E). Of several edges between the same components the heaviest is kept, so critical paths stay critical.
+/// - Parameters:
+///   - components: from Directed_StronglyConnectedComponents
+///   - count: the components
+/// - Returns: The rows of the condensation, each entry holding the edge index of the edge it was kept from
+Csr *Directed_Condensation(const Csr *csr, const uint32_t *components, unsigned int count);
+
+/// Kahn's algorithm, repeatedly taking the vertices no remaining edge enters, in O(V + E)
+/// - Parameters:
+///   - order: Vertices entries, set to the vertices with every edge leading forward
+/// - Returns: false if the graph has a cycle, self loops included, leaving order partly set
+bool Directed_TopologicalSort(const Csr *csr, VertexIndex *order);
+
+/// The heaviest path ending at each vertex of a directed acyclic graph, relaxing the edges of each vertex in topological order,
+/// in O(V + E). The heaviest of them is the critical path, the chain of tasks that bounds the whole schedule.
+/// - Parameters:
+///   - order: from Directed_TopologicalSort
+///   - lengths: Vertices entries, set to the total weight of the heaviest path ending at each vertex
+///   - predecessors: Vertices entries set to the vertex before each on its heaviest path, itself if no edge enters it, or NULL
+///   - edges: Vertices entries set to the index of the last edge of the heaviest path to each, or DIRECTED_NO_EDGE, or NULL
+/// - Returns: The vertex the critical path ends at
+VertexIndex Directed_CriticalPath(const Csr *csr, const VertexIndex *order, uint64_t *lengths, VertexIndex *predecessors,
+                                  uint32_t *edges);
+
+/// The strongly connected components of the graph, following the direction of each edge
+/// - Parameters:
+///   - components: set to the component of each vertex, in topological order, see Directed_StronglyConnectedComponents
+/// - Returns: The strongly connected components
+unsigned int Graph_StronglyConnectedComponents(const Graph *g, unsigned int components[GRAPH_MAX_SIZE]);
+
+/// The critical path of the graph, the path of the largest total weight
+/// - Parameters:
+///   - path: set to the edges of the path in order, terminated by MST_NO_EDGE
+///   - weight: set to the total weight of the path
+/// - Returns: false if the graph has a cycle, leaving the path empty
+bool Graph_CriticalPath(const Graph *g, EdgeIndex path[GRAPH_MAX_SIZE], unsigned long long *weight);
+
+#endif /* Directed_h */
@@ -0,0 +1,101 @@
+//
+//  EdgeList.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "EdgeList.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Counters.h"
+
+#define EDGE_LIST_INITIAL_CAPACITY 64
+
+EdgeList *EdgeList_CreateEdgeList(unsigned int vertices, size_t capacity)
+{
+    EdgeList *el = malloc(sizeof(EdgeList));
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(EdgeList));
+    el->Vertices = vertices;
+    el->Sources = NULL;
+    el->Targets = NULL;
+    el->Weights = NULL;
+    el->Count = 0;
+    el->Capacity = 0;
+    EdgeList_Reserve(el, capacity > 0 ? capacity : EDGE_LIST_INITIAL_CAPACITY);
+    return el;
+}
+
+void EdgeList_FreeEdgeList(EdgeList *el)
+{
+    assert(el != NULL);
+    free(el->Sources);
+    free(el->Targets);
+    free(el->Weights);
+    free(el);
+}
+
+void EdgeList_Reserve(EdgeList *el, size_t capacity)
+{
+    assert(el != NULL);
+    if (capacity <= el->Capacity) return;
+    
+    el->Sources = realloc(el->Sources, capacity * sizeof(VertexIndex));
+    el->Targets = realloc(el->Targets, capacity * sizeof(VertexIndex));
+    el->Weights = realloc(el->Weights, capacity * sizeof(unsigned int));
+    assert(el->Sources != NULL && el->Targets != NULL && el->Weights != NULL);
+    Counters_Add(COUNTER_BYTES_GRAPH, (capacity - el->Capacity) * (2 * sizeof(VertexIndex) + sizeof(unsigned int)));
+    el->Capacity = capacity;
+}
+
+Graph *Graph_FromEdgeList(const EdgeList *el)
+{
+    assert(el != NULL);
+    if (el->Vertices > GRAPH_MAX_SIZE || el->Count > GRAPH_MAX_SIZE) return NULL;
+    
+    Graph *g = Graph_CreateGraph();
+    for (unsigned int v = 0; v < el->Vertices; v++)
+    {
+        Graph_AddVertex(g);
+    }
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        Graph_AddEdgeWeighted(g, el->Sources[e], el->Targets[e], el->Weights[e]);
+    }
+    return g;
+}
+
+EdgeList *EdgeList_FromGraph(const Graph *g)
+{
+    assert(g != NULL);
+    
+    EdgeList *el = EdgeList_CreateEdgeList(g->Vertices, g->Edges);
+    for (EdgeIndex e = 0; e < g->Edges; e++)
+    {
+        // The source holds the weight and the target -1, a self loop has only the weight
+        VertexIndex source = 0;
+        VertexIndex target = GRAPH_MAX_SIZE;
+        for (VertexIndex v = 0; v < g->Vertices; v++)
+        {
+            if (g->IncidenceMatrix[v][e] > 0) source = v;
+            else if (g->IncidenceMatrix[v][e] < 0) target = v;
+        }
+        EdgeList_Add(el, source, target == GRAPH_MAX_SIZE ? source : target, g->IncidenceMatrix[source][e]);
+    }
+    return el;
+}
+
+void EdgeList_Write(const EdgeList *el, OutputSink *sink)
+{
+    assert(el != NULL);
+    assert(sink != NULL);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        OutputSink_WriteInt(sink, el->Sources[e]);
+        OutputSink_WriteChar(sink, ' ');
+        OutputSink_WriteInt(sink, el->Targets[e]);
+        OutputSink_WriteChar(sink, ' ');
+        OutputSink_WriteInt(sink, el->Weights[e]);
+        OutputSink_WriteChar(sink, '\n');
+    }
+}
@@ -0,0 +1,62 @@
+//
+//  EdgeList.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef EdgeList_h
+#define EdgeList_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "Graph.h"
+
+/// A growable list of weighted edges with no limit on its size, the bulk format generators and importers produce.
+/// Edges are stored as parallel arrays, so a pass over the sources or targets reads only what it needs.
+typedef struct
+{
+    /// Every vertex is numbered below Vertices, including those without edges
+    unsigned int Vertices;
+    
+    VertexIndex *Sources;
+    VertexIndex *Targets;
+    unsigned int *Weights;
+    size_t Count;
+    size_t Capacity;
+} EdgeList;
+
+/// Creates an empty edge list
+/// - Parameters:
+///   - vertices: the number of vertices
+///   - capacity: edges to reserve room for, 0 for a default
+EdgeList *EdgeList_CreateEdgeList(unsigned int vertices, size_t capacity);
+
+/// Frees the memory of the edge list
+void EdgeList_FreeEdgeList(EdgeList *el);
+
+/// Grows the arrays so at least capacity edges fit
+void EdgeList_Reserve(EdgeList *el, size_t capacity);
+
+/// Appends an edge directed from v1 to v2. Inline, so generators append millions of edges a second.
+static inline void EdgeList_Add(EdgeList *el, VertexIndex v1, VertexIndex v2, unsigned int weight)
+{
+    if (el->Count == el->Capacity) EdgeList_Reserve(el, el->Capacity * 2);
+    el->Sources[el->Count] = v1;
+    el->Targets[el->Count] = v2;
+    el->Weights[el->Count] = weight;
+    el->Count++;
+}
+
+/// Creates a graph with the vertices and edges of the list, in order
+/// - Returns: The graph, or NULL if the list has more vertices or edges than GRAPH_MAX_SIZE
+Graph *Graph_FromEdgeList(const EdgeList *el);
+
+/// Creates the list of the edges of the graph, in the order of their EdgeIndex. Each edge is listed from the vertex its
+/// incidence matrix column holds the weight for to the one it holds -1 for, so the list follows the direction of every edge.
+EdgeList *EdgeList_FromGraph(const Graph *g);
+
+/// Writes the list as "v1 v2 weight" lines, readable by Graph_ReadEdgeList when small enough
+void EdgeList_Write(const EdgeList *el, OutputSink *sink);
+
+#endif /* EdgeList_h */
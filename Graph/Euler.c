@@ -0,0 +1,143 @@
+//
+//  Euler.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Euler.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Profiler.h"
+
+/// The edge the walk starts with, before it has taken any
+#define EULER_NO_EDGE UINT32_MAX
+
+/// A vertex of the walk and the edge it was reached through
+typedef struct
+{
+    VertexIndex Vertex;
+    uint32_t Edge;
+} _Step;
+
+/// Picks the vertex to start from by the degrees of the vertices, the one with an extra edge out or an odd degree if any
+/// - Returns: The kind of walk the degrees allow, if every edge is connected
+static EulerKind _Euler_Start(const Csr *out, const Csr *in, VertexIndex *start)
+{
+    const unsigned int n = out->Vertices;
+    uint32_t *inDegrees = NULL;
+    if (in == NULL)
+    {
+        inDegrees = calloc(n, sizeof(uint32_t));
+        for (uint64_t i = 0; i < out->Count; i++) inDegrees[out->Targets[i]]++;
+    }
+
+    VertexIndex first = n, unbalanced = n;
+    unsigned int unbalancedCount = 0;
+    bool isBalanced = true;
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        const uint64_t outDegree = out->Offsets[v + 1] - out->Offsets[v];
+        if (in == NULL)
+        {
+            // A trail leaves its start once more than it enters it, and enters its end once more
+            const int64_t extra = (int64_t) outDegree - inDegrees[v];
+            if (outDegree > 0 && first == n) first = v;
+            if (extra == 0) continue;
+            if (extra < -1 || extra > 1) isBalanced = false;
+            if (extra == 1 && unbalanced == n) unbalanced = v;
+            unbalancedCount++;
+            continue;
+        }
+
+        // Walked either way, only the ends of a trail have an odd degree. A self loop adds 2, once from each row.
+        const uint64_t degree = outDegree + in->Offsets[v + 1] - in->Offsets[v];
+        if (degree > 0 && first == n) first = v;
+        if (degree % 2 == 0) continue;
+        if (unbalanced == n) unbalanced = v;
+        unbalancedCount++;
+    }
+    free(inDegrees);
+
+    *start = unbalanced != n ? unbalanced : first != n ? first : 0;
+    if (!isBalanced || (unbalancedCount != 0 && unbalancedCount != 2)) return EULER_NONE;
+    return unbalancedCount == 0 ? EULER_CIRCUIT : EULER_TRAIL;
+}
+
+EulerKind Euler_Trail(const Csr *out, const Csr *in, uint32_t *trail, VertexIndex *start)
+{
+    PROFILE_ZONE("Euler_Trail");
+    assert(out != NULL && trail != NULL);
+    assert(in == NULL || (in->Vertices == out->Vertices && in->Count == out->Count));
+
+    VertexIndex first;
+    EulerKind kind = _Euler_Start(out, in, &first);
+    if (start != NULL) *start = first;
+    if (kind == EULER_NONE || out->Count == 0) return kind;
+
+    const unsigned int n = out->Vertices;
+    uint32_t *cursors = calloc(n, sizeof(uint32_t));
+    _Step *walk = malloc((out->Count + 1) * sizeof(_Step));
+
+    // Walked either way, each edge is in two rows, so it is marked when taken from the first
+    bool *isTaken = in != NULL ? calloc(out->Count, sizeof(bool)) : NULL;
+
+    // Edges are written from the back, as the walk backs out of each vertex with no edges left
+    uint64_t written = 0;
+    size_t depth = 1;
+    walk[0] = (_Step) { .Vertex = first, .Edge = EULER_NO_EDGE };
+    while (depth > 0)
+    {
+        const VertexIndex v = walk[depth - 1].Vertex;
+        const uint32_t outDegree = (uint32_t) (out->Offsets[v + 1] - out->Offsets[v]);
+        const uint32_t degree = outDegree + (in != NULL ? (uint32_t) (in->Offsets[v + 1] - in->Offsets[v]) : 0);
+
+        bool isExtended = false;
+        while (cursors[v] < degree && !isExtended)
+        {
+            const uint32_t next = cursors[v]++;
+            const Csr *row = next < outDegree ? out : in;
+            const uint64_t i = row->Offsets[v] + (next < outDegree ? next : next - outDegree);
+            const uint32_t e = row->Edges[i];
+            if (isTaken != NULL)
+            {
+                assert(e < out->Count);
+                if (isTaken[e]) continue;
+                isTaken[e] = true;
+            }
+            walk[depth++] = (_Step) { .Vertex = row->Targets[i], .Edge = e };
+            isExtended = true;
+        }
+        if (isExtended) continue;
+
+        depth--;
+        if (walk[depth].Edge != EULER_NO_EDGE) trail[out->Count - ++written] = walk[depth].Edge;
+    }
+
+    free(cursors);
+    free(walk);
+    free(isTaken);
+
+    // Edges in another component were never reached
+    return written == out->Count ? kind : EULER_NONE;
+}
+
+EulerKind Graph_EulerTrail(const Graph *g, bool isDirected, EdgeIndex trail[GRAPH_MAX_SIZE + 1], VertexIndex *start)
+{
+    PROFILE_ZONE("Graph_EulerTrail");
+    assert(g != NULL && trail != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *out = Csr_FromEdgeList(el);
+    Csr *in = isDirected ? NULL : Csr_Transpose(out);
+    uint32_t edges[GRAPH_MAX_SIZE];
+    EulerKind kind = Euler_Trail(out, in, edges, start);
+    if (in != NULL) Csr_FreeCsr(in);
+    Csr_FreeCsr(out);
+    EdgeList_FreeEdgeList(el);
+
+    EdgeIndex length = kind == EULER_NONE ? 0 : g->Edges;
+    for (EdgeIndex i = 0; i < length; i++) trail[i] = edges[i];
+    trail[length] = MST_NO_EDGE;
+    return kind;
+}
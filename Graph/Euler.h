@@ -0,0 +1,45 @@
+//
+//  Euler.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Euler_h
+#define Euler_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+typedef enum
+{
+    /// No walk takes every edge once
+    EULER_NONE,
+
+    /// A walk takes every edge once, ending at a vertex other than where it starts
+    EULER_TRAIL,
+
+    /// A walk takes every edge once and ends where it starts, including the empty walk of a graph with no edges
+    EULER_CIRCUIT,
+} EulerKind;
+
+/// Hierholzer's algorithm, splicing closed walks into the walk so far at the vertex they start from. The walk is kept on an
+/// explicit stack and each vertex keeps a cursor into its edges, so every edge is looked at a constant number of times, in
+/// O(V + E). Parallel edges and self loops are edges like any other.
+/// - Parameters:
+///   - out: the edges leaving each vertex
+///   - in: the edges entering each vertex, Csr_Transpose(out), to walk edges either way, or NULL to follow their direction
+///   - trail: Count entries, set to the edge index of each edge in the order it is walked
+///   - start: set to the vertex the walk starts at, the lowest that can start one, or NULL
+/// - Returns: The kind of walk, leaving trail partly set when none exists
+EulerKind Euler_Trail(const Csr *out, const Csr *in, uint32_t *trail, VertexIndex *start);
+
+/// A walk taking every edge of the graph once
+/// - Parameters:
+///   - isDirected: follow the direction of each edge, rather than walking it either way
+///   - trail: set to the edges in the order they are walked, terminated by MST_NO_EDGE
+///   - start: set to the vertex the walk starts at, or NULL
+/// - Returns: The kind of walk, leaving trail empty when none exists
+EulerKind Graph_EulerTrail(const Graph *g, bool isDirected, EdgeIndex trail[GRAPH_MAX_SIZE + 1], VertexIndex *start);
+
+#endif /* Euler_h */
@@ -0,0 +1,485 @@
+//
+//  Flow.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Flow.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "Util/Counters.h"
+#include "Util/Profiler.h"
+
+/// The end of a list of vertices, and the layer of a vertex the source does not reach
+#define FLOW_NO_VERTEX UINT32_MAX
+
+/// The work of a relabel on top of the arcs it looks at, and the work per vertex between global relabels, as Cherkassky and
+/// Goldberg tuned them
+#define FLOW_RELABEL_WORK 12
+#define FLOW_GLOBAL_RELABEL_WORK 6
+
+FlowNetwork *Flow_CreateNetwork(const Csr *csr)
+{
+    PROFILE_ZONE("Flow_CreateNetwork");
+    assert(csr != NULL);
+
+    const unsigned int n = csr->Vertices;
+    FlowNetwork *network = malloc(sizeof(FlowNetwork));
+    network->Vertices = n;
+    network->Count = 2 * csr->Count;
+    network->Offsets = calloc((size_t) n + 1, sizeof(uint64_t));
+    network->Heads = malloc(network->Count * sizeof(VertexIndex));
+    network->Residuals = malloc(network->Count * sizeof(unsigned int));
+    network->Reverses = malloc(network->Count * sizeof(uint64_t));
+    network->Edges = malloc(network->Count * sizeof(uint32_t));
+    assert(network->Offsets != NULL && (network->Count == 0 || (network->Heads != NULL && network->Residuals != NULL &&
+                                                                network->Reverses != NULL && network->Edges != NULL)));
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(FlowNetwork) + ((size_t) n + 1) * sizeof(uint64_t) +
+                 network->Count * (sizeof(VertexIndex) + sizeof(unsigned int) + sizeof(uint64_t) + sizeof(uint32_t)));
+
+    // Each vertex has an arc for every edge leaving it and every edge entering it
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        network->Offsets[u + 1] += csr->Offsets[u + 1] - csr->Offsets[u];
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++) network->Offsets[csr->Targets[i] + 1]++;
+    }
+    for (VertexIndex v = 0; v < n; v++) network->Offsets[v + 1] += network->Offsets[v];
+
+    uint64_t *next = malloc(n * sizeof(uint64_t));
+    if (n > 0) memcpy(next, network->Offsets, n * sizeof(uint64_t));
+    network->IsUnitCapacity = true;
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            const VertexIndex v = csr->Targets[i];
+            const uint64_t a = next[u]++, b = next[v]++;
+            network->Heads[a] = v;
+            network->Residuals[a] = csr->Weights[i];
+            network->Reverses[a] = b;
+            network->Edges[a] = csr->Edges[i];
+            network->Heads[b] = u;
+            network->Residuals[b] = 0;
+            network->Reverses[b] = a;
+            network->Edges[b] = FLOW_NO_EDGE;
+            network->IsUnitCapacity &= csr->Weights[i] == 1;
+        }
+    }
+    free(next);
+    return network;
+}
+
+void Flow_FreeNetwork(FlowNetwork *n)
+{
+    assert(n != NULL);
+    free(n->Offsets);
+    free(n->Heads);
+    free(n->Residuals);
+    free(n->Reverses);
+    free(n->Edges);
+    free(n);
+}
+
+void Flow_Reset(FlowNetwork *n)
+{
+    assert(n != NULL);
+    for (uint64_t a = 0; a < n->Count; a++)
+    {
+        if (n->Edges[a] == FLOW_NO_EDGE) continue;
+        n->Residuals[a] += n->Residuals[n->Reverses[a]];
+        n->Residuals[n->Reverses[a]] = 0;
+    }
+}
+
+/// The state of a push relabel search. Labels run from 0 to twice the vertices, those from Vertices up only reaching the source.
+typedef struct
+{
+    FlowNetwork *Network;
+    VertexIndex Source;
+    VertexIndex Target;
+
+    uint32_t *Labels;
+    uint64_t *Excess;
+
+    /// The arc of each vertex to push along next, those before it are known not to be admissible
+    uint64_t *Current;
+
+    /// The first active vertex of each label, linked through NextActive
+    uint32_t *Active;
+    uint32_t *NextActive;
+
+    /// The first vertex of each label below Vertices, doubly linked through NextInLabel and PreviousInLabel, to find the gaps
+    uint32_t *Labeled;
+    uint32_t *NextInLabel;
+    uint32_t *PreviousInLabel;
+
+    /// No active vertex is above Highest, and no vertex is in Labeled above HighestLabeled
+    uint32_t Highest;
+    uint32_t HighestLabeled;
+
+    VertexIndex *Queue;
+
+    /// The work of the relabels since the last global relabel
+    uint64_t Work;
+} _PushRelabel;
+
+static inline void _Flow_AddActive(_PushRelabel *pr, VertexIndex v)
+{
+    const uint32_t label = pr->Labels[v];
+    pr->NextActive[v] = pr->Active[label];
+    pr->Active[label] = v;
+    if (label > pr->Highest) pr->Highest = label;
+}
+
+static inline void _Flow_AddLabeled(_PushRelabel *pr, VertexIndex v)
+{
+    const uint32_t label = pr->Labels[v];
+    const uint32_t first = pr->Labeled[label];
+    pr->NextInLabel[v] = first;
+    pr->PreviousInLabel[v] = FLOW_NO_VERTEX;
+    if (first != FLOW_NO_VERTEX) pr->PreviousInLabel[first] = v;
+    pr->Labeled[label] = v;
+    if (label > pr->HighestLabeled) pr->HighestLabeled = label;
+}
+
+static inline void _Flow_RemoveLabeled(_PushRelabel *pr, VertexIndex v)
+{
+    const uint32_t next = pr->NextInLabel[v], previous = pr->PreviousInLabel[v];
+    if (previous != FLOW_NO_VERTEX) pr->NextInLabel[previous] = next;
+    else pr->Labeled[pr->Labels[v]] = next;
+    if (next != FLOW_NO_VERTEX) pr->PreviousInLabel[next] = previous;
+}
+
+/// Labels every vertex unlabeled that reaches the root through arcs with capacity left by its distance on from the root's label
+static void _Flow_SearchBack(_PushRelabel *pr, VertexIndex root)
+{
+    const FlowNetwork *n = pr->Network;
+    const uint32_t unlabeled = 2 * n->Vertices;
+    size_t head = 0, tail = 0;
+    pr->Queue[tail++] = root;
+    while (head < tail)
+    {
+        const VertexIndex v = pr->Queue[head++];
+        for (uint64_t a = n->Offsets[v]; a < n->Offsets[v + 1]; a++)
+        {
+            const VertexIndex w = n->Heads[a];
+            if (pr->Labels[w] != unlabeled || n->Residuals[n->Reverses[a]] == 0) continue;
+            pr->Labels[w] = pr->Labels[v] + 1;
+            pr->Queue[tail++] = w;
+        }
+    }
+}
+
+/// Sets every label to the distance to the target, or past Vertices by the distance to the source for the vertices cut off
+/// from the target, and lists the vertices of each label again
+static void _Flow_GlobalRelabel(_PushRelabel *pr)
+{
+    const FlowNetwork *n = pr->Network;
+    const unsigned int count = n->Vertices;
+    for (VertexIndex v = 0; v < count; v++) pr->Labels[v] = 2 * count;
+    pr->Labels[pr->Source] = count;
+    pr->Labels[pr->Target] = 0;
+    _Flow_SearchBack(pr, pr->Target);
+    _Flow_SearchBack(pr, pr->Source);
+
+    for (uint32_t label = 0; label <= 2 * count; label++) pr->Active[label] = FLOW_NO_VERTEX;
+    for (uint32_t label = 0; label < count; label++) pr->Labeled[label] = FLOW_NO_VERTEX;
+    pr->Highest = 0;
+    pr->HighestLabeled = 0;
+    for (VertexIndex v = 0; v < count; v++)
+    {
+        if (v == pr->Source || v == pr->Target) continue;
+        pr->Current[v] = n->Offsets[v];
+        if (pr->Labels[v] < count) _Flow_AddLabeled(pr, v);
+
+        // Excess always reaches back to the source, so no vertex with excess is left unlabeled
+        if (pr->Excess[v] > 0) _Flow_AddActive(pr, v);
+    }
+    pr->Work = 0;
+}
+
+/// No vertex is left at the label, so no vertex above it reaches the target. They are lifted to Vertices at once, to return
+/// their excess to the source.
+static void _Flow_Gap(_PushRelabel *pr, uint32_t gap)
+{
+    const uint32_t count = pr->Network->Vertices;
+    for (uint32_t label = gap + 1; label <= pr->HighestLabeled; label++)
+    {
+        for (VertexIndex v = pr->Labeled[label]; v != FLOW_NO_VERTEX; v = pr->NextInLabel[v]) pr->Labels[v] = count;
+        pr->Labeled[label] = FLOW_NO_VERTEX;
+
+        VertexIndex v = pr->Active[label];
+        while (v != FLOW_NO_VERTEX)
+        {
+            const VertexIndex next = pr->NextActive[v];
+            _Flow_AddActive(pr, v);
+            v = next;
+        }
+        pr->Active[label] = FLOW_NO_VERTEX;
+    }
+    pr->HighestLabeled = gap;
+}
+
+/// Pushes the excess of the vertex along its admissible arcs, relabeling it once if any is left
+static void _Flow_Discharge(_PushRelabel *pr, VertexIndex v)
+{
+    FlowNetwork *n = pr->Network;
+    const uint32_t count = n->Vertices;
+    const uint64_t end = n->Offsets[v + 1];
+    const uint32_t label = pr->Labels[v];
+
+    uint64_t a = pr->Current[v];
+    for (; a < end; a++)
+    {
+        const VertexIndex w = n->Heads[a];
+        if (n->Residuals[a] == 0 || pr->Labels[w] + 1 != label) continue;
+
+        const uint64_t delta = pr->Excess[v] < n->Residuals[a] ? pr->Excess[v] : n->Residuals[a];
+        n->Residuals[a] -= delta;
+        n->Residuals[n->Reverses[a]] += delta;
+        pr->Excess[v] -= delta;
+        if (pr->Excess[w] == 0 && w != pr->Source && w != pr->Target) _Flow_AddActive(pr, w);
+        pr->Excess[w] += delta;
+        if (pr->Excess[v] == 0) break;
+    }
+    pr->Current[v] = a;
+    if (pr->Excess[v] == 0) return;
+
+    // Every arc is looked at again, lifting the vertex just above the lowest it has capacity left to
+    uint32_t lowest = 2 * count;
+    uint64_t lowestArc = n->Offsets[v];
+    for (a = n->Offsets[v]; a < end; a++)
+    {
+        if (n->Residuals[a] > 0 && pr->Labels[n->Heads[a]] < lowest)
+        {
+            lowest = pr->Labels[n->Heads[a]];
+            lowestArc = a;
+        }
+    }
+    pr->Work += FLOW_RELABEL_WORK + end - n->Offsets[v];
+
+    uint32_t relabeled = lowest + 1 < 2 * count ? lowest + 1 : 2 * count;
+    if (label < count)
+    {
+        _Flow_RemoveLabeled(pr, v);
+        if (pr->Labeled[label] == FLOW_NO_VERTEX)
+        {
+            _Flow_Gap(pr, label);
+            if (relabeled < count) relabeled = count;
+        }
+    }
+    pr->Labels[v] = relabeled;
+    pr->Current[v] = lowestArc;
+    if (relabeled < count) _Flow_AddLabeled(pr, v);
+    if (relabeled < 2 * count) _Flow_AddActive(pr, v);
+}
+
+uint64_t Flow_PushRelabel(FlowNetwork *n, VertexIndex source, VertexIndex target)
+{
+    PROFILE_ZONE("Flow_PushRelabel");
+    assert(n != NULL && source < n->Vertices && target < n->Vertices && source != target);
+    assert(n->Vertices < UINT32_MAX / 2);
+
+    const unsigned int count = n->Vertices;
+    _PushRelabel pr =
+    {
+        .Network = n,
+        .Source = source,
+        .Target = target,
+        .Labels = malloc(count * sizeof(uint32_t)),
+        .Excess = calloc(count, sizeof(uint64_t)),
+        .Current = malloc(count * sizeof(uint64_t)),
+        .Active = malloc((2 * (size_t) count + 1) * sizeof(uint32_t)),
+        .NextActive = malloc(count * sizeof(uint32_t)),
+        .Labeled = malloc(count * sizeof(uint32_t)),
+        .NextInLabel = malloc(count * sizeof(uint32_t)),
+        .PreviousInLabel = malloc(count * sizeof(uint32_t)),
+        .Queue = malloc(count * sizeof(VertexIndex)),
+    };
+
+    // Every arc from the source is saturated, then the labels are set exactly
+    for (uint64_t a = n->Offsets[source]; a < n->Offsets[source + 1]; a++)
+    {
+        const VertexIndex w = n->Heads[a];
+        if (w == source || n->Residuals[a] == 0) continue;
+        pr.Excess[w] += n->Residuals[a];
+        n->Residuals[n->Reverses[a]] += n->Residuals[a];
+        n->Residuals[a] = 0;
+    }
+    _Flow_GlobalRelabel(&pr);
+
+    const uint64_t globalRelabelWork = FLOW_GLOBAL_RELABEL_WORK * (uint64_t) count + n->Count / 2;
+    while (true)
+    {
+        if (pr.Work > globalRelabelWork) _Flow_GlobalRelabel(&pr);
+
+        while (pr.Highest > 0 && pr.Active[pr.Highest] == FLOW_NO_VERTEX) pr.Highest--;
+        const VertexIndex v = pr.Active[pr.Highest];
+        if (v == FLOW_NO_VERTEX) break;
+        pr.Active[pr.Highest] = pr.NextActive[v];
+        _Flow_Discharge(&pr, v);
+    }
+
+    const uint64_t flow = pr.Excess[target];
+    free(pr.Labels);
+    free(pr.Excess);
+    free(pr.Current);
+    free(pr.Active);
+    free(pr.NextActive);
+    free(pr.Labeled);
+    free(pr.NextInLabel);
+    free(pr.PreviousInLabel);
+    free(pr.Queue);
+    return flow;
+}
+
+/// Layers the vertices the source reaches through arcs with capacity left by their distance from it
+/// - Returns: false if the target is not reached
+static bool _Flow_Layer(const FlowNetwork *n, VertexIndex source, VertexIndex target, uint32_t *layers, VertexIndex *queue)
+{
+    for (VertexIndex v = 0; v < n->Vertices; v++) layers[v] = FLOW_NO_VERTEX;
+    layers[source] = 0;
+    size_t head = 0, tail = 0;
+    queue[tail++] = source;
+    while (head < tail)
+    {
+        const VertexIndex v = queue[head++];
+
+        // Layers past the target hold no shortest path to it
+        if (layers[target] != FLOW_NO_VERTEX && layers[v] >= layers[target]) break;
+        for (uint64_t a = n->Offsets[v]; a < n->Offsets[v + 1]; a++)
+        {
+            const VertexIndex w = n->Heads[a];
+            if (layers[w] != FLOW_NO_VERTEX || n->Residuals[a] == 0) continue;
+            layers[w] = layers[v] + 1;
+            queue[tail++] = w;
+        }
+    }
+    return layers[target] != FLOW_NO_VERTEX;
+}
+
+uint64_t Flow_Dinic(FlowNetwork *n, VertexIndex source, VertexIndex target)
+{
+    PROFILE_ZONE("Flow_Dinic");
+    assert(n != NULL && source < n->Vertices && target < n->Vertices && source != target);
+
+    const unsigned int count = n->Vertices;
+    uint32_t *layers = malloc(count * sizeof(uint32_t));
+    VertexIndex *queue = malloc(count * sizeof(VertexIndex));
+    uint64_t *current = malloc(count * sizeof(uint64_t));
+
+    // The arcs of the path from the source, each a layer further than the last
+    uint64_t *path = malloc(count * sizeof(uint64_t));
+
+    uint64_t flow = 0;
+    while (_Flow_Layer(n, source, target, layers, queue))
+    {
+        memcpy(current, n->Offsets, count * sizeof(uint64_t));
+        size_t depth = 0;
+        VertexIndex v = source;
+        while (true)
+        {
+            if (v == target)
+            {
+                // Pushes the least capacity left along the path, then backs up to the first arc it used up
+                unsigned int delta = n->Residuals[path[0]];
+                for (size_t i = 1; i < depth; i++)
+                {
+                    if (n->Residuals[path[i]] < delta) delta = n->Residuals[path[i]];
+                }
+                size_t saturated = depth;
+                for (size_t i = 0; i < depth; i++)
+                {
+                    n->Residuals[path[i]] -= delta;
+                    n->Residuals[n->Reverses[path[i]]] += delta;
+                    if (n->Residuals[path[i]] == 0 && saturated == depth) saturated = i;
+                }
+                flow += delta;
+                depth = saturated;
+                v = depth == 0 ? source : n->Heads[path[depth - 1]];
+                continue;
+            }
+
+            uint64_t a = current[v];
+            const uint64_t end = n->Offsets[v + 1];
+            while (a < end && (n->Residuals[a] == 0 || layers[n->Heads[a]] != layers[v] + 1)) a++;
+            current[v] = a;
+            if (a < end)
+            {
+                path[depth++] = a;
+                v = n->Heads[a];
+                continue;
+            }
+
+            // No path to the target is left through the vertex, so the search stops reaching it
+            if (v == source) break;
+            layers[v] = FLOW_NO_VERTEX;
+            v = --depth == 0 ? source : n->Heads[path[depth - 1]];
+            current[v]++;
+        }
+    }
+
+    free(layers);
+    free(queue);
+    free(current);
+    free(path);
+    return flow;
+}
+
+unsigned int Flow_MinCut(const FlowNetwork *n, VertexIndex source, bool *isSourceSide)
+{
+    PROFILE_ZONE("Flow_MinCut");
+    assert(n != NULL && source < n->Vertices && isSourceSide != NULL);
+
+    VertexIndex *queue = malloc(n->Vertices * sizeof(VertexIndex));
+    for (VertexIndex v = 0; v < n->Vertices; v++) isSourceSide[v] = false;
+    isSourceSide[source] = true;
+    size_t head = 0, tail = 0;
+    queue[tail++] = source;
+    while (head < tail)
+    {
+        const VertexIndex v = queue[head++];
+        for (uint64_t a = n->Offsets[v]; a < n->Offsets[v + 1]; a++)
+        {
+            const VertexIndex w = n->Heads[a];
+            if (isSourceSide[w] || n->Residuals[a] == 0) continue;
+            isSourceSide[w] = true;
+            queue[tail++] = w;
+        }
+    }
+    free(queue);
+    return (unsigned int) tail;
+}
+
+unsigned int Graph_MinCut(const Graph *g, VertexIndex source, VertexIndex target, EdgeIndex cut[GRAPH_MAX_SIZE + 1],
+                          unsigned long long *flow)
+{
+    PROFILE_ZONE("Graph_MinCut");
+    assert(g != NULL && cut != NULL && flow != NULL);
+    assert(source < g->Vertices && target < g->Vertices && source != target);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    FlowNetwork *network = Flow_CreateNetwork(csr);
+    *flow = network->IsUnitCapacity ? Flow_Dinic(network, source, target) : Flow_PushRelabel(network, source, target);
+
+    bool isSourceSide[GRAPH_MAX_SIZE];
+    Flow_MinCut(network, source, isSourceSide);
+    unsigned int count = 0;
+    for (VertexIndex u = 0; u < g->Vertices; u++)
+    {
+        if (!isSourceSide[u]) continue;
+        for (uint64_t a = network->Offsets[u]; a < network->Offsets[u + 1]; a++)
+        {
+            if (network->Edges[a] != FLOW_NO_EDGE && !isSourceSide[network->Heads[a]]) cut[count++] = network->Edges[a];
+        }
+    }
+    cut[count] = MST_NO_EDGE;
+
+    Flow_FreeNetwork(network);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return count;
+}
@@ -0,0 +1,88 @@
+//
+//  Flow.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Flow_h
+#define Flow_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Csr.h"
+
+/// The edge of an arc that undoes the flow of another
+#define FLOW_NO_EDGE UINT32_MAX
+
+/// The residual network of a graph, each edge an arc leaving its source with its weight as capacity, paired with an arc
+/// leaving its target with no capacity that pushing along the edge opens. Both arcs of every edge touching a vertex are in its
+/// row, so a search over the residual arcs reads one row per vertex, in either direction.
+typedef struct
+{
+    unsigned int Vertices;
+
+    /// Entries in Heads, Residuals, Reverses and Edges, twice the edges
+    uint64_t Count;
+
+    /// Vertices + 1 entries
+    uint64_t *Offsets;
+
+    /// The vertex each arc leads to
+    VertexIndex *Heads;
+
+    /// The capacity left on each arc. The residual of the reverse of an edge's arc is the flow along the edge.
+    unsigned int *Residuals;
+
+    /// The index of the arc paired with each
+    uint64_t *Reverses;
+
+    /// The index in the edge list of the edge of each arc leaving its source, FLOW_NO_EDGE for the reverse arcs
+    uint32_t *Edges;
+
+    /// Every edge has a capacity of 1, where Flow_Dinic takes O(E sqrt(E))
+    bool IsUnitCapacity;
+} FlowNetwork;
+
+/// Creates the residual network of the rows in O(V + E), with no flow
+FlowNetwork *Flow_CreateNetwork(const Csr *csr);
+
+/// Frees the memory of the network
+void Flow_FreeNetwork(FlowNetwork *n);
+
+/// Takes every flow off the network in O(E), so it can be searched again
+void Flow_Reset(FlowNetwork *n);
+
+/// Goldberg and Tarjan's push relabel, always discharging the active vertex of the highest label. Labels are set exactly by
+/// a breadth first search back from the target and the source once the relabels since the last have done about as much work
+/// as one, and a label no vertex is left at cuts every vertex above it off from the target at once, so in practice it takes
+/// little more than a few searches. Excess that cannot reach the target is returned to the source in the same pass.
+/// - Parameters:
+///   - n: a network with no flow, left holding a maximum flow
+/// - Returns: The value of the flow, the total capacity of a minimum cut
+uint64_t Flow_PushRelabel(FlowNetwork *n, VertexIndex source, VertexIndex target);
+
+/// Dinic's blocking flows, a breadth first search layering the vertices by their distance from the source and a depth first
+/// search pushing along the layers until no path is left, walking each arc of a layer once. Best when IsUnitCapacity is set.
+/// - Parameters:
+///   - n: a network with no flow, left holding a maximum flow
+/// - Returns: The value of the flow, the total capacity of a minimum cut
+uint64_t Flow_Dinic(FlowNetwork *n, VertexIndex source, VertexIndex target);
+
+/// The side of a minimum cut holding the source, the vertices it reaches through arcs with capacity left, in O(V + E)
+/// - Parameters:
+///   - n: a network holding a maximum flow
+///   - isSourceSide: Vertices entries, set to if each vertex is on the side of the source. The edges from the side of
+///                   the source to the other are the cut.
+/// - Returns: The vertices on the side of the source
+unsigned int Flow_MinCut(const FlowNetwork *n, VertexIndex source, bool *isSourceSide);
+
+/// A minimum cut between two vertices of the graph, following the direction of each edge with its weight as capacity
+/// - Parameters:
+///   - cut: set to the edges of the cut, terminated by MST_NO_EDGE
+///   - flow: set to the value of a maximum flow from source to target, the total weight of the cut
+/// - Returns: The edges of the cut
+unsigned int Graph_MinCut(const Graph *g, VertexIndex source, VertexIndex target, EdgeIndex cut[GRAPH_MAX_SIZE + 1],
+                          unsigned long long *flow);
+
+#endif /* Flow_h */
@@ -0,0 +1,490 @@
+//
+//  Generators.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Generators.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include "Util/Random.h"
+#include "Util/Counters.h"
+
+#define PAIR_SET_EMPTY UINT64_MAX
+#define PAIR_SET_REMOVED (UINT64_MAX - 1)
+
+/// Cells per side the random geometric generator buckets points into, at most
+#define GEOMETRIC_MAX_CELLS 4096
+
+/// Draws the weights of a graph
+typedef struct
+{
+    Random Random;
+    GeneratorWeightKind Kind;
+    unsigned int Min;
+    unsigned int Max;
+} _WeightSource;
+
+static const GeneratorOptions _DefaultOptions = {};
+
+static _WeightSource _WeightSource_Create(const GeneratorOptions *options)
+{
+    _WeightSource ws = {.Kind = options->Weights, .Min = options->MinWeight, .Max = options->MaxWeight};
+    Random_Seed(&ws.Random, options->Seed);
+    if (ws.Kind != GENERATOR_WEIGHTS_UNIT) assert(ws.Min >= 1 && ws.Min <= ws.Max);
+    return ws;
+}
+
+static inline unsigned int _WeightSource_Next(_WeightSource *ws)
+{
+    switch (ws->Kind)
+    {
+        case GENERATOR_WEIGHTS_UNIFORM:
+            return ws->Min + (unsigned int) Random_Below(&ws->Random, (uint64_t) ws->Max - ws->Min + 1);
+        
+        case GENERATOR_WEIGHTS_EXPONENTIAL:
+        {
+            double weight = ws->Min + Random_Exponential(&ws->Random, (ws->Max - ws->Min) / 4.0);
+            return weight >= ws->Max ? ws->Max : (unsigned int) weight;
+        }
+        
+        default:
+            return 1;
+    }
+}
+
+/// Places the vertices evenly around a circle
+static void _LayoutCircle(GeneratorPoint *positions, unsigned int n)
+{
+    if (positions == NULL) return;
+    for (unsigned int v = 0; v < n; v++)
+    {
+        double angle = 2 * M_PI * v / n;
+        positions[v] = (GeneratorPoint) {0.5f + 0.45f * (float) cos(angle), 0.5f + 0.45f * (float) sin(angle)};
+    }
+}
+
+/// An open addressing set of vertex pairs, for the generators that must not repeat an edge
+typedef struct
+{
+    uint64_t *Keys;
+    size_t Mask;
+} _PairSet;
+
+static _PairSet _PairSet_Create(size_t entries)
+{
+    size_t capacity = 16;
+    while (capacity < 2 * entries) capacity *= 2;
+    _PairSet set = {.Keys = malloc(capacity * sizeof(uint64_t)), .Mask = capacity - 1};
+    memset(set.Keys, 0xFF, capacity * sizeof(uint64_t));
+    Counters_Add(COUNTER_BYTES_GRAPH, capacity * sizeof(uint64_t));
+    return set;
+}
+
+static inline uint64_t _PairSet_Key(VertexIndex u, VertexIndex v)
+{
+    return (uint64_t) u << 32 | v;
+}
+
+static inline size_t _PairSet_Hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return (size_t) key;
+}
+
+static inline bool _PairSet_Contains(const _PairSet *set, uint64_t key)
+{
+    for (size_t i = _PairSet_Hash(key) & set->Mask; set->Keys[i] != PAIR_SET_EMPTY; i = (i + 1) & set->Mask)
+    {
+        if (set->Keys[i] == key) return true;
+    }
+    return false;
+}
+
+/// - Returns: false if the key was already in the set
+static inline bool _PairSet_Insert(_PairSet *set, uint64_t key)
+{
+    size_t slot = SIZE_MAX;
+    size_t i = _PairSet_Hash(key) & set->Mask;
+    for (; set->Keys[i] != PAIR_SET_EMPTY; i = (i + 1) & set->Mask)
+    {
+        if (set->Keys[i] == key) return false;
+        if (set->Keys[i] == PAIR_SET_REMOVED && slot == SIZE_MAX) slot = i;
+    }
+    set->Keys[slot == SIZE_MAX ? i : slot] = key;
+    return true;
+}
+
+static inline void _PairSet_Remove(_PairSet *set, uint64_t key)
+{
+    for (size_t i = _PairSet_Hash(key) & set->Mask; set->Keys[i] != PAIR_SET_EMPTY; i = (i + 1) & set->Mask)
+    {
+        if (set->Keys[i] == key)
+        {
+            set->Keys[i] = PAIR_SET_REMOVED;
+            return;
+        }
+    }
+}
+
+/// Draws a uniform pair of distinct vertices, ordered low to high unless directed
+static inline void _RandomPair(Random *r, unsigned int n, bool isDirected, VertexIndex *u, VertexIndex *v)
+{
+    VertexIndex a = (VertexIndex) Random_Below(r, n);
+    VertexIndex b = (VertexIndex) Random_Below(r, n - 1);
+    if (b >= a) b++;
+    if (!isDirected && a > b)
+    {
+        VertexIndex t = a;
+        a = b;
+        b = t;
+    }
+    *u = a;
+    *v = b;
+}
+
+static uint64_t _PairCount(unsigned int n, bool isDirected)
+{
+    uint64_t ordered = (uint64_t) n * (n > 0 ? n - 1 : 0);
+    return isDirected ? ordered : ordered / 2;
+}
+
+EdgeList *Generators_Complete(unsigned int n, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    _WeightSource ws = _WeightSource_Create(options);
+    
+    EdgeList *el = EdgeList_CreateEdgeList(n, _PairCount(n, options->IsDirected));
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (VertexIndex v = options->IsDirected ? 0 : u + 1; v < n; v++)
+        {
+            if (u != v) EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+        }
+    }
+    _LayoutCircle(options->Positions, n);
+    return el;
+}
+
+EdgeList *Generators_ErdosRenyi(unsigned int n, double p, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    assert(p >= 0 && p <= 1);
+    if (p == 1) return Generators_Complete(n, options);
+    
+    _WeightSource ws = _WeightSource_Create(options);
+    Random r;
+    Random_Seed(&r, options->Seed ^ 0xE7D5C3B1A9F8E6D4ull);
+    
+    uint64_t pairs = _PairCount(n, options->IsDirected);
+    EdgeList *el = EdgeList_CreateEdgeList(n, (size_t) (pairs * p * 1.05) + 16);
+    _LayoutCircle(options->Positions, n);
+    if (p == 0 || n < 2) return el;
+    
+    // Batagelj and Brandes, jump straight to the next pair that is an edge. Pairs are numbered row by row,
+    // the lower triangle when undirected, every off diagonal entry when directed.
+    if (options->IsDirected)
+    {
+        uint64_t pair = UINT64_MAX;
+        for (;;)
+        {
+            uint64_t skip = Random_Geometric(&r, p);
+            if (skip >= pairs - (pair + 1)) break;
+            pair += 1 + skip;
+            
+            VertexIndex u = (VertexIndex) (pair / (n - 1));
+            VertexIndex v = (VertexIndex) (pair % (n - 1));
+            if (v >= u) v++;
+            EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+        }
+    }
+    else
+    {
+        uint64_t v = 1;
+        uint64_t w = UINT64_MAX;
+        while (v < n)
+        {
+            uint64_t skip = Random_Geometric(&r, p);
+            if (skip >= pairs) break;
+            w += 1 + skip;
+            while (w >= v && v < n)
+            {
+                w -= v;
+                v++;
+            }
+            if (v < n) EdgeList_Add(el, (VertexIndex) w, (VertexIndex) v, _WeightSource_Next(&ws));
+        }
+    }
+    return el;
+}
+
+EdgeList *Generators_RandomEdges(unsigned int n, size_t m, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    uint64_t pairs = _PairCount(n, options->IsDirected);
+    assert(m <= pairs);
+    
+    _WeightSource ws = _WeightSource_Create(options);
+    Random r;
+    Random_Seed(&r, options->Seed ^ 0xE7D5C3B1A9F8E6D4ull);
+    
+    EdgeList *el = EdgeList_CreateEdgeList(n, m);
+    _LayoutCircle(options->Positions, n);
+    
+    // Rejection is quick while most pairs are free, past half the pairs the ones left out are chosen instead
+    bool isComplement = m > pairs / 2;
+    size_t chosen = isComplement ? pairs - m : m;
+    _PairSet set = _PairSet_Create(chosen);
+    for (size_t i = 0; i < chosen;)
+    {
+        VertexIndex u, v;
+        _RandomPair(&r, n, options->IsDirected, &u, &v);
+        if (!_PairSet_Insert(&set, _PairSet_Key(u, v))) continue;
+        if (!isComplement) EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+        i++;
+    }
+    
+    if (isComplement)
+    {
+        for (VertexIndex u = 0; u < n; u++)
+        {
+            for (VertexIndex v = options->IsDirected ? 0 : u + 1; v < n; v++)
+            {
+                if (u == v || _PairSet_Contains(&set, _PairSet_Key(u, v))) continue;
+                EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+            }
+        }
+    }
+    
+    free(set.Keys);
+    return el;
+}
+
+EdgeList *Generators_BarabasiAlbert(unsigned int n, unsigned int m, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    assert(m >= 1 && m < n);
+    
+    _WeightSource ws = _WeightSource_Create(options);
+    Random r;
+    Random_Seed(&r, options->Seed ^ 0xE7D5C3B1A9F8E6D4ull);
+    
+    size_t edges = m + (size_t) (n - m - 1) * m;
+    EdgeList *el = EdgeList_CreateEdgeList(n, edges);
+    _LayoutCircle(options->Positions, n);
+    
+    // Every vertex appears once per edge it is on, so a uniform entry is a vertex chosen in proportion to its degree
+    VertexIndex *repeated = malloc(2 * edges * sizeof(VertexIndex));
+    VertexIndex *targets = malloc(m * sizeof(VertexIndex));
+    size_t repeatedCount = 0;
+    
+    for (VertexIndex v = 1; v <= m; v++)
+    {
+        EdgeList_Add(el, v, 0, _WeightSource_Next(&ws));
+        repeated[repeatedCount++] = 0;
+        repeated[repeatedCount++] = v;
+    }
+    
+    for (VertexIndex source = m + 1; source < n; source++)
+    {
+        for (unsigned int t = 0; t < m;)
+        {
+            VertexIndex target = repeated[Random_Below(&r, repeatedCount)];
+            bool isChosen = false;
+            for (unsigned int i = 0; i < t && !isChosen; i++) isChosen = targets[i] == target;
+            if (!isChosen) targets[t++] = target;
+        }
+        for (unsigned int t = 0; t < m; t++)
+        {
+            EdgeList_Add(el, source, targets[t], _WeightSource_Next(&ws));
+            repeated[repeatedCount++] = targets[t];
+            repeated[repeatedCount++] = source;
+        }
+    }
+    
+    free(repeated);
+    free(targets);
+    return el;
+}
+
+EdgeList *Generators_WattsStrogatz(unsigned int n, unsigned int k, double beta, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    assert(k % 2 == 0 && k < n);
+    assert(beta >= 0 && beta <= 1);
+    
+    _WeightSource ws = _WeightSource_Create(options);
+    Random r;
+    Random_Seed(&r, options->Seed ^ 0xE7D5C3B1A9F8E6D4ull);
+    
+    size_t edges = (size_t) n * (k / 2);
+    EdgeList *el = EdgeList_CreateEdgeList(n, edges);
+    _LayoutCircle(options->Positions, n);
+    
+    _PairSet set = _PairSet_Create(edges);
+    unsigned int *degrees = malloc(n * sizeof(unsigned int));
+    for (VertexIndex v = 0; v < n; v++) degrees[v] = k;
+    
+    for (unsigned int j = 1; j <= k / 2; j++)
+    {
+        for (VertexIndex u = 0; u < n; u++)
+        {
+            VertexIndex v = (u + j) % n;
+            EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+            _PairSet_Insert(&set, u < v ? _PairSet_Key(u, v) : _PairSet_Key(v, u));
+        }
+    }
+    
+    // Rewire the far end of each edge, unless its near end is already joined to every vertex
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        if (Random_Double(&r) >= beta) continue;
+        VertexIndex u = el->Sources[e];
+        VertexIndex v = el->Targets[e];
+        if (degrees[u] >= n - 1) continue;
+        
+        VertexIndex w;
+        uint64_t key;
+        do
+        {
+            w = (VertexIndex) Random_Below(&r, n);
+            key = u < w ? _PairSet_Key(u, w) : _PairSet_Key(w, u);
+        }
+        while (w == u || _PairSet_Contains(&set, key));
+        
+        _PairSet_Remove(&set, u < v ? _PairSet_Key(u, v) : _PairSet_Key(v, u));
+        _PairSet_Insert(&set, key);
+        degrees[v]--;
+        degrees[w]++;
+        el->Targets[e] = w;
+    }
+    
+    free(set.Keys);
+    free(degrees);
+    return el;
+}
+
+EdgeList *Generators_Grid(unsigned int rows, unsigned int columns, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    _WeightSource ws = _WeightSource_Create(options);
+    
+    unsigned int n = rows * columns;
+    size_t edges = rows * (size_t) (columns > 0 ? columns - 1 : 0) + (size_t) (rows > 0 ? rows - 1 : 0) * columns;
+    EdgeList *el = EdgeList_CreateEdgeList(n, edges);
+    for (unsigned int row = 0; row < rows; row++)
+    {
+        for (unsigned int column = 0; column < columns; column++)
+        {
+            VertexIndex v = row * columns + column;
+            if (column + 1 < columns) EdgeList_Add(el, v, v + 1, _WeightSource_Next(&ws));
+            if (row + 1 < rows) EdgeList_Add(el, v, v + columns, _WeightSource_Next(&ws));
+            if (options->Positions != NULL)
+            {
+                options->Positions[v] = (GeneratorPoint) {(column + 0.5f) / columns, (row + 0.5f) / rows};
+            }
+        }
+    }
+    return el;
+}
+
+EdgeList *Generators_CompleteBipartite(unsigned int a, unsigned int b, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    _WeightSource ws = _WeightSource_Create(options);
+    
+    EdgeList *el = EdgeList_CreateEdgeList(a + b, (size_t) a * b);
+    for (VertexIndex u = 0; u < a; u++)
+    {
+        for (VertexIndex v = a; v < a + b; v++)
+        {
+            EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+        }
+    }
+    
+    // The two sides face each other in columns
+    if (options->Positions != NULL)
+    {
+        for (VertexIndex u = 0; u < a; u++) options->Positions[u] = (GeneratorPoint) {0.25f, (u + 0.5f) / a};
+        for (VertexIndex v = 0; v < b; v++) options->Positions[a + v] = (GeneratorPoint) {0.75f, (v + 0.5f) / b};
+    }
+    return el;
+}
+
+EdgeList *Generators_RandomGeometric(unsigned int n, double radius, const GeneratorOptions *options)
+{
+    if (options == NULL) options = &_DefaultOptions;
+    assert(radius > 0);
+    
+    _WeightSource ws = _WeightSource_Create(options);
+    Random r;
+    Random_Seed(&r, options->Seed ^ 0xE7D5C3B1A9F8E6D4ull);
+    
+    GeneratorPoint *points = options->Positions != NULL ? options->Positions : malloc(n * sizeof(GeneratorPoint));
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        points[v] = (GeneratorPoint) {(float) Random_Double(&r), (float) Random_Double(&r)};
+    }
+    
+    // Bucket the points in cells at least radius wide, so every neighbor is in the same or an adjacent cell
+    unsigned int cells = radius >= 1 ? 1 : (unsigned int) (1 / radius);
+    if (cells > GEOMETRIC_MAX_CELLS) cells = GEOMETRIC_MAX_CELLS;
+    if (cells < 1) cells = 1;
+    size_t cellCount = (size_t) cells * cells;
+    
+    size_t *starts = calloc(cellCount + 1, sizeof(size_t));
+    VertexIndex *sorted = malloc(n * sizeof(VertexIndex));
+    unsigned int *cellOf = malloc(n * sizeof(unsigned int));
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        unsigned int x = (unsigned int) (points[v].X * cells);
+        unsigned int y = (unsigned int) (points[v].Y * cells);
+        if (x >= cells) x = cells - 1;
+        if (y >= cells) y = cells - 1;
+        cellOf[v] = y * cells + x;
+        starts[cellOf[v] + 1]++;
+    }
+    for (size_t c = 0; c < cellCount; c++) starts[c + 1] += starts[c];
+    size_t *fill = malloc(cellCount * sizeof(size_t));
+    memcpy(fill, starts, cellCount * sizeof(size_t));
+    for (VertexIndex v = 0; v < n; v++) sorted[fill[cellOf[v]]++] = v;
+    free(fill);
+    
+    double expected = M_PI * radius * radius * n * (n > 0 ? n - 1 : 0) / 2;
+    EdgeList *el = EdgeList_CreateEdgeList(n, (size_t) (expected * 1.1) + 16);
+    double radiusSquared = radius * radius;
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        int x = cellOf[u] % cells;
+        int y = cellOf[u] / cells;
+        for (int dy = -1; dy <= 1; dy++)
+        {
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                int nx = x + dx;
+                int ny = y + dy;
+                if (nx < 0 || ny < 0 || nx >= (int) cells || ny >= (int) cells) continue;
+                size_t cell = (size_t) ny * cells + nx;
+                for (size_t i = starts[cell]; i < starts[cell + 1]; i++)
+                {
+                    VertexIndex v = sorted[i];
+                    if (v <= u) continue;
+                    double ddx = points[u].X - points[v].X;
+                    double ddy = points[u].Y - points[v].Y;
+                    if (ddx * ddx + ddy * ddy <= radiusSquared) EdgeList_Add(el, u, v, _WeightSource_Next(&ws));
+                }
+            }
+        }
+    }
+    
+    free(starts);
+    free(sorted);
+    free(cellOf);
+    if (points != options->Positions) free(points);
+    return el;
+}
@@ -0,0 +1,80 @@
+//
+//  Generators.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Generators_h
+#define Generators_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "EdgeList.h"
+
+typedef enum
+{
+    /// Every edge weighs 1
+    GENERATOR_WEIGHTS_UNIT,
+    
+    /// Uniform between MinWeight and MaxWeight, inclusive
+    GENERATOR_WEIGHTS_UNIFORM,
+    
+    /// MinWeight plus an exponential with a mean a quarter of the way to MaxWeight, capped at MaxWeight
+    GENERATOR_WEIGHTS_EXPONENTIAL,
+} GeneratorWeightKind;
+
+/// A vertex position in the unit square
+typedef struct
+{
+    float X;
+    float Y;
+} GeneratorPoint;
+
+/// How a graph is generated. Zero initialized options generate an undirected graph of unit weights from seed 0.
+typedef struct
+{
+    /// The same seed and options always generate the same graph
+    uint64_t Seed;
+    
+    /// Pairs are ordered, so both u to v and v to u may be generated. Only used by the G(n,p), G(n,m) and complete generators,
+    /// the rest generate every undirected edge once, directed from the lower to the higher vertex unless noted.
+    bool IsDirected;
+    
+    GeneratorWeightKind Weights;
+    unsigned int MinWeight;
+    unsigned int MaxWeight;
+    
+    /// Optional, filled with a position per vertex. Grids and geometric graphs use their own layout, the rest a circle.
+    GeneratorPoint *Positions;
+} GeneratorOptions;
+
+/// Erdős–Rényi G(n,p), every pair is an edge with probability p. Skips geometrically from edge to edge, so the time is
+/// linear in the edges generated rather than the pairs.
+EdgeList *Generators_ErdosRenyi(unsigned int n, double p, const GeneratorOptions *options);
+
+/// Erdős–Rényi G(n,m), m distinct pairs chosen uniformly
+EdgeList *Generators_RandomEdges(unsigned int n, size_t m, const GeneratorOptions *options);
+
+/// Barabási–Albert preferential attachment. Starts from a star of m + 1 vertices, every later vertex is directed to
+/// m distinct earlier vertices chosen in proportion to their degree, 1 <= m < n.
+EdgeList *Generators_BarabasiAlbert(unsigned int n, unsigned int m, const GeneratorOptions *options);
+
+/// Watts–Strogatz small world. A ring where every vertex is joined to its k nearest neighbors, k even and < n, then
+/// every edge has its far end rewired to a uniformly chosen vertex with probability beta, keeping the graph simple.
+EdgeList *Generators_WattsStrogatz(unsigned int n, unsigned int k, double beta, const GeneratorOptions *options);
+
+/// A rows by columns grid, vertex r * columns + c joined to its right and lower neighbors
+EdgeList *Generators_Grid(unsigned int rows, unsigned int columns, const GeneratorOptions *options);
+
+/// Every pair of the n vertices
+EdgeList *Generators_Complete(unsigned int n, const GeneratorOptions *options);
+
+/// Every vertex of the first a joined to every vertex of the following b
+EdgeList *Generators_CompleteBipartite(unsigned int a, unsigned int b, const GeneratorOptions *options);
+
+/// n points uniform in the unit square, joined when they are within radius. Points are bucketed in cells of at least
+/// radius, so only neighboring cells are compared.
+EdgeList *Generators_RandomGeometric(unsigned int n, double radius, const GeneratorOptions *options);
+
+#endif /* Generators_h */
@@ -11,20 +11,93 @@
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
+#include "Util/Counters.h"
+
+#define ADJ_ROW_SIZE (GRAPH_MAX_SIZE * sizeof(bool))
+#define INCIDENCE_ROW_SIZE (GRAPH_MAX_SIZE * sizeof(signed int))
+
+/// Every row of a chunk that has never been written to
+static const signed int _ZeroRow[GRAPH_MAX_SIZE] = {0};
+
+static void _GraphChunk_Release(GraphChunk *chunk)
+{
+    if (chunk != NULL && atomic_fetch_sub(&chunk->References, 1) == 1)
+    {
+        free(chunk);
+    }
+}
+
+/// Makes sure the chunk in the slot is held by nothing else, copying it if it is shared or allocating it if it is NULL
+/// - Returns: true if the slot now holds a different chunk, and the row pointers into it need updating
+static bool _GraphChunk_MakeWritable(GraphChunk **slot, size_t rowSize)
+{
+    GraphChunk *chunk = *slot;
+    if (chunk != NULL && atomic_load(&chunk->References) == 1) return false;
+    
+    GraphChunk *copy = malloc(sizeof(GraphChunk) + GRAPH_CHUNK_ROWS * rowSize);
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(GraphChunk) + GRAPH_CHUNK_ROWS * rowSize);
+    atomic_init(&copy->References, 1);
+    if (chunk == NULL)
+    {
+        memset(copy->Rows, 0, GRAPH_CHUNK_ROWS * rowSize);
+    }
+    else
+    {
+        memcpy(copy->Rows, chunk->Rows, GRAPH_CHUNK_ROWS * rowSize);
+        _GraphChunk_Release(chunk);
+    }
+    
+    *slot = copy;
+    return true;
+}
+
+static bool *_Graph_WritableAdjRow(Graph *g, VertexIndex v)
+{
+    assert(!g->IsSnapshot);
+    unsigned int c = v / GRAPH_CHUNK_ROWS;
+    if (_GraphChunk_MakeWritable(&g->AdjChunks[c], ADJ_ROW_SIZE))
+    {
+        for (unsigned int r = 0; r < GRAPH_CHUNK_ROWS && c * GRAPH_CHUNK_ROWS + r < GRAPH_MAX_SIZE; r++)
+        {
+            g->AdjMatrix[c * GRAPH_CHUNK_ROWS + r] = (const bool *) (g->AdjChunks[c]->Rows + r * ADJ_ROW_SIZE);
+        }
+    }
+    return (bool *) g->AdjMatrix[v];
+}
+
+static signed int *_Graph_WritableIncidenceRow(Graph *g, VertexIndex v)
+{
+    assert(!g->IsSnapshot);
+    unsigned int c = v / GRAPH_CHUNK_ROWS;
+    if (_GraphChunk_MakeWritable(&g->IncidenceChunks[c], INCIDENCE_ROW_SIZE))
+    {
+        for (unsigned int r = 0; r < GRAPH_CHUNK_ROWS && c * GRAPH_CHUNK_ROWS + r < GRAPH_MAX_SIZE; r++)
+        {
+            g->IncidenceMatrix[c * GRAPH_CHUNK_ROWS + r] = (const signed int *) (g->IncidenceChunks[c]->Rows + r * INCIDENCE_ROW_SIZE);
+        }
+    }
+    return (signed int *) g->IncidenceMatrix[v];
+}
 
 Graph *Graph_CreateGraph(void)
 {
     Graph *g = malloc(sizeof(Graph));
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(Graph));
     g->Edges = 0;
     g->Vertices = 0;
+    g->Version = 0;
+    g->IsSnapshot = false;
     
     for (int i = 0; i < GRAPH_MAX_SIZE; ++i)
     {
-        for (int j = 0; j < GRAPH_MAX_SIZE; ++j)
-        {
-            g->AdjMatrix[i][j] = false;
-            g->IncidenceMatrix[i][j] = INCIDENCE_MATRIX_NO_VALUE;
-        }
+        g->AdjMatrix[i] = (const bool *) _ZeroRow;
+        g->IncidenceMatrix[i] = _ZeroRow;
+    }
+    
+    for (int c = 0; c < GRAPH_CHUNK_COUNT; ++c)
+    {
+        g->AdjChunks[c] = NULL;
+        g->IncidenceChunks[c] = NULL;
     }
     
     return g;
@@ -32,12 +105,49 @@ Graph *Graph_CreateGraph(void)
 
 void Graph_FreeGraph(Graph *g)
 {
+    for (int c = 0; c < GRAPH_CHUNK_COUNT; ++c)
+    {
+        _GraphChunk_Release(g->AdjChunks[c]);
+        _GraphChunk_Release(g->IncidenceChunks[c]);
+    }
     free(g);
 }
 
+Graph *Graph_Snapshot(const Graph *g)
+{
+    assert(g != NULL);
+    Graph *snapshot = malloc(sizeof(Graph));
+    Counters_Add(COUNTER_BYTES_GRAPH, sizeof(Graph));
+    memcpy(snapshot, g, sizeof(Graph));
+    snapshot->IsSnapshot = true;
+    
+    for (int c = 0; c < GRAPH_CHUNK_COUNT; ++c)
+    {
+        if (g->AdjChunks[c] != NULL) atomic_fetch_add(&g->AdjChunks[c]->References, 1);
+        if (g->IncidenceChunks[c] != NULL) atomic_fetch_add(&g->IncidenceChunks[c]->References, 1);
+    }
+    
+    return snapshot;
+}
+
+static void _Graph_RecordChange(Graph *g, GraphChange change)
+{
+    g->ChangeLog[g->Version % GRAPH_CHANGE_LOG_SIZE] = change;
+    g->Version++;
+}
+
+const GraphChange *Graph_ChangeAt(const Graph *g, unsigned long version)
+{
+    assert(g != NULL);
+    if (version == 0 || version > g->Version || g->Version - version >= GRAPH_CHANGE_LOG_SIZE) return NULL;
+    return &g->ChangeLog[(version - 1) % GRAPH_CHANGE_LOG_SIZE];
+}
+
 VertexIndex Graph_AddVertex(Graph *g)
 {
     assert(g != NULL);
+    assert(!g->IsSnapshot);
+    _Graph_RecordChange(g, (GraphChange) {.Kind = GRAPH_CHANGE_ADD_VERTEX, .V1 = g->Vertices, .V2 = g->Vertices});
     return g->Vertices++;
 }
 
@@ -51,11 +161,14 @@ EdgeIndex Graph_AddEdgeWeighted(Graph *g, VertexIndex v1, VertexIndex v2, Vertex
     // Self loop
     if (v1 != v2)
     {
-        g->IncidenceMatrix[v2][e] = INCIDENCE_MATRIX_NEGATIVE_DIRECTION;
+        _Graph_WritableIncidenceRow(g, v2)[e] = INCIDENCE_MATRIX_NEGATIVE_DIRECTION;
     }
-    g->IncidenceMatrix[v1][e] = weight;
-    g->AdjMatrix[v1][v2] = true;
+    _Graph_WritableIncidenceRow(g, v1)[e] = weight;
+    _Graph_WritableAdjRow(g, v1)[v2] = true;
+    g->EdgeSources[e] = v1;
+    g->EdgeTargets[e] = v2;
     
+    _Graph_RecordChange(g, (GraphChange) {.Kind = GRAPH_CHANGE_ADD_EDGE, .V1 = v1, .V2 = v2, .E = e});
     g->Edges++;
     return e;
 }
@@ -65,6 +178,39 @@ EdgeIndex Graph_AddEdge(Graph *g, VertexIndex v1, VertexIndex v2)
     return Graph_AddEdgeWeighted(g, v1, v2, INCIDENCE_MATRIX_POSITIVE_DIRECTION);
 }
 
+void Graph_RemoveLastVertex(Graph *g)
+{
+    assert(g != NULL);
+    assert(!g->IsSnapshot);
+    assert(g->Vertices > 0);
+    
+    VertexIndex v = g->Vertices - 1;
+    assert(Graph_VertexDegree(g, v) == 0);
+    
+    g->Vertices--;
+    _Graph_RecordChange(g, (GraphChange) {.Kind = GRAPH_CHANGE_REMOVE_VERTEX, .V1 = v, .V2 = v});
+}
+
+void Graph_RemoveLastEdge(Graph *g, VertexIndex v1, VertexIndex v2, bool wasAdjacent)
+{
+    assert(g != NULL);
+    assert(!g->IsSnapshot);
+    assert(g->Edges > 0);
+    
+    EdgeIndex e = g->Edges - 1;
+    assert(Graph_IsIncident(g, v1, e) && Graph_IsIncident(g, v2, e));
+    
+    _Graph_WritableIncidenceRow(g, v1)[e] = INCIDENCE_MATRIX_NO_VALUE;
+    _Graph_WritableIncidenceRow(g, v2)[e] = INCIDENCE_MATRIX_NO_VALUE;
+    if (!wasAdjacent)
+    {
+        _Graph_WritableAdjRow(g, v1)[v2] = false;
+    }
+    
+    g->Edges--;
+    _Graph_RecordChange(g, (GraphChange) {.Kind = GRAPH_CHANGE_REMOVE_EDGE, .V1 = v1, .V2 = v2, .E = e});
+}
+
 bool Graph_IsIncident(Graph *g, VertexIndex v, EdgeIndex e)
 {
     assert(g != NULL);
@@ -112,45 +258,7 @@ unsigned int Graph_VertexDegree(Graph *g, VertexIndex v)
             deg++;
         }
     }
+    Counters_Add(COUNTER_DEGREE_QUERIES, 1);
+    Counters_Add(COUNTER_DEGREE_EDGES_SCANNED, g->Edges);
     return deg;
 }
-
-void Graph_DumpAdjMatrix(Graph *g, StringBuffer buffer)
-{
-    memset(buffer, '\0', sizeof(StringBuffer));
-    char numStr[3];
-    for (int i = 0; i < g->Vertices; i++)
-    {
-        for (int j = 0; j < g->Vertices; j++)
-        {
-            sprintf(numStr, "%u", g->AdjMatrix[i][j]);
-            strcat(buffer, numStr);
-            if (j + 1 < g->Vertices)
-            {
-                strcat(buffer, " ");
-            }
-        }
-        strcat(buffer, "\n");
-    }
-    strcat(buffer, "\0");
-}
-
-void Graph_DumpIncidenceMatrix(Graph *g, StringBuffer buffer)
-{
-    memset(buffer, '\0', sizeof(StringBuffer));
-    char numStr[3];
-    for (int i = 0; i < g->Vertices; i++)
-    {
-        for (int j = 0; j < g->Edges; j++)
-        {
-            sprintf(numStr, "%d", g->IncidenceMatrix[i][j]);
-            strcat(buffer, numStr);
-            if (j + 1 < g->Edges)
-            {
-                strcat(buffer, " ");
-            }
-        }
-        strcat(buffer, "\n");
-    }
-    strcat(buffer, "\0");
-}
@@ -9,6 +9,9 @@
 #define Graph_h
 
 #include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "Util/OutputSink.h"
 
 #define GRAPH_MAX_SIZE 127
 
@@ -18,17 +21,71 @@
 
 #define MST_NO_EDGE (unsigned int)(-1)
 
+#define GRAPH_CHANGE_LOG_SIZE 64
+
+/// Rows of a matrix stored, shared and copied together
+#define GRAPH_CHUNK_ROWS 16
+#define GRAPH_CHUNK_COUNT ((GRAPH_MAX_SIZE + GRAPH_CHUNK_ROWS - 1) / GRAPH_CHUNK_ROWS)
+
 typedef char StringBuffer[0xFFF];
+
+typedef enum
+{
+    /// Every entry, separated by spaces, one row per line
+    GRAPH_DUMP_DENSE,
+    
+    /// One "row column value" line per non zero entry
+    GRAPH_DUMP_SPARSE,
+    
+    /// Every row as runs of equal entries, separated by spaces. A run of n > 1 entries is written as "value*n".
+    GRAPH_DUMP_RUN_LENGTH,
+} GraphDumpFormat;
 typedef unsigned int VertexIndex;
 typedef unsigned int EdgeIndex;
 
+/// Where and why a graph file could not be loaded
+typedef struct
+{
+    /// The line of the file, starting at 1
+    unsigned int Line;
+    const char *Message;
+} GraphLoadError;
+
+typedef enum
+{
+    GRAPH_CHANGE_ADD_VERTEX,
+    GRAPH_CHANGE_ADD_EDGE,
+    GRAPH_CHANGE_REMOVE_VERTEX,
+    GRAPH_CHANGE_REMOVE_EDGE,
+} GraphChangeKind;
+
+/// A single change to a graph, enough for a cache of the graph to patch only what was touched
+typedef struct
+{
+    GraphChangeKind Kind;
+    VertexIndex V1;
+    VertexIndex V2;
+    EdgeIndex E;
+} GraphChange;
+
+/// GRAPH_CHUNK_ROWS consecutive rows of a matrix, shared by a graph and its snapshots until one of them writes to it
+typedef struct
+{
+    /// Graphs and snapshots holding the chunk, it is freed when the last one lets go
+    atomic_uint References;
+    
+    _Alignas(signed int) unsigned char Rows[];
+} GraphChunk;
+
 typedef struct
 {
     unsigned int Edges;
     unsigned int Vertices;
     
     /// Maps Vertex to Vertex returning true if they are adjacent, false if they are not
-    bool AdjMatrix[GRAPH_MAX_SIZE][GRAPH_MAX_SIZE];
+    ///
+    /// NOTE: Rows are read only views into AdjChunks, write through Graph_ functions
+    const bool *AdjMatrix[GRAPH_MAX_SIZE];
     
     /// Maps Vertex to Edge returning a weight:
     /// 0 if they do not connect,
@@ -36,15 +93,39 @@ typedef struct
     /// less than 0 if they connect and is directed inwards
     ///
     /// NOTE: A self loop is denoted by a single entry in a column
-    signed int IncidenceMatrix[GRAPH_MAX_SIZE][GRAPH_MAX_SIZE];
+    const signed int *IncidenceMatrix[GRAPH_MAX_SIZE];
+    
+    /// Maps Edge to the vertex it is directed outwards from and the one it is directed inwards to, the same vertex for a
+    /// self loop, so the entries of an edge are found without scanning its column
+    VertexIndex EdgeSources[GRAPH_MAX_SIZE];
+    VertexIndex EdgeTargets[GRAPH_MAX_SIZE];
+    
+    /// Storage behind the matrix rows. A NULL chunk has never been written to and its rows read as zero.
+    GraphChunk *AdjChunks[GRAPH_CHUNK_COUNT];
+    GraphChunk *IncidenceChunks[GRAPH_CHUNK_COUNT];
+    
+    /// Snapshots are read only
+    bool IsSnapshot;
+    
+    /// Incremented on every change to the graph
+    unsigned long Version;
+    
+    /// The most recent changes, the change that produced version v is at (v - 1) % GRAPH_CHANGE_LOG_SIZE
+    GraphChange ChangeLog[GRAPH_CHANGE_LOG_SIZE];
 } Graph;
 
-/// Returns a new graph with 0 edges, 0 vertices, false values in the adj matrix, and all 0's in the incidence matrix
+/// Returns a new graph with 0 edges, 0 vertices, false values in the adj matrix, and all 0's in the incidence matrix.
+/// No matrix storage is allocated until it is written to.
 Graph *Graph_CreateGraph(void);
 
-/// Frees the memory of the graph
+/// Frees the memory of the graph or snapshot. Chunks still held by other snapshots are left to them.
 void Graph_FreeGraph(Graph *g);
 
+/// Takes a read only view of the graph as of now, in O(1). The snapshot shares every chunk with the graph,
+/// the next write to a shared chunk copies it first, so the snapshot can be read from another thread while the graph keeps changing.
+/// - Returns: A snapshot to free with Graph_FreeGraph, from any thread
+Graph *Graph_Snapshot(const Graph *g);
+
 /// Adds a vertex to the adjacency matrix and incidence matrix O(1)
 /// - Returns: the index of the vertex created
 VertexIndex Graph_AddVertex(Graph *g);
@@ -66,9 +147,23 @@ EdgeIndex Graph_AddEdge(Graph *g, VertexIndex v1, VertexIndex v2);
 /// - Returns: the new edge index
 EdgeIndex Graph_AddEdgeWeighted(Graph *g, VertexIndex v1, VertexIndex v2, VertexIndex weight);
 
+/// - Returns: The change that produced version v, or NULL if it is older than the change log
+const GraphChange *Graph_ChangeAt(const Graph *g, unsigned long version);
+
 /// Removes the edge e from the graph
 void Graph_RemoveEdge(Graph *g, EdgeIndex e);
 
+/// Undoes the last Graph_AddVertex in O(1). The vertex must have no edges.
+void Graph_RemoveLastVertex(Graph *g);
+
+/// Undoes the last Graph_AddEdge in O(1)
+/// - Parameters:
+///   - g: The graph
+///   - v1: The vertex the edge was directed from
+///   - v2: The vertex the edge was directed towards
+///   - wasAdjacent: If v1 was adjacent to v2 before the edge was added, ie there is a parallel edge
+void Graph_RemoveLastEdge(Graph *g, VertexIndex v1, VertexIndex v2, bool wasAdjacent);
+
 /// Queries the incidence matrix
 /// - Parameters:
 ///   - g: The graph
@@ -113,10 +208,25 @@ unsigned int Graph_VertexDegree(Graph *g, VertexIndex v);
 /// terminated by a -1 vertex
 void Graph_MinSpanningTree(Graph *g, EdgeIndex edges[GRAPH_MAX_SIZE]);
 
-/// Dumps the adj matrix into a string
+/// Labels every vertex with its connected component, ignoring the direction of edges
+/// - Returns: the number of components
+unsigned int Graph_ConnectedComponents(const Graph *g, unsigned int components[GRAPH_MAX_SIZE]);
+
+/// Reads a graph from an edge list, one "v1 v2 [weight]" line per edge. Vertices are numbered from 0, and the graph has
+/// as many as the largest one referenced. Blank lines and lines starting with # are skipped.
+/// - Returns: The graph, or NULL if the file is malformed, with the reason in error
+Graph *Graph_ReadEdgeList(FILE *file, GraphLoadError *error);
+
+/// Streams the adj matrix to the sink, in time linear to the output
+void Graph_WriteAdjMatrix(const Graph *g, OutputSink *sink, GraphDumpFormat format);
+
+/// Streams the incidence matrix to the sink, in time linear to the output
+void Graph_WriteIncidenceMatrix(const Graph *g, OutputSink *sink, GraphDumpFormat format);
+
+/// Dumps the adj matrix into a string, truncated to fit the buffer
 void Graph_DumpAdjMatrix(Graph *g, StringBuffer buffer);
 
-/// Dumps the incidence matrix into a string
+/// Dumps the incidence matrix into a string, truncated to fit the buffer
 void Graph_DumpIncidenceMatrix(Graph *g, StringBuffer buffer);
 
 
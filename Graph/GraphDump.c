@@ -0,0 +1,193 @@
+//
+//  GraphDump.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Graph.h"
+#include <assert.h>
+#include "Util/Profiler.h"
+
+/// Reads a single entry of a matrix
+typedef int (*MatrixEntry)(const Graph *g, unsigned int row, unsigned int column);
+
+static int _AdjMatrixEntry(const Graph *g, unsigned int row, unsigned int column)
+{
+    return g->AdjMatrix[row][column];
+}
+
+static int _IncidenceMatrixEntry(const Graph *g, unsigned int row, unsigned int column)
+{
+    return g->IncidenceMatrix[row][column];
+}
+
+static void _WriteDense(const Graph *g, OutputSink *sink, MatrixEntry entry, unsigned int rows, unsigned int columns)
+{
+    for (unsigned int i = 0; i < rows; i++)
+    {
+        for (unsigned int j = 0; j < columns; j++)
+        {
+            OutputSink_WriteInt(sink, entry(g, i, j));
+            if (j + 1 < columns)
+            {
+                OutputSink_WriteChar(sink, ' ');
+            }
+        }
+        OutputSink_WriteChar(sink, '\n');
+    }
+}
+
+/// A non zero entry of a matrix
+typedef struct
+{
+    unsigned int Row;
+    unsigned int Column;
+} _Entry;
+
+/// Fills entries with the non zero entries of a matrix in any order
+/// - Returns: How many were filled
+typedef unsigned int (*MatrixEntries)(const Graph *g, _Entry entries[2 * GRAPH_MAX_SIZE]);
+
+/// The entry of each edge, from the row of its source to the column of its target
+static unsigned int _AdjMatrixEntries(const Graph *g, _Entry entries[2 * GRAPH_MAX_SIZE])
+{
+    for (EdgeIndex e = 0; e < g->Edges; e++)
+    {
+        entries[e] = (_Entry) { .Row = g->EdgeSources[e], .Column = g->EdgeTargets[e] };
+    }
+    return g->Edges;
+}
+
+/// The entries of each edge in its column, one for a self loop
+static unsigned int _IncidenceMatrixEntries(const Graph *g, _Entry entries[2 * GRAPH_MAX_SIZE])
+{
+    unsigned int count = 0;
+    for (EdgeIndex e = 0; e < g->Edges; e++)
+    {
+        entries[count++] = (_Entry) { .Row = g->EdgeSources[e], .Column = e };
+        if (g->EdgeTargets[e] != g->EdgeSources[e]) entries[count++] = (_Entry) { .Row = g->EdgeTargets[e], .Column = e };
+    }
+    return count;
+}
+
+/// Stable counting sort of the entries by their rows, or by their columns
+static void _SortEntries(_Entry *entries, _Entry *sorted, unsigned int count, bool isByRow)
+{
+    unsigned int starts[GRAPH_MAX_SIZE + 1] = {0};
+    for (unsigned int i = 0; i < count; i++) starts[(isByRow ? entries[i].Row : entries[i].Column) + 1]++;
+    for (unsigned int k = 0; k < GRAPH_MAX_SIZE; k++) starts[k + 1] += starts[k];
+    for (unsigned int i = 0; i < count; i++) sorted[starts[isByRow ? entries[i].Row : entries[i].Column]++] = entries[i];
+}
+
+/// Writes the non zero entries row by row in O(V + E), rather than scanning every entry
+static void _WriteSparse(const Graph *g, OutputSink *sink, MatrixEntry entry, MatrixEntries nonZero)
+{
+    _Entry entries[2 * GRAPH_MAX_SIZE], sorted[2 * GRAPH_MAX_SIZE];
+    const unsigned int count = nonZero(g, entries);
+    _SortEntries(entries, sorted, count, false);
+    _SortEntries(sorted, entries, count, true);
+    
+    for (unsigned int k = 0; k < count; k++)
+    {
+        // Parallel edges share an entry of the adj matrix
+        const unsigned int i = entries[k].Row, j = entries[k].Column;
+        if (k > 0 && entries[k - 1].Row == i && entries[k - 1].Column == j) continue;
+        int value = entry(g, i, j);
+        if (value == 0) continue;
+        
+        OutputSink_WriteInt(sink, i);
+        OutputSink_WriteChar(sink, ' ');
+        OutputSink_WriteInt(sink, j);
+        OutputSink_WriteChar(sink, ' ');
+        OutputSink_WriteInt(sink, value);
+        OutputSink_WriteChar(sink, '\n');
+    }
+}
+
+static void _WriteRun(OutputSink *sink, int value, unsigned int length)
+{
+    OutputSink_WriteInt(sink, value);
+    if (length > 1)
+    {
+        OutputSink_WriteChar(sink, '*');
+        OutputSink_WriteInt(sink, length);
+    }
+}
+
+static void _WriteRunLength(const Graph *g, OutputSink *sink, MatrixEntry entry, unsigned int rows, unsigned int columns)
+{
+    for (unsigned int i = 0; i < rows; i++)
+    {
+        if (columns == 0)
+        {
+            OutputSink_WriteChar(sink, '\n');
+            continue;
+        }
+        
+        int value = entry(g, i, 0);
+        unsigned int length = 1;
+        for (unsigned int j = 1; j < columns; j++)
+        {
+            int next = entry(g, i, j);
+            if (next == value)
+            {
+                length++;
+                continue;
+            }
+            _WriteRun(sink, value, length);
+            OutputSink_WriteChar(sink, ' ');
+            value = next;
+            length = 1;
+        }
+        _WriteRun(sink, value, length);
+        OutputSink_WriteChar(sink, '\n');
+    }
+}
+
+static void _WriteMatrix(const Graph *g, OutputSink *sink, GraphDumpFormat format, MatrixEntry entry, MatrixEntries nonZero,
+                         unsigned int columns)
+{
+    switch (format)
+    {
+        case GRAPH_DUMP_DENSE:
+            _WriteDense(g, sink, entry, g->Vertices, columns);
+            break;
+        case GRAPH_DUMP_SPARSE:
+            _WriteSparse(g, sink, entry, nonZero);
+            break;
+        case GRAPH_DUMP_RUN_LENGTH:
+            _WriteRunLength(g, sink, entry, g->Vertices, columns);
+            break;
+    }
+}
+
+void Graph_WriteAdjMatrix(const Graph *g, OutputSink *sink, GraphDumpFormat format)
+{
+    PROFILE_ZONE("Graph_WriteAdjMatrix");
+    assert(g != NULL);
+    assert(sink != NULL);
+    _WriteMatrix(g, sink, format, _AdjMatrixEntry, _AdjMatrixEntries, g->Vertices);
+}
+
+void Graph_WriteIncidenceMatrix(const Graph *g, OutputSink *sink, GraphDumpFormat format)
+{
+    PROFILE_ZONE("Graph_WriteIncidenceMatrix");
+    assert(g != NULL);
+    assert(sink != NULL);
+    _WriteMatrix(g, sink, format, _IncidenceMatrixEntry, _IncidenceMatrixEntries, g->Edges);
+}
+
+void Graph_DumpAdjMatrix(Graph *g, StringBuffer buffer)
+{
+    OutputSink *sink = OutputSink_CreateFixedBufferSink(buffer, sizeof(StringBuffer));
+    Graph_WriteAdjMatrix(g, sink, GRAPH_DUMP_DENSE);
+    OutputSink_FreeOutputSink(sink);
+}
+
+void Graph_DumpIncidenceMatrix(Graph *g, StringBuffer buffer)
+{
+    OutputSink *sink = OutputSink_CreateFixedBufferSink(buffer, sizeof(StringBuffer));
+    Graph_WriteIncidenceMatrix(g, sink, GRAPH_DUMP_DENSE);
+    OutputSink_FreeOutputSink(sink);
+}
@@ -0,0 +1,255 @@
+//
+//  GraphFile.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "GraphFile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Util/Profiler.h"
+
+#define GRAPH_FILE_CHECKSUM_PRIME 0x9E3779B97F4A7C15ull
+#define GRAPH_FILE_CHECKSUM_MIX 0xC2B2AE3D27D4EB4Full
+
+_Static_assert(sizeof(GraphFileHeader) == 32 + 16 * GRAPH_FILE_SECTION_COUNT, "the header must have no padding");
+
+static inline uint64_t _Rotate(uint64_t x, int bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+/// Continues a checksum over the bytes. Four independent lanes of 8 byte words keep up with reading from memory.
+/// It catches corruption, not tampering.
+static uint64_t _Checksum(uint64_t checksum, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    uint64_t lanes[4] = { checksum, checksum ^ GRAPH_FILE_CHECKSUM_PRIME, checksum ^ GRAPH_FILE_CHECKSUM_MIX, ~checksum };
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        for (int lane = 0; lane < 4; lane++)
+        {
+            uint64_t word;
+            memcpy(&word, bytes + i + lane * 8, sizeof(word));
+            lanes[lane] = _Rotate(lanes[lane] + word * GRAPH_FILE_CHECKSUM_MIX, 31) * GRAPH_FILE_CHECKSUM_PRIME;
+        }
+    }
+    
+    uint64_t h = _Rotate(lanes[0], 1) + _Rotate(lanes[1], 7) + _Rotate(lanes[2], 12) + _Rotate(lanes[3], 18);
+    for (; i < size; i++)
+    {
+        h = (h ^ bytes[i]) * GRAPH_FILE_CHECKSUM_PRIME;
+    }
+    h ^= size;
+    h ^= h >> 33;
+    h *= GRAPH_FILE_CHECKSUM_MIX;
+    h ^= h >> 29;
+    return h;
+}
+
+static inline uint64_t _Align(uint64_t offset)
+{
+    return (offset + GRAPH_FILE_ALIGNMENT - 1) & ~(uint64_t) (GRAPH_FILE_ALIGNMENT - 1);
+}
+
+/// - Returns: The size every section must have, empty sketch sections are allowed too
+static uint64_t _SectionSize(GraphFileSectionKind kind, uint64_t vertices, uint64_t count)
+{
+    switch (kind)
+    {
+        case GRAPH_FILE_OFFSETS: return (vertices + 1) * sizeof(uint64_t);
+        case GRAPH_FILE_TARGETS: return count * sizeof(VertexIndex);
+        case GRAPH_FILE_WEIGHTS: return count * sizeof(unsigned int);
+        case GRAPH_FILE_EDGES: return count * sizeof(uint32_t);
+        case GRAPH_FILE_POSITIONS: return vertices * 2 * sizeof(float);
+        case GRAPH_FILE_COLORS: return vertices * sizeof(uint32_t);
+        case GRAPH_FILE_LABELS: return vertices * GRAPH_FILE_LABEL_SIZE;
+        default: assert(false); return 0;
+    }
+}
+
+bool GraphFile_Write(const char *path, const Csr *csr, const GraphFileSketch *sketch, bool hasChecksum)
+{
+    PROFILE_ZONE("GraphFile_Write");
+    assert(path != NULL);
+    assert(csr != NULL);
+    
+    const void *data[GRAPH_FILE_SECTION_COUNT] =
+    {
+        csr->Offsets, csr->Targets, csr->Weights, csr->Edges,
+        sketch != NULL ? sketch->Positions : NULL,
+        sketch != NULL ? sketch->Colors : NULL,
+        sketch != NULL ? sketch->Labels : NULL,
+    };
+    
+    GraphFileHeader header =
+    {
+        .ByteOrder = GRAPH_FILE_BYTE_ORDER, .Version = GRAPH_FILE_VERSION, .Vertices = csr->Vertices, .Count = csr->Count
+    };
+    memcpy(header.Magic, GRAPH_FILE_MAGIC, sizeof(header.Magic));
+    uint64_t offset = _Align(sizeof(GraphFileHeader));
+    for (GraphFileSectionKind kind = 0; kind < GRAPH_FILE_SECTION_COUNT; kind++)
+    {
+        uint64_t size = data[kind] != NULL ? _SectionSize(kind, csr->Vertices, csr->Count) : 0;
+        header.Sections[kind] = (GraphFileSection) { .Offset = offset, .Size = size };
+        offset = _Align(offset + size);
+        if (hasChecksum) header.Checksum = _Checksum(header.Checksum, data[kind], size);
+    }
+    if (hasChecksum) header.Flags |= GRAPH_FILE_HAS_CHECKSUM;
+    
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) return false;
+    
+    static const char padding[GRAPH_FILE_ALIGNMENT] = {0};
+    bool isWritten = fwrite(&header, sizeof(header), 1, file) == 1;
+    uint64_t written = sizeof(header);
+    for (GraphFileSectionKind kind = 0; kind < GRAPH_FILE_SECTION_COUNT && isWritten; kind++)
+    {
+        const GraphFileSection *section = &header.Sections[kind];
+        isWritten = fwrite(padding, 1, section->Offset - written, file) == section->Offset - written;
+        
+        // Sections left out have no data, and fwrite is never handed NULL even for nothing
+        if (section->Size > 0) isWritten = isWritten && fwrite(data[kind], 1, section->Size, file) == section->Size;
+        written = section->Offset + section->Size;
+    }
+    
+    // Mapped files are read in whole pages, the end is padded so the last section is too
+    isWritten = isWritten && fwrite(padding, 1, _Align(written) - written, file) == _Align(written) - written;
+    return fclose(file) == 0 && isWritten;
+}
+
+static GraphFile *_Fail(GraphLoadError *error, const char *message)
+{
+    if (error != NULL)
+    {
+        error->Line = 0;
+        error->Message = message;
+    }
+    return NULL;
+}
+
+static bool _Reject(GraphLoadError *error, const char *message)
+{
+    _Fail(error, message);
+    return false;
+}
+
+GraphFile *GraphFile_Open(const char *path, GraphLoadError *error)
+{
+    PROFILE_ZONE("GraphFile_Open");
+    assert(path != NULL);
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return _Fail(error, "could not open the file");
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(GraphFileHeader))
+    {
+        close(fd);
+        return _Fail(error, "not a graph file");
+    }
+    
+    size_t size = (size_t) info.st_size;
+    void *memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) return _Fail(error, "could not map the file");
+    
+    const GraphFileHeader *header = memory;
+    const char *message = NULL;
+    if (memcmp(header->Magic, GRAPH_FILE_MAGIC, sizeof(header->Magic)) != 0) message = "not a graph file";
+    else if (header->ByteOrder == __builtin_bswap16(GRAPH_FILE_BYTE_ORDER)) message = "graph file of the other byte order";
+    else if (header->Version != GRAPH_FILE_VERSION || header->ByteOrder != GRAPH_FILE_BYTE_ORDER)
+    {
+        message = "unsupported graph file version";
+    }
+    else if (header->Count >= UINT32_MAX) message = "too many edges";
+    for (GraphFileSectionKind kind = 0; kind < GRAPH_FILE_SECTION_COUNT && message == NULL; kind++)
+    {
+        const GraphFileSection *section = &header->Sections[kind];
+        uint64_t expected = _SectionSize(kind, header->Vertices, header->Count);
+        bool isOptional = kind >= GRAPH_FILE_POSITIONS && section->Size == 0;
+        if (section->Offset % GRAPH_FILE_ALIGNMENT != 0 || section->Offset > size || section->Size > size - section->Offset ||
+            (section->Size != expected && !isOptional))
+        {
+            message = "truncated or malformed graph file";
+        }
+    }
+    if (message != NULL)
+    {
+        munmap(memory, size);
+        return _Fail(error, message);
+    }
+    
+    const char *base = memory;
+    const GraphFileSection *sections = header->Sections;
+    GraphFile *file = malloc(sizeof(GraphFile));
+    file->Header = header;
+    file->Memory = memory;
+    file->Size = size;
+    file->Csr = (Csr)
+    {
+        .Vertices = header->Vertices,
+        .Count = header->Count,
+        .Offsets = (uint64_t *) (base + sections[GRAPH_FILE_OFFSETS].Offset),
+        .Targets = (VertexIndex *) (base + sections[GRAPH_FILE_TARGETS].Offset),
+        .Weights = (unsigned int *) (base + sections[GRAPH_FILE_WEIGHTS].Offset),
+        .Edges = (uint32_t *) (base + sections[GRAPH_FILE_EDGES].Offset),
+        .IsOwned = false,
+    };
+    file->Sketch = (GraphFileSketch)
+    {
+        .Positions = sections[GRAPH_FILE_POSITIONS].Size > 0 ? (float *) (base + sections[GRAPH_FILE_POSITIONS].Offset) : NULL,
+        .Colors = sections[GRAPH_FILE_COLORS].Size > 0 ? (uint32_t *) (base + sections[GRAPH_FILE_COLORS].Offset) : NULL,
+        .Labels = sections[GRAPH_FILE_LABELS].Size > 0 ? (void *) (base + sections[GRAPH_FILE_LABELS].Offset) : NULL,
+    };
+    return file;
+}
+
+bool GraphFile_Verify(const GraphFile *file, GraphLoadError *error)
+{
+    PROFILE_ZONE("GraphFile_Verify");
+    assert(file != NULL);
+    
+    const GraphFileHeader *header = file->Header;
+    if (header->Flags & GRAPH_FILE_HAS_CHECKSUM)
+    {
+        uint64_t checksum = 0;
+        for (GraphFileSectionKind kind = 0; kind < GRAPH_FILE_SECTION_COUNT; kind++)
+        {
+            checksum = _Checksum(checksum, (const char *) file->Memory + header->Sections[kind].Offset, header->Sections[kind].Size);
+        }
+        if (checksum != header->Checksum) return _Reject(error, "checksum mismatch");
+    }
+    
+    // Every edge must appear exactly once, so the edge list of the rows is well defined
+    const Csr *csr = &file->Csr;
+    if (csr->Offsets[0] != 0 || csr->Offsets[csr->Vertices] != csr->Count) return _Reject(error, "malformed rows");
+    uint64_t *seen = calloc(csr->Count / 64 + 1, sizeof(uint64_t));
+    bool isValid = true;
+    for (unsigned int v = 0; v < csr->Vertices && isValid; v++)
+    {
+        isValid = csr->Offsets[v] <= csr->Offsets[v + 1] && csr->Offsets[v + 1] <= csr->Count;
+        for (uint64_t i = csr->Offsets[v]; i < csr->Offsets[v + 1] && isValid; i++)
+        {
+            uint32_t e = csr->Edges[i];
+            isValid = csr->Targets[i] < csr->Vertices && csr->Weights[i] > 0 && e < csr->Count && !(seen[e / 64] >> (e % 64) & 1);
+            if (isValid) seen[e / 64] |= 1ull << (e % 64);
+        }
+    }
+    free(seen);
+    return isValid || _Reject(error, "malformed rows");
+}
+
+void GraphFile_Close(GraphFile *file)
+{
+    assert(file != NULL);
+    munmap(file->Memory, file->Size);
+    free(file);
+}
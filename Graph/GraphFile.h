@@ -0,0 +1,116 @@
+//
+//  GraphFile.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef GraphFile_h
+#define GraphFile_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Csr.h"
+
+#define GRAPH_FILE_MAGIC "GTSG"
+#define GRAPH_FILE_VERSION 2
+#define GRAPH_FILE_EXTENSION ".gtsg"
+
+/// Every section starts on a multiple of this, so its array is aligned where the file is mapped
+#define GRAPH_FILE_ALIGNMENT 64
+
+#define GRAPH_FILE_LABEL_SIZE 32
+
+/// Written in the byte order of the host, a host of the other order reads it swapped
+#define GRAPH_FILE_BYTE_ORDER 0xFEFF
+
+/// The file has a checksum of its sections
+#define GRAPH_FILE_HAS_CHECKSUM 1
+
+typedef enum
+{
+    /// The arrays of a Csr
+    GRAPH_FILE_OFFSETS,
+    GRAPH_FILE_TARGETS,
+    GRAPH_FILE_WEIGHTS,
+    GRAPH_FILE_EDGES,
+    
+    /// The sketch of the graph, each one empty when it was not saved
+    GRAPH_FILE_POSITIONS,
+    GRAPH_FILE_COLORS,
+    GRAPH_FILE_LABELS,
+    
+    GRAPH_FILE_SECTION_COUNT,
+} GraphFileSectionKind;
+
+typedef struct
+{
+    /// Bytes from the start of the file, a multiple of GRAPH_FILE_ALIGNMENT
+    uint64_t Offset;
+    uint64_t Size;
+} GraphFileSection;
+
+/// The start of a graph file, followed by its sections. The header and sections are stored in the byte order of the host
+/// that wrote them, so the file is mapped and used in place. A host of the other order refuses it rather than swap every
+/// section.
+typedef struct
+{
+    char Magic[4];
+    
+    /// GRAPH_FILE_BYTE_ORDER
+    uint16_t ByteOrder;
+    uint16_t Version;
+    uint32_t Flags;
+    uint32_t Vertices;
+    uint64_t Count;
+    
+    /// Of the bytes of every section in order, when GRAPH_FILE_HAS_CHECKSUM is set
+    uint64_t Checksum;
+    
+    GraphFileSection Sections[GRAPH_FILE_SECTION_COUNT];
+} GraphFileHeader;
+
+/// How each vertex was drawn, NULL for what was not saved
+typedef struct
+{
+    /// The X and then Y of each vertex
+    float *Positions;
+    
+    /// The 0xRRGGBBAA color of each vertex
+    uint32_t *Colors;
+    
+    char (*Labels)[GRAPH_FILE_LABEL_SIZE];
+} GraphFileSketch;
+
+/// A graph file mapped into memory. Nothing is read until it is used, pages are read from disk as they are first touched.
+typedef struct
+{
+    const GraphFileHeader *Header;
+    
+    /// The rows, read in place from the file
+    Csr Csr;
+    
+    GraphFileSketch Sketch;
+    
+    void *Memory;
+    size_t Size;
+} GraphFile;
+
+/// Writes the rows, and the sketch of their vertices if not NULL
+/// - Parameters:
+///   - hasChecksum: if the file is written with a checksum for GraphFile_Verify, which costs a pass over every section
+/// - Returns: false if the file could not be written
+bool GraphFile_Write(const char *path, const Csr *csr, const GraphFileSketch *sketch, bool hasChecksum);
+
+/// Maps a file in O(1), checking only its header and the bounds of its sections. The sections are trusted until verified.
+/// - Returns: The file, or NULL with the reason in error
+GraphFile *GraphFile_Open(const char *path, GraphLoadError *error);
+
+/// Reads every section in O(V + E), checking the checksum if the file has one, and that every entry of the rows is in range
+/// - Returns: false with the reason in error if the file is corrupt
+bool GraphFile_Verify(const GraphFile *file, GraphLoadError *error);
+
+/// Unmaps the file, the rows and sketch cannot be used after
+void GraphFile_Close(GraphFile *file);
+
+#endif /* GraphFile_h */
@@ -0,0 +1,75 @@
+//
+//  GraphLoad.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Graph.h"
+#include <stdio.h>
+#include <assert.h>
+#include <limits.h>
+
+#define GRAPH_LOAD_LINE_SIZE 256
+
+typedef struct
+{
+    VertexIndex V1;
+    VertexIndex V2;
+    unsigned int Weight;
+} EdgeListEntry;
+
+static Graph *_Fail(GraphLoadError *error, unsigned int line, const char *message)
+{
+    if (error != NULL)
+    {
+        error->Line = line;
+        error->Message = message;
+    }
+    return NULL;
+}
+
+Graph *Graph_ReadEdgeList(FILE *file, GraphLoadError *error)
+{
+    assert(file != NULL);
+    
+    // Every vertex is added before the first edge, so the edges are held until the largest vertex is known
+    EdgeListEntry edges[GRAPH_MAX_SIZE];
+    unsigned int edgeCount = 0;
+    unsigned int vertexCount = 0;
+    
+    char buffer[GRAPH_LOAD_LINE_SIZE];
+    unsigned int line = 0;
+    while (fgets(buffer, sizeof(buffer), file) != NULL)
+    {
+        line++;
+        
+        char first = '\0';
+        if (sscanf(buffer, " %c", &first) != 1 || first == '#') continue;
+        
+        EdgeListEntry entry = { .Weight = INCIDENCE_MATRIX_POSITIVE_DIRECTION };
+        char trailing = '\0';
+        int fields = sscanf(buffer, "%u %u %u %c", &entry.V1, &entry.V2, &entry.Weight, &trailing);
+        if (fields < 2 || fields > 3) return _Fail(error, line, "expected \"v1 v2 [weight]\"");
+        if (entry.Weight == 0 || entry.Weight > INT_MAX) return _Fail(error, line, "weights must be between 1 and INT_MAX");
+        if (entry.V1 >= GRAPH_MAX_SIZE || entry.V2 >= GRAPH_MAX_SIZE) return _Fail(error, line, "too many vertices");
+        if (edgeCount == GRAPH_MAX_SIZE) return _Fail(error, line, "too many edges");
+        
+        edges[edgeCount++] = entry;
+        if (entry.V1 >= vertexCount) vertexCount = entry.V1 + 1;
+        if (entry.V2 >= vertexCount) vertexCount = entry.V2 + 1;
+    }
+    
+    if (ferror(file)) return _Fail(error, line, "could not read the file");
+    
+    Graph *g = Graph_CreateGraph();
+    for (unsigned int v = 0; v < vertexCount; v++)
+    {
+        Graph_AddVertex(g);
+    }
+    for (unsigned int e = 0; e < edgeCount; e++)
+    {
+        Graph_AddEdgeWeighted(g, edges[e].V1, edges[e].V2, edges[e].Weight);
+    }
+    return g;
+}
@@ -0,0 +1,635 @@
+//
+//  Import.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Import.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Util/Profiler.h"
+#include "Util/WorkerPool.h"
+
+/// Vertices are numbered below this, so the vertex count fits in an unsigned int
+#define IMPORT_MAX_VERTICES UINT_MAX
+
+/// Parts smaller than this are not worth a thread
+#define IMPORT_MIN_PART_SIZE (1 << 16)
+
+/// The state of a parse, carried from one line to the next. Each part of a parallel parse has its own.
+typedef struct
+{
+    ImportFormat Format;
+    
+    /// Lines parsed so far
+    unsigned long long Line;
+    
+    /// Why the parse stopped, NULL while it succeeds
+    const char *Error;
+    
+    /// One more than the largest vertex seen, or the vertex count a header declared if larger
+    unsigned long long Vertices;
+    
+    /// The header a format starts with has been parsed
+    bool HasHeader;
+    
+    /// Matrix Market
+    bool HasBanner;
+    bool IsPattern;
+    
+    /// METIS, the vertex of the next line, the values to skip before its neighbors and if neighbors are followed by weights
+    unsigned long long NextVertex;
+    unsigned int SkippedValues;
+    bool HasEdgeWeights;
+    
+} _ImportParser;
+
+static inline bool _IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char *_SkipSpaces(const char *at, const char *end)
+{
+    while (at < end && _IsSpace(*at)) at++;
+    return at;
+}
+
+/// - Returns: If only spaces are left on the line
+static inline bool _IsEnd(const char *at, const char *end)
+{
+    return _SkipSpaces(at, end) == end;
+}
+
+/// Reads the next word of the line
+static inline const char *_ReadWord(const char **at, const char *end, size_t *length)
+{
+    const char *start = _SkipSpaces(*at, end);
+    const char *p = start;
+    while (p < end && !_IsSpace(*p)) p++;
+    *at = p;
+    *length = p - start;
+    return start;
+}
+
+static inline bool _IsWord(const char *word, size_t length, const char *expected)
+{
+    return length == strlen(expected) && strncasecmp(word, expected, length) == 0;
+}
+
+/// Reads the next whitespace separated unsigned integer. Values far past UINT_MAX saturate at ULLONG_MAX, so range checks catch them.
+/// - Returns: false if the next word is not a number
+static inline bool _ReadUnsigned(const char **at, const char *end, unsigned long long *value)
+{
+    const char *p = _SkipSpaces(*at, end);
+    if (p == end || (unsigned char)(*p - '0') > 9) return false;
+    
+    unsigned long long v = 0;
+    while (p < end && (unsigned char)(*p - '0') <= 9)
+    {
+        v = v <= UINT_MAX ? v * 10 + (*p - '0') : ULLONG_MAX;
+        p++;
+    }
+    if (p < end && !_IsSpace(*p)) return false;
+    
+    *at = p;
+    *value = v;
+    return true;
+}
+
+/// Reads the next whitespace separated real number, such as -1, 2.5 or 3e-2
+/// - Returns: false if the next word is not a number
+static inline bool _ReadReal(const char **at, const char *end, double *value)
+{
+    const char *p = _SkipSpaces(*at, end);
+    bool isNegative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) p++;
+    
+    double mantissa = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    for (; p < end && (unsigned char)(*p - '0') <= 9; p++, hasDigits = true)
+    {
+        mantissa = mantissa * 10 + (*p - '0');
+    }
+    if (p < end && *p == '.')
+    {
+        for (p++; p < end && (unsigned char)(*p - '0') <= 9; p++, hasDigits = true)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            exponent--;
+        }
+    }
+    if (!hasDigits) return false;
+    
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        p++;
+        bool isExponentNegative = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+')) p++;
+        if (p == end || (unsigned char)(*p - '0') > 9) return false;
+        int written = 0;
+        for (; p < end && (unsigned char)(*p - '0') <= 9; p++)
+        {
+            if (written < 10000) written = written * 10 + (*p - '0');
+        }
+        exponent += isExponentNegative ? -written : written;
+    }
+    if (p < end && !_IsSpace(*p)) return false;
+    
+    *at = p;
+    *value = (isNegative ? -mantissa : mantissa) * pow(10, exponent);
+    return true;
+}
+
+static bool _ImportParser_Fail(_ImportParser *p, const char *message)
+{
+    p->Error = message;
+    return false;
+}
+
+static inline bool _ImportParser_AddEdge(_ImportParser *p, EdgeList *el, unsigned long long v1, unsigned long long v2,
+                                         unsigned long long weight)
+{
+    if (weight == 0 || weight > INT_MAX) return _ImportParser_Fail(p, "weights must be between 1 and INT_MAX");
+    if (v1 >= IMPORT_MAX_VERTICES || v2 >= IMPORT_MAX_VERTICES) return _ImportParser_Fail(p, "too many vertices");
+    
+    if (v1 >= p->Vertices) p->Vertices = v1 + 1;
+    if (v2 >= p->Vertices) p->Vertices = v2 + 1;
+    EdgeList_Add(el, (VertexIndex)v1, (VertexIndex)v2, (unsigned int)weight);
+    return true;
+}
+
+/// Reserves room for the edges a header declares, unless the count is implausible
+static void _ImportParser_Declare(_ImportParser *p, EdgeList *el, unsigned long long vertices, unsigned long long edges)
+{
+    if (vertices > p->Vertices) p->Vertices = vertices;
+    if (edges <= UINT_MAX) EdgeList_Reserve(el, el->Count + edges);
+}
+
+static bool _ParseEdgeListLine(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    at = _SkipSpaces(at, end);
+    if (at == end || *at == '#' || *at == '%') return true;
+    
+    unsigned long long v1, v2, weight = INCIDENCE_MATRIX_POSITIVE_DIRECTION;
+    bool isWellFormed = _ReadUnsigned(&at, end, &v1) && _ReadUnsigned(&at, end, &v2) &&
+                        (_IsEnd(at, end) || _ReadUnsigned(&at, end, &weight)) && _IsEnd(at, end);
+    if (!isWellFormed) return _ImportParser_Fail(p, "expected \"v1 v2 [weight]\"");
+    return _ImportParser_AddEdge(p, el, v1, v2, weight);
+}
+
+static bool _ParseDimacsLine(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    at = _SkipSpaces(at, end);
+    if (at == end || *at == 'c') return true;
+    
+    char kind = *at++;
+    if (kind == 'p')
+    {
+        size_t length;
+        unsigned long long vertices, edges;
+        _ReadWord(&at, end, &length);
+        if (length == 0 || !_ReadUnsigned(&at, end, &vertices) || !_ReadUnsigned(&at, end, &edges) || !_IsEnd(at, end))
+        {
+            return _ImportParser_Fail(p, "expected \"p <problem> vertices edges\"");
+        }
+        if (vertices > IMPORT_MAX_VERTICES) return _ImportParser_Fail(p, "too many vertices");
+        _ImportParser_Declare(p, el, vertices, edges);
+        p->HasHeader = true;
+        return true;
+    }
+    if (kind != 'a' && kind != 'e') return _ImportParser_Fail(p, "expected a c, p, a or e line");
+    
+    unsigned long long v1, v2, weight = INCIDENCE_MATRIX_POSITIVE_DIRECTION;
+    bool isWellFormed = at < end && _IsSpace(*at) && _ReadUnsigned(&at, end, &v1) && _ReadUnsigned(&at, end, &v2) &&
+                        (kind == 'e' || _IsEnd(at, end) || _ReadUnsigned(&at, end, &weight)) && _IsEnd(at, end);
+    if (!isWellFormed) return _ImportParser_Fail(p, kind == 'a' ? "expected \"a v1 v2 [weight]\"" : "expected \"e v1 v2\"");
+    if (v1 == 0 || v2 == 0) return _ImportParser_Fail(p, "vertices are numbered from 1");
+    return _ImportParser_AddEdge(p, el, v1 - 1, v2 - 1, weight);
+}
+
+static bool _ParseMatrixMarketBanner(_ImportParser *p, const char *at, const char *end)
+{
+    size_t length;
+    const char *word = _ReadWord(&at, end, &length);
+    if (!_IsWord(word, length, "%%MatrixMarket")) return _ImportParser_Fail(p, "expected a %%MatrixMarket banner");
+    
+    word = _ReadWord(&at, end, &length);
+    if (!_IsWord(word, length, "matrix")) return _ImportParser_Fail(p, "only matrices are supported");
+    
+    word = _ReadWord(&at, end, &length);
+    if (!_IsWord(word, length, "coordinate")) return _ImportParser_Fail(p, "only coordinate matrices are supported");
+    
+    word = _ReadWord(&at, end, &length);
+    p->IsPattern = _IsWord(word, length, "pattern");
+    if (!p->IsPattern && !_IsWord(word, length, "real") && !_IsWord(word, length, "integer"))
+    {
+        return _ImportParser_Fail(p, "only real, integer and pattern matrices are supported");
+    }
+    
+    // Symmetric matrices list each edge once, below the diagonal, which is how they are stored
+    word = _ReadWord(&at, end, &length);
+    if (!_IsWord(word, length, "general") && !_IsWord(word, length, "symmetric") && !_IsWord(word, length, "skew-symmetric") &&
+        !_IsWord(word, length, "hermitian"))
+    {
+        return _ImportParser_Fail(p, "expected general, symmetric, skew-symmetric or hermitian");
+    }
+    
+    p->HasBanner = true;
+    return true;
+}
+
+static bool _ParseMatrixMarketLine(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    if (!p->HasBanner) return _ParseMatrixMarketBanner(p, at, end);
+    
+    at = _SkipSpaces(at, end);
+    if (at == end || *at == '%') return true;
+    
+    if (!p->HasHeader)
+    {
+        unsigned long long rows, columns, entries;
+        if (!_ReadUnsigned(&at, end, &rows) || !_ReadUnsigned(&at, end, &columns) || !_ReadUnsigned(&at, end, &entries) ||
+            !_IsEnd(at, end))
+        {
+            return _ImportParser_Fail(p, "expected \"rows columns entries\"");
+        }
+        if (rows > IMPORT_MAX_VERTICES || columns > IMPORT_MAX_VERTICES) return _ImportParser_Fail(p, "too many vertices");
+        _ImportParser_Declare(p, el, rows > columns ? rows : columns, entries);
+        p->HasHeader = true;
+        return true;
+    }
+    
+    unsigned long long row, column;
+    double value = INCIDENCE_MATRIX_POSITIVE_DIRECTION;
+    bool isWellFormed = _ReadUnsigned(&at, end, &row) && _ReadUnsigned(&at, end, &column) &&
+                        (p->IsPattern || _ReadReal(&at, end, &value)) && _IsEnd(at, end);
+    if (!isWellFormed) return _ImportParser_Fail(p, p->IsPattern ? "expected \"row column\"" : "expected \"row column value\"");
+    if (row == 0 || column == 0) return _ImportParser_Fail(p, "rows and columns are numbered from 1");
+    
+    // Weights are positive integers, so values are rounded by magnitude
+    double magnitude = round(fabs(value));
+    unsigned long long weight = magnitude < 1 ? 1 : magnitude > INT_MAX ? ULLONG_MAX : (unsigned long long)magnitude;
+    return _ImportParser_AddEdge(p, el, row - 1, column - 1, weight);
+}
+
+static bool _ParseMetisLine(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    const char *start = _SkipSpaces(at, end);
+    if (start < end && *start == '%') return true;
+    
+    if (!p->HasHeader)
+    {
+        if (start == end) return true;
+        
+        unsigned long long vertices, edges, format = 0, constraints = 1;
+        bool isWellFormed = _ReadUnsigned(&at, end, &vertices) && _ReadUnsigned(&at, end, &edges) &&
+                            (_IsEnd(at, end) || _ReadUnsigned(&at, end, &format)) &&
+                            (_IsEnd(at, end) || _ReadUnsigned(&at, end, &constraints)) && _IsEnd(at, end) &&
+                            format <= 111 && format % 10 <= 1 && format / 10 % 10 <= 1 && constraints <= 64;
+        if (!isWellFormed) return _ImportParser_Fail(p, "expected \"vertices edges [format [constraints]]\"");
+        if (vertices > IMPORT_MAX_VERTICES) return _ImportParser_Fail(p, "too many vertices");
+        
+        // The format digits flag vertex sizes, vertex weights and edge weights, only edge weights are kept
+        p->HasEdgeWeights = format % 10 == 1;
+        p->SkippedValues = (format / 100 == 1) + (format / 10 % 10 == 1 ? (unsigned int)constraints : 0);
+        _ImportParser_Declare(p, el, vertices, edges);
+        p->HasHeader = true;
+        return true;
+    }
+    
+    // Every line is a vertex, even an empty one
+    if (p->NextVertex >= p->Vertices)
+    {
+        return start == end ? true : _ImportParser_Fail(p, "more vertex lines than vertices");
+    }
+    VertexIndex v = (VertexIndex)p->NextVertex++;
+    
+    unsigned long long skipped;
+    for (unsigned int i = 0; i < p->SkippedValues; i++)
+    {
+        if (!_ReadUnsigned(&at, end, &skipped)) return _ImportParser_Fail(p, "expected the size and weights of the vertex");
+    }
+    
+    while (!_IsEnd(at, end))
+    {
+        unsigned long long neighbor, weight = INCIDENCE_MATRIX_POSITIVE_DIRECTION;
+        if (!_ReadUnsigned(&at, end, &neighbor)) return _ImportParser_Fail(p, "expected \"neighbor [weight] ...\"");
+        if (p->HasEdgeWeights && !_ReadUnsigned(&at, end, &weight)) return _ImportParser_Fail(p, "expected a weight after the neighbor");
+        if (neighbor == 0 || neighbor > p->Vertices) return _ImportParser_Fail(p, "neighbors must be between 1 and the vertex count");
+        
+        // Each edge is listed by both of its vertices, and kept from the smaller
+        if (v <= neighbor - 1 && !_ImportParser_AddEdge(p, el, v, neighbor - 1, weight)) return false;
+    }
+    return true;
+}
+
+static bool _ImportParser_ParseLine(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    p->Line++;
+    switch (p->Format)
+    {
+        case IMPORT_EDGE_LIST: return _ParseEdgeListLine(p, at, end, el);
+        case IMPORT_DIMACS: return _ParseDimacsLine(p, at, end, el);
+        case IMPORT_MATRIX_MARKET: return _ParseMatrixMarketLine(p, at, end, el);
+        case IMPORT_METIS: return _ParseMetisLine(p, at, end, el);
+        default: assert(false); return false;
+    }
+}
+
+/// Parses every line of the range, the last one may end without a newline
+static bool _ImportParser_ParseLines(_ImportParser *p, const char *at, const char *end, EdgeList *el)
+{
+    while (at < end)
+    {
+        const char *newline = memchr(at, '\n', end - at);
+        const char *lineEnd = newline != NULL ? newline : end;
+        if (!_ImportParser_ParseLine(p, at, lineEnd, el)) return false;
+        at = lineEnd + 1;
+    }
+    return true;
+}
+
+/// Checks the parse did not stop before a header it needs
+static bool _ImportParser_Finish(_ImportParser *p)
+{
+    if (p->Format == IMPORT_MATRIX_MARKET && !p->HasBanner) return _ImportParser_Fail(p, "expected a %%MatrixMarket banner");
+    if (p->Format == IMPORT_MATRIX_MARKET && !p->HasHeader) return _ImportParser_Fail(p, "expected \"rows columns entries\"");
+    return true;
+}
+
+static EdgeList *_Fail(GraphLoadError *error, unsigned long long line, const char *message)
+{
+    if (error != NULL)
+    {
+        error->Line = line > UINT_MAX ? UINT_MAX : (unsigned int)line;
+        error->Message = message;
+    }
+    return NULL;
+}
+
+static EdgeList *_FailParse(const _ImportParser *p, EdgeList *el, GraphLoadError *error)
+{
+    EdgeList_FreeEdgeList(el);
+    return _Fail(error, p->Line, p->Error);
+}
+
+ImportFormat Import_FormatOfPath(const char *path)
+{
+    assert(path != NULL);
+    const char *extension = strrchr(path, '.');
+    if (extension == NULL || strchr(extension, '/') != NULL) return IMPORT_EDGE_LIST;
+    
+    extension++;
+    if (strcasecmp(extension, "gr") == 0 || strcasecmp(extension, "dimacs") == 0 || strcasecmp(extension, "col") == 0)
+    {
+        return IMPORT_DIMACS;
+    }
+    if (strcasecmp(extension, "mtx") == 0) return IMPORT_MATRIX_MARKET;
+    if (strcasecmp(extension, "graph") == 0 || strcasecmp(extension, "metis") == 0) return IMPORT_METIS;
+    return IMPORT_EDGE_LIST;
+}
+
+bool Import_ParseFormat(const char *name, ImportFormat *format)
+{
+    static const char *names[IMPORT_FORMAT_COUNT] = { "edgelist", "dimacs", "mtx", "metis" };
+    for (ImportFormat f = 0; f < IMPORT_FORMAT_COUNT; f++)
+    {
+        if (strcmp(name, names[f]) == 0)
+        {
+            *format = f;
+            return true;
+        }
+    }
+    return false;
+}
+
+EdgeList *Import_Read(FILE *file, ImportFormat format, GraphLoadError *error)
+{
+    PROFILE_ZONE("Import_Read");
+    assert(file != NULL);
+    assert(format < IMPORT_FORMAT_COUNT);
+    
+    _ImportParser parser = { .Format = format };
+    EdgeList *el = EdgeList_CreateEdgeList(0, 0);
+    
+    // Whole lines are parsed where they were read, and the partial line at the end is moved to the front before the next read
+    char *buffer = malloc(IMPORT_BUFFER_SIZE);
+    size_t filled = 0;
+    while (true)
+    {
+        size_t read = fread(buffer + filled, 1, IMPORT_BUFFER_SIZE - filled, file);
+        filled += read;
+        if (read == 0)
+        {
+            if (ferror(file))
+            {
+                free(buffer);
+                EdgeList_FreeEdgeList(el);
+                return _Fail(error, parser.Line, "could not read the file");
+            }
+            break;
+        }
+        
+        const char *lastNewline = buffer + filled;
+        while (lastNewline > buffer && lastNewline[-1] != '\n') lastNewline--;
+        if (lastNewline == buffer)
+        {
+            if (filled < IMPORT_BUFFER_SIZE) continue;
+            free(buffer);
+            EdgeList_FreeEdgeList(el);
+            return _Fail(error, parser.Line + 1, "line is longer than the read buffer");
+        }
+        
+        if (!_ImportParser_ParseLines(&parser, buffer, lastNewline, el))
+        {
+            free(buffer);
+            return _FailParse(&parser, el, error);
+        }
+        filled -= lastNewline - buffer;
+        memmove(buffer, lastNewline, filled);
+    }
+    
+    bool isParsed = _ImportParser_ParseLines(&parser, buffer, buffer + filled, el) && _ImportParser_Finish(&parser);
+    free(buffer);
+    if (!isParsed) return _FailParse(&parser, el, error);
+    
+    el->Vertices = (unsigned int)parser.Vertices;
+    return el;
+}
+
+/// A range of a mapped file, parsed on its own thread
+typedef struct
+{
+    _ImportParser Parser;
+    const char *Start;
+    const char *End;
+    EdgeList *Edges;
+    bool IsParsed;
+} _ImportPart;
+
+static void *_ImportPart_Parse(void *context)
+{
+    _ImportPart *part = context;
+    part->IsParsed = _ImportParser_ParseLines(&part->Parser, part->Start, part->End, part->Edges);
+    return NULL;
+}
+
+static unsigned long long _CountLines(const char *at, const char *end)
+{
+    unsigned long long lines = 0;
+    while ((at = memchr(at, '\n', end - at)) != NULL)
+    {
+        lines++;
+        at++;
+    }
+    return lines;
+}
+
+EdgeList *Import_ReadParallel(const char *path, ImportFormat format, unsigned int threads, GraphLoadError *error)
+{
+    PROFILE_ZONE("Import_ReadParallel");
+    assert(path != NULL);
+    assert(format < IMPORT_FORMAT_COUNT);
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return _Fail(error, 0, "could not open the file");
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return _Fail(error, 0, "could not read the file");
+    }
+    
+    size_t size = (size_t)info.st_size;
+    char *data = NULL;
+    if (size > 0)
+    {
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            return _Fail(error, 0, "could not map the file");
+        }
+        madvise(data, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+    const char *end = data + size;
+    
+    // Headers change how the lines after them are read, so they are parsed before the file is split
+    _ImportParser header = { .Format = format };
+    EdgeList *el = EdgeList_CreateEdgeList(0, 0);
+    const char *body = data;
+    if (format == IMPORT_MATRIX_MARKET)
+    {
+        while (body < end && !header.HasHeader)
+        {
+            const char *newline = memchr(body, '\n', end - body);
+            const char *lineEnd = newline != NULL ? newline : end;
+            if (!_ImportParser_ParseLine(&header, body, lineEnd, el)) break;
+            body = lineEnd < end ? lineEnd + 1 : end;
+        }
+        if (header.Error == NULL) _ImportParser_Finish(&header);
+        if (header.Error != NULL)
+        {
+            if (data != NULL) munmap(data, size);
+            return _FailParse(&header, el, error);
+        }
+    }
+    
+    // METIS numbers vertices by line, so its lines cannot be parsed out of order
+    if (threads == 0) threads = (unsigned int)WorkerPool_DefaultThreadCount() + 1;
+    size_t partCount = format == IMPORT_METIS ? 1 : threads;
+    size_t maxParts = (size_t)(end - body) / IMPORT_MIN_PART_SIZE + 1;
+    if (partCount > maxParts) partCount = maxParts;
+    
+    _ImportPart *parts = malloc(sizeof(_ImportPart) * partCount);
+    const char *start = body;
+    for (size_t i = 0; i < partCount; i++)
+    {
+        const char *partEnd = i + 1 == partCount ? end : body + (end - body) * (i + 1) / partCount;
+        if (partEnd < start) partEnd = start;
+        const char *newline = partEnd < end ? memchr(partEnd, '\n', end - partEnd) : NULL;
+        if (i + 1 < partCount) partEnd = newline != NULL ? newline + 1 : end;
+        
+        parts[i].Parser = header;
+        parts[i].Parser.Line = 0;
+        parts[i].Start = start;
+        parts[i].End = partEnd;
+        parts[i].Edges = i == 0 ? el : EdgeList_CreateEdgeList(0, (partEnd - start) / 16 + 1);
+        if (i == 0) EdgeList_Reserve(el, (partEnd - start) / 16 + 1);
+        start = partEnd;
+    }
+    
+    // The calling thread parses the first part while the others are parsed alongside it
+    pthread_t *workers = malloc(sizeof(pthread_t) * partCount);
+    for (size_t i = 1; i < partCount; i++)
+    {
+        pthread_create(&workers[i], NULL, _ImportPart_Parse, &parts[i]);
+    }
+    _ImportPart_Parse(&parts[0]);
+    for (size_t i = 1; i < partCount; i++)
+    {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+    
+    // The first part that failed is reported, with its line counted from the start of the file
+    size_t failed = partCount;
+    for (size_t i = 0; i < partCount && failed == partCount; i++)
+    {
+        if (!parts[i].IsParsed) failed = i;
+    }
+    
+    unsigned long long vertices = 0;
+    size_t edges = 0;
+    for (size_t i = 0; i < partCount; i++)
+    {
+        if (parts[i].Parser.Vertices > vertices) vertices = parts[i].Parser.Vertices;
+        edges += parts[i].Edges->Count;
+    }
+    
+    if (failed == partCount)
+    {
+        EdgeList_Reserve(el, edges);
+        for (size_t i = 1; i < partCount; i++)
+        {
+            EdgeList *part = parts[i].Edges;
+            memcpy(el->Sources + el->Count, part->Sources, part->Count * sizeof(VertexIndex));
+            memcpy(el->Targets + el->Count, part->Targets, part->Count * sizeof(VertexIndex));
+            memcpy(el->Weights + el->Count, part->Weights, part->Count * sizeof(unsigned int));
+            el->Count += part->Count;
+        }
+        el->Vertices = (unsigned int)vertices;
+    }
+    else
+    {
+        parts[failed].Parser.Line += _CountLines(data, parts[failed].Start);
+    }
+    
+    for (size_t i = 1; i < partCount; i++)
+    {
+        EdgeList_FreeEdgeList(parts[i].Edges);
+    }
+    if (data != NULL) munmap(data, size);
+    
+    if (failed < partCount)
+    {
+        _ImportParser p = parts[failed].Parser;
+        free(parts);
+        return _FailParse(&p, el, error);
+    }
+    free(parts);
+    return el;
+}
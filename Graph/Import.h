@@ -0,0 +1,55 @@
+//
+//  Import.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Import_h
+#define Import_h
+
+#include <stdio.h>
+#include "EdgeList.h"
+
+/// Bytes read from a file at a time. Lines must fit in it.
+#define IMPORT_BUFFER_SIZE (1 << 20)
+
+typedef enum
+{
+    /// One "v1 v2 [weight]" line per edge, vertices numbered from 0. Lines starting with # or % are skipped.
+    IMPORT_EDGE_LIST,
+    
+    /// DIMACS, a "p <problem> n m" line, then "a v1 v2 [weight]" arcs or "e v1 v2" edges numbered from 1. Lines starting with c are skipped.
+    IMPORT_DIMACS,
+    
+    /// Matrix Market coordinate matrices, every "row column [value]" entry is an edge. Values are rounded to weights of at least 1,
+    /// symmetric matrices store every edge once.
+    IMPORT_MATRIX_MARKET,
+    
+    /// METIS, an "n m [format [constraints]]" header, then the neighbors of each vertex, one line per vertex numbered from 1.
+    /// Every edge is listed by both of its vertices and kept once.
+    IMPORT_METIS,
+    
+    IMPORT_FORMAT_COUNT,
+} ImportFormat;
+
+/// - Returns: The format the extension of the path implies, .gr .dimacs .col for DIMACS, .mtx for Matrix Market, .graph .metis for METIS,
+/// and edge lists otherwise
+ImportFormat Import_FormatOfPath(const char *path);
+
+/// Parses edgelist, dimacs, mtx or metis
+/// - Returns: false if the name is not a format
+bool Import_ParseFormat(const char *name, ImportFormat *format);
+
+/// Streams a file through a buffer of IMPORT_BUFFER_SIZE, tokenizing lines in place
+/// - Returns: The edges, or NULL if the file is malformed, with the reason in error
+EdgeList *Import_Read(FILE *file, ImportFormat format, GraphLoadError *error);
+
+/// Maps the file and splits it at line boundaries, parsing each part on its own thread. METIS numbers vertices by line,
+/// so it is parsed on one thread.
+/// - Parameters:
+///   - threads: the parts to split the file into, 0 for WorkerPool_DefaultThreadCount() + 1
+/// - Returns: The edges in the order of the file, or NULL if the file cannot be mapped or is malformed, with the reason in error
+EdgeList *Import_ReadParallel(const char *path, ImportFormat format, unsigned int threads, GraphLoadError *error);
+
+#endif /* Import_h */
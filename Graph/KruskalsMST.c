@@ -11,6 +11,8 @@
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
+#include "Util/Profiler.h"
+#include "Util/Counters.h"
 
 typedef struct {
     int parent;
@@ -66,7 +68,9 @@ int _CompareEdgeInformation(const void *a, const void *b)
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 void Graph_MinSpanningTree(Graph *g, EdgeIndex edges[GRAPH_MAX_SIZE]) 
 {
+    PROFILE_ZONE("Graph_MinSpanningTree");
     assert(g != NULL);
+    Counters_Add(COUNTER_MST_COMPUTATIONS, 1);
     
     // Initialize Union Find sets
     UnionFind sets[g->Vertices];
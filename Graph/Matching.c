@@ -0,0 +1,729 @@
+//
+//  Matching.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Matching.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "Util/Profiler.h"
+
+/// The end of a path, and the distance of a vertex a search has not reached
+#define MATCHING_NONE UINT32_MAX
+
+/// The edges of every vertex either way, without self loops
+typedef struct
+{
+    unsigned int Vertices;
+
+    /// Vertices + 1 entries
+    uint64_t *Offsets;
+
+    VertexIndex *Targets;
+    unsigned int *Weights;
+
+    /// The index in the edge list of each entry
+    uint32_t *Edges;
+} _Adjacency;
+
+static _Adjacency _Matching_Adjacency(const Csr *csr)
+{
+    const unsigned int n = csr->Vertices;
+    _Adjacency a = { .Vertices = n, .Offsets = calloc((size_t) n + 1, sizeof(uint64_t)) };
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            if (csr->Targets[i] == u) continue;
+            a.Offsets[u + 1]++;
+            a.Offsets[csr->Targets[i] + 1]++;
+        }
+    }
+    for (VertexIndex v = 0; v < n; v++) a.Offsets[v + 1] += a.Offsets[v];
+
+    const uint64_t count = a.Offsets[n];
+    a.Targets = malloc(count * sizeof(VertexIndex));
+    a.Weights = malloc(count * sizeof(unsigned int));
+    a.Edges = malloc(count * sizeof(uint32_t));
+    uint64_t *next = malloc(n * sizeof(uint64_t));
+    for (VertexIndex v = 0; v < n; v++) next[v] = a.Offsets[v];
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            const VertexIndex v = csr->Targets[i];
+            if (v == u) continue;
+            const uint64_t forward = next[u]++, backward = next[v]++;
+            a.Targets[forward] = v;
+            a.Targets[backward] = u;
+            a.Weights[forward] = a.Weights[backward] = csr->Weights[i];
+            a.Edges[forward] = a.Edges[backward] = csr->Edges[i];
+        }
+    }
+    free(next);
+    return a;
+}
+
+static void _Matching_FreeAdjacency(_Adjacency *a)
+{
+    free(a->Offsets);
+    free(a->Targets);
+    free(a->Weights);
+    free(a->Edges);
+}
+
+static bool _Matching_Bipartition(const _Adjacency *a, uint8_t *sides)
+{
+    const unsigned int n = a->Vertices;
+    VertexIndex *queue = malloc(n * sizeof(VertexIndex));
+    bool isBipartite = true;
+    for (VertexIndex v = 0; v < n; v++) sides[v] = 2;
+    for (VertexIndex root = 0; root < n && isBipartite; root++)
+    {
+        if (sides[root] != 2) continue;
+        sides[root] = 0;
+        size_t head = 0, tail = 0;
+        queue[tail++] = root;
+        while (head < tail && isBipartite)
+        {
+            const VertexIndex v = queue[head++];
+            for (uint64_t i = a->Offsets[v]; i < a->Offsets[v + 1]; i++)
+            {
+                const VertexIndex w = a->Targets[i];
+                if (sides[w] == sides[v]) isBipartite = false;
+                if (sides[w] != 2) continue;
+                sides[w] = !sides[v];
+                queue[tail++] = w;
+            }
+        }
+    }
+    free(queue);
+    return isBipartite;
+}
+
+/// Matches each unmatched vertex, of side 0 if there are sides, to its unmatched neighbor of the least degree, so the searches
+/// only have the vertices this leaves to find paths from. Hubs are left for the vertices with no other neighbor.
+/// - Returns: The edges matched
+static unsigned int _Matching_Greedy(const _Adjacency *a, const uint8_t *sides, uint32_t *mates, uint32_t *edges)
+{
+    unsigned int count = 0;
+    for (VertexIndex u = 0; u < a->Vertices; u++)
+    {
+        if ((sides != NULL && sides[u] != 0) || mates[u] != MATCHING_UNMATCHED) continue;
+        uint64_t best = UINT64_MAX, bestDegree = UINT64_MAX;
+        for (uint64_t i = a->Offsets[u]; i < a->Offsets[u + 1]; i++)
+        {
+            const VertexIndex v = a->Targets[i];
+            const uint64_t degree = a->Offsets[v + 1] - a->Offsets[v];
+            if (mates[v] != MATCHING_UNMATCHED || degree >= bestDegree) continue;
+            best = i;
+            bestDegree = degree;
+        }
+        if (best == UINT64_MAX) continue;
+        const VertexIndex v = a->Targets[best];
+        mates[u] = v;
+        mates[v] = u;
+        edges[u] = edges[v] = a->Edges[best];
+        count++;
+    }
+    return count;
+}
+
+bool Matching_Bipartition(const Csr *csr, uint8_t *sides)
+{
+    PROFILE_ZONE("Matching_Bipartition");
+    assert(csr != NULL && sides != NULL);
+
+    _Adjacency a = _Matching_Adjacency(csr);
+    bool isBipartite = _Matching_Bipartition(&a, sides);
+    _Matching_FreeAdjacency(&a);
+    return isBipartite;
+}
+
+/// Matches each vertex of side 0 on the path to the vertex of side 1 its current entry leads to
+static inline void _Matching_Flip(const _Adjacency *a, const VertexIndex *path, size_t depth, const uint64_t *current,
+                                  uint32_t *mates, uint32_t *edges)
+{
+    for (size_t i = 0; i < depth; i++)
+    {
+        const uint64_t entry = current[path[i]];
+        mates[path[i]] = a->Targets[entry];
+        mates[a->Targets[entry]] = path[i];
+        edges[path[i]] = edges[a->Targets[entry]] = a->Edges[entry];
+    }
+}
+
+static unsigned int _Matching_HopcroftKarp(const _Adjacency *a, const uint8_t *sides, uint32_t *mates, uint32_t *edges)
+{
+    const unsigned int n = a->Vertices;
+    for (VertexIndex v = 0; v < n; v++) mates[v] = edges[v] = MATCHING_UNMATCHED;
+    unsigned int count = _Matching_Greedy(a, sides, mates, edges);
+
+    // The layer of each vertex of side 0, the next entry of its row to try, and the vertices of side 0 on the path
+    uint32_t *layers = malloc(n * sizeof(uint32_t));
+    uint64_t *current = malloc(n * sizeof(uint64_t));
+    VertexIndex *queue = malloc(n * sizeof(VertexIndex));
+    VertexIndex *path = queue;
+    while (true)
+    {
+        // Layers from every unmatched vertex of side 0 up to the first layer with an edge to an unmatched vertex of side 1
+        size_t head = 0, tail = 0;
+        for (VertexIndex u = 0; u < n; u++)
+        {
+            layers[u] = MATCHING_NONE;
+            if (sides[u] != 0 || mates[u] != MATCHING_UNMATCHED) continue;
+            layers[u] = 0;
+            queue[tail++] = u;
+        }
+        uint32_t shortest = MATCHING_NONE;
+        while (head < tail)
+        {
+            const VertexIndex u = queue[head++];
+            if (layers[u] >= shortest) break;
+            for (uint64_t i = a->Offsets[u]; i < a->Offsets[u + 1]; i++)
+            {
+                const VertexIndex w = mates[a->Targets[i]];
+                if (w == MATCHING_UNMATCHED) shortest = layers[u] + 1;
+                else if (layers[w] == MATCHING_NONE)
+                {
+                    layers[w] = layers[u] + 1;
+                    queue[tail++] = w;
+                }
+            }
+        }
+        if (shortest == MATCHING_NONE) break;
+
+        // Each augmenting path leads one layer further at every step, the vertices it dead ends at are left out of the layers
+        for (VertexIndex u = 0; u < n; u++) current[u] = a->Offsets[u];
+        for (VertexIndex root = 0; root < n; root++)
+        {
+            if (layers[root] != 0 || mates[root] != MATCHING_UNMATCHED) continue;
+            size_t depth = 0;
+            path[depth++] = root;
+            while (depth > 0)
+            {
+                const VertexIndex u = path[depth - 1];
+                if (current[u] == a->Offsets[u + 1])
+                {
+                    layers[u] = MATCHING_NONE;
+                    if (--depth > 0) current[path[depth - 1]]++;
+                    continue;
+                }
+
+                const VertexIndex w = mates[a->Targets[current[u]]];
+                if (w == MATCHING_UNMATCHED && layers[u] + 1 == shortest)
+                {
+                    // The vertices of the path leave the layers, keeping the paths of the phase vertex disjoint
+                    for (size_t i = 0; i < depth; i++) layers[path[i]] = MATCHING_NONE;
+                    _Matching_Flip(a, path, depth, current, mates, edges);
+                    count++;
+                    break;
+                }
+                if (w != MATCHING_UNMATCHED && layers[w] == layers[u] + 1) path[depth++] = w;
+                else current[u]++;
+            }
+        }
+    }
+
+    free(layers);
+    free(current);
+    free(queue);
+    return count;
+}
+
+unsigned int Matching_HopcroftKarp(const Csr *csr, const uint8_t *sides, uint32_t *mates, uint32_t *edges)
+{
+    PROFILE_ZONE("Matching_HopcroftKarp");
+    assert(csr != NULL && sides != NULL && mates != NULL && edges != NULL);
+
+    _Adjacency a = _Matching_Adjacency(csr);
+    unsigned int count = _Matching_HopcroftKarp(&a, sides, mates, edges);
+    _Matching_FreeAdjacency(&a);
+    return count;
+}
+
+/// The state of a phase of Edmonds' algorithm, a forest of alternating trees grown from every unmatched vertex
+typedef struct
+{
+    const _Adjacency *Adjacency;
+    uint32_t *Mates;
+    uint32_t *Edges;
+
+    /// The vertex before each odd vertex of the forest on its alternating path to the root, and the edge between them.
+    /// Shrinking a blossom sets them on its even vertices too, leading around the cycle the way that ends matched.
+    uint32_t *Parents;
+    uint32_t *ParentEdges;
+
+    /// A disjoint set forest of the blossoms, whose roots are the bases they are shrunk into, and the roots a blossom being
+    /// shrunk takes in, linked once both paths around it are walked
+    uint32_t *Bases;
+    VertexIndex *Shrunk;
+    size_t ShrunkCount;
+
+    /// The root of the tree each vertex of the forest is in
+    uint32_t *Trees;
+
+    /// The phase each vertex was last even in, the walk it was last passed by, and the phase each root last augmented in
+    uint32_t *Even;
+    uint32_t *Walks;
+    uint32_t *Augmented;
+    uint32_t Phase;
+    uint32_t Walk;
+
+    VertexIndex *Queue;
+    size_t Tail;
+
+    /// The vertices whose parent or base the phase may have set, to be reset after it
+    VertexIndex *Touched;
+    size_t TouchedCount;
+} _Blossom;
+
+static inline void _Blossom_AddEven(_Blossom *b, VertexIndex v, VertexIndex root)
+{
+    b->Even[v] = b->Phase;
+    b->Trees[v] = root;
+    b->Touched[b->TouchedCount++] = v;
+    b->Queue[b->Tail++] = v;
+}
+
+/// - Returns: The base of the outermost blossom the vertex is shrunk into, itself if none
+static inline VertexIndex _Blossom_Base(_Blossom *b, VertexIndex v)
+{
+    while (b->Bases[v] != v)
+    {
+        b->Bases[v] = b->Bases[b->Bases[v]];
+        v = b->Bases[v];
+    }
+    return v;
+}
+
+/// - Returns: The base of the first blossom the alternating paths of two even vertices of a tree to its root share
+static VertexIndex _Blossom_CommonBase(_Blossom *b, VertexIndex u, VertexIndex v)
+{
+    b->Walk++;
+    while (true)
+    {
+        u = _Blossom_Base(b, u);
+        b->Walks[u] = b->Walk;
+        if (b->Mates[u] == MATCHING_UNMATCHED) break;
+        u = b->Parents[b->Mates[u]];
+    }
+    while (true)
+    {
+        v = _Blossom_Base(b, v);
+        if (b->Walks[v] == b->Walk) return v;
+        v = b->Parents[b->Mates[v]];
+    }
+}
+
+/// Walks the path from the even vertex down to the base, pointing the parents of its even vertices back the other way
+/// around the cycle, starting with the edge closing it, and gathering the blossoms on it. The odd vertices of the path turn
+/// even.
+static void _Blossom_ShrinkPath(_Blossom *b, VertexIndex v, VertexIndex base, VertexIndex child, uint32_t childEdge)
+{
+    while (_Blossom_Base(b, v) != base)
+    {
+        const VertexIndex mate = b->Mates[v];
+        if (b->Even[mate] != b->Phase) _Blossom_AddEven(b, mate, b->Trees[v]);
+        b->Shrunk[b->ShrunkCount++] = _Blossom_Base(b, v);
+        b->Shrunk[b->ShrunkCount++] = _Blossom_Base(b, mate);
+        b->Parents[v] = child;
+        b->ParentEdges[v] = childEdge;
+        child = mate;
+        childEdge = b->ParentEdges[mate];
+        v = b->Parents[mate];
+    }
+}
+
+/// Matches the even vertex to another by the edge, flipping the alternating path from it to the root of its tree
+static void _Blossom_Augment(_Blossom *b, VertexIndex v, VertexIndex w, uint32_t e)
+{
+    while (true)
+    {
+        const VertexIndex mate = b->Mates[v];
+        b->Mates[v] = w;
+        b->Edges[v] = e;
+        if (mate == MATCHING_UNMATCHED) return;
+        w = mate;
+        v = b->Parents[mate];
+        e = b->ParentEdges[mate];
+        b->Mates[w] = v;
+        b->Edges[w] = e;
+    }
+}
+
+/// Grows the forest breadth first until no even vertex is left to scan. An edge between even vertices of two trees is an
+/// augmenting path, after which both trees are left alone for the rest of the phase.
+/// - Returns: The augmenting paths the phase found, each adding an edge to the matching
+static unsigned int _Blossom_Phase(_Blossom *b)
+{
+    const _Adjacency *a = b->Adjacency;
+    b->Phase++;
+    b->Tail = 0;
+    b->TouchedCount = 0;
+    for (VertexIndex v = 0; v < a->Vertices; v++)
+    {
+        if (b->Mates[v] == MATCHING_UNMATCHED) _Blossom_AddEven(b, v, v);
+    }
+
+    unsigned int count = 0;
+    size_t head = 0;
+    while (head < b->Tail)
+    {
+        const VertexIndex v = b->Queue[head++];
+        for (uint64_t i = a->Offsets[v]; i < a->Offsets[v + 1] && b->Augmented[b->Trees[v]] != b->Phase; i++)
+        {
+            const VertexIndex w = a->Targets[i];
+            if (b->Mates[v] == w) continue;
+            if (b->Even[w] == b->Phase)
+            {
+                if (b->Augmented[b->Trees[w]] == b->Phase) continue;
+                if (b->Trees[v] != b->Trees[w])
+                {
+                    b->Augmented[b->Trees[v]] = b->Augmented[b->Trees[w]] = b->Phase;
+                    _Blossom_Augment(b, v, w, a->Edges[i]);
+                    _Blossom_Augment(b, w, v, a->Edges[i]);
+                    count++;
+                    continue;
+                }
+
+                // An edge between two even vertices of a tree closes an odd cycle, shrunk into the base where their paths
+                // meet
+                if (_Blossom_Base(b, v) == _Blossom_Base(b, w)) continue;
+                const VertexIndex base = _Blossom_CommonBase(b, v, w);
+                b->ShrunkCount = 0;
+                _Blossom_ShrinkPath(b, v, base, w, a->Edges[i]);
+                _Blossom_ShrinkPath(b, w, base, v, a->Edges[i]);
+                for (size_t s = 0; s < b->ShrunkCount; s++) b->Bases[b->Shrunk[s]] = base;
+            }
+            else if (b->Parents[w] == MATCHING_NONE)
+            {
+                // Every unmatched vertex is a root, so the vertex is matched and turns odd
+                b->Parents[w] = v;
+                b->ParentEdges[w] = a->Edges[i];
+                b->Trees[w] = b->Trees[v];
+                b->Touched[b->TouchedCount++] = w;
+                _Blossom_AddEven(b, b->Mates[w], b->Trees[v]);
+            }
+        }
+    }
+
+    for (size_t t = 0; t < b->TouchedCount; t++)
+    {
+        b->Parents[b->Touched[t]] = MATCHING_NONE;
+        b->Bases[b->Touched[t]] = b->Touched[t];
+    }
+    return count;
+}
+
+unsigned int Matching_Blossom(const Csr *csr, uint32_t *mates, uint32_t *edges)
+{
+    PROFILE_ZONE("Matching_Blossom");
+    assert(csr != NULL && mates != NULL && edges != NULL);
+
+    _Adjacency a = _Matching_Adjacency(csr);
+    const unsigned int n = a.Vertices;
+    for (VertexIndex v = 0; v < n; v++) mates[v] = edges[v] = MATCHING_UNMATCHED;
+    unsigned int count = _Matching_Greedy(&a, NULL, mates, edges);
+
+    // A vertex of a phase is touched once when it turns odd and once when it turns even
+    _Blossom b =
+    {
+        .Adjacency = &a,
+        .Mates = mates,
+        .Edges = edges,
+        .Parents = malloc(n * sizeof(uint32_t)),
+        .ParentEdges = malloc(n * sizeof(uint32_t)),
+        .Bases = malloc(n * sizeof(uint32_t)),
+        .Shrunk = malloc(2 * (size_t) n * sizeof(VertexIndex)),
+        .Trees = malloc(n * sizeof(uint32_t)),
+        .Even = calloc(n, sizeof(uint32_t)),
+        .Walks = calloc(n, sizeof(uint32_t)),
+        .Augmented = calloc(n, sizeof(uint32_t)),
+        .Queue = malloc(n * sizeof(VertexIndex)),
+        .Touched = malloc(2 * (size_t) n * sizeof(VertexIndex)),
+    };
+    for (VertexIndex v = 0; v < n; v++)
+    {
+        b.Parents[v] = MATCHING_NONE;
+        b.Bases[v] = v;
+    }
+
+    // A phase that finds no augmenting path leaves every tree with none, so the matching is maximum
+    while (true)
+    {
+        const unsigned int found = _Blossom_Phase(&b);
+        if (found == 0) break;
+        count += found;
+    }
+
+    free(b.Parents);
+    free(b.ParentEdges);
+    free(b.Bases);
+    free(b.Shrunk);
+    free(b.Trees);
+    free(b.Even);
+    free(b.Walks);
+    free(b.Augmented);
+    free(b.Queue);
+    free(b.Touched);
+    _Matching_FreeAdjacency(&a);
+    return count;
+}
+
+/// An indexed binary heap of vertices by distance
+typedef struct
+{
+    const int64_t *Keys;
+    VertexIndex *Entries;
+
+    /// The index in Entries of each vertex, MATCHING_NONE when it is not in the heap
+    uint32_t *Positions;
+    size_t Count;
+} _Heap;
+
+static inline void _Heap_Up(_Heap *h, size_t i)
+{
+    const VertexIndex v = h->Entries[i];
+    while (i > 0 && h->Keys[h->Entries[(i - 1) / 2]] > h->Keys[v])
+    {
+        h->Entries[i] = h->Entries[(i - 1) / 2];
+        h->Positions[h->Entries[i]] = (uint32_t) i;
+        i = (i - 1) / 2;
+    }
+    h->Entries[i] = v;
+    h->Positions[v] = (uint32_t) i;
+}
+
+/// Adds the vertex, or moves it up once its key has dropped
+static inline void _Heap_Push(_Heap *h, VertexIndex v)
+{
+    if (h->Positions[v] == MATCHING_NONE)
+    {
+        h->Entries[h->Count] = v;
+        h->Positions[v] = (uint32_t) h->Count++;
+    }
+    _Heap_Up(h, h->Positions[v]);
+}
+
+static inline VertexIndex _Heap_Pop(_Heap *h)
+{
+    const VertexIndex top = h->Entries[0];
+    h->Positions[top] = MATCHING_NONE;
+    const VertexIndex v = h->Entries[--h->Count];
+    size_t i = 0;
+    while (h->Count > 0)
+    {
+        size_t child = 2 * i + 1;
+        if (child >= h->Count) break;
+        if (child + 1 < h->Count && h->Keys[h->Entries[child + 1]] < h->Keys[h->Entries[child]]) child++;
+        if (h->Keys[h->Entries[child]] >= h->Keys[v]) break;
+        h->Entries[i] = h->Entries[child];
+        h->Positions[h->Entries[i]] = (uint32_t) i;
+        i = child;
+    }
+    if (h->Count > 0)
+    {
+        h->Entries[i] = v;
+        h->Positions[v] = (uint32_t) i;
+    }
+    return top;
+}
+
+static unsigned int _Matching_Assignment(const _Adjacency *a, const uint8_t *sides, uint32_t *mates, uint32_t *edges,
+                                         uint64_t *weight)
+{
+    const unsigned int n = a->Vertices;
+    for (VertexIndex v = 0; v < n; v++) mates[v] = edges[v] = MATCHING_UNMATCHED;
+
+    // Potentials keep the cost of every edge that can be taken non negative. The search that last reached each vertex and
+    // its distance then, and for side 1 the weight of its matched edge.
+    int64_t *potentials = calloc(n, sizeof(int64_t));
+    int64_t *distances = malloc(n * sizeof(int64_t));
+    uint32_t *reached = calloc(n, sizeof(uint32_t));
+    unsigned int *matchedWeights = malloc(n * sizeof(unsigned int));
+    VertexIndex *settled = malloc(n * sizeof(VertexIndex));
+    VertexIndex *unmatched = malloc(n * sizeof(VertexIndex));
+
+    // The search each vertex of side 1 was last passed by a path of cost 0, the next entry of each row to try, and the
+    // vertices of side 0 on the path
+    uint32_t *visited = calloc(n, sizeof(uint32_t));
+    uint64_t *current = malloc(n * sizeof(uint64_t));
+    VertexIndex *path = malloc(n * sizeof(VertexIndex));
+    _Heap heap = { .Keys = distances, .Entries = malloc(n * sizeof(VertexIndex)), .Positions = malloc(n * sizeof(uint32_t)) };
+    for (VertexIndex v = 0; v < n; v++) heap.Positions[v] = MATCHING_NONE;
+
+    // The vertices of side 0 left to match, dropped once matched
+    size_t unmatchedCount = 0;
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        if (sides[u] == 0 && a->Offsets[u + 1] > a->Offsets[u]) unmatched[unmatchedCount++] = u;
+    }
+
+    unsigned int count = 0;
+    uint64_t total = 0;
+    for (uint32_t search = 1; unmatchedCount > 0; search++)
+    {
+        for (size_t i = 0; i < unmatchedCount; i++)
+        {
+            reached[unmatched[i]] = search;
+            distances[unmatched[i]] = 0;
+            _Heap_Push(&heap, unmatched[i]);
+        }
+
+        // Settles vertices until the first unmatched vertex of side 1, the end of the cheapest augmenting path
+        VertexIndex end = MATCHING_NONE;
+        size_t settledCount = 0;
+        while (heap.Count > 0)
+        {
+            const VertexIndex v = _Heap_Pop(&heap);
+            settled[settledCount++] = v;
+            const VertexIndex mate = mates[v];
+            if (sides[v] == 1 && mate == MATCHING_UNMATCHED)
+            {
+                end = v;
+                break;
+            }
+
+            // From side 1 the only way on is back along the matched edge, whose cost the potentials keep at 0
+            if (sides[v] == 1)
+            {
+                reached[mate] = search;
+                distances[mate] = distances[v] + potentials[v] - potentials[mate] - matchedWeights[v];
+                _Heap_Push(&heap, mate);
+                continue;
+            }
+            for (uint64_t i = a->Offsets[v]; i < a->Offsets[v + 1]; i++)
+            {
+                const VertexIndex w = a->Targets[i];
+                const int64_t distance = distances[v] + a->Weights[i] + potentials[v] - potentials[w];
+                if (w == mate || (reached[w] == search && distance >= distances[w])) continue;
+                reached[w] = search;
+                distances[w] = distance;
+                _Heap_Push(&heap, w);
+            }
+        }
+        while (heap.Count > 0) _Heap_Pop(&heap);
+        if (end == MATCHING_NONE) break;
+
+        // Every settled vertex is lowered by how much nearer it is than the end, leaving the costs non negative
+        const int64_t distance = distances[end];
+        for (size_t i = 0; i < settledCount; i++) potentials[settled[i]] += distances[settled[i]] - distance;
+
+        // Every augmenting path of cost 0 now is as cheap as the one found, so as many vertex disjoint ones as a depth first
+        // search over the edges of cost 0 finds are flipped, and the potentials stay valid on their edges, now reversed
+        for (size_t r = 0; r < unmatchedCount; r++)
+        {
+            if (mates[unmatched[r]] != MATCHING_UNMATCHED) continue;
+            size_t depth = 0;
+            path[depth++] = unmatched[r];
+            current[unmatched[r]] = a->Offsets[unmatched[r]];
+            while (depth > 0)
+            {
+                const VertexIndex u = path[depth - 1];
+                if (current[u] == a->Offsets[u + 1])
+                {
+                    if (--depth > 0) current[path[depth - 1]]++;
+                    continue;
+                }
+                const uint64_t i = current[u];
+                const VertexIndex w = a->Targets[i];
+                if (w == mates[u] || visited[w] == search || a->Weights[i] + potentials[u] - potentials[w] != 0)
+                {
+                    current[u]++;
+                    continue;
+                }
+                visited[w] = search;
+                if (mates[w] != MATCHING_UNMATCHED)
+                {
+                    path[depth++] = mates[w];
+                    current[mates[w]] = a->Offsets[mates[w]];
+                    continue;
+                }
+
+                // Each vertex of side 0 on the path takes the vertex of side 1 it leads to from the next
+                for (size_t k = 0; k < depth; k++)
+                {
+                    const uint64_t entry = current[path[k]];
+                    const VertexIndex next = a->Targets[entry];
+                    if (mates[next] != MATCHING_UNMATCHED) total -= matchedWeights[next];
+                    mates[path[k]] = next;
+                    mates[next] = path[k];
+                    edges[path[k]] = edges[next] = a->Edges[entry];
+                    matchedWeights[next] = a->Weights[entry];
+                    total += matchedWeights[next];
+                }
+                count++;
+                break;
+            }
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < unmatchedCount; i++)
+        {
+            if (mates[unmatched[i]] == MATCHING_UNMATCHED) unmatched[kept++] = unmatched[i];
+        }
+        unmatchedCount = kept;
+    }
+
+    free(potentials);
+    free(distances);
+    free(reached);
+    free(matchedWeights);
+    free(settled);
+    free(unmatched);
+    free(visited);
+    free(current);
+    free(path);
+    free(heap.Entries);
+    free(heap.Positions);
+    if (weight != NULL) *weight = total;
+    return count;
+}
+
+unsigned int Matching_Assignment(const Csr *csr, const uint8_t *sides, uint32_t *mates, uint32_t *edges, uint64_t *weight)
+{
+    PROFILE_ZONE("Matching_Assignment");
+    assert(csr != NULL && sides != NULL && mates != NULL && edges != NULL);
+
+    _Adjacency a = _Matching_Adjacency(csr);
+    unsigned int count = _Matching_Assignment(&a, sides, mates, edges, weight);
+    _Matching_FreeAdjacency(&a);
+    return count;
+}
+
+unsigned int Graph_MaximumMatching(const Graph *g, EdgeIndex matching[GRAPH_MAX_SIZE + 1], bool *isBipartite,
+                                   unsigned long long *weight)
+{
+    PROFILE_ZONE("Graph_MaximumMatching");
+    assert(g != NULL && matching != NULL);
+
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _Adjacency a = _Matching_Adjacency(csr);
+    uint8_t sides[GRAPH_MAX_SIZE];
+    uint32_t mates[GRAPH_MAX_SIZE], edges[GRAPH_MAX_SIZE];
+    bool isTwoSided = _Matching_Bipartition(&a, sides);
+    uint64_t total = 0;
+    if (isTwoSided) _Matching_Assignment(&a, sides, mates, edges, &total);
+    _Matching_FreeAdjacency(&a);
+    if (!isTwoSided) Matching_Blossom(csr, mates, edges);
+
+    // Each edge is listed once, from the lower of its two ends
+    unsigned int count = 0;
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        if (mates[v] == MATCHING_UNMATCHED || mates[v] < v) continue;
+        matching[count++] = edges[v];
+        if (!isTwoSided) total += el->Weights[edges[v]];
+    }
+    matching[count] = MST_NO_EDGE;
+
+    if (isBipartite != NULL) *isBipartite = isTwoSided;
+    if (weight != NULL) *weight = total;
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    return count;
+}
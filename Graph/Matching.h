@@ -0,0 +1,68 @@
+//
+//  Matching.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Matching_h
+#define Matching_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Csr.h"
+
+/// The mate and edge of a vertex no edge of the matching touches
+#define MATCHING_UNMATCHED UINT32_MAX
+
+/// Two colors the vertices by a breadth first search from each uncolored vertex, ignoring the direction of each edge and
+/// self loops, in O(V + E)
+/// - Parameters:
+///   - sides: Vertices entries, set to 0 or 1 so every edge joins the two sides
+/// - Returns: false if an odd cycle leaves the graph with no two sides, leaving sides partly set
+bool Matching_Bipartition(const Csr *csr, uint8_t *sides);
+
+/// Hopcroft and Karp's maximum matching of a bipartite graph in O(E sqrt(V)). Each phase finds the shortest augmenting paths
+/// from every unmatched vertex of side 0 by one breadth first search, then augments along as many vertex disjoint ones as a
+/// depth first search over the layers finds, on an explicit stack.
+/// - Parameters:
+///   - sides: from Matching_Bipartition
+///   - mates: Vertices entries, set to the vertex each is matched to, or MATCHING_UNMATCHED
+///   - edges: Vertices entries, set to the index in the edge list of the edge each is matched by, or MATCHING_UNMATCHED
+/// - Returns: The edges of the matching
+unsigned int Matching_HopcroftKarp(const Csr *csr, const uint8_t *sides, uint32_t *mates, uint32_t *edges);
+
+/// Edmonds' maximum matching of any graph, ignoring the direction of each edge and self loops. Each phase grows a forest of
+/// alternating trees breadth first from every unmatched vertex. An edge between even vertices of two trees is an augmenting
+/// path, after which both trees are left alone until the next phase, and an edge closing an odd cycle within a tree shrinks
+/// it into its base, found in a disjoint set forest, so the search goes on as if the cycle were one vertex. Phases run until
+/// one finds no path, each in O(E) but for the sets, in O(V E) at worst but usually in a handful.
+/// - Parameters:
+///   - mates: see Matching_HopcroftKarp
+///   - edges: see Matching_HopcroftKarp
+/// - Returns: The edges of the matching
+unsigned int Matching_Blossom(const Csr *csr, uint32_t *mates, uint32_t *edges);
+
+/// The maximum matching of a bipartite graph of the least total weight, the assignment problem with edges missing, by
+/// successive shortest augmenting paths. Dijkstra's algorithm over costs made non negative by a potential on each vertex
+/// finds the cheapest path from any unmatched vertex of side 0, stopping at the first unmatched vertex of side 1, in
+/// O(V E log(V)) at worst.
+/// - Parameters:
+///   - sides: from Matching_Bipartition
+///   - mates: see Matching_HopcroftKarp
+///   - edges: see Matching_HopcroftKarp
+///   - weight: set to the total weight of the matching, or NULL
+/// - Returns: The edges of the matching, as many as Matching_HopcroftKarp finds
+unsigned int Matching_Assignment(const Csr *csr, const uint8_t *sides, uint32_t *mates, uint32_t *edges, uint64_t *weight);
+
+/// A maximum matching of the graph, ignoring the direction of each edge. A bipartite graph gets the matching of the
+/// least total weight, any other graph a maximum matching by Matching_Blossom.
+/// - Parameters:
+///   - matching: set to the edges of the matching, terminated by MST_NO_EDGE
+///   - isBipartite: set to if the graph is bipartite, or NULL
+///   - weight: set to the total weight of the matching, or NULL
+/// - Returns: The edges of the matching
+unsigned int Graph_MaximumMatching(const Graph *g, EdgeIndex matching[GRAPH_MAX_SIZE + 1], bool *isBipartite,
+                                   unsigned long long *weight);
+
+#endif /* Matching_h */
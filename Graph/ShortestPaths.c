@@ -0,0 +1,437 @@
+//
+//  ShortestPaths.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "ShortestPaths.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "EdgeList.h"
+#include "Util/Parallel.h"
+#include "Util/Profiler.h"
+
+/// One bucket per bit a key can differ from the last popped key in, and one for keys equal to it
+#define RADIX_HEAP_BUCKETS 65
+
+#define SHORTEST_PATHS_NO_BIN SIZE_MAX
+
+/// Frontier vertices a thread relaxes, or gathers before appending them to the frontier, at a time
+#define SHORTEST_PATHS_CHUNK 64
+#define SHORTEST_PATHS_GATHER 256
+
+typedef struct
+{
+    uint64_t Key;
+    VertexIndex Vertex;
+} _RadixEntry;
+
+typedef struct
+{
+    _RadixEntry *Entries;
+    size_t Count;
+    size_t Capacity;
+} _RadixBucket;
+
+/// A monotone priority queue, keys are never pushed below the last popped key. Bucket i holds the keys whose highest bit
+/// differing from the last popped key is bit i - 1, so each entry moves down at most 64 times over its life.
+typedef struct
+{
+    _RadixBucket Buckets[RADIX_HEAP_BUCKETS];
+    uint64_t Last;
+} _RadixHeap;
+
+static inline unsigned int _RadixHeap_Bucket(uint64_t last, uint64_t key)
+{
+    return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+}
+
+static inline void _RadixBucket_Add(_RadixBucket *bucket, uint64_t key, VertexIndex v)
+{
+    if (bucket->Count == bucket->Capacity)
+    {
+        bucket->Capacity = bucket->Capacity == 0 ? 16 : bucket->Capacity * 2;
+        bucket->Entries = realloc(bucket->Entries, bucket->Capacity * sizeof(_RadixEntry));
+        assert(bucket->Entries != NULL);
+    }
+    bucket->Entries[bucket->Count++] = (_RadixEntry) { .Key = key, .Vertex = v };
+}
+
+static inline void _RadixHeap_Push(_RadixHeap *heap, uint64_t key, VertexIndex v)
+{
+    assert(key >= heap->Last);
+    _RadixBucket_Add(&heap->Buckets[_RadixHeap_Bucket(heap->Last, key)], key, v);
+}
+
+/// - Returns: false if the heap is empty, otherwise an entry of the smallest key
+static bool _RadixHeap_Pop(_RadixHeap *heap, _RadixEntry *entry)
+{
+    if (heap->Buckets[0].Count == 0)
+    {
+        unsigned int i = 1;
+        while (i < RADIX_HEAP_BUCKETS && heap->Buckets[i].Count == 0) i++;
+        if (i == RADIX_HEAP_BUCKETS) return false;
+        
+        // Every key of the bucket shares the bits above i - 1 with the smallest, so each lands in a lower bucket
+        _RadixBucket *bucket = &heap->Buckets[i];
+        uint64_t smallest = UINT64_MAX;
+        for (size_t j = 0; j < bucket->Count; j++)
+        {
+            if (bucket->Entries[j].Key < smallest) smallest = bucket->Entries[j].Key;
+        }
+        heap->Last = smallest;
+        for (size_t j = 0; j < bucket->Count; j++)
+        {
+            _RadixEntry moved = bucket->Entries[j];
+            _RadixBucket_Add(&heap->Buckets[_RadixHeap_Bucket(smallest, moved.Key)], moved.Key, moved.Vertex);
+        }
+        bucket->Count = 0;
+    }
+    *entry = heap->Buckets[0].Entries[--heap->Buckets[0].Count];
+    return true;
+}
+
+static void _RadixHeap_Free(_RadixHeap *heap)
+{
+    for (int i = 0; i < RADIX_HEAP_BUCKETS; i++)
+    {
+        free(heap->Buckets[i].Entries);
+    }
+}
+
+void ShortestPaths_Dijkstra(const Csr *csr, VertexIndex source, uint64_t *distances, VertexIndex *predecessors, uint32_t *edges)
+{
+    PROFILE_ZONE("ShortestPaths_Dijkstra");
+    assert(csr != NULL && distances != NULL);
+    assert(source < csr->Vertices);
+    
+    for (VertexIndex v = 0; v < csr->Vertices; v++)
+    {
+        distances[v] = SHORTEST_PATHS_UNREACHED;
+        if (predecessors != NULL) predecessors[v] = v;
+        if (edges != NULL) edges[v] = SHORTEST_PATHS_NO_EDGE;
+    }
+    distances[source] = 0;
+    
+    _RadixHeap heap = {};
+    _RadixHeap_Push(&heap, 0, source);
+    _RadixEntry entry;
+    while (_RadixHeap_Pop(&heap, &entry))
+    {
+        // A vertex is pushed again each time its distance drops, only its last entry is current
+        VertexIndex u = entry.Vertex;
+        if (entry.Key != distances[u]) continue;
+        
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            VertexIndex v = csr->Targets[i];
+            uint64_t distance = entry.Key + csr->Weights[i];
+            if (distance >= distances[v]) continue;
+            
+            distances[v] = distance;
+            if (predecessors != NULL) predecessors[v] = u;
+            if (edges != NULL) edges[v] = csr->Edges[i];
+            _RadixHeap_Push(&heap, distance, v);
+        }
+    }
+    _RadixHeap_Free(&heap);
+}
+
+typedef struct
+{
+    VertexIndex *Vertices;
+    size_t Count;
+    size_t Capacity;
+} _Bin;
+
+/// The bins of one thread, indexed by distance / delta
+typedef struct
+{
+    _Bin *Bins;
+    size_t Count;
+} _Bins;
+
+typedef struct
+{
+    const Csr *Csr;
+    VertexIndex Source;
+    uint64_t Delta;
+    unsigned int Threads;
+    ParallelBarrier Barrier;
+    _Atomic uint64_t *Distances;
+    _Bins *Bins;
+    
+    /// The vertices of the bin being settled, each once
+    VertexIndex *Frontier;
+    atomic_size_t FrontierCount;
+    atomic_size_t Cursor;
+    
+    /// The round each vertex was last added to the frontier in
+    _Atomic uint32_t *Rounds;
+    
+    /// The bin of the next round, alternating between two so one can be reset while the other is claimed
+    atomic_size_t NextBin[2];
+    
+    /// The sum of the weights while the mean is taken for delta
+    _Atomic uint64_t TotalWeight;
+    
+    /// The smallest (edge << 32 | predecessor) of each vertex, so predecessors are the same on any number of threads
+    _Atomic uint64_t *Predecessors;
+} _DeltaStepping;
+
+static void _Bins_Add(_Bins *bins, size_t bin, VertexIndex v)
+{
+    if (bin >= bins->Count)
+    {
+        size_t count = bins->Count == 0 ? 64 : bins->Count;
+        while (count <= bin) count *= 2;
+        bins->Bins = realloc(bins->Bins, count * sizeof(_Bin));
+        assert(bins->Bins != NULL);
+        memset(bins->Bins + bins->Count, 0, (count - bins->Count) * sizeof(_Bin));
+        bins->Count = count;
+    }
+    
+    _Bin *b = &bins->Bins[bin];
+    if (b->Count == b->Capacity)
+    {
+        b->Capacity = b->Capacity == 0 ? 64 : b->Capacity * 2;
+        b->Vertices = realloc(b->Vertices, b->Capacity * sizeof(VertexIndex));
+        assert(b->Vertices != NULL);
+    }
+    b->Vertices[b->Count++] = v;
+}
+
+/// Relaxes every edge leaving the vertices of the frontier, each thread claiming a chunk of them at a time
+static void _DeltaStepping_Relax(_DeltaStepping *ds, _Bins *bins)
+{
+    const Csr *csr = ds->Csr;
+    size_t count = atomic_load_explicit(&ds->FrontierCount, memory_order_relaxed);
+    size_t start;
+    while ((start = atomic_fetch_add_explicit(&ds->Cursor, SHORTEST_PATHS_CHUNK, memory_order_relaxed)) < count)
+    {
+        size_t end = start + SHORTEST_PATHS_CHUNK < count ? start + SHORTEST_PATHS_CHUNK : count;
+        for (size_t f = start; f < end; f++)
+        {
+            VertexIndex u = ds->Frontier[f];
+            uint64_t distance = atomic_load_explicit(&ds->Distances[u], memory_order_relaxed);
+            for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+            {
+                VertexIndex v = csr->Targets[i];
+                uint64_t candidate = distance + csr->Weights[i];
+                uint64_t current = atomic_load_explicit(&ds->Distances[v], memory_order_relaxed);
+                while (candidate < current)
+                {
+                    if (atomic_compare_exchange_weak_explicit(&ds->Distances[v], &current, candidate,
+                                                              memory_order_relaxed, memory_order_relaxed))
+                    {
+                        _Bins_Add(bins, candidate / ds->Delta, v);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void _DeltaStepping_Append(_DeltaStepping *ds, const VertexIndex *vertices, unsigned int count)
+{
+    size_t at = atomic_fetch_add_explicit(&ds->FrontierCount, count, memory_order_relaxed);
+    memcpy(ds->Frontier + at, vertices, count * sizeof(VertexIndex));
+}
+
+/// Moves the vertices of the bin into the frontier, skipping those whose distance has since dropped into an earlier bin
+/// and those already added this round
+static void _DeltaStepping_Gather(_DeltaStepping *ds, _Bins *bins, size_t bin, uint32_t round)
+{
+    if (bin >= bins->Count) return;
+    
+    _Bin *b = &bins->Bins[bin];
+    VertexIndex gathered[SHORTEST_PATHS_GATHER];
+    unsigned int count = 0;
+    for (size_t i = 0; i < b->Count; i++)
+    {
+        VertexIndex v = b->Vertices[i];
+        if (atomic_load_explicit(&ds->Distances[v], memory_order_relaxed) / ds->Delta != bin) continue;
+        if (atomic_exchange_explicit(&ds->Rounds[v], round, memory_order_relaxed) == round) continue;
+        
+        gathered[count++] = v;
+        if (count == SHORTEST_PATHS_GATHER)
+        {
+            _DeltaStepping_Append(ds, gathered, count);
+            count = 0;
+        }
+    }
+    _DeltaStepping_Append(ds, gathered, count);
+    b->Count = 0;
+}
+
+/// Keeps the smallest packed edge and predecessor of every vertex a shortest path reaches through, over the share of the rows
+static void _DeltaStepping_Predecessors(_DeltaStepping *ds, unsigned int thread)
+{
+    const Csr *csr = ds->Csr;
+    VertexIndex from = Csr_VertexOfEntry(csr, Parallel_RangeStart(csr->Count, thread, ds->Threads));
+    VertexIndex to = thread + 1 == ds->Threads ? csr->Vertices :
+        Csr_VertexOfEntry(csr, Parallel_RangeStart(csr->Count, thread + 1, ds->Threads));
+    for (VertexIndex u = from; u < to; u++)
+    {
+        uint64_t distance = atomic_load_explicit(&ds->Distances[u], memory_order_relaxed);
+        if (distance == SHORTEST_PATHS_UNREACHED) continue;
+        
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            VertexIndex v = csr->Targets[i];
+            if (distance + csr->Weights[i] != atomic_load_explicit(&ds->Distances[v], memory_order_relaxed)) continue;
+            
+            uint64_t packed = (uint64_t) csr->Edges[i] << 32 | u;
+            uint64_t current = atomic_load_explicit(&ds->Predecessors[v], memory_order_relaxed);
+            while (packed < current && !atomic_compare_exchange_weak_explicit(&ds->Predecessors[v], &current, packed,
+                                                                             memory_order_relaxed, memory_order_relaxed));
+        }
+    }
+}
+
+static void _DeltaStepping_Thread(void *context, unsigned int thread)
+{
+    _DeltaStepping *ds = context;
+    const Csr *csr = ds->Csr;
+    _Bins *bins = &ds->Bins[thread];
+    
+    size_t first = Parallel_RangeStart(csr->Vertices, thread, ds->Threads);
+    size_t last = Parallel_RangeStart(csr->Vertices, thread + 1, ds->Threads);
+    for (size_t v = first; v < last; v++)
+    {
+        atomic_store_explicit(&ds->Distances[v], v == ds->Source ? 0 : SHORTEST_PATHS_UNREACHED, memory_order_relaxed);
+        atomic_store_explicit(&ds->Rounds[v], UINT32_MAX, memory_order_relaxed);
+        if (ds->Predecessors != NULL) atomic_store_explicit(&ds->Predecessors[v], UINT64_MAX, memory_order_relaxed);
+    }
+    if (ds->Delta == 0)
+    {
+        uint64_t weight = 0;
+        size_t end = Parallel_RangeStart(csr->Count, thread + 1, ds->Threads);
+        for (size_t i = Parallel_RangeStart(csr->Count, thread, ds->Threads); i < end; i++) weight += csr->Weights[i];
+        atomic_fetch_add_explicit(&ds->TotalWeight, weight, memory_order_relaxed);
+    }
+    if (ParallelBarrier_Wait(&ds->Barrier) && ds->Delta == 0)
+    {
+        uint64_t mean = csr->Count > 0 ? atomic_load_explicit(&ds->TotalWeight, memory_order_relaxed) / csr->Count : 1;
+        ds->Delta = mean > 0 ? mean : 1;
+    }
+    ParallelBarrier_Wait(&ds->Barrier);
+    
+    for (uint32_t round = 0; ; round++)
+    {
+        _DeltaStepping_Relax(ds, bins);
+        
+        // The next bin is the smallest any thread still holds, light edges can refill the one just settled
+        size_t bin = atomic_load_explicit(&ds->NextBin[round & 1], memory_order_relaxed);
+        for (size_t b = bin; b < bins->Count; b++)
+        {
+            if (bins->Bins[b].Count == 0) continue;
+            
+            size_t next = atomic_load_explicit(&ds->NextBin[(round + 1) & 1], memory_order_relaxed);
+            while (b < next && !atomic_compare_exchange_weak_explicit(&ds->NextBin[(round + 1) & 1], &next, b,
+                                                                      memory_order_relaxed, memory_order_relaxed));
+            break;
+        }
+        if (ParallelBarrier_Wait(&ds->Barrier))
+        {
+            atomic_store_explicit(&ds->NextBin[round & 1], SHORTEST_PATHS_NO_BIN, memory_order_relaxed);
+            atomic_store_explicit(&ds->FrontierCount, 0, memory_order_relaxed);
+            atomic_store_explicit(&ds->Cursor, 0, memory_order_relaxed);
+        }
+        ParallelBarrier_Wait(&ds->Barrier);
+        
+        size_t next = atomic_load_explicit(&ds->NextBin[(round + 1) & 1], memory_order_relaxed);
+        if (next == SHORTEST_PATHS_NO_BIN) break;
+        _DeltaStepping_Gather(ds, bins, next, round);
+        ParallelBarrier_Wait(&ds->Barrier);
+    }
+    
+    if (ds->Predecessors == NULL) return;
+    _DeltaStepping_Predecessors(ds, thread);
+}
+
+void ShortestPaths_DeltaStepping(const Csr *csr, VertexIndex source, uint64_t delta, unsigned int threads,
+                                 uint64_t *distances, VertexIndex *predecessors, uint32_t *edges)
+{
+    PROFILE_ZONE("ShortestPaths_DeltaStepping");
+    assert(csr != NULL && distances != NULL);
+    assert(source < csr->Vertices);
+    _Static_assert(sizeof(_Atomic uint64_t) == sizeof(uint64_t), "distances are relaxed in place");
+    
+    _DeltaStepping ds =
+    {
+        .Csr = csr,
+        .Source = source,
+        .Delta = delta,
+        .Threads = Parallel_ThreadCount(threads),
+        .Distances = (_Atomic uint64_t *) distances,
+        .Frontier = malloc(csr->Vertices * sizeof(VertexIndex)),
+        .Rounds = malloc(csr->Vertices * sizeof(uint32_t)),
+    };
+    ds.Bins = calloc(ds.Threads, sizeof(_Bins));
+    if (predecessors != NULL || edges != NULL) ds.Predecessors = malloc(csr->Vertices * sizeof(uint64_t));
+    ds.Frontier[0] = source;
+    atomic_init(&ds.FrontierCount, 1);
+    atomic_init(&ds.NextBin[0], 0);
+    atomic_init(&ds.NextBin[1], SHORTEST_PATHS_NO_BIN);
+    
+    ParallelBarrier_Init(&ds.Barrier, ds.Threads);
+    Parallel_Run(ds.Threads, _DeltaStepping_Thread, &ds);
+    ParallelBarrier_Destroy(&ds.Barrier);
+    
+    for (VertexIndex v = 0; v < csr->Vertices && ds.Predecessors != NULL; v++)
+    {
+        uint64_t packed = ds.Predecessors[v];
+        bool isReached = packed != UINT64_MAX && v != source;
+        if (predecessors != NULL) predecessors[v] = isReached ? (VertexIndex) packed : v;
+        if (edges != NULL) edges[v] = isReached ? (uint32_t) (packed >> 32) : SHORTEST_PATHS_NO_EDGE;
+    }
+    
+    for (unsigned int t = 0; t < ds.Threads; t++)
+    {
+        for (size_t b = 0; b < ds.Bins[t].Count; b++) free(ds.Bins[t].Bins[b].Vertices);
+        free(ds.Bins[t].Bins);
+    }
+    free(ds.Bins);
+    free(ds.Frontier);
+    free(ds.Rounds);
+    free(ds.Predecessors);
+}
+
+bool Graph_ShortestPath(const Graph *g, VertexIndex source, VertexIndex target, EdgeIndex path[GRAPH_MAX_SIZE])
+{
+    PROFILE_ZONE("Graph_ShortestPath");
+    assert(g != NULL && path != NULL);
+    assert(source < g->Vertices && target < g->Vertices);
+    
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint64_t distances[GRAPH_MAX_SIZE];
+    VertexIndex predecessors[GRAPH_MAX_SIZE];
+    uint32_t edges[GRAPH_MAX_SIZE];
+    ShortestPaths_Dijkstra(csr, source, distances, predecessors, edges);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    
+    path[0] = MST_NO_EDGE;
+    if (distances[target] == SHORTEST_PATHS_UNREACHED) return false;
+    
+    // Walk back from the target, then reverse into the order of the path
+    int length = 0;
+    for (VertexIndex v = target; v != source; v = predecessors[v])
+    {
+        path[length++] = edges[v];
+    }
+    for (int i = 0; i < length / 2; i++)
+    {
+        EdgeIndex e = path[i];
+        path[i] = path[length - 1 - i];
+        path[length - 1 - i] = e;
+    }
+    path[length] = MST_NO_EDGE;
+    return true;
+}
@@ -0,0 +1,45 @@
+//
+//  ShortestPaths.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ShortestPaths_h
+#define ShortestPaths_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+/// The distance of a vertex the source cannot reach
+#define SHORTEST_PATHS_UNREACHED UINT64_MAX
+
+/// The predecessor edge of the source and of vertices it cannot reach
+#define SHORTEST_PATHS_NO_EDGE UINT32_MAX
+
+/// Dijkstra's algorithm from the source, following the direction of each edge. Distances only grow as vertices are settled,
+/// so the queue is a radix heap, each pop moving entries only towards the bucket of the smallest.
+/// - Parameters:
+///   - distances: Vertices entries, set to the total weight of a shortest path from the source, or SHORTEST_PATHS_UNREACHED
+///   - predecessors: Vertices entries set to the vertex before each on a shortest path, the source for itself and
+///                   unreached vertices, or NULL
+///   - edges: Vertices entries set to the index in the edge list of the last edge of a shortest path to each, or
+///            SHORTEST_PATHS_NO_EDGE, or NULL
+void ShortestPaths_Dijkstra(const Csr *csr, VertexIndex source, uint64_t *distances, VertexIndex *predecessors, uint32_t *edges);
+
+/// Delta stepping from the source, the same paths as ShortestPaths_Dijkstra found on every thread. Vertices are settled a bucket
+/// of distances delta wide at a time, every thread relaxing its share of the bucket until it empties. Of several shortest paths,
+/// the predecessor edge of each vertex is the one with the smallest index.
+/// - Parameters:
+///   - delta: the width of the buckets, 0 for the mean weight of the edges
+///   - threads: the threads to relax edges on, 0 for one per processor
+void ShortestPaths_DeltaStepping(const Csr *csr, VertexIndex source, uint64_t delta, unsigned int threads,
+                                 uint64_t *distances, VertexIndex *predecessors, uint32_t *edges);
+
+/// A shortest path between two vertices of the graph, following the direction of each edge
+/// - Parameters:
+///   - path: set to the edges of the path in order, terminated by MST_NO_EDGE
+/// - Returns: false if there is no path from source to target
+bool Graph_ShortestPath(const Graph *g, VertexIndex source, VertexIndex target, EdgeIndex path[GRAPH_MAX_SIZE]);
+
+#endif /* ShortestPaths_h */
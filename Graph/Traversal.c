@@ -0,0 +1,432 @@
+//
+//  Traversal.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Traversal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "Util/Parallel.h"
+#include "Util/Profiler.h"
+
+/// A top down level switches to bottom up once the frontier has more than 1 / alpha of the unexplored edges,
+/// and back once it has fewer than 1 / beta of the vertices, as tuned by Beamer et al.
+#define TRAVERSAL_ALPHA 14
+#define TRAVERSAL_BETA 24
+
+/// Frontier vertices, or bitmap words, a thread claims at a time, so threads stay busy on skewed degrees
+#define TRAVERSAL_CHUNK 64
+
+/// Vertices a thread collects before appending them to a shared queue at once
+#define TRAVERSAL_LOCAL_QUEUE 256
+
+typedef struct
+{
+    const Csr *Out;
+    const Csr *In;
+    VertexIndex Source;
+    unsigned int Threads;
+    uint32_t *Levels;
+    VertexIndex *Parents;
+    ParallelBarrier Barrier;
+    
+    /// Set once a vertex is reached, claimed with an atomic or when searching top down
+    _Atomic uint64_t *Visited;
+    
+    /// The frontier as a queue while searching top down, and as a bitmap while searching bottom up
+    VertexIndex *Frontier;
+    VertexIndex *Next;
+    _Atomic uint64_t *FrontierBits;
+    _Atomic uint64_t *NextBits;
+    size_t Words;
+    
+    /// Written by one thread between barriers
+    uint32_t Level;
+    bool IsBottomUp;
+    bool IsConverting;
+    bool IsDone;
+    uint64_t FrontierCount;
+    uint64_t UnexploredEdges;
+    unsigned int Reached;
+    
+    /// Claimed and totalled by every thread during a level
+    atomic_size_t Cursor;
+    atomic_size_t NextTail;
+    atomic_size_t FrontierTail;
+    _Atomic uint64_t NextCount;
+    _Atomic uint64_t NextEdges;
+} _BreadthFirst;
+
+typedef struct
+{
+    VertexIndex Vertices[TRAVERSAL_LOCAL_QUEUE];
+    unsigned int Count;
+} _LocalQueue;
+
+static inline uint64_t _Degree(const Csr *csr, VertexIndex v)
+{
+    return csr->Offsets[v + 1] - csr->Offsets[v];
+}
+
+static void _LocalQueue_Flush(_LocalQueue *local, VertexIndex *queue, atomic_size_t *tail)
+{
+    if (local->Count == 0) return;
+    size_t at = atomic_fetch_add_explicit(tail, local->Count, memory_order_relaxed);
+    memcpy(queue + at, local->Vertices, local->Count * sizeof(VertexIndex));
+    local->Count = 0;
+}
+
+static inline void _LocalQueue_Push(_LocalQueue *local, VertexIndex v, VertexIndex *queue, atomic_size_t *tail)
+{
+    if (local->Count == TRAVERSAL_LOCAL_QUEUE) _LocalQueue_Flush(local, queue, tail);
+    local->Vertices[local->Count++] = v;
+}
+
+/// Expands every frontier vertex, claiming each unreached neighbor for the next level
+static void _BreadthFirst_TopDown(_BreadthFirst *bfs)
+{
+    const Csr *out = bfs->Out;
+    _LocalQueue local = { .Count = 0 };
+    uint64_t count = 0, edges = 0;
+    size_t start;
+    while ((start = atomic_fetch_add_explicit(&bfs->Cursor, TRAVERSAL_CHUNK, memory_order_relaxed)) < bfs->FrontierCount)
+    {
+        size_t end = start + TRAVERSAL_CHUNK < bfs->FrontierCount ? start + TRAVERSAL_CHUNK : bfs->FrontierCount;
+        for (size_t f = start; f < end; f++)
+        {
+            VertexIndex u = bfs->Frontier[f];
+            for (uint64_t i = out->Offsets[u]; i < out->Offsets[u + 1]; i++)
+            {
+                VertexIndex v = out->Targets[i];
+                uint64_t bit = 1ull << (v % 64);
+                
+                // Reading first skips the atomic on the many edges to vertices already reached
+                if (atomic_load_explicit(&bfs->Visited[v / 64], memory_order_relaxed) & bit) continue;
+                if (atomic_fetch_or_explicit(&bfs->Visited[v / 64], bit, memory_order_relaxed) & bit) continue;
+                
+                bfs->Levels[v] = bfs->Level + 1;
+                if (bfs->Parents != NULL) bfs->Parents[v] = u;
+                count++;
+                edges += _Degree(out, v);
+                _LocalQueue_Push(&local, v, bfs->Next, &bfs->NextTail);
+            }
+        }
+    }
+    _LocalQueue_Flush(&local, bfs->Next, &bfs->NextTail);
+    atomic_fetch_add_explicit(&bfs->NextCount, count, memory_order_relaxed);
+    atomic_fetch_add_explicit(&bfs->NextEdges, edges, memory_order_relaxed);
+}
+
+/// Has every unreached vertex look for a parent in the frontier. Threads claim whole bitmap words, so the words
+/// of the next frontier and of the visited vertices are only written by the thread that claimed them.
+static void _BreadthFirst_BottomUp(_BreadthFirst *bfs)
+{
+    const Csr *in = bfs->In;
+    unsigned int vertices = bfs->Out->Vertices;
+    uint64_t count = 0, edges = 0;
+    size_t start;
+    while ((start = atomic_fetch_add_explicit(&bfs->Cursor, TRAVERSAL_CHUNK, memory_order_relaxed)) < bfs->Words)
+    {
+        size_t end = start + TRAVERSAL_CHUNK < bfs->Words ? start + TRAVERSAL_CHUNK : bfs->Words;
+        for (size_t w = start; w < end; w++)
+        {
+            uint64_t visited = atomic_load_explicit(&bfs->Visited[w], memory_order_relaxed);
+            uint64_t next = 0;
+            for (unsigned int b = 0; b < 64 && w * 64 + b < vertices; b++)
+            {
+                if (visited >> b & 1) continue;
+                
+                VertexIndex v = (VertexIndex) (w * 64 + b);
+                for (uint64_t i = in->Offsets[v]; i < in->Offsets[v + 1]; i++)
+                {
+                    VertexIndex u = in->Targets[i];
+                    if (!(atomic_load_explicit(&bfs->FrontierBits[u / 64], memory_order_relaxed) >> (u % 64) & 1)) continue;
+                    
+                    bfs->Levels[v] = bfs->Level + 1;
+                    if (bfs->Parents != NULL) bfs->Parents[v] = u;
+                    next |= 1ull << b;
+                    count++;
+                    edges += _Degree(bfs->Out, v);
+                    break;
+                }
+            }
+            atomic_store_explicit(&bfs->NextBits[w], next, memory_order_relaxed);
+            if (next != 0) atomic_fetch_or_explicit(&bfs->Visited[w], next, memory_order_relaxed);
+        }
+    }
+    atomic_fetch_add_explicit(&bfs->NextCount, count, memory_order_relaxed);
+    atomic_fetch_add_explicit(&bfs->NextEdges, edges, memory_order_relaxed);
+}
+
+/// Makes the next level the frontier and picks the direction to search it in. Run by one thread between levels.
+static void _BreadthFirst_Advance(_BreadthFirst *bfs)
+{
+    uint64_t count = atomic_load_explicit(&bfs->NextCount, memory_order_relaxed);
+    uint64_t edges = atomic_load_explicit(&bfs->NextEdges, memory_order_relaxed);
+    bfs->Level++;
+    bfs->Reached += (unsigned int) count;
+    bfs->UnexploredEdges -= edges;
+    bfs->FrontierCount = count;
+    bfs->IsDone = count == 0;
+    
+    bool wasBottomUp = bfs->IsBottomUp;
+    if (wasBottomUp)
+    {
+        _Atomic uint64_t *bits = bfs->FrontierBits;
+        bfs->FrontierBits = bfs->NextBits;
+        bfs->NextBits = bits;
+        bfs->IsBottomUp = count >= bfs->Out->Vertices / TRAVERSAL_BETA;
+    }
+    else
+    {
+        VertexIndex *queue = bfs->Frontier;
+        bfs->Frontier = bfs->Next;
+        bfs->Next = queue;
+        bfs->IsBottomUp = bfs->In != NULL && edges > bfs->UnexploredEdges / TRAVERSAL_ALPHA;
+        if (bfs->IsBottomUp) memset(bfs->FrontierBits, 0, bfs->Words * sizeof(uint64_t));
+    }
+    bfs->IsConverting = wasBottomUp != bfs->IsBottomUp;
+    atomic_store_explicit(&bfs->Cursor, 0, memory_order_relaxed);
+    atomic_store_explicit(&bfs->NextTail, 0, memory_order_relaxed);
+    atomic_store_explicit(&bfs->FrontierTail, 0, memory_order_relaxed);
+    atomic_store_explicit(&bfs->NextCount, 0, memory_order_relaxed);
+    atomic_store_explicit(&bfs->NextEdges, 0, memory_order_relaxed);
+}
+
+/// Turns the frontier from the queue into the bitmap, or back, for the direction of the next level
+static void _BreadthFirst_Convert(_BreadthFirst *bfs, unsigned int thread)
+{
+    if (bfs->IsBottomUp)
+    {
+        size_t end = Parallel_RangeStart(bfs->FrontierCount, thread + 1, bfs->Threads);
+        for (size_t f = Parallel_RangeStart(bfs->FrontierCount, thread, bfs->Threads); f < end; f++)
+        {
+            VertexIndex v = bfs->Frontier[f];
+            atomic_fetch_or_explicit(&bfs->FrontierBits[v / 64], 1ull << (v % 64), memory_order_relaxed);
+        }
+        return;
+    }
+    
+    _LocalQueue local = { .Count = 0 };
+    size_t end = Parallel_RangeStart(bfs->Words, thread + 1, bfs->Threads);
+    for (size_t w = Parallel_RangeStart(bfs->Words, thread, bfs->Threads); w < end; w++)
+    {
+        for (uint64_t bits = atomic_load_explicit(&bfs->FrontierBits[w], memory_order_relaxed); bits != 0; bits &= bits - 1)
+        {
+            _LocalQueue_Push(&local, (VertexIndex) (w * 64 + __builtin_ctzll(bits)), bfs->Frontier, &bfs->FrontierTail);
+        }
+    }
+    _LocalQueue_Flush(&local, bfs->Frontier, &bfs->FrontierTail);
+}
+
+static void _BreadthFirst_Thread(void *context, unsigned int thread)
+{
+    _BreadthFirst *bfs = context;
+    
+    unsigned int vertices = bfs->Out->Vertices;
+    size_t end = Parallel_RangeStart(vertices, thread + 1, bfs->Threads);
+    for (size_t v = Parallel_RangeStart(vertices, thread, bfs->Threads); v < end; v++)
+    {
+        if (v != bfs->Source) bfs->Levels[v] = TRAVERSAL_UNREACHED;
+    }
+    ParallelBarrier_Wait(&bfs->Barrier);
+    
+    while (true)
+    {
+        if (bfs->IsBottomUp) _BreadthFirst_BottomUp(bfs);
+        else _BreadthFirst_TopDown(bfs);
+        if (ParallelBarrier_Wait(&bfs->Barrier)) _BreadthFirst_Advance(bfs);
+        ParallelBarrier_Wait(&bfs->Barrier);
+        if (bfs->IsDone) return;
+        
+        if (bfs->IsConverting)
+        {
+            _BreadthFirst_Convert(bfs, thread);
+            ParallelBarrier_Wait(&bfs->Barrier);
+        }
+    }
+}
+
+unsigned int Traversal_BreadthFirst(const Csr *out, const Csr *in, VertexIndex source, unsigned int threads,
+                                    uint32_t *levels, VertexIndex *parents)
+{
+    PROFILE_ZONE("Traversal_BreadthFirst");
+    assert(out != NULL && levels != NULL);
+    assert(source < out->Vertices);
+    assert(in == NULL || (in->Vertices == out->Vertices && in->Count == out->Count));
+    
+    _BreadthFirst bfs =
+    {
+        .Out = out,
+        .In = in,
+        .Source = source,
+        .Threads = Parallel_ThreadCount(threads),
+        .Levels = levels,
+        .Parents = parents,
+        .Words = ((size_t) out->Vertices + 63) / 64,
+        .Level = 0,
+        .FrontierCount = 1,
+        .UnexploredEdges = out->Count - _Degree(out, source),
+        .Reached = 1,
+    };
+    bfs.Visited = calloc(bfs.Words, sizeof(uint64_t));
+    bfs.Frontier = malloc(out->Vertices * sizeof(VertexIndex));
+    bfs.Next = malloc(out->Vertices * sizeof(VertexIndex));
+    if (in != NULL)
+    {
+        bfs.FrontierBits = malloc(bfs.Words * sizeof(uint64_t));
+        bfs.NextBits = malloc(bfs.Words * sizeof(uint64_t));
+    }
+    assert(bfs.Visited != NULL && bfs.Frontier != NULL && bfs.Next != NULL);
+    
+    bfs.Visited[source / 64] = 1ull << (source % 64);
+    bfs.Frontier[0] = source;
+    levels[source] = 0;
+    if (parents != NULL) parents[source] = source;
+    
+    ParallelBarrier_Init(&bfs.Barrier, bfs.Threads);
+    Parallel_Run(bfs.Threads, _BreadthFirst_Thread, &bfs);
+    ParallelBarrier_Destroy(&bfs.Barrier);
+    
+    free(bfs.Visited);
+    free(bfs.Frontier);
+    free(bfs.Next);
+    free(bfs.FrontierBits);
+    free(bfs.NextBits);
+    return bfs.Reached;
+}
+
+typedef struct
+{
+    const Csr *Csr;
+    unsigned int Threads;
+    uint32_t *Components;
+    ParallelBarrier Barrier;
+    
+    /// The union find forest. A root is always linked under a smaller root, so each root is the smallest vertex of its tree.
+    _Atomic uint32_t *Parents;
+    
+    /// The roots in the share of each thread, then the first component number of the share
+    unsigned int *Roots;
+} _Components;
+
+static inline uint32_t _Components_Find(_Atomic uint32_t *parents, uint32_t v)
+{
+    uint32_t parent = atomic_load_explicit(&parents[v], memory_order_relaxed);
+    while (parent != v)
+    {
+        // Path halving, a lost race only leaves a longer path
+        uint32_t grandparent = atomic_load_explicit(&parents[parent], memory_order_relaxed);
+        if (grandparent != parent)
+        {
+            atomic_compare_exchange_weak_explicit(&parents[v], &parent, grandparent, memory_order_relaxed, memory_order_relaxed);
+        }
+        v = grandparent;
+        parent = atomic_load_explicit(&parents[v], memory_order_relaxed);
+    }
+    return v;
+}
+
+static inline void _Components_Union(_Atomic uint32_t *parents, uint32_t a, uint32_t b)
+{
+    while (true)
+    {
+        a = _Components_Find(parents, a);
+        b = _Components_Find(parents, b);
+        if (a == b) return;
+        if (a < b)
+        {
+            uint32_t smaller = a;
+            a = b;
+            b = smaller;
+        }
+        
+        // Fails if another thread linked the larger root first, then both are found again
+        uint32_t expected = a;
+        if (atomic_compare_exchange_weak_explicit(&parents[a], &expected, b, memory_order_relaxed, memory_order_relaxed)) return;
+    }
+}
+
+static void _Components_Thread(void *context, unsigned int thread)
+{
+    _Components *cc = context;
+    const Csr *csr = cc->Csr;
+    VertexIndex first = (VertexIndex) Parallel_RangeStart(csr->Vertices, thread, cc->Threads);
+    VertexIndex last = (VertexIndex) Parallel_RangeStart(csr->Vertices, thread + 1, cc->Threads);
+    for (VertexIndex v = first; v < last; v++)
+    {
+        atomic_store_explicit(&cc->Parents[v], v, memory_order_relaxed);
+    }
+    ParallelBarrier_Wait(&cc->Barrier);
+    
+    VertexIndex from = Csr_VertexOfEntry(csr, Parallel_RangeStart(csr->Count, thread, cc->Threads));
+    VertexIndex to = Csr_VertexOfEntry(csr, Parallel_RangeStart(csr->Count, thread + 1, cc->Threads));
+    if (thread + 1 == cc->Threads) to = csr->Vertices;
+    for (VertexIndex v = from; v < to; v++)
+    {
+        for (uint64_t i = csr->Offsets[v]; i < csr->Offsets[v + 1]; i++)
+        {
+            _Components_Union(cc->Parents, v, csr->Targets[i]);
+        }
+    }
+    ParallelBarrier_Wait(&cc->Barrier);
+    
+    // With every edge joined the forest no longer changes, so each vertex points straight at its root
+    unsigned int roots = 0;
+    for (VertexIndex v = first; v < last; v++)
+    {
+        uint32_t root = _Components_Find(cc->Parents, v);
+        atomic_store_explicit(&cc->Parents[v], root, memory_order_relaxed);
+        roots += root == v;
+    }
+    cc->Roots[thread] = roots;
+    if (ParallelBarrier_Wait(&cc->Barrier))
+    {
+        unsigned int count = 0;
+        for (unsigned int t = 0; t < cc->Threads; t++)
+        {
+            unsigned int share = cc->Roots[t];
+            cc->Roots[t] = count;
+            count += share;
+        }
+        cc->Roots[cc->Threads] = count;
+    }
+    ParallelBarrier_Wait(&cc->Barrier);
+    
+    unsigned int component = cc->Roots[thread];
+    for (VertexIndex v = first; v < last; v++)
+    {
+        if (atomic_load_explicit(&cc->Parents[v], memory_order_relaxed) == v) cc->Components[v] = component++;
+    }
+    ParallelBarrier_Wait(&cc->Barrier);
+    
+    for (VertexIndex v = first; v < last; v++)
+    {
+        uint32_t root = atomic_load_explicit(&cc->Parents[v], memory_order_relaxed);
+        if (root != v) cc->Components[v] = cc->Components[root];
+    }
+}
+
+unsigned int Traversal_ConnectedComponents(const Csr *csr, unsigned int threads, uint32_t *components)
+{
+    PROFILE_ZONE("Traversal_ConnectedComponents");
+    assert(csr != NULL && components != NULL);
+    
+    _Components cc = { .Csr = csr, .Threads = Parallel_ThreadCount(threads), .Components = components };
+    cc.Parents = malloc(csr->Vertices * sizeof(uint32_t));
+    cc.Roots = malloc((cc.Threads + 1) * sizeof(unsigned int));
+    assert((csr->Vertices == 0 || cc.Parents != NULL) && cc.Roots != NULL);
+    
+    ParallelBarrier_Init(&cc.Barrier, cc.Threads);
+    Parallel_Run(cc.Threads, _Components_Thread, &cc);
+    ParallelBarrier_Destroy(&cc.Barrier);
+    
+    unsigned int count = cc.Roots[cc.Threads];
+    free(cc.Parents);
+    free(cc.Roots);
+    return count;
+}
@@ -0,0 +1,39 @@
+//
+//  Traversal.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Traversal_h
+#define Traversal_h
+
+#include <stdint.h>
+#include "Csr.h"
+
+/// The level of a vertex the search never reached
+#define TRAVERSAL_UNREACHED UINT32_MAX
+
+/// Breadth first search from the source over the rows of any size, level by level. Each level either expands the frontier
+/// top down, or has every unreached vertex look for a parent in it bottom up, whichever reads fewer edges.
+/// - Parameters:
+///   - out: the edges leaving each vertex
+///   - in: the edges entering each vertex, Csr_Transpose(out), or NULL to only search top down. For an undirected search
+///         pass rows holding both directions of every edge as out and in.
+///   - source: the vertex to start from
+///   - threads: the threads to search on, 0 for one per processor
+///   - levels: Vertices entries, set to the edges on a shortest path from the source, or TRAVERSAL_UNREACHED
+///   - parents: Vertices entries set to the vertex each was reached from, the source for itself, or NULL
+/// - Returns: The vertices reached, including the source
+unsigned int Traversal_BreadthFirst(const Csr *out, const Csr *in, VertexIndex source, unsigned int threads,
+                                    uint32_t *levels, VertexIndex *parents);
+
+/// The components of the rows, ignoring the direction of edges. Every thread joins the ends of its share of the edges
+/// in a lock free union find, so the rows are read once.
+/// - Parameters:
+///   - threads: the threads to join edges on, 0 for one per processor
+///   - components: Vertices entries, set to the component of each vertex, numbered from 0 in the order of their smallest vertex
+/// - Returns: The number of components
+unsigned int Traversal_ConnectedComponents(const Csr *csr, unsigned int threads, uint32_t *components);
+
+#endif /* Traversal_h */
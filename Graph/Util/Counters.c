@@ -0,0 +1,80 @@
+//
+//  Counters.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Counters.h"
+#include <stdio.h>
+#include <assert.h>
+
+atomic_ullong Counters_Values[COUNTER_KIND_COUNT];
+
+static const char *_CounterKindToName[COUNTER_KIND_COUNT] =
+{
+    [COUNTER_BVH_QUERIES] = "bvh_queries",
+    [COUNTER_BVH_NODES_VISITED] = "bvh_nodes_visited",
+    [COUNTER_BVH_PRIMITIVE_TESTS] = "bvh_primitive_tests",
+    [COUNTER_BVH_REBUILDS] = "bvh_rebuilds",
+    [COUNTER_BVH_REBUILD_NANOSECONDS] = "bvh_rebuild_ns",
+    [COUNTER_DEGREE_QUERIES] = "degree_queries",
+    [COUNTER_DEGREE_EDGES_SCANNED] = "degree_edges_scanned",
+    [COUNTER_MST_COMPUTATIONS] = "mst_computations",
+    [COUNTER_BYTES_GRAPH] = "bytes_graph",
+    [COUNTER_BYTES_BVH] = "bytes_bvh",
+    [COUNTER_BYTES_GRAPH_SKETCH] = "bytes_graph_sketch",
+    [COUNTER_BYTES_JOURNAL] = "bytes_journal",
+    [COUNTER_BYTES_ANALYTICS] = "bytes_analytics",
+    [COUNTER_BYTES_MATRIX_VIEW] = "bytes_matrix_view",
+};
+
+unsigned long long Counters_Get(CounterKind kind)
+{
+    assert(kind < COUNTER_KIND_COUNT);
+    return atomic_load_explicit(&Counters_Values[kind], memory_order_relaxed);
+}
+
+const char *Counters_Name(CounterKind kind)
+{
+    assert(kind < COUNTER_KIND_COUNT);
+    return _CounterKindToName[kind];
+}
+
+void Counters_Reset(void)
+{
+    for (int kind = 0; kind < COUNTER_KIND_COUNT; kind++)
+    {
+        atomic_store_explicit(&Counters_Values[kind], 0, memory_order_relaxed);
+    }
+}
+
+/// Writes numerator / denominator with two decimals, or 0 if nothing was counted
+static void _WriteAverage(OutputSink *sink, const char *name, CounterKind numerator, CounterKind denominator)
+{
+    unsigned long long count = Counters_Get(denominator);
+    char average[32];
+    snprintf(average, sizeof(average), "%.2f", count == 0 ? 0.0 : (double) Counters_Get(numerator) / count);
+    
+    OutputSink_WriteString(sink, name);
+    OutputSink_WriteChar(sink, ' ');
+    OutputSink_WriteString(sink, average);
+    OutputSink_WriteChar(sink, '\n');
+}
+
+void Counters_Write(OutputSink *sink)
+{
+    assert(sink != NULL);
+    
+    for (int kind = 0; kind < COUNTER_KIND_COUNT; kind++)
+    {
+        OutputSink_WriteString(sink, Counters_Name(kind));
+        OutputSink_WriteChar(sink, ' ');
+        OutputSink_WriteInt(sink, Counters_Get(kind));
+        OutputSink_WriteChar(sink, '\n');
+    }
+    _WriteAverage(sink, "bvh_nodes_per_query", COUNTER_BVH_NODES_VISITED, COUNTER_BVH_QUERIES);
+    _WriteAverage(sink, "bvh_primitive_tests_per_query", COUNTER_BVH_PRIMITIVE_TESTS, COUNTER_BVH_QUERIES);
+    _WriteAverage(sink, "bvh_rebuild_ns_per_rebuild", COUNTER_BVH_REBUILD_NANOSECONDS, COUNTER_BVH_REBUILDS);
+    _WriteAverage(sink, "degree_edges_per_query", COUNTER_DEGREE_EDGES_SCANNED, COUNTER_DEGREE_QUERIES);
+}
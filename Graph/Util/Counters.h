@@ -0,0 +1,64 @@
+//
+//  Counters.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Counters_h
+#define Counters_h
+
+#include <stdatomic.h>
+#include "OutputSink.h"
+
+typedef enum
+{
+    /// Bvh Tree collision checks, the nodes they visited and the primitive bounding boxes they tested
+    COUNTER_BVH_QUERIES,
+    COUNTER_BVH_NODES_VISITED,
+    COUNTER_BVH_PRIMITIVE_TESTS,
+    
+    /// Bvh Trees built from scratch, and the nanoseconds spent building them
+    COUNTER_BVH_REBUILDS,
+    COUNTER_BVH_REBUILD_NANOSECONDS,
+    
+    /// Graph_VertexDegree calls and the incidence matrix entries they scanned
+    COUNTER_DEGREE_QUERIES,
+    COUNTER_DEGREE_EDGES_SCANNED,
+    
+    /// Minimum spanning trees computed
+    COUNTER_MST_COMPUTATIONS,
+    
+    /// Bytes allocated by each subsystem since the counters were reset, whether freed since or not
+    COUNTER_BYTES_GRAPH,
+    COUNTER_BYTES_BVH,
+    COUNTER_BYTES_GRAPH_SKETCH,
+    COUNTER_BYTES_JOURNAL,
+    COUNTER_BYTES_ANALYTICS,
+    COUNTER_BYTES_MATRIX_VIEW,
+    
+    COUNTER_KIND_COUNT,
+} CounterKind;
+
+/// The value of every counter. Updated with relaxed atomics from any thread, read through Counters_Get.
+extern atomic_ullong Counters_Values[COUNTER_KIND_COUNT];
+
+/// Adds to a counter. Inline, so instrumenting a hot path costs a single relaxed atomic add.
+static inline void Counters_Add(CounterKind kind, unsigned long long amount)
+{
+    atomic_fetch_add_explicit(&Counters_Values[kind], amount, memory_order_relaxed);
+}
+
+/// - Returns: The current value of the counter
+unsigned long long Counters_Get(CounterKind kind);
+
+/// - Returns: The snake case name of the counter, as written by Counters_Write
+const char *Counters_Name(CounterKind kind);
+
+/// Sets every counter back to zero
+void Counters_Reset(void);
+
+/// Writes every counter as a "name value" line, followed by the per query averages
+void Counters_Write(OutputSink *sink);
+
+#endif /* Counters_h */
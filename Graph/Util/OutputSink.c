@@ -0,0 +1,204 @@
+//
+//  OutputSink.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "OutputSink.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <unistd.h>
+
+#define GROWABLE_BUFFER_INITIAL_CAPACITY 0x1000
+
+static OutputSink *_CreateOutputSink(OutputSinkKind kind)
+{
+    OutputSink *sink = malloc(sizeof(OutputSink));
+    sink->Kind = kind;
+    sink->Cursor = 0;
+    sink->HasError = false;
+    sink->Buffer = NULL;
+    sink->BufferSize = 0;
+    sink->BufferCapacity = 0;
+    sink->File = NULL;
+    sink->FileDescriptor = -1;
+    sink->StagingSize = 0;
+    return sink;
+}
+
+OutputSink *OutputSink_CreateGrowableBufferSink(void)
+{
+    OutputSink *sink = _CreateOutputSink(OUTPUT_SINK_GROWABLE_BUFFER);
+    sink->BufferCapacity = GROWABLE_BUFFER_INITIAL_CAPACITY;
+    sink->Buffer = malloc(sink->BufferCapacity);
+    sink->Buffer[0] = '\0';
+    return sink;
+}
+
+OutputSink *OutputSink_CreateFixedBufferSink(char *buffer, size_t capacity)
+{
+    assert(buffer != NULL);
+    assert(capacity > 0);
+    
+    OutputSink *sink = _CreateOutputSink(OUTPUT_SINK_FIXED_BUFFER);
+    sink->Buffer = buffer;
+    sink->BufferCapacity = capacity;
+    sink->Buffer[0] = '\0';
+    return sink;
+}
+
+OutputSink *OutputSink_CreateFileSink(FILE *file)
+{
+    assert(file != NULL);
+    
+    OutputSink *sink = _CreateOutputSink(OUTPUT_SINK_FILE);
+    sink->File = file;
+    return sink;
+}
+
+OutputSink *OutputSink_CreateFileDescriptorSink(int fd)
+{
+    assert(fd >= 0);
+    
+    OutputSink *sink = _CreateOutputSink(OUTPUT_SINK_FILE_DESCRIPTOR);
+    sink->FileDescriptor = fd;
+    return sink;
+}
+
+void OutputSink_FreeOutputSink(OutputSink *sink)
+{
+    assert(sink != NULL);
+    
+    OutputSink_Flush(sink);
+    if (sink->Kind == OUTPUT_SINK_GROWABLE_BUFFER)
+    {
+        free(sink->Buffer);
+    }
+    free(sink);
+}
+
+static void _WriteFileDescriptor(OutputSink *sink, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written = write(sink->FileDescriptor, data, size);
+        
+        // A signal arriving before anything was written is no failure, the write is tried again
+        if (written < 0 && errno == EINTR) continue;
+        if (written < 0)
+        {
+            sink->HasError = true;
+            return;
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+static void _WriteBuffer(OutputSink *sink, const char *data, size_t size)
+{
+    // Keep room for the null terminator
+    if (sink->BufferSize + size + 1 > sink->BufferCapacity)
+    {
+        if (sink->Kind == OUTPUT_SINK_FIXED_BUFFER)
+        {
+            sink->HasError = true;
+            size = sink->BufferCapacity - sink->BufferSize - 1;
+        }
+        else
+        {
+            while (sink->BufferSize + size + 1 > sink->BufferCapacity)
+            {
+                sink->BufferCapacity *= 2;
+            }
+            sink->Buffer = realloc(sink->Buffer, sink->BufferCapacity);
+        }
+    }
+    
+    memcpy(sink->Buffer + sink->BufferSize, data, size);
+    sink->BufferSize += size;
+    sink->Buffer[sink->BufferSize] = '\0';
+}
+
+void OutputSink_Write(OutputSink *sink, const char *data, size_t size)
+{
+    assert(sink != NULL);
+    sink->Cursor += size;
+    
+    switch (sink->Kind)
+    {
+        case OUTPUT_SINK_GROWABLE_BUFFER:
+        case OUTPUT_SINK_FIXED_BUFFER:
+            _WriteBuffer(sink, data, size);
+            break;
+        
+        case OUTPUT_SINK_FILE:
+            if (fwrite(data, 1, size, sink->File) != size) sink->HasError = true;
+            break;
+        
+        case OUTPUT_SINK_FILE_DESCRIPTOR:
+            if (sink->StagingSize + size > OUTPUT_SINK_STAGING_SIZE)
+            {
+                OutputSink_Flush(sink);
+            }
+            if (size >= OUTPUT_SINK_STAGING_SIZE)
+            {
+                _WriteFileDescriptor(sink, data, size);
+                break;
+            }
+            memcpy(sink->Staging + sink->StagingSize, data, size);
+            sink->StagingSize += size;
+            break;
+    }
+}
+
+void OutputSink_WriteString(OutputSink *sink, const char *str)
+{
+    OutputSink_Write(sink, str, strlen(str));
+}
+
+void OutputSink_WriteChar(OutputSink *sink, char c)
+{
+    OutputSink_Write(sink, &c, 1);
+}
+
+void OutputSink_WriteInt(OutputSink *sink, long long value)
+{
+    // Enough for the sign and every digit of the smallest long long
+    char digits[21];
+    size_t i = sizeof(digits);
+    
+    unsigned long long magnitude = value < 0 ? -(unsigned long long) value : (unsigned long long) value;
+    do
+    {
+        digits[--i] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    
+    if (value < 0)
+    {
+        digits[--i] = '-';
+    }
+    
+    OutputSink_Write(sink, digits + i, sizeof(digits) - i);
+}
+
+void OutputSink_Flush(OutputSink *sink)
+{
+    assert(sink != NULL);
+    
+    if (sink->Kind == OUTPUT_SINK_FILE)
+    {
+        if (fflush(sink->File) != 0) sink->HasError = true;
+        return;
+    }
+    
+    if (sink->Kind == OUTPUT_SINK_FILE_DESCRIPTOR && sink->StagingSize > 0)
+    {
+        _WriteFileDescriptor(sink, sink->Staging, sink->StagingSize);
+        sink->StagingSize = 0;
+    }
+}
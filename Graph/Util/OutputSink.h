@@ -0,0 +1,84 @@
+//
+//  OutputSink.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef OutputSink_h
+#define OutputSink_h
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define OUTPUT_SINK_STAGING_SIZE 0x1000
+
+typedef enum
+{
+    /// A heap buffer that doubles when full
+    OUTPUT_SINK_GROWABLE_BUFFER,
+    
+    /// A caller owned buffer, output past its capacity is dropped
+    OUTPUT_SINK_FIXED_BUFFER,
+    
+    OUTPUT_SINK_FILE,
+    OUTPUT_SINK_FILE_DESCRIPTOR,
+} OutputSinkKind;
+
+/// A destination for streamed text output with a tracked write cursor
+typedef struct
+{
+    OutputSinkKind Kind;
+    
+    /// The amount of bytes written through the sink, including any dropped by a fixed buffer
+    size_t Cursor;
+    
+    /// True if a write to the underlying file failed or a fixed buffer overflowed
+    bool HasError;
+    
+    /// The buffer of a buffer sink, always null terminated
+    char *Buffer;
+    size_t BufferSize;
+    size_t BufferCapacity;
+    
+    FILE *File;
+    
+    /// Small writes to a file descriptor are staged so each write(2) is large
+    int FileDescriptor;
+    char Staging[OUTPUT_SINK_STAGING_SIZE];
+    size_t StagingSize;
+} OutputSink;
+
+/// Creates a sink that writes into a heap buffer that grows as needed
+OutputSink *OutputSink_CreateGrowableBufferSink(void);
+
+/// Creates a sink that writes into a caller owned buffer of the given capacity (including the null terminator).
+/// Output that does not fit is dropped and the sink is marked with an error.
+OutputSink *OutputSink_CreateFixedBufferSink(char *buffer, size_t capacity);
+
+/// Creates a sink that writes to an open file. The file is not closed when the sink is freed.
+OutputSink *OutputSink_CreateFileSink(FILE *file);
+
+/// Creates a sink that writes to an open file descriptor. The descriptor is not closed when the sink is freed.
+OutputSink *OutputSink_CreateFileDescriptorSink(int fd);
+
+/// Flushes and frees the sink, including the buffer of a growable buffer sink
+void OutputSink_FreeOutputSink(OutputSink *sink);
+
+/// Writes size bytes of data to the sink
+void OutputSink_Write(OutputSink *sink, const char *data, size_t size);
+
+/// Writes a null terminated string to the sink
+void OutputSink_WriteString(OutputSink *sink, const char *str);
+
+/// Writes a single character to the sink
+void OutputSink_WriteChar(OutputSink *sink, char c);
+
+/// Writes the decimal representation of value to the sink
+void OutputSink_WriteInt(OutputSink *sink, long long value);
+
+/// Pushes staged output to the underlying file or file descriptor
+void OutputSink_Flush(OutputSink *sink);
+
+#endif /* OutputSink_h */
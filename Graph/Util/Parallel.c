@@ -0,0 +1,96 @@
+//
+//  Parallel.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Parallel.h"
+#include <stdlib.h>
+#include <assert.h>
+#include "WorkerPool.h"
+
+typedef struct
+{
+    ParallelFunction Run;
+    void *Context;
+    unsigned int Thread;
+} _ParallelThread;
+
+static void *_Parallel_ThreadMain(void *arg)
+{
+    _ParallelThread *thread = arg;
+    thread->Run(thread->Context, thread->Thread);
+    return NULL;
+}
+
+unsigned int Parallel_ThreadCount(unsigned int requested)
+{
+    // The pool keeps a core for the main thread, which does its share here
+    return requested > 0 ? requested : (unsigned int) WorkerPool_DefaultThreadCount() + 1;
+}
+
+void Parallel_Run(unsigned int threads, ParallelFunction run, void *context)
+{
+    assert(threads > 0);
+    assert(run != NULL);
+    
+    pthread_t *handles = malloc(sizeof(pthread_t) * threads);
+    _ParallelThread *arguments = malloc(sizeof(_ParallelThread) * threads);
+    for (unsigned int i = 1; i < threads; i++)
+    {
+        arguments[i] = (_ParallelThread) { .Run = run, .Context = context, .Thread = i };
+        pthread_create(&handles[i], NULL, _Parallel_ThreadMain, &arguments[i]);
+    }
+    run(context, 0);
+    for (unsigned int i = 1; i < threads; i++)
+    {
+        pthread_join(handles[i], NULL);
+    }
+    free(arguments);
+    free(handles);
+}
+
+void ParallelBarrier_Init(ParallelBarrier *barrier, unsigned int threads)
+{
+    assert(barrier != NULL);
+    assert(threads > 0);
+    pthread_mutex_init(&barrier->Mutex, NULL);
+    pthread_cond_init(&barrier->HasArrived, NULL);
+    barrier->Threads = threads;
+    barrier->Waiting = 0;
+    barrier->Generation = 0;
+}
+
+void ParallelBarrier_Destroy(ParallelBarrier *barrier)
+{
+    assert(barrier != NULL);
+    pthread_cond_destroy(&barrier->HasArrived);
+    pthread_mutex_destroy(&barrier->Mutex);
+}
+
+bool ParallelBarrier_Wait(ParallelBarrier *barrier)
+{
+    assert(barrier != NULL);
+    if (barrier->Threads == 1) return true;
+    
+    pthread_mutex_lock(&barrier->Mutex);
+    unsigned long generation = barrier->Generation;
+    bool isLast = ++barrier->Waiting == barrier->Threads;
+    if (isLast)
+    {
+        barrier->Waiting = 0;
+        barrier->Generation++;
+        pthread_cond_broadcast(&barrier->HasArrived);
+    }
+    else
+    {
+        // The generation tells a spurious wake up from the release of this wait
+        while (generation == barrier->Generation)
+        {
+            pthread_cond_wait(&barrier->HasArrived, &barrier->Mutex);
+        }
+    }
+    pthread_mutex_unlock(&barrier->Mutex);
+    return isLast;
+}
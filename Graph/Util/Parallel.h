@@ -0,0 +1,53 @@
+//
+//  Parallel.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Parallel_h
+#define Parallel_h
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/// Holds threads until every one of them has arrived, so they can move from one step of an algorithm to the next together
+typedef struct
+{
+    pthread_mutex_t Mutex;
+    pthread_cond_t HasArrived;
+    unsigned int Threads;
+    unsigned int Waiting;
+    unsigned long Generation;
+} ParallelBarrier;
+
+/// The work of one thread of Parallel_Run
+/// - Parameters:
+///   - context: passed through from Parallel_Run
+///   - thread: the thread, from 0 up to threads
+typedef void (*ParallelFunction)(void *context, unsigned int thread);
+
+/// - Returns: The threads to run on, requested if not 0, otherwise one per processor
+unsigned int Parallel_ThreadCount(unsigned int requested);
+
+/// - Returns: The first of count items in the share of the thread, so thread + 1 gives the end of the share
+static inline size_t Parallel_RangeStart(size_t count, unsigned int thread, unsigned int threads)
+{
+    return (size_t) ((unsigned __int128) count * thread / threads);
+}
+
+/// Runs the function on threads threads at once and waits for all of them. The calling thread is thread 0,
+/// so a single thread runs without creating any.
+void Parallel_Run(unsigned int threads, ParallelFunction run, void *context);
+
+/// Creates a barrier for the threads
+void ParallelBarrier_Init(ParallelBarrier *barrier, unsigned int threads);
+
+void ParallelBarrier_Destroy(ParallelBarrier *barrier);
+
+/// Waits until every thread has called it
+/// - Returns: true on exactly one of the threads, so it can do the serial work between two waits
+bool ParallelBarrier_Wait(ParallelBarrier *barrier);
+
+#endif /* Parallel_h */
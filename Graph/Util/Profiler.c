@@ -0,0 +1,152 @@
+//
+//  Profiler.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Profiler.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <assert.h>
+
+/// Every thread that has recorded a zone. Threads are pushed on first use and live until the process exits,
+/// so their zones can still be exported after a worker stops.
+static _Atomic(ProfilerThread *) _Threads = NULL;
+static atomic_uint _NextThreadId = 0;
+static _Thread_local ProfilerThread *_CurrentThread = NULL;
+
+/// Only touched by the thread marking frames
+static ProfilerFrames _Frames;
+static unsigned long long _FrameStart;
+static unsigned long _FrameHead;
+
+unsigned long long Profiler_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long) now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+static ProfilerThread *_ProfilerThread_Current(void)
+{
+    if (_CurrentThread != NULL) return _CurrentThread;
+    
+    ProfilerThread *thread = calloc(1, sizeof(ProfilerThread));
+    thread->Id = atomic_fetch_add(&_NextThreadId, 1);
+    thread->Next = atomic_load(&_Threads);
+    while (!atomic_compare_exchange_weak(&_Threads, &thread->Next, thread));
+    
+    _CurrentThread = thread;
+    return thread;
+}
+
+ProfilerZone Profiler_BeginZone(const char *name)
+{
+    return (ProfilerZone) {.Name = name, .Start = Profiler_Now()};
+}
+
+void Profiler_EndZone(ProfilerZone *zone)
+{
+    ProfilerThread *thread = _ProfilerThread_Current();
+    unsigned long head = atomic_load_explicit(&thread->Head, memory_order_relaxed);
+    thread->Events[head % PROFILER_RING_SIZE] = (ProfilerEvent) {zone->Name, zone->Start, Profiler_Now()};
+    
+    // Publish the event to readers
+    atomic_store_explicit(&thread->Head, head + 1, memory_order_release);
+}
+
+void Profiler_BeginFrame(void)
+{
+    _FrameStart = Profiler_Now();
+    _FrameHead = atomic_load_explicit(&_ProfilerThread_Current()->Head, memory_order_relaxed);
+}
+
+static int _CompareZoneTotals(const void *a, const void *b)
+{
+    unsigned long long x = ((const ProfilerZoneTotal *) a)->Total;
+    unsigned long long y = ((const ProfilerZoneTotal *) b)->Total;
+    return (x < y) - (x > y);
+}
+
+void Profiler_EndFrame(void)
+{
+    unsigned long long end = Profiler_Now();
+    _Frames.Durations[_Frames.Count++ % PROFILER_FRAME_HISTORY] = end - _FrameStart;
+    
+    // Total the zones that ended on this thread during the frame, nested zones are counted in their parents too
+    ProfilerThread *thread = _ProfilerThread_Current();
+    unsigned long head = atomic_load_explicit(&thread->Head, memory_order_relaxed);
+    unsigned long first = head - _FrameHead > PROFILER_RING_SIZE ? head - PROFILER_RING_SIZE : _FrameHead;
+    
+    _Frames.ZoneCount = 0;
+    for (unsigned long i = first; i < head; i++)
+    {
+        const ProfilerEvent *event = &thread->Events[i % PROFILER_RING_SIZE];
+        size_t z = 0;
+        while (z < _Frames.ZoneCount && _Frames.Zones[z].Name != event->Name) z++;
+        if (z == _Frames.ZoneCount)
+        {
+            if (z == PROFILER_MAX_FRAME_ZONES) continue;
+            _Frames.Zones[_Frames.ZoneCount++] = (ProfilerZoneTotal) {.Name = event->Name, .Total = 0};
+        }
+        _Frames.Zones[z].Total += event->End - event->Start;
+    }
+    qsort(_Frames.Zones, _Frames.ZoneCount, sizeof(ProfilerZoneTotal), _CompareZoneTotals);
+}
+
+const ProfilerFrames *Profiler_Frames(void)
+{
+    return &_Frames;
+}
+
+/// Writes nanoseconds as the microseconds trace events are measured in
+static void _WriteMicroseconds(OutputSink *sink, unsigned long long nanoseconds)
+{
+    char number[32];
+    snprintf(number, sizeof(number), "%llu.%03llu", nanoseconds / 1000, nanoseconds % 1000);
+    OutputSink_WriteString(sink, number);
+}
+
+void Profiler_WriteTrace(OutputSink *sink)
+{
+    assert(sink != NULL);
+    
+    ProfilerEvent *events = malloc(PROFILER_RING_SIZE * sizeof(ProfilerEvent));
+    bool isFirst = true;
+    
+    OutputSink_WriteString(sink, "{\"traceEvents\": [");
+    for (ProfilerThread *thread = atomic_load(&_Threads); thread != NULL; thread = thread->Next)
+    {
+        unsigned long head = atomic_load_explicit(&thread->Head, memory_order_acquire);
+        unsigned long copied = head > PROFILER_RING_SIZE ? head - PROFILER_RING_SIZE : 0;
+        for (unsigned long i = copied; i < head; i++)
+        {
+            events[i - copied] = thread->Events[i % PROFILER_RING_SIZE];
+        }
+        
+        // The thread kept recording while its ring was copied, drop whatever it overwrote
+        unsigned long after = atomic_load_explicit(&thread->Head, memory_order_acquire);
+        unsigned long first = after - copied > PROFILER_RING_SIZE ? after - PROFILER_RING_SIZE : copied;
+        
+        for (unsigned long i = first; i < head; i++)
+        {
+            const ProfilerEvent *event = &events[i - copied];
+            OutputSink_WriteString(sink, isFirst ? "\n  " : ",\n  ");
+            OutputSink_WriteString(sink, "{\"name\": \"");
+            OutputSink_WriteString(sink, event->Name);
+            OutputSink_WriteString(sink, "\", \"ph\": \"X\", \"pid\": 1, \"tid\": ");
+            OutputSink_WriteInt(sink, thread->Id);
+            OutputSink_WriteString(sink, ", \"ts\": ");
+            _WriteMicroseconds(sink, event->Start);
+            OutputSink_WriteString(sink, ", \"dur\": ");
+            _WriteMicroseconds(sink, event->End - event->Start);
+            OutputSink_WriteChar(sink, '}');
+            isFirst = false;
+        }
+    }
+    OutputSink_WriteString(sink, "\n]}\n");
+    
+    free(events);
+}
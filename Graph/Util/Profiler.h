@@ -0,0 +1,111 @@
+//
+//  Profiler.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "OutputSink.h"
+
+/// Zones each thread keeps before the oldest are overwritten
+#define PROFILER_RING_SIZE 4096
+
+/// Frames kept for the frame time overlay
+#define PROFILER_FRAME_HISTORY 120
+
+/// Distinct zones totalled per frame, the rest are dropped from the totals
+#define PROFILER_MAX_FRAME_ZONES 16
+
+/// A timed zone that has ended
+typedef struct
+{
+    /// A string literal, compared by address
+    const char *Name;
+    unsigned long long Start;
+    unsigned long long End;
+} ProfilerEvent;
+
+/// The zones of one thread. Only the owning thread writes, any thread may read the events before Head.
+typedef struct ProfilerThread
+{
+    ProfilerEvent Events[PROFILER_RING_SIZE];
+    
+    /// Total events written, the next is written at Head % PROFILER_RING_SIZE
+    atomic_ulong Head;
+    
+    unsigned int Id;
+    struct ProfilerThread *Next;
+} ProfilerThread;
+
+/// A zone being timed
+typedef struct
+{
+    const char *Name;
+    unsigned long long Start;
+} ProfilerZone;
+
+/// Time spent in one zone over the last frame
+typedef struct
+{
+    const char *Name;
+    unsigned long long Total;
+} ProfilerZoneTotal;
+
+/// The frames of the thread calling Profiler_BeginFrame and Profiler_EndFrame
+typedef struct
+{
+    /// Durations of the last frames, the latest at (Count - 1) % PROFILER_FRAME_HISTORY
+    unsigned long long Durations[PROFILER_FRAME_HISTORY];
+    unsigned long Count;
+    
+    /// Zones of the last complete frame, by total time
+    ProfilerZoneTotal Zones[PROFILER_MAX_FRAME_ZONES];
+    size_t ZoneCount;
+} ProfilerFrames;
+
+/// - Returns: Nanoseconds on a monotonic clock
+unsigned long long Profiler_Now(void);
+
+/// Starts timing a zone on the calling thread
+ProfilerZone Profiler_BeginZone(const char *name);
+
+/// Records the zone into the ring of the calling thread
+void Profiler_EndZone(ProfilerZone *zone);
+
+/// Marks the start of a frame on the calling thread
+void Profiler_BeginFrame(void);
+
+/// Marks the end of the frame, totalling the zones it ran
+void Profiler_EndFrame(void);
+
+/// - Returns: The frame history of the thread marking frames
+const ProfilerFrames *Profiler_Frames(void);
+
+/// Writes every zone still held by every thread as Chrome trace event JSON, viewable in chrome://tracing or Perfetto
+void Profiler_WriteTrace(OutputSink *sink);
+
+// Zones compile to nothing with PROFILER_DISABLED defined
+#ifndef PROFILER_DISABLED
+
+/// Times the rest of the enclosing scope as a zone
+#define PROFILE_ZONE(name) \
+    ProfilerZone _ProfilerZone __attribute__((cleanup(Profiler_EndZone))) = Profiler_BeginZone(name)
+
+#define PROFILE_BEGIN_FRAME() Profiler_BeginFrame()
+#define PROFILE_END_FRAME() Profiler_EndFrame()
+
+#else
+
+#define PROFILE_ZONE(name) ((void) 0)
+#define PROFILE_BEGIN_FRAME() ((void) 0)
+#define PROFILE_END_FRAME() ((void) 0)
+
+#endif
+
+#endif /* Profiler_h */
@@ -0,0 +1,38 @@
+//
+//  Random.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "Random.h"
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+
+void Random_Seed(Random *r, uint64_t seed)
+{
+    assert(r != NULL);
+    for (int i = 0; i < 4; i++)
+    {
+        seed += 0x9E3779B97F4A7C15ull;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        r->State[i] = z ^ (z >> 31);
+    }
+}
+
+uint64_t Random_Geometric(Random *r, double p)
+{
+    assert(p > 0 && p < 1);
+    
+    // Inverts the distribution function, 1 - u is never 0
+    double skip = floor(log1p(-Random_Double(r)) / log1p(-p));
+    return skip >= 0x1.0p63 ? UINT64_MAX : (uint64_t) skip;
+}
+
+double Random_Exponential(Random *r, double mean)
+{
+    return -log1p(-Random_Double(r)) * mean;
+}
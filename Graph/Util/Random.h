@@ -0,0 +1,72 @@
+//
+//  Random.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef Random_h
+#define Random_h
+
+#include <stdint.h>
+
+/// A xoshiro256** generator. The same seed gives the same sequence on every platform.
+typedef struct
+{
+    uint64_t State[4];
+} Random;
+
+/// Seeds the generator, spreading the seed over the state with splitmix64
+void Random_Seed(Random *r, uint64_t seed);
+
+static inline uint64_t _Random_Rotate(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+/// - Returns: The next 64 random bits
+static inline uint64_t Random_Next(Random *r)
+{
+    uint64_t *s = r->State;
+    uint64_t result = _Random_Rotate(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = _Random_Rotate(s[3], 45);
+    return result;
+}
+
+/// - Returns: A uniform double in [0, 1)
+static inline double Random_Double(Random *r)
+{
+    return (Random_Next(r) >> 11) * 0x1.0p-53;
+}
+
+/// - Returns: A uniform integer in [0, bound), without the bias of a modulo
+static inline uint64_t Random_Below(Random *r, uint64_t bound)
+{
+    // Lemire's multiply and reject, the rejection is rare unless bound is close to 2^64
+    unsigned __int128 product = (unsigned __int128) Random_Next(r) * bound;
+    uint64_t low = (uint64_t) product;
+    if (low < bound)
+    {
+        uint64_t threshold = -bound % bound;
+        while (low < threshold)
+        {
+            product = (unsigned __int128) Random_Next(r) * bound;
+            low = (uint64_t) product;
+        }
+    }
+    return (uint64_t) (product >> 64);
+}
+
+/// - Returns: The number of failures before the first success of trials that each succeed with probability p, 0 < p < 1
+uint64_t Random_Geometric(Random *r, double p);
+
+/// - Returns: An exponentially distributed double with the given mean
+double Random_Exponential(Random *r, double mean);
+
+#endif /* Random_h */
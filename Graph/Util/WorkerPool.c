@@ -0,0 +1,144 @@
+//
+//  WorkerPool.c
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include "WorkerPool.h"
+#include <stdlib.h>
+#include <assert.h>
+#include <unistd.h>
+
+size_t WorkerPool_DefaultThreadCount(void)
+{
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return processors > 2 ? processors - 1 : 1;
+}
+
+static void *_WorkerPool_WorkerLoop(void *arg)
+{
+    WorkerPool *wp = arg;
+    
+    while (true)
+    {
+        pthread_mutex_lock(&wp->Mutex);
+        while (wp->Head == NULL && !wp->IsShuttingDown)
+        {
+            pthread_cond_wait(&wp->HasJobs, &wp->Mutex);
+        }
+        if (wp->Head == NULL)
+        {
+            pthread_mutex_unlock(&wp->Mutex);
+            return NULL;
+        }
+        
+        WorkerJob *job = wp->Head;
+        wp->Head = job->Next;
+        if (wp->Head == NULL) wp->Tail = NULL;
+        pthread_mutex_unlock(&wp->Mutex);
+        
+        if (atomic_load(&job->IsCancelRequested))
+        {
+            atomic_store(&job->State, WORKER_JOB_CANCELLED);
+            continue;
+        }
+        
+        atomic_store(&job->State, WORKER_JOB_RUNNING);
+        job->Run(job);
+        
+        // Nothing touches the job after its state, as the submitter may free it as soon as it is finished
+        atomic_store(&job->State, atomic_load(&job->IsCancelRequested) ? WORKER_JOB_CANCELLED : WORKER_JOB_DONE);
+    }
+}
+
+WorkerPool *WorkerPool_CreateWorkerPool(size_t threadCount)
+{
+    assert(threadCount > 0);
+    
+    WorkerPool *wp = malloc(sizeof(WorkerPool));
+    wp->ThreadCount = threadCount;
+    wp->Threads = malloc(sizeof(pthread_t) * threadCount);
+    wp->Head = NULL;
+    wp->Tail = NULL;
+    wp->IsShuttingDown = false;
+    pthread_mutex_init(&wp->Mutex, NULL);
+    pthread_cond_init(&wp->HasJobs, NULL);
+    
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        pthread_create(&wp->Threads[i], NULL, _WorkerPool_WorkerLoop, wp);
+    }
+    
+    return wp;
+}
+
+void WorkerPool_FreeWorkerPool(WorkerPool *wp)
+{
+    assert(wp != NULL);
+    
+    pthread_mutex_lock(&wp->Mutex);
+    for (WorkerJob *job = wp->Head; job != NULL; job = job->Next)
+    {
+        atomic_store(&job->IsCancelRequested, true);
+    }
+    wp->IsShuttingDown = true;
+    pthread_cond_broadcast(&wp->HasJobs);
+    pthread_mutex_unlock(&wp->Mutex);
+    
+    for (size_t i = 0; i < wp->ThreadCount; i++)
+    {
+        pthread_join(wp->Threads[i], NULL);
+    }
+    
+    pthread_cond_destroy(&wp->HasJobs);
+    pthread_mutex_destroy(&wp->Mutex);
+    free(wp->Threads);
+    free(wp);
+}
+
+WorkerJob WorkerJob_CreateWorkerJob(WorkerJobFunction run, void *context)
+{
+    WorkerJob job = { .Run = run, .Context = context, .Next = NULL };
+    atomic_init(&job.State, WORKER_JOB_QUEUED);
+    atomic_init(&job.IsCancelRequested, false);
+    return job;
+}
+
+void WorkerPool_Submit(WorkerPool *wp, WorkerJob *job)
+{
+    assert(wp != NULL);
+    assert(job != NULL);
+    
+    atomic_store(&job->State, WORKER_JOB_QUEUED);
+    job->Next = NULL;
+    
+    pthread_mutex_lock(&wp->Mutex);
+    if (wp->Tail == NULL)
+    {
+        wp->Head = job;
+    }
+    else
+    {
+        wp->Tail->Next = job;
+    }
+    wp->Tail = job;
+    pthread_cond_signal(&wp->HasJobs);
+    pthread_mutex_unlock(&wp->Mutex);
+}
+
+void WorkerJob_Cancel(WorkerJob *job)
+{
+    atomic_store(&job->IsCancelRequested, true);
+}
+
+bool WorkerJob_IsCancelRequested(WorkerJob *job)
+{
+    return atomic_load(&job->IsCancelRequested);
+}
+
+bool WorkerJob_IsFinished(WorkerJob *job)
+{
+    WorkerJobState state = atomic_load(&job->State);
+    return state == WORKER_JOB_DONE || state == WORKER_JOB_CANCELLED;
+}
@@ -0,0 +1,84 @@
+//
+//  WorkerPool.h
+//  Graph
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef WorkerPool_h
+#define WorkerPool_h
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum
+{
+    WORKER_JOB_QUEUED,
+    WORKER_JOB_RUNNING,
+    WORKER_JOB_DONE,
+    
+    /// The job was cancelled before it started, or stopped early after observing a cancel request
+    WORKER_JOB_CANCELLED,
+} WorkerJobState;
+
+typedef struct WorkerJob WorkerJob;
+
+/// The work of a job, run on a worker thread. Long running work should poll WorkerJob_IsCancelRequested.
+typedef void (*WorkerJobFunction)(WorkerJob *job);
+
+/// A unit of work submitted to a worker pool. The memory of the job is owned by the submitter, and must
+/// stay alive until WorkerJob_IsFinished.
+struct WorkerJob
+{
+    WorkerJobFunction Run;
+    
+    /// Passed through to Run
+    void *Context;
+    
+    _Atomic(WorkerJobState) State;
+    atomic_bool IsCancelRequested;
+    
+    /// The next job in the queue
+    WorkerJob *Next;
+};
+
+/// A fixed amount of threads pulling jobs from a FIFO queue
+typedef struct
+{
+    pthread_t *Threads;
+    size_t ThreadCount;
+    
+    pthread_mutex_t Mutex;
+    pthread_cond_t HasJobs;
+    WorkerJob *Head;
+    WorkerJob *Tail;
+    bool IsShuttingDown;
+} WorkerPool;
+
+/// - Returns: One less than the amount of online processors, so the main thread keeps a core, and at least 1
+size_t WorkerPool_DefaultThreadCount(void);
+
+/// Creates a pool of threads waiting for jobs
+WorkerPool *WorkerPool_CreateWorkerPool(size_t threadCount);
+
+/// Cancels every queued job, waits for running jobs to finish and frees the pool
+void WorkerPool_FreeWorkerPool(WorkerPool *wp);
+
+/// Creates a job that runs the function with the given context
+WorkerJob WorkerJob_CreateWorkerJob(WorkerJobFunction run, void *context);
+
+/// Queues a job to be run on the next free worker
+void WorkerPool_Submit(WorkerPool *wp, WorkerJob *job);
+
+/// Asks a job to stop. A queued job will never run, a running job stops the next time it checks.
+void WorkerJob_Cancel(WorkerJob *job);
+
+/// - Returns: If the job has been asked to stop
+bool WorkerJob_IsCancelRequested(WorkerJob *job);
+
+/// - Returns: If the job is done or cancelled, after which its memory may be freed
+bool WorkerJob_IsFinished(WorkerJob *job);
+
+#endif /* WorkerPool_h */
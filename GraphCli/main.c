@@ -0,0 +1,1089 @@
+//
+//  main.c
+//  GraphCli
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <limits.h>
+#include "Graph.h"
+#include "Generators.h"
+#include "Import.h"
+#include "GraphFile.h"
+#include "Traversal.h"
+#include "ShortestPaths.h"
+#include "AllPairs.h"
+#include "Biconnected.h"
+#include "Directed.h"
+#include "Euler.h"
+#include "Coloring.h"
+#include "Clique.h"
+#include "Flow.h"
+#include "Matching.h"
+#include "Util/Counters.h"
+#include "Util/WorkerPool.h"
+
+#define EXIT_USAGE 2
+#define GENERATOR_MAX_ARGUMENTS 3
+
+/// Vertices past which the packed adjacency the clique searches need would take too much memory, 32 MB at this size
+#define CLI_MATRIX_MAX_VERTICES 16384
+
+typedef void (*CliAnalytic)(Graph *g, OutputSink *out);
+
+/// Streams a matrix of the graph in the format picked with -f
+typedef void (*CliMatrixWriter)(const Graph *g, OutputSink *sink, GraphDumpFormat format);
+
+/// An analytic, either run on the graph or a matrix written under its name
+typedef struct
+{
+    const char *Name;
+    CliAnalytic Run;
+    CliMatrixWriter WriteMatrix;
+} CliAnalyticEntry;
+
+static void _RunSummary(Graph *g, OutputSink *out)
+{
+    OutputSink_WriteString(out, "vertices: ");
+    OutputSink_WriteInt(out, g->Vertices);
+    OutputSink_WriteString(out, "\nedges: ");
+    OutputSink_WriteInt(out, g->Edges);
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunDegrees(Graph *g, OutputSink *out)
+{
+    OutputSink_WriteString(out, "degrees:");
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, Graph_VertexDegree(g, v));
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunMst(Graph *g, OutputSink *out)
+{
+    EdgeIndex edges[GRAPH_MAX_SIZE];
+    edges[0] = MST_NO_EDGE;
+    if (g->Vertices > 1 && g->Edges > 0) Graph_MinSpanningTree(g, edges);
+    
+    long long weight = 0;
+    OutputSink_WriteString(out, "mst:");
+    for (int i = 0; i < GRAPH_MAX_SIZE && edges[i] != MST_NO_EDGE; i++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, edges[i]);
+        
+        // The weight of an edge is the entry of the vertex it is directed from
+        for (VertexIndex v = 0; v < g->Vertices; v++)
+        {
+            if (g->IncidenceMatrix[v][edges[i]] > 0) weight += g->IncidenceMatrix[v][edges[i]];
+        }
+    }
+    OutputSink_WriteString(out, "\nmst weight: ");
+    OutputSink_WriteInt(out, weight);
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunComponents(Graph *g, OutputSink *out)
+{
+    unsigned int components[GRAPH_MAX_SIZE];
+    unsigned int count = Graph_ConnectedComponents(g, components);
+    
+    OutputSink_WriteString(out, "components: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, "\ncomponent of each vertex:");
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, components[v]);
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunPaths(Graph *g, OutputSink *out)
+{
+    OutputSink_WriteString(out, "distances from 0:");
+    if (g->Vertices > 0)
+    {
+        EdgeList *el = EdgeList_FromGraph(g);
+        Csr *csr = Csr_FromEdgeList(el);
+        uint64_t distances[GRAPH_MAX_SIZE];
+        ShortestPaths_Dijkstra(csr, 0, distances, NULL, NULL);
+        for (VertexIndex v = 0; v < g->Vertices; v++)
+        {
+            OutputSink_WriteChar(out, ' ');
+            if (distances[v] == SHORTEST_PATHS_UNREACHED) OutputSink_WriteChar(out, '-');
+            else OutputSink_WriteInt(out, distances[v]);
+        }
+        Csr_FreeCsr(csr);
+        EdgeList_FreeEdgeList(el);
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunBridges(Graph *g, OutputSink *out)
+{
+    EdgeIndex bridges[GRAPH_MAX_SIZE];
+    bool isCutVertex[GRAPH_MAX_SIZE];
+    unsigned int count = Graph_BridgesAndCutVertices(g, bridges, isCutVertex);
+    
+    OutputSink_WriteString(out, "biconnected components: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, "\nbridges:");
+    for (int i = 0; bridges[i] != MST_NO_EDGE; i++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, bridges[i]);
+    }
+    OutputSink_WriteString(out, "\ncut vertices:");
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        if (!isCutVertex[v]) continue;
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, v);
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+static void _RunScc(Graph *g, OutputSink *out)
+{
+    unsigned int components[GRAPH_MAX_SIZE];
+    unsigned int count = Graph_StronglyConnectedComponents(g, components);
+    
+    OutputSink_WriteString(out, "strong components: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, "\nstrong component of each vertex:");
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, components[v]);
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+/// Writes the size of the condensation of the rows and the weight of its critical path, the same for graphs of any size
+static void _WriteCondensation(const Csr *csr, OutputSink *out)
+{
+    uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+    unsigned int count = Directed_StronglyConnectedComponents(csr, components);
+    Csr *condensation = Directed_Condensation(csr, components, count);
+    
+    // The components are numbered in topological order already
+    VertexIndex *order = malloc(count * sizeof(VertexIndex));
+    uint64_t *lengths = malloc(count * sizeof(uint64_t));
+    for (VertexIndex c = 0; c < count; c++) order[c] = c;
+    VertexIndex end = count > 0 ? Directed_CriticalPath(condensation, order, lengths, NULL, NULL) : 0;
+    
+    OutputSink_WriteString(out, "condensation vertices: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, "\ncondensation edges: ");
+    OutputSink_WriteInt(out, condensation->Count);
+    OutputSink_WriteString(out, "\ncritical path weight: ");
+    OutputSink_WriteInt(out, count > 0 ? lengths[end] : 0);
+    OutputSink_WriteChar(out, '\n');
+    
+    free(components);
+    free(order);
+    free(lengths);
+    Csr_FreeCsr(condensation);
+}
+
+static void _RunDag(Graph *g, OutputSink *out)
+{
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _WriteCondensation(csr, out);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Writes the kind of Euler walk of the rows, following the direction of each edge if one does and walking them either way
+/// otherwise, and where it starts, with its edges if asked to
+static void _WriteEuler(const Csr *csr, OutputSink *out, bool isTrailWritten)
+{
+    uint32_t *trail = malloc(csr->Count * sizeof(uint32_t));
+    VertexIndex start;
+    bool isDirected = true;
+    EulerKind kind = Euler_Trail(csr, NULL, trail, &start);
+    if (kind == EULER_NONE)
+    {
+        Csr *in = Csr_Transpose(csr);
+        isDirected = false;
+        kind = Euler_Trail(csr, in, trail, &start);
+        Csr_FreeCsr(in);
+    }
+    
+    const char *kinds[] = { [EULER_NONE] = "none", [EULER_TRAIL] = "trail", [EULER_CIRCUIT] = "circuit" };
+    OutputSink_WriteString(out, "euler: ");
+    OutputSink_WriteString(out, kinds[kind]);
+    if (kind != EULER_NONE)
+    {
+        OutputSink_WriteString(out, isDirected ? " following direction" : " ignoring direction");
+        OutputSink_WriteString(out, "\neuler start: ");
+        OutputSink_WriteInt(out, start);
+    }
+    if (kind != EULER_NONE && isTrailWritten)
+    {
+        OutputSink_WriteString(out, "\neuler trail:");
+        for (uint64_t i = 0; i < csr->Count; i++)
+        {
+            OutputSink_WriteChar(out, ' ');
+            OutputSink_WriteInt(out, trail[i]);
+        }
+    }
+    OutputSink_WriteChar(out, '\n');
+    free(trail);
+}
+
+static void _RunEuler(Graph *g, OutputSink *out)
+{
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _WriteEuler(csr, out, true);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+static void _RunColoring(Graph *g, OutputSink *out)
+{
+    unsigned int colors[GRAPH_MAX_SIZE];
+    unsigned int count = Graph_ChromaticNumber(g, NULL, colors, NULL);
+    
+    OutputSink_WriteString(out, "chromatic number: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, "\ncolor of each vertex:");
+    for (VertexIndex v = 0; v < g->Vertices; v++)
+    {
+        OutputSink_WriteChar(out, ' ');
+        OutputSink_WriteInt(out, colors[v]);
+    }
+    OutputSink_WriteChar(out, '\n');
+}
+
+/// Keeps nothing of each clique, Clique_Maximal counts them
+static bool _CountClique(void *context, unsigned int thread, const uint32_t *clique, unsigned int size)
+{
+    (void) context;
+    (void) thread;
+    (void) clique;
+    (void) size;
+    return true;
+}
+
+/// Writes the size of the largest clique of the rows and the count of maximal cliques, with the vertices of the largest in
+/// order if asked to
+static void _WriteCliques(const Csr *csr, unsigned int threads, OutputSink *out, bool isCliqueWritten)
+{
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    CliqueOptions options = { .Threads = threads };
+    uint32_t *clique = malloc((csr->Vertices + 1) * sizeof(uint32_t));
+    unsigned int size = Clique_Maximum(m, &options, clique, NULL);
+    unsigned long long count = Clique_Maximal(m, &options, _CountClique, NULL);
+    
+    OutputSink_WriteString(out, "maximum clique: ");
+    OutputSink_WriteInt(out, size);
+    if (isCliqueWritten)
+    {
+        bool *isInClique = calloc(csr->Vertices, sizeof(bool));
+        for (unsigned int i = 0; i < size; i++) isInClique[clique[i]] = true;
+        OutputSink_WriteString(out, "\nmaximum clique vertices:");
+        for (VertexIndex v = 0; v < csr->Vertices; v++)
+        {
+            if (!isInClique[v]) continue;
+            OutputSink_WriteChar(out, ' ');
+            OutputSink_WriteInt(out, v);
+        }
+        free(isInClique);
+    }
+    OutputSink_WriteString(out, "\nmaximal cliques: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteChar(out, '\n');
+    
+    free(clique);
+    BitMatrix_FreeBitMatrix(m);
+}
+
+static void _RunCliques(Graph *g, OutputSink *out)
+{
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _WriteCliques(csr, 0, out, true);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Writes the value of a maximum flow from vertex 0 to the last vertex of the rows, each edge weight a capacity, and the edges
+/// of a minimum cut, listed if asked to. Networks of unit capacities are searched by Dinic's algorithm. Rows of no vertices
+/// have no target, written as -.
+static void _WriteFlow(const Csr *csr, OutputSink *out, bool isCutWritten)
+{
+    if (csr->Vertices == 0)
+    {
+        OutputSink_WriteString(out, isCutWritten ? "max flow to -: 0\nmin cut:\n" : "max flow to -: 0\nmin cut edges: 0\n");
+        return;
+    }
+    
+    const VertexIndex source = 0, target = csr->Vertices - 1;
+    FlowNetwork *network = Flow_CreateNetwork(csr);
+    uint64_t flow = 0;
+    if (source != target)
+    {
+        flow = network->IsUnitCapacity ? Flow_Dinic(network, source, target) : Flow_PushRelabel(network, source, target);
+    }
+    bool *isSourceSide = malloc(csr->Vertices * sizeof(bool));
+    Flow_MinCut(network, source, isSourceSide);
+    
+    OutputSink_WriteString(out, "max flow to ");
+    OutputSink_WriteInt(out, target);
+    OutputSink_WriteString(out, ": ");
+    OutputSink_WriteInt(out, flow);
+    OutputSink_WriteString(out, isCutWritten ? "\nmin cut:" : "\nmin cut edges: ");
+    unsigned long long count = 0;
+    for (VertexIndex u = 0; u < csr->Vertices && source != target; u++)
+    {
+        if (!isSourceSide[u]) continue;
+        for (uint64_t a = network->Offsets[u]; a < network->Offsets[u + 1]; a++)
+        {
+            if (network->Edges[a] == FLOW_NO_EDGE || isSourceSide[network->Heads[a]]) continue;
+            count++;
+            if (!isCutWritten) continue;
+            OutputSink_WriteChar(out, ' ');
+            OutputSink_WriteInt(out, network->Edges[a]);
+        }
+    }
+    if (!isCutWritten) OutputSink_WriteInt(out, count);
+    OutputSink_WriteChar(out, '\n');
+    
+    free(isSourceSide);
+    Flow_FreeNetwork(network);
+}
+
+static void _RunFlow(Graph *g, OutputSink *out)
+{
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _WriteFlow(csr, out, true);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Writes the size of a maximum matching of the rows and if they are bipartite. Bipartite rows are matched by Hopcroft and
+/// Karp's algorithm and any others by Edmonds', unless asked for the edges of the matching, which then is the assignment of
+/// the least total weight when bipartite.
+static void _WriteMatching(const Csr *csr, OutputSink *out, bool isMatchingWritten)
+{
+    uint8_t *sides = malloc(csr->Vertices);
+    uint32_t *mates = malloc(csr->Vertices * sizeof(uint32_t));
+    uint32_t *edges = malloc(csr->Vertices * sizeof(uint32_t));
+    const bool isBipartite = Matching_Bipartition(csr, sides);
+    uint64_t weight = 0;
+    unsigned int count;
+    if (isBipartite && isMatchingWritten) count = Matching_Assignment(csr, sides, mates, edges, &weight);
+    else if (isBipartite) count = Matching_HopcroftKarp(csr, sides, mates, edges);
+    else count = Matching_Blossom(csr, mates, edges);
+    
+    OutputSink_WriteString(out, "matching: ");
+    OutputSink_WriteInt(out, count);
+    OutputSink_WriteString(out, isBipartite ? "\nbipartite: yes\n" : "\nbipartite: no\n");
+    if (isMatchingWritten)
+    {
+        if (isBipartite)
+        {
+            OutputSink_WriteString(out, "matching weight: ");
+            OutputSink_WriteInt(out, weight);
+            OutputSink_WriteChar(out, '\n');
+        }
+        OutputSink_WriteString(out, "matching edges:");
+        for (VertexIndex v = 0; v < csr->Vertices; v++)
+        {
+            if (mates[v] == MATCHING_UNMATCHED || mates[v] < v) continue;
+            OutputSink_WriteChar(out, ' ');
+            OutputSink_WriteInt(out, edges[v]);
+        }
+        OutputSink_WriteChar(out, '\n');
+    }
+    
+    free(edges);
+    free(mates);
+    free(sides);
+}
+
+static void _RunMatching(Graph *g, OutputSink *out)
+{
+    EdgeList *el = EdgeList_FromGraph(g);
+    Csr *csr = Csr_FromEdgeList(el);
+    _WriteMatching(csr, out, true);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+
+static void _RunDistances(Graph *g, OutputSink *out)
+{
+    uint64_t distances[GRAPH_MAX_SIZE * GRAPH_MAX_SIZE];
+    Graph_AllPairsShortestPaths(g, distances);
+    
+    OutputSink_WriteString(out, "distances:\n");
+    for (VertexIndex u = 0; u < g->Vertices; u++)
+    {
+        for (VertexIndex v = 0; v < g->Vertices; v++)
+        {
+            if (v > 0) OutputSink_WriteChar(out, ' ');
+            uint64_t distance = distances[u * g->Vertices + v];
+            if (distance == SHORTEST_PATHS_UNREACHED) OutputSink_WriteChar(out, '-');
+            else OutputSink_WriteInt(out, distance);
+        }
+        OutputSink_WriteChar(out, '\n');
+    }
+}
+
+static void _RunReachability(Graph *g, OutputSink *out)
+{
+    uint64_t rows[GRAPH_MAX_SIZE * ALL_PAIRS_ROW_WORDS(GRAPH_MAX_SIZE)];
+    Graph_TransitiveClosure(g, rows);
+    
+    OutputSink_WriteString(out, "reachability:\n");
+    for (VertexIndex u = 0; u < g->Vertices; u++)
+    {
+        for (VertexIndex v = 0; v < g->Vertices; v++)
+        {
+            OutputSink_WriteChar(out, AllPairs_IsReachable(rows, g->Vertices, u, v) ? '1' : '0');
+        }
+        OutputSink_WriteChar(out, '\n');
+    }
+}
+
+static const CliAnalyticEntry _Analytics[] =
+{
+    { "summary", _RunSummary, NULL },
+    { "degrees", _RunDegrees, NULL },
+    { "mst", _RunMst, NULL },
+    { "components", _RunComponents, NULL },
+    { "paths", _RunPaths, NULL },
+    { "bridges", _RunBridges, NULL },
+    { "scc", _RunScc, NULL },
+    { "dag", _RunDag, NULL },
+    { "euler", _RunEuler, NULL },
+    { "coloring", _RunColoring, NULL },
+    { "cliques", _RunCliques, NULL },
+    { "flow", _RunFlow, NULL },
+    { "matching", _RunMatching, NULL },
+    { "distances", _RunDistances, NULL },
+    { "reachability", _RunReachability, NULL },
+    { "adjacency", NULL, Graph_WriteAdjMatrix },
+    { "incidence", NULL, Graph_WriteIncidenceMatrix },
+};
+#define ANALYTICS_COUNT (sizeof(_Analytics) / sizeof(_Analytics[0]))
+
+typedef struct
+{
+    bool Selected[ANALYTICS_COUNT];
+    GraphDumpFormat Format;
+    bool IsQuiet;
+    
+    /// Seed and weights of generated graphs
+    GeneratorOptions Generator;
+    
+    /// Where generated edges are written, NULL to not write them
+    const char *EdgesPath;
+    
+    /// Where loaded and generated graphs are written as a graph file, NULL to not write them
+    const char *GraphFilePath;
+    
+    /// The format of every file, implied by each extension unless set
+    ImportFormat Import;
+    bool IsImportSet;
+    
+    /// Threads files are parsed on, 0 to stream them through a buffer
+    unsigned int Threads;
+} CliOptions;
+
+static double _Milliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e3 + now.tv_nsec / 1e6;
+}
+
+static void _Usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [-q] [-c] [-a analytics] [-f dense|sparse|rle] [-i format] [-j threads] [-b file] [-g generator [-s seed] [-w min,max] [-d] [-e file]] file...\n", program);
+    fprintf(stderr, "  Loads each graph file (- for stdin) and each generated graph, and prints the analytics to stdout and their\n");
+    fprintf(stderr, "  timings to stderr. Graphs past %d vertices or edges only get their summary, components, paths, bridges,\n",
+            GRAPH_MAX_SIZE);
+    fprintf(stderr, "  scc, dag, euler, flow and matching, and cliques up to %d vertices. The flow runs from vertex 0 to the last vertex.\n",
+            CLI_MATRIX_MAX_VERTICES);
+    fprintf(stderr, "  -a  comma separated analytics, default summary. One of:");
+    for (size_t i = 0; i < ANALYTICS_COUNT; i++)
+    {
+        fprintf(stderr, " %s", _Analytics[i].Name);
+    }
+    fprintf(stderr, ", all\n");
+    fprintf(stderr, "  -f  format of the adjacency and incidence matrices, default dense\n");
+    fprintf(stderr, "  -i  format of the files, edgelist (\"v1 v2 [weight]\" lines), dimacs, mtx or metis, default by extension:\n");
+    fprintf(stderr, "      .gr .dimacs .col for dimacs, .mtx for mtx, .graph .metis for metis and edgelist otherwise\n");
+    fprintf(stderr, "  -j  parse each file on threads, 0 for one per processor, default the file is streamed on one thread.\n");
+    fprintf(stderr, "      %s graph files are mapped instead of parsed, and summarized without being read when large\n", GRAPH_FILE_EXTENSION);
+    fprintf(stderr, "      The components, paths and cliques of large graphs are found on as many threads, default one per processor\n");
+    fprintf(stderr, "  -b  write each loaded or generated graph to file as a graph file, the last one is kept\n");
+    fprintf(stderr, "  -q  do not print timings\n");
+    fprintf(stderr, "  -c  print the performance counters to stderr once every file is done\n");
+    fprintf(stderr, "  -g  generate a graph, one of gnp:n,p gnm:n,m ba:n,m ws:n,k,beta grid:rows,columns complete:n\n");
+    fprintf(stderr, "      bipartite:a,b geometric:n,radius\n");
+    fprintf(stderr, "  -s  seed of the generated graphs, default 0\n");
+    fprintf(stderr, "  -w  generate uniform weights between min and max, default every weight is 1\n");
+    fprintf(stderr, "  -d  generate directed pairs, for gnp, gnm and complete\n");
+    fprintf(stderr, "  -e  write the generated edges to file as an edge list, the last generated graph is kept\n");
+}
+
+static bool _ParseWeights(const char *range, GeneratorOptions *options)
+{
+    unsigned int min, max;
+    char trailing;
+    if (sscanf(range, "%u,%u%c", &min, &max, &trailing) != 2 || min < 1 || min > max || max > INT_MAX)
+    {
+        fprintf(stderr, "weights must be min,max with 1 <= min <= max: %s\n", range);
+        return false;
+    }
+    options->Weights = GENERATOR_WEIGHTS_UNIFORM;
+    options->MinWeight = min;
+    options->MaxWeight = max;
+    return true;
+}
+
+/// Parses a comma separated list of analytic names into selected
+/// - Returns: false if a name is not an analytic
+static bool _ParseAnalytics(char *list, bool selected[ANALYTICS_COUNT])
+{
+    for (char *name = strtok(list, ","); name != NULL; name = strtok(NULL, ","))
+    {
+        bool found = false;
+        for (size_t i = 0; i < ANALYTICS_COUNT; i++)
+        {
+            if (strcmp(name, "all") == 0 || strcmp(name, _Analytics[i].Name) == 0)
+            {
+                selected[i] = true;
+                found = true;
+            }
+        }
+        if (!found)
+        {
+            fprintf(stderr, "unknown analytic: %s\n", name);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _ParseFormat(const char *name, GraphDumpFormat *format)
+{
+    if (strcmp(name, "dense") == 0) *format = GRAPH_DUMP_DENSE;
+    else if (strcmp(name, "sparse") == 0) *format = GRAPH_DUMP_SPARSE;
+    else if (strcmp(name, "rle") == 0) *format = GRAPH_DUMP_RUN_LENGTH;
+    else
+    {
+        fprintf(stderr, "unknown format: %s\n", name);
+        return false;
+    }
+    return true;
+}
+
+/// Runs the selected analytics on a loaded or generated graph, under a "# name" header
+static void _RunAnalytics(const char *name, Graph *g, const CliOptions *options, OutputSink *out)
+{
+    OutputSink_WriteString(out, "# ");
+    OutputSink_WriteString(out, name);
+    OutputSink_WriteChar(out, '\n');
+    for (size_t i = 0; i < ANALYTICS_COUNT; i++)
+    {
+        if (!options->Selected[i]) continue;
+        
+        double start = _Milliseconds();
+        if (_Analytics[i].Run != NULL) _Analytics[i].Run(g, out);
+        else
+        {
+            OutputSink_WriteString(out, _Analytics[i].Name);
+            OutputSink_WriteString(out, ":\n");
+            _Analytics[i].WriteMatrix(g, out, options->Format);
+        }
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s %s %.3f ms\n", name, _Analytics[i].Name, _Milliseconds() - start);
+    }
+}
+
+/// Writes the counts of a graph too large for the analytics, the only summary known without the graph
+static void _RunSummaryOnly(const char *name, unsigned int vertices, unsigned long long edges, OutputSink *out)
+{
+    OutputSink_WriteString(out, "# ");
+    OutputSink_WriteString(out, name);
+    OutputSink_WriteString(out, "\nvertices: ");
+    OutputSink_WriteInt(out, vertices);
+    OutputSink_WriteString(out, "\nedges: ");
+    OutputSink_WriteInt(out, edges);
+    OutputSink_WriteChar(out, '\n');
+    OutputSink_Flush(out);
+    fprintf(stderr, "%s has more than %d vertices or edges, skipping the analytics other than components, paths, bridges, scc, dag, euler, cliques, flow and matching\n", name, GRAPH_MAX_SIZE);
+}
+
+static bool _IsSelected(const CliOptions *options, CliAnalytic run)
+{
+    for (size_t i = 0; i < ANALYTICS_COUNT; i++)
+    {
+        if (options->Selected[i] && _Analytics[i].Run == run) return true;
+    }
+    return false;
+}
+
+/// - Returns: If any analytic that runs on graphs of any size is selected
+static bool _HasLargeAnalytics(const CliOptions *options)
+{
+    return _IsSelected(options, _RunComponents) || _IsSelected(options, _RunPaths) || _IsSelected(options, _RunBridges) ||
+           _IsSelected(options, _RunScc) || _IsSelected(options, _RunDag) || _IsSelected(options, _RunEuler) ||
+           _IsSelected(options, _RunCliques) || _IsSelected(options, _RunFlow) || _IsSelected(options, _RunMatching);
+}
+
+/// Counts the components and the distances from vertex 0 of a graph too large for the analytics on every thread,
+/// and its bridges and cut vertices, strong components, condensation, Euler walk, cliques, maximum flow and maximum
+/// matching, if they are selected
+static void _RunLargeAnalytics(const char *name, const Csr *csr, const CliOptions *options, OutputSink *out)
+{
+    if (csr == NULL) return;
+    
+    if (_IsSelected(options, _RunComponents))
+    {
+        double start = _Milliseconds();
+        uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+        unsigned int count = Traversal_ConnectedComponents(csr, options->Threads, components);
+        free(components);
+        
+        OutputSink_WriteString(out, "components: ");
+        OutputSink_WriteInt(out, count);
+        OutputSink_WriteChar(out, '\n');
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s components %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunPaths) && csr->Vertices > 0)
+    {
+        double start = _Milliseconds();
+        uint64_t *distances = malloc(csr->Vertices * sizeof(uint64_t));
+        ShortestPaths_DeltaStepping(csr, 0, 0, options->Threads, distances, NULL, NULL);
+        unsigned int reached = 0;
+        uint64_t farthest = 0;
+        for (VertexIndex v = 0; v < csr->Vertices; v++)
+        {
+            if (distances[v] == SHORTEST_PATHS_UNREACHED) continue;
+            reached++;
+            if (distances[v] > farthest) farthest = distances[v];
+        }
+        free(distances);
+        
+        OutputSink_WriteString(out, "reached from 0: ");
+        OutputSink_WriteInt(out, reached);
+        OutputSink_WriteString(out, "\nfarthest from 0: ");
+        OutputSink_WriteInt(out, farthest);
+        OutputSink_WriteChar(out, '\n');
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s paths %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunBridges))
+    {
+        double start = _Milliseconds();
+        Csr *in = Csr_Transpose(csr);
+        uint32_t *components = malloc(csr->Count * sizeof(uint32_t));
+        bool *isCutVertex = malloc(csr->Vertices * sizeof(bool));
+        bool *isBridge = malloc(csr->Count * sizeof(bool));
+        unsigned int count = Biconnected_Components(csr, in, components, isCutVertex, isBridge);
+        unsigned long long bridges = 0;
+        unsigned int cutVertices = 0;
+        for (uint64_t e = 0; e < csr->Count; e++) bridges += isBridge[e];
+        for (VertexIndex v = 0; v < csr->Vertices; v++) cutVertices += isCutVertex[v];
+        free(components);
+        free(isCutVertex);
+        free(isBridge);
+        Csr_FreeCsr(in);
+        
+        OutputSink_WriteString(out, "biconnected components: ");
+        OutputSink_WriteInt(out, count);
+        OutputSink_WriteString(out, "\nbridge count: ");
+        OutputSink_WriteInt(out, bridges);
+        OutputSink_WriteString(out, "\ncut vertex count: ");
+        OutputSink_WriteInt(out, cutVertices);
+        OutputSink_WriteChar(out, '\n');
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s bridges %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunScc))
+    {
+        double start = _Milliseconds();
+        uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+        unsigned int count = Directed_StronglyConnectedComponents(csr, components);
+        uint32_t *sizes = calloc(count, sizeof(uint32_t));
+        uint32_t largest = 0;
+        for (VertexIndex v = 0; v < csr->Vertices; v++)
+        {
+            if (++sizes[components[v]] > largest) largest = sizes[components[v]];
+        }
+        free(components);
+        free(sizes);
+        
+        OutputSink_WriteString(out, "strong components: ");
+        OutputSink_WriteInt(out, count);
+        OutputSink_WriteString(out, "\nlargest strong component: ");
+        OutputSink_WriteInt(out, largest);
+        OutputSink_WriteChar(out, '\n');
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s scc %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunDag))
+    {
+        double start = _Milliseconds();
+        _WriteCondensation(csr, out);
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s dag %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunEuler))
+    {
+        double start = _Milliseconds();
+        _WriteEuler(csr, out, false);
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s euler %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunCliques) && csr->Vertices > CLI_MATRIX_MAX_VERTICES)
+    {
+        fprintf(stderr, "%s has more than %d vertices, skipping cliques\n", name, CLI_MATRIX_MAX_VERTICES);
+    }
+    else if (_IsSelected(options, _RunCliques))
+    {
+        double start = _Milliseconds();
+        _WriteCliques(csr, options->Threads, out, false);
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s cliques %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunFlow))
+    {
+        double start = _Milliseconds();
+        _WriteFlow(csr, out, false);
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s flow %.3f ms\n", name, _Milliseconds() - start);
+    }
+    
+    if (_IsSelected(options, _RunMatching))
+    {
+        double start = _Milliseconds();
+        _WriteMatching(csr, out, false);
+        OutputSink_Flush(out);
+        if (!options->IsQuiet) fprintf(stderr, "%s matching %.3f ms\n", name, _Milliseconds() - start);
+    }
+}
+
+/// Runs the selected analytics on the graph of the edges, or only summarizes them when the graph would be too large
+static void _RunEdgeList(const char *name, const EdgeList *el, const CliOptions *options, OutputSink *out)
+{
+    Graph *g = Graph_FromEdgeList(el);
+    if (g == NULL)
+    {
+        _RunSummaryOnly(name, el->Vertices, el->Count, out);
+        Csr *csr = Csr_FromEdgeList(el);
+        _RunLargeAnalytics(name, csr, options, out);
+        if (csr != NULL) Csr_FreeCsr(csr);
+        return;
+    }
+    _RunAnalytics(name, g, options, out);
+    Graph_FreeGraph(g);
+}
+
+/// Writes the edges as a graph file with a checksum, if asked to
+/// - Returns: false if the file could not be written
+static bool _WriteGraphFile(const EdgeList *el, const CliOptions *options)
+{
+    if (options->GraphFilePath == NULL) return true;
+    
+    double start = _Milliseconds();
+    Csr *csr = Csr_FromEdgeList(el);
+    bool isWritten = csr != NULL && GraphFile_Write(options->GraphFilePath, csr, NULL, true);
+    if (csr != NULL) Csr_FreeCsr(csr);
+    if (!isWritten) fprintf(stderr, "could not write %s\n", options->GraphFilePath);
+    else if (!options->IsQuiet) fprintf(stderr, "%s write %.3f ms\n", options->GraphFilePath, _Milliseconds() - start);
+    return isWritten;
+}
+
+/// Maps a graph file, and runs the selected analytics on it when it is small enough to read whole
+/// - Returns: false if the file could not be opened or is corrupt
+static bool _RunGraphFile(const char *path, const CliOptions *options, OutputSink *out)
+{
+    GraphLoadError error = {0};
+    double start = _Milliseconds();
+    GraphFile *file = GraphFile_Open(path, &error);
+    double opened = _Milliseconds();
+    if (file == NULL)
+    {
+        fprintf(stderr, "%s: %s\n", path, error.Message);
+        return false;
+    }
+    if (!options->IsQuiet) fprintf(stderr, "%s open %.3f ms\n", path, opened - start);
+    
+    // A large graph is summarized from the header, without reading a page of its rows unless it is analyzed
+    const Csr *csr = &file->Csr;
+    bool isLarge = csr->Vertices > GRAPH_MAX_SIZE || csr->Count > GRAPH_MAX_SIZE;
+    bool isRead = (isLarge && !_HasLargeAnalytics(options)) || GraphFile_Verify(file, &error);
+    if (!isRead)
+    {
+        fprintf(stderr, "%s: %s\n", path, error.Message);
+    }
+    else if (isLarge)
+    {
+        _RunSummaryOnly(path, csr->Vertices, csr->Count, out);
+        _RunLargeAnalytics(path, csr, options, out);
+    }
+    else
+    {
+        EdgeList *el = EdgeList_FromCsr(csr);
+        _RunEdgeList(path, el, options, out);
+        EdgeList_FreeEdgeList(el);
+    }
+    GraphFile_Close(file);
+    return isRead;
+}
+
+/// Loads a single file and runs the selected analytics on it
+/// - Returns: false if the file could not be loaded
+static bool _RunFile(const char *path, const CliOptions *options, OutputSink *out)
+{
+    size_t length = strlen(path);
+    size_t extensionLength = strlen(GRAPH_FILE_EXTENSION);
+    if (length > extensionLength && strcmp(path + length - extensionLength, GRAPH_FILE_EXTENSION) == 0)
+    {
+        return _RunGraphFile(path, options, out);
+    }
+    
+    bool isStdin = strcmp(path, "-") == 0;
+    ImportFormat format = options->IsImportSet ? options->Import : Import_FormatOfPath(path);
+    GraphLoadError error = {0};
+    EdgeList *el;
+    double start = _Milliseconds();
+    if (options->Threads == 0 || isStdin)
+    {
+        FILE *file = isStdin ? stdin : fopen(path, "r");
+        if (file == NULL)
+        {
+            perror(path);
+            return false;
+        }
+        el = Import_Read(file, format, &error);
+        if (file != stdin) fclose(file);
+    }
+    else
+    {
+        el = Import_ReadParallel(path, format, options->Threads, &error);
+    }
+    double loaded = _Milliseconds();
+    
+    if (el == NULL)
+    {
+        fprintf(stderr, "%s:%u: %s\n", path, error.Line, error.Message);
+        return false;
+    }
+    if (!options->IsQuiet)
+    {
+        fprintf(stderr, "%s load %.3f ms, %.0f edges per second\n", path, loaded - start, el->Count / ((loaded - start) / 1e3));
+    }
+    
+    bool isWritten = _WriteGraphFile(el, options);
+    _RunEdgeList(path, el, options, out);
+    EdgeList_FreeEdgeList(el);
+    return isWritten;
+}
+
+/// Generates the graph a "name:arguments" spec describes
+/// - Returns: The edges, or NULL if the spec is malformed
+static EdgeList *_Generate(const char *spec, const GeneratorOptions *options)
+{
+    char name[32];
+    double a[GENERATOR_MAX_ARGUMENTS] = {};
+    int count = 0;
+    const char *arguments = strchr(spec, ':');
+    size_t nameLength = arguments == NULL ? strlen(spec) : (size_t) (arguments - spec);
+    if (nameLength >= sizeof(name)) return NULL;
+    memcpy(name, spec, nameLength);
+    name[nameLength] = '\0';
+    
+    while (arguments != NULL && count < GENERATOR_MAX_ARGUMENTS)
+    {
+        char *end;
+        a[count++] = strtod(arguments + 1, &end);
+        if (end == arguments + 1 || (*end != ',' && *end != '\0')) return NULL;
+        arguments = *end == ',' ? end : NULL;
+    }
+    if (arguments != NULL) return NULL;
+    
+    // Every size is a positive integer that fits a VertexIndex
+    for (int i = 0; i < count; i++)
+    {
+        if (a[i] < 0 || a[i] > 0xFFFFFFF) return NULL;
+    }
+    unsigned int n = (unsigned int) a[0];
+    unsigned int m = (unsigned int) a[1];
+    
+    if (strcmp(name, "gnp") == 0 && count == 2 && a[1] <= 1) return Generators_ErdosRenyi(n, a[1], options);
+    if (strcmp(name, "gnm") == 0 && count == 2 && n > 1)
+    {
+        unsigned long long pairs = (unsigned long long) n * (n - 1) / (options->IsDirected ? 1 : 2);
+        if (m <= pairs) return Generators_RandomEdges(n, m, options);
+    }
+    if (strcmp(name, "ba") == 0 && count == 2 && m >= 1 && m < n) return Generators_BarabasiAlbert(n, m, options);
+    if (strcmp(name, "ws") == 0 && count == 3 && m % 2 == 0 && m < n && a[2] <= 1) return Generators_WattsStrogatz(n, m, a[2], options);
+    if (strcmp(name, "grid") == 0 && count == 2) return Generators_Grid(n, m, options);
+    if (strcmp(name, "complete") == 0 && count == 1) return Generators_Complete(n, options);
+    if (strcmp(name, "bipartite") == 0 && count == 2) return Generators_CompleteBipartite(n, m, options);
+    if (strcmp(name, "geometric") == 0 && count == 2 && a[1] > 0) return Generators_RandomGeometric(n, a[1], options);
+    return NULL;
+}
+
+/// Generates a graph and runs the selected analytics on it, if it is small enough for them
+/// - Returns: false if the spec is malformed or the edges could not be written
+static bool _RunGenerator(const char *spec, const CliOptions *options, OutputSink *out)
+{
+    double start = _Milliseconds();
+    EdgeList *el = _Generate(spec, &options->Generator);
+    double generated = _Milliseconds();
+    if (el == NULL)
+    {
+        fprintf(stderr, "malformed generator: %s\n", spec);
+        return false;
+    }
+    if (!options->IsQuiet)
+    {
+        fprintf(stderr, "%s generate %.3f ms, %.0f edges per second\n", spec, generated - start, el->Count / ((generated - start) / 1e3));
+    }
+    
+    bool isWritten = true;
+    if (options->EdgesPath != NULL)
+    {
+        FILE *file = fopen(options->EdgesPath, "w");
+        if (file == NULL)
+        {
+            perror(options->EdgesPath);
+            isWritten = false;
+        }
+        else
+        {
+            OutputSink *sink = OutputSink_CreateFileSink(file);
+            EdgeList_Write(el, sink);
+            OutputSink_FreeOutputSink(sink);
+            fclose(file);
+        }
+    }
+    
+    isWritten = _WriteGraphFile(el, options) && isWritten;
+    _RunEdgeList(spec, el, options, out);
+    EdgeList_FreeEdgeList(el);
+    return isWritten;
+}
+
+int main(int argc, char *argv[])
+{
+    CliOptions options = { .Selected = { [0] = true }, .Format = GRAPH_DUMP_DENSE };
+    bool isDefaultSelection = true;
+    bool showCounters = false;
+    const char **generators = calloc(argc, sizeof(char *));
+    int generatorCount = 0;
+    
+    int option;
+    while ((option = getopt(argc, argv, "a:f:i:j:b:qcg:s:w:de:h")) != -1)
+    {
+        switch (option)
+        {
+            case 'a':
+                if (isDefaultSelection)
+                {
+                    memset(options.Selected, 0, sizeof(options.Selected));
+                    isDefaultSelection = false;
+                }
+                if (!_ParseAnalytics(optarg, options.Selected)) return EXIT_USAGE;
+                break;
+            case 'f':
+                if (!_ParseFormat(optarg, &options.Format)) return EXIT_USAGE;
+                break;
+            case 'i':
+                if (!Import_ParseFormat(optarg, &options.Import))
+                {
+                    fprintf(stderr, "unknown file format: %s\n", optarg);
+                    return EXIT_USAGE;
+                }
+                options.IsImportSet = true;
+                break;
+            case 'j':
+                options.Threads = (unsigned int) strtoul(optarg, NULL, 10);
+                if (options.Threads == 0) options.Threads = (unsigned int) WorkerPool_DefaultThreadCount() + 1;
+                break;
+            case 'b':
+                options.GraphFilePath = optarg;
+                break;
+            case 'q':
+                options.IsQuiet = true;
+                break;
+            case 'c':
+                showCounters = true;
+                break;
+            case 'g':
+                generators[generatorCount++] = optarg;
+                break;
+            case 's':
+                options.Generator.Seed = strtoull(optarg, NULL, 0);
+                break;
+            case 'w':
+                if (!_ParseWeights(optarg, &options.Generator)) return EXIT_USAGE;
+                break;
+            case 'd':
+                options.Generator.IsDirected = true;
+                break;
+            case 'e':
+                options.EdgesPath = optarg;
+                break;
+            default:
+                _Usage(argv[0]);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_USAGE;
+        }
+    }
+    
+    if (optind == argc && generatorCount == 0)
+    {
+        _Usage(argv[0]);
+        return EXIT_USAGE;
+    }
+    
+    OutputSink *out = OutputSink_CreateFileSink(stdout);
+    int status = EXIT_SUCCESS;
+    for (int i = 0; i < generatorCount; i++)
+    {
+        if (!_RunGenerator(generators[i], &options, out)) status = EXIT_FAILURE;
+    }
+    for (int i = optind; i < argc; i++)
+    {
+        if (!_RunFile(argv[i], &options, out)) status = EXIT_FAILURE;
+    }
+    free(generators);
+    OutputSink_FreeOutputSink(out);
+    
+    if (showCounters)
+    {
+        OutputSink *err = OutputSink_CreateFileSink(stderr);
+        Counters_Write(err);
+        OutputSink_FreeOutputSink(err);
+    }
+    
+    return status;
+}
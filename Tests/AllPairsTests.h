@@ -0,0 +1,136 @@
+//
+//  AllPairsTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef AllPairsTests_h
+#define AllPairsTests_h
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include "AllPairs.h"
+#include "Traversal.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define ALL_PAIRS_TEST_CASE(name) TEST name(void) { _Setup_AllPairs_Tests(_##name); }
+
+static void _Setup_AllPairs_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 9, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000 };
+    test(&options);
+}
+
+/// Checks every row of the blocked Floyd–Warshall against Dijkstra from the same vertex
+static void _AllPairs_AssertMatchesDijkstra(const Csr *csr, unsigned int threads)
+{
+    const size_t n = csr->Vertices;
+    uint64_t *distances = malloc(n * n * sizeof(uint64_t));
+    uint64_t *expected = malloc(n * sizeof(uint64_t));
+    AllPairs_FloydWarshall(csr, threads, distances);
+    for (VertexIndex source = 0; source < n; source++)
+    {
+        ShortestPaths_Dijkstra(csr, source, expected, NULL, NULL);
+        assert(memcmp(distances + source * n, expected, n * sizeof(uint64_t)) == 0);
+    }
+    free(distances);
+    free(expected);
+}
+
+TEST _AllPairs_FloydWarshall_MatchesDijkstraFromEverySource(GeneratorOptions *options)
+{
+    // Arrange, a few tiles and a partial one, with unreachable pairs
+    EdgeList *el = Generators_RandomEdges(300, 900, options);
+    Csr *csr = Csr_FromEdgeList(el);
+
+    // Weights too heavy to add in 32 bits
+    options->MinWeight = INT_MAX / 2;
+    options->MaxWeight = INT_MAX;
+    EdgeList *heavy = Generators_RandomEdges(140, 500, options);
+    Csr *heavyCsr = Csr_FromEdgeList(heavy);
+
+    // Act, Assert
+    _AllPairs_AssertMatchesDijkstra(csr, 1);
+    _AllPairs_AssertMatchesDijkstra(csr, 3);
+    _AllPairs_AssertMatchesDijkstra(heavyCsr, 2);
+
+    Csr_FreeCsr(csr);
+    Csr_FreeCsr(heavyCsr);
+    EdgeList_FreeEdgeList(el);
+    EdgeList_FreeEdgeList(heavy);
+}
+ALL_PAIRS_TEST_CASE(AllPairs_FloydWarshall_MatchesDijkstraFromEverySource)
+
+
+TEST _AllPairs_TransitiveClosure_MatchesBreadthFirstReachability(GeneratorOptions *options)
+{
+    // Arrange, sparse enough to leave vertices outside of every cycle
+    EdgeList *el = Generators_RandomEdges(200, 180, options);
+    Csr *csr = Csr_FromEdgeList(el);
+    const unsigned int n = csr->Vertices;
+    uint64_t *rows = malloc(n * ALL_PAIRS_ROW_WORDS(n) * sizeof(uint64_t));
+    uint32_t *levels = malloc(n * sizeof(uint32_t));
+
+    // Act
+    AllPairs_TransitiveClosure(csr, rows);
+
+    // Assert, a vertex reaches itself only if it reaches a vertex with an edge back
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        Traversal_BreadthFirst(csr, NULL, u, 1, levels, NULL);
+        bool isOnCycle = false;
+        for (size_t e = 0; e < el->Count; e++)
+        {
+            isOnCycle |= el->Targets[e] == u && levels[el->Sources[e]] != TRAVERSAL_UNREACHED;
+        }
+        for (VertexIndex v = 0; v < n; v++)
+        {
+            bool isReachable = v == u ? isOnCycle : levels[v] != TRAVERSAL_UNREACHED;
+            assert(AllPairs_IsReachable(rows, n, u, v) == isReachable);
+        }
+    }
+
+    free(rows);
+    free(levels);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+ALL_PAIRS_TEST_CASE(AllPairs_TransitiveClosure_MatchesBreadthFirstReachability)
+
+
+TEST _Graph_AllPairsShortestPaths_FollowsTheDirectionOfEachEdge(GeneratorOptions *_)
+{
+    // Arrange
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 4; i++) Graph_AddVertex(g);
+    Graph_AddEdgeWeighted(g, 0, 1, 5);
+    Graph_AddEdgeWeighted(g, 1, 2, 1);
+    Graph_AddEdgeWeighted(g, 0, 2, 10);
+    Graph_AddEdgeWeighted(g, 2, 2, 1);
+    const uint64_t none = SHORTEST_PATHS_UNREACHED;
+    const uint64_t expected[4][4] =
+    {
+        { 0, 5, 6, none },
+        { none, 0, 1, none },
+        { none, none, 0, none },
+        { none, none, none, 0 },
+    };
+    uint64_t distances[4][4];
+    uint64_t rows[4];
+
+    // Act
+    Graph_AllPairsShortestPaths(g, &distances[0][0]);
+    Graph_TransitiveClosure(g, rows);
+
+    // Assert, only the self loop reaches its own vertex
+    assert(memcmp(distances, expected, sizeof(expected)) == 0);
+    assert(rows[0] == 0x6 && rows[1] == 0x4 && rows[2] == 0x4 && rows[3] == 0);
+
+    Graph_FreeGraph(g);
+}
+ALL_PAIRS_TEST_CASE(Graph_AllPairsShortestPaths_FollowsTheDirectionOfEachEdge)
+
+#endif /* AllPairsTests_h */
@@ -0,0 +1,150 @@
+//
+//  BiconnectedTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef BiconnectedTests_h
+#define BiconnectedTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Biconnected.h"
+#include "Traversal.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define BICONNECTED_TEST_CASE(name) TEST name(void) { _Setup_Biconnected_Tests(_##name); }
+
+/// The results of a search, freed together
+typedef struct
+{
+    Csr *Out;
+    Csr *In;
+    unsigned int Count;
+    uint32_t *Components;
+    bool *IsArticulation;
+    bool *IsBridge;
+} BiconnectedResult;
+
+static void _Setup_Biconnected_Tests(void (*test)(BiconnectedResult*))
+{
+    BiconnectedResult result = {};
+    test(&result);
+    Csr_FreeCsr(result.Out);
+    Csr_FreeCsr(result.In);
+    free(result.Components);
+    free(result.IsArticulation);
+    free(result.IsBridge);
+}
+
+static void _Biconnected_Run(BiconnectedResult *result, const EdgeList *el)
+{
+    result->Out = Csr_FromEdgeList(el);
+    result->In = Csr_Transpose(result->Out);
+    result->Components = malloc(el->Count * sizeof(uint32_t));
+    result->IsArticulation = malloc(el->Vertices * sizeof(bool));
+    result->IsBridge = malloc(el->Count * sizeof(bool));
+    result->Count = Biconnected_Components(result->Out, result->In, result->Components, result->IsArticulation, result->IsBridge);
+}
+
+/// - Returns: The connected components of the list without the edges of skip, or the edges touching vertex skip
+static unsigned int _Biconnected_ComponentsWithout(const EdgeList *el, size_t skipEdge, VertexIndex skipVertex)
+{
+    EdgeList *rest = EdgeList_CreateEdgeList(el->Vertices, el->Count);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        if (e == skipEdge || el->Sources[e] == skipVertex || el->Targets[e] == skipVertex) continue;
+        EdgeList_Add(rest, el->Sources[e], el->Targets[e], 1);
+    }
+    Csr *csr = Csr_FromEdgeList(rest);
+    uint32_t *components = malloc(el->Vertices * sizeof(uint32_t));
+    unsigned int count = Traversal_ConnectedComponents(csr, 1, components);
+    free(components);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(rest);
+    return count;
+}
+
+TEST _Biconnected_Components_SplitsAMultigraphAtItsCutVertices(BiconnectedResult *result)
+{
+    // Arrange, triangles 0 1 2 and 2 3 4 sharing 2, a parallel pair between 4 and 5, a bridge from 5 to 6 with a self loop on 6,
+    // and an isolated 7. Directions do not matter.
+    EdgeList *el = EdgeList_CreateEdgeList(8, 0);
+    const VertexIndex edges[][2] = { { 0, 1 }, { 2, 1 }, { 2, 0 }, { 2, 3 }, { 3, 4 }, { 4, 2 }, { 4, 5 }, { 5, 4 }, { 6, 5 }, { 6, 6 } };
+    for (size_t e = 0; e < sizeof(edges) / sizeof(edges[0]); e++) EdgeList_Add(el, edges[e][0], edges[e][1], 1);
+    
+    // Act
+    _Biconnected_Run(result, el);
+    
+    // Assert
+    assert(result->Count == 5);
+    assert(result->Components[0] == result->Components[1] && result->Components[1] == result->Components[2]);
+    assert(result->Components[3] == result->Components[4] && result->Components[4] == result->Components[5]);
+    assert(result->Components[6] == result->Components[7]);
+    bool isUsed[5] = {};
+    const size_t representatives[] = { 0, 3, 6, 8, 9 };
+    for (int i = 0; i < 5; i++)
+    {
+        assert(result->Components[representatives[i]] < 5 && !isUsed[result->Components[representatives[i]]]);
+        isUsed[result->Components[representatives[i]]] = true;
+    }
+    
+    for (size_t e = 0; e < el->Count; e++) assert(result->IsBridge[e] == (e == 8));
+    const bool isArticulation[] = { false, false, true, false, true, true, false, false };
+    for (VertexIndex v = 0; v < 8; v++) assert(result->IsArticulation[v] == isArticulation[v]);
+    
+    EdgeList_FreeEdgeList(el);
+}
+BICONNECTED_TEST_CASE(Biconnected_Components_SplitsAMultigraphAtItsCutVertices)
+
+
+TEST _Biconnected_Components_MatchesRemovingEachVertexAndEdge(BiconnectedResult *result)
+{
+    // Arrange, sparse enough for many bridges, with parallel edges and self loops added
+    GeneratorOptions options = { .Seed = 13, .IsDirected = true };
+    EdgeList *el = Generators_RandomEdges(80, 90, &options);
+    for (VertexIndex v = 0; v < 80; v += 9) EdgeList_Add(el, v, v, 1);
+    for (size_t e = 0; e < 90; e += 11) EdgeList_Add(el, el->Targets[e], el->Sources[e], 1);
+    
+    // Act
+    _Biconnected_Run(result, el);
+    
+    // Assert
+    const unsigned int count = _Biconnected_ComponentsWithout(el, SIZE_MAX, UINT32_MAX);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        assert(result->IsBridge[e] == (_Biconnected_ComponentsWithout(el, e, UINT32_MAX) > count));
+    }
+    for (VertexIndex v = 0; v < el->Vertices; v++)
+    {
+        // Without its edges the vertex is a component of its own
+        assert(result->IsArticulation[v] == (_Biconnected_ComponentsWithout(el, SIZE_MAX, v) > count + 1));
+    }
+    
+    EdgeList_FreeEdgeList(el);
+}
+BICONNECTED_TEST_CASE(Biconnected_Components_MatchesRemovingEachVertexAndEdge)
+
+
+TEST _Biconnected_Components_SearchesAPathOfAMillionVertices(BiconnectedResult *result)
+{
+    // Arrange, deeper than any call stack
+    const unsigned int n = 1000000;
+    EdgeList *el = EdgeList_CreateEdgeList(n, n);
+    for (VertexIndex v = 1; v < n; v++) EdgeList_Add(el, v, v - 1, 1);
+    
+    // Act
+    _Biconnected_Run(result, el);
+    
+    // Assert, every edge is a bridge of its own and every inner vertex cuts the path
+    assert(result->Count == n - 1);
+    for (size_t e = 0; e < el->Count; e++) assert(result->IsBridge[e]);
+    for (VertexIndex v = 0; v < n; v++) assert(result->IsArticulation[v] == (v > 0 && v < n - 1));
+    
+    EdgeList_FreeEdgeList(el);
+}
+BICONNECTED_TEST_CASE(Biconnected_Components_SearchesAPathOfAMillionVertices)
+
+#endif /* BiconnectedTests_h */
@@ -0,0 +1,235 @@
+//
+//  CliqueTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef CliqueTests_h
+#define CliqueTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Clique.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define CLIQUE_TEST_CASE(name) TEST name(void) { _Setup_Clique_Tests(_##name); }
+
+static void _Setup_Clique_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 37 };
+    test(&options);
+}
+
+/// Every clique found, as a set of at most 64 vertices
+typedef struct
+{
+    uint64_t Sets[4096];
+    atomic_uint Count;
+    unsigned int Limit;
+} _CliqueTests_Found;
+
+static bool _CliqueTests_Add(void *context, unsigned int thread, const uint32_t *clique, unsigned int size)
+{
+    _CliqueTests_Found *found = context;
+    uint64_t set = 0;
+    for (unsigned int i = 0; i < size; i++) set |= 1ull << clique[i];
+    unsigned int at = atomic_fetch_add(&found->Count, 1);
+    assert(at < 4096);
+    found->Sets[at] = set;
+    return found->Limit == 0 || at + 1 < found->Limit;
+}
+
+static int _CliqueTests_Compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return x < y ? -1 : x > y;
+}
+
+/// - Returns: If every two vertices of the set are adjacent
+static bool _CliqueTests_IsClique(const BitMatrix *m, uint64_t set)
+{
+    for (VertexIndex u = 0; u < m->Vertices; u++)
+    {
+        if (!(set >> u & 1)) continue;
+        for (VertexIndex v = u + 1; v < m->Vertices; v++)
+        {
+            if (set >> v & 1 && !Bitset_Has(BitMatrix_Row(m, u), v)) return false;
+        }
+    }
+    return true;
+}
+
+TEST _Clique_Maximal_MatchesTryingEverySet(GeneratorOptions *options)
+{
+    for (int trial = 0; trial < 20; trial++)
+    {
+        // Arrange
+        options->Seed = trial;
+        const unsigned int n = 12;
+        EdgeList *el = Generators_ErdosRenyi(n, 0.2 + trial % 5 * 0.15, options);
+        Csr *csr = Csr_FromEdgeList(el);
+        BitMatrix *m = BitMatrix_FromCsr(csr);
+
+        // Cliques no vertex can be added to
+        uint64_t expected[4096];
+        unsigned int expectedCount = 0, largest = 0;
+        for (uint64_t set = 1; set < 1ull << n; set++)
+        {
+            if (!_CliqueTests_IsClique(m, set)) continue;
+            bool isMaximal = true;
+            for (VertexIndex v = 0; v < n && isMaximal; v++) isMaximal = set >> v & 1 || !_CliqueTests_IsClique(m, set | 1ull << v);
+            if (isMaximal) expected[expectedCount++] = set;
+            if ((unsigned int) __builtin_popcountll(set) > largest) largest = __builtin_popcountll(set);
+        }
+
+        for (unsigned int threads = 1; threads <= 3; threads += 2)
+        {
+            // Act
+            static _CliqueTests_Found found;
+            atomic_init(&found.Count, 0);
+            found.Limit = 0;
+            CliqueOptions clique = { .Threads = threads };
+            unsigned long long count = Clique_Maximal(m, &clique, _CliqueTests_Add, &found);
+            uint32_t vertices[12];
+            bool isOptimal = false;
+            unsigned int size = Clique_Maximum(m, &clique, vertices, &isOptimal);
+
+            // Assert
+            assert(count == expectedCount && atomic_load(&found.Count) == expectedCount);
+            qsort(found.Sets, expectedCount, sizeof(uint64_t), _CliqueTests_Compare);
+            for (unsigned int i = 0; i < expectedCount; i++) assert(found.Sets[i] == expected[i]);
+            assert(size == largest && isOptimal);
+            uint64_t set = 0;
+            for (unsigned int i = 0; i < size; i++) set |= 1ull << vertices[i];
+            assert((unsigned int) __builtin_popcountll(set) == size && _CliqueTests_IsClique(m, set));
+        }
+
+        BitMatrix_FreeBitMatrix(m);
+        Csr_FreeCsr(csr);
+        EdgeList_FreeEdgeList(el);
+    }
+}
+CLIQUE_TEST_CASE(Clique_Maximal_MatchesTryingEverySet)
+
+
+static bool _CliqueTests_Count(void *context, unsigned int thread, const uint32_t *clique, unsigned int size)
+{
+    atomic_ullong *counts = context;
+    assert(size == 10);
+    atomic_fetch_add(&counts[thread < 8 ? thread : 7], 1);
+    return true;
+}
+
+TEST _Clique_Maximal_StreamsTheCliquesOfAMoonMoserGraph(GeneratorOptions *_)
+{
+    // Arrange, ten parts of three vertices with every two vertices of different parts joined have 3^10 maximal cliques,
+    // the most any graph of 30 vertices has
+    EdgeList *el = EdgeList_CreateEdgeList(30, 0);
+    for (VertexIndex u = 0; u < 30; u++)
+    {
+        for (VertexIndex v = u + 1; v < 30; v++)
+        {
+            if (u / 3 != v / 3) EdgeList_Add(el, u, v, 1);
+        }
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    atomic_ullong counts[8] = {0};
+    CliqueOptions options = { .Threads = 4 };
+    uint32_t clique[30];
+    static _CliqueTests_Found found;
+    atomic_init(&found.Count, 0);
+    found.Limit = 100;
+
+    // Act
+    unsigned long long count = Clique_Maximal(m, &options, _CliqueTests_Count, counts);
+    unsigned long long stopped = Clique_Maximal(m, &options, _CliqueTests_Add, &found);
+    unsigned int size = Clique_Maximum(m, &options, clique, NULL);
+
+    // Assert, stopping may let the other threads hand over a clique each before they see it
+    unsigned long long total = 0;
+    for (int i = 0; i < 8; i++) total += counts[i];
+    assert(count == 59049 && total == count);
+    assert(stopped >= 100 && stopped < 100 + 4);
+    assert(size == 10);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        for (unsigned int j = i + 1; j < size; j++) assert(clique[i] / 3 != clique[j] / 3);
+    }
+
+    BitMatrix_FreeBitMatrix(m);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+CLIQUE_TEST_CASE(Clique_Maximal_StreamsTheCliquesOfAMoonMoserGraph)
+
+
+TEST _Clique_DegeneracyOrder_LeavesFewNeighborsAfterEachVertex(GeneratorOptions *options)
+{
+    // Arrange
+    EdgeList *el = Generators_BarabasiAlbert(2000, 4, options);
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    VertexIndex *order = malloc(m->Vertices * sizeof(VertexIndex));
+    uint32_t *positions = malloc(m->Vertices * sizeof(uint32_t));
+    bool isOptimal = false;
+    uint32_t clique[64];
+
+    // Act
+    unsigned int degeneracy = Clique_DegeneracyOrder(m, order);
+    unsigned int size = Clique_Maximum(m, NULL, clique, &isOptimal);
+
+    // Assert, preferential attachment of 4 edges per vertex leaves every vertex 4 neighbors added after it at most
+    assert(degeneracy == 4);
+    for (unsigned int i = 0; i < m->Vertices; i++) positions[order[i]] = i;
+    for (VertexIndex v = 0; v < m->Vertices; v++)
+    {
+        unsigned int later = 0;
+        for (VertexIndex u = 0; u < m->Vertices; u++) later += Bitset_Has(BitMatrix_Row(m, v), u) && positions[u] > positions[v];
+        assert(later <= degeneracy);
+    }
+    assert(isOptimal && size >= 2 && size <= degeneracy + 1);
+    for (unsigned int i = 0; i < size; i++)
+    {
+        for (unsigned int j = i + 1; j < size; j++) assert(Bitset_Has(BitMatrix_Row(m, clique[i]), clique[j]));
+    }
+
+    free(order);
+    free(positions);
+    BitMatrix_FreeBitMatrix(m);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+CLIQUE_TEST_CASE(Clique_DegeneracyOrder_LeavesFewNeighborsAfterEachVertex)
+
+
+TEST _Graph_MaximumClique_IgnoresDirectionAndSelfLoops(GeneratorOptions *_)
+{
+    // Arrange, a triangle against each other direction, a self loop and a path
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 6; i++) Graph_AddVertex(g);
+    Graph_AddEdge(g, 3, 4);
+    Graph_AddEdge(g, 5, 4);
+    Graph_AddEdge(g, 3, 5);
+    Graph_AddEdge(g, 2, 2);
+    Graph_AddEdge(g, 0, 1);
+    Graph_AddEdge(g, 1, 2);
+    VertexIndex clique[GRAPH_MAX_SIZE];
+    bool isOptimal = false;
+
+    // Act
+    unsigned int size = Graph_MaximumClique(g, NULL, clique, &isOptimal);
+
+    // Assert
+    assert(size == 3 && isOptimal);
+    bool isInClique[6] = {0};
+    for (unsigned int i = 0; i < size; i++) isInClique[clique[i]] = true;
+    assert(isInClique[3] && isInClique[4] && isInClique[5]);
+
+    Graph_FreeGraph(g);
+}
+CLIQUE_TEST_CASE(Graph_MaximumClique_IgnoresDirectionAndSelfLoops)
+
+#endif /* CliqueTests_h */
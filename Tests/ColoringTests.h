@@ -0,0 +1,148 @@
+//
+//  ColoringTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ColoringTests_h
+#define ColoringTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Coloring.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define COLORING_TEST_CASE(name) TEST name(void) { _Setup_Coloring_Tests(_##name); }
+
+static void _Setup_Coloring_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 31 };
+    test(&options);
+}
+
+/// Checks no two adjacent vertices share a color, and that exactly count colors are used
+static void _Coloring_AssertProper(const BitMatrix *m, const uint32_t *colors, unsigned int count)
+{
+    bool isUsed[64] = {0};
+    for (VertexIndex u = 0; u < m->Vertices; u++)
+    {
+        assert(colors[u] < count && colors[u] < 64);
+        isUsed[colors[u]] = true;
+        for (VertexIndex v = 0; v < m->Vertices; v++)
+        {
+            if (Bitset_Has(BitMatrix_Row(m, u), v)) assert(colors[u] != colors[v]);
+        }
+    }
+    for (unsigned int c = 0; c < count; c++) assert(isUsed[c]);
+}
+
+/// - Returns: If the vertices from v on can be colored with colors, trying every color of each vertex in turn
+static bool _Coloring_CanColor(const BitMatrix *m, uint32_t *colors, VertexIndex v, unsigned int count)
+{
+    if (v == m->Vertices) return true;
+    for (colors[v] = 0; colors[v] < count; colors[v]++)
+    {
+        bool isProper = true;
+        for (VertexIndex u = 0; u < v; u++) isProper &= !Bitset_Has(BitMatrix_Row(m, v), u) || colors[u] != colors[v];
+        if (isProper && _Coloring_CanColor(m, colors, v + 1, count)) return true;
+    }
+    return false;
+}
+
+TEST _Coloring_Chromatic_MatchesTryingEveryColoring(GeneratorOptions *options)
+{
+    for (int trial = 0; trial < 24; trial++)
+    {
+        // Arrange
+        options->Seed = trial;
+        EdgeList *el = Generators_ErdosRenyi(10, 0.2 + trial % 6 * 0.12, options);
+        Csr *csr = Csr_FromEdgeList(el);
+        BitMatrix *m = BitMatrix_FromCsr(csr);
+        uint32_t colors[10], tried[10];
+        unsigned int expected = 0;
+        while (!_Coloring_CanColor(m, tried, 0, expected)) expected++;
+
+        // Act, Assert, DSatur only bounds the chromatic number, on one thread or several
+        unsigned int upper = Coloring_DSatur(m, colors);
+        _Coloring_AssertProper(m, colors, upper);
+        assert(upper >= expected);
+        for (unsigned int threads = 1; threads <= 3; threads += 2)
+        {
+            bool isOptimal = false;
+            ColoringOptions coloring = { .Threads = threads };
+            assert(Coloring_Chromatic(m, &coloring, colors, &isOptimal) == expected && isOptimal);
+            _Coloring_AssertProper(m, colors, expected);
+        }
+
+        BitMatrix_FreeBitMatrix(m);
+        Csr_FreeCsr(csr);
+        EdgeList_FreeEdgeList(el);
+    }
+}
+COLORING_TEST_CASE(Coloring_Chromatic_MatchesTryingEveryColoring)
+
+
+TEST _Coloring_Chromatic_ColorsTheGrotzschGraphAndStopsWhenCancelled(GeneratorOptions *options)
+{
+    // Arrange, the Mycielskian of a 5 cycle has no triangle but needs 4 colors, so no clique proves it
+    EdgeList *el = EdgeList_CreateEdgeList(11, 0);
+    for (VertexIndex v = 0; v < 5; v++)
+    {
+        EdgeList_Add(el, v, (v + 1) % 5, 1);
+        EdgeList_Add(el, 5 + v, (v + 1) % 5, 1);
+        EdgeList_Add(el, 5 + v, (v + 4) % 5, 1);
+        EdgeList_Add(el, 5 + v, 10, 1);
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    BitMatrix *m = BitMatrix_FromCsr(csr);
+    uint32_t colors[11];
+    bool isOptimal = false;
+
+    // A dense graph too hard to finish before the flag is first looked at
+    EdgeList *dense = Generators_ErdosRenyi(60, 0.5, options);
+    Csr *denseCsr = Csr_FromEdgeList(dense);
+    BitMatrix *denseMatrix = BitMatrix_FromCsr(denseCsr);
+    uint32_t denseColors[60];
+    atomic_bool isCancelRequested = true;
+    ColoringOptions cancelled = { .Threads = 2, .IsCancelRequested = &isCancelRequested };
+
+    // Act, Assert
+    assert(Coloring_Chromatic(m, NULL, colors, &isOptimal) == 4 && isOptimal);
+    _Coloring_AssertProper(m, colors, 4);
+    unsigned int count = Coloring_Chromatic(denseMatrix, &cancelled, denseColors, &isOptimal);
+    assert(!isOptimal);
+    _Coloring_AssertProper(denseMatrix, denseColors, count);
+
+    BitMatrix_FreeBitMatrix(m);
+    BitMatrix_FreeBitMatrix(denseMatrix);
+    Csr_FreeCsr(csr);
+    Csr_FreeCsr(denseCsr);
+    EdgeList_FreeEdgeList(el);
+    EdgeList_FreeEdgeList(dense);
+}
+COLORING_TEST_CASE(Coloring_Chromatic_ColorsTheGrotzschGraphAndStopsWhenCancelled)
+
+
+TEST _Graph_ChromaticNumber_IgnoresDirectionAndSelfLoops(GeneratorOptions *_)
+{
+    // Arrange, a 6 cycle with alternating directions, a self loop and a chord making a triangle
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 6; i++) Graph_AddVertex(g);
+    for (VertexIndex v = 0; v < 6; v++) Graph_AddEdge(g, v % 2 == 0 ? v : (v + 1) % 6, v % 2 == 0 ? (v + 1) % 6 : v);
+    Graph_AddEdge(g, 3, 3);
+    unsigned int colors[GRAPH_MAX_SIZE];
+    bool isOptimal = false;
+
+    // Act, Assert
+    assert(Graph_ChromaticNumber(g, NULL, colors, &isOptimal) == 2 && isOptimal);
+    for (VertexIndex v = 0; v < 6; v++) assert(colors[v] != colors[(v + 1) % 6]);
+    Graph_AddEdge(g, 0, 2);
+    assert(Graph_ChromaticNumber(g, NULL, colors, &isOptimal) == 3 && isOptimal);
+
+    Graph_FreeGraph(g);
+}
+COLORING_TEST_CASE(Graph_ChromaticNumber_IgnoresDirectionAndSelfLoops)
+
+#endif /* ColoringTests_h */
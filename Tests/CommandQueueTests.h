@@ -0,0 +1,89 @@
+//
+//  CommandQueueTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef CommandQueueTests_h
+#define CommandQueueTests_h
+
+#include <assert.h>
+#include "../Graph Theorist Sketchpad/CommandQueue/CommandQueue.h"
+#include "Util/Counters.h"
+
+#define TEST static inline void
+#define COMMAND_QUEUE_TEST_CASE(name) TEST name(void) { _Setup_CommandQueue_Tests(_##name); }
+
+static void _Setup_CommandQueue_Tests(void (*test)(CommandQueue*, Journal*, GraphSketch*))
+{
+    CommandQueue *q = CommandQueue_CreateCommandQueue();
+    Journal *j = Journal_CreateJournal(SCENE_BOUNDING_BOX);
+    GraphSketch *gs = GraphSketch_CreateGraphSketch();
+    assert(q != NULL);
+    test(q, j, gs);
+    CommandQueue_FreeCommandQueue(q);
+    Journal_FreeJournal(j);
+    GraphSketch_FreeGraphSketch(gs);
+}
+
+TEST _CommandQueue_ApplyBulkEdits_RebuildsTheBvhTreeOnce(CommandQueue *q, Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    for (int i = 0; i < 20; i++)
+    {
+        CommandQueue_AddVertex(q, (Vector2) {30 + i * 25, 100 + (i % 2) * 100}, RED);
+    }
+    for (VertexIndex v = 1; v < 20; v++)
+    {
+        CommandQueue_AddEdge(q, v - 1, v, 2);
+    }
+    Counters_Reset();
+    
+    // Act
+    size_t applied = CommandQueue_Apply(q, j, gs);
+    
+    // Assert
+    assert(applied == 39 && q->Count == 0);
+    assert(Counters_Get(COUNTER_BVH_REBUILDS) == 1);
+    assert(!gs->IsInBatch && !gs->IsBvhTreeStale);
+    assert(gs->Graph->Vertices == 20 && gs->Graph->Edges == 19);
+    for (VertexIndex v = 0; v < 20; v++)
+    {
+        assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v].BoundingBox) == v);
+    }
+    
+    // Every edit is still undone on its own
+    assert(j->Count == 39);
+    Journal_Undo(j, gs);
+    assert(gs->Graph->Edges == 18);
+}
+COMMAND_QUEUE_TEST_CASE(CommandQueue_ApplyBulkEdits_RebuildsTheBvhTreeOnce)
+
+
+TEST _CommandQueue_MoveVertex_ReplacesTheQueuedMove(CommandQueue *q, Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    Counters_Reset();
+    
+    // Act
+    for (int x = 110; x <= 200; x += 10)
+    {
+        CommandQueue_MoveVertex(q, v1, (Vector2) {x, 100});
+    }
+    CommandQueue_EndMove(q);
+    
+    // Assert
+    assert(q->Count == 2);
+    CommandQueue_Apply(q, j, gs);
+    
+    // A short queue updates the Bvh Tree in place
+    assert(Counters_Get(COUNTER_BVH_REBUILDS) == 0);
+    assert(gs->IndexToPrimitiveMap[v1].Centroid.x == 200);
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v1].BoundingBox) == v1);
+    assert(j->Count == 2);
+}
+COMMAND_QUEUE_TEST_CASE(CommandQueue_MoveVertex_ReplacesTheQueuedMove)
+
+#endif /* CommandQueueTests_h */
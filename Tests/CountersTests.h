@@ -0,0 +1,74 @@
+//
+//  CountersTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef CountersTests_h
+#define CountersTests_h
+
+#include <assert.h>
+#include <string.h>
+#include "Graph.h"
+#include "Util/Counters.h"
+
+#define TEST static inline void
+#define COUNTERS_TEST_CASE(name) TEST name(void) { _Setup_Counters_Tests(_##name); }
+
+static void _Setup_Counters_Tests(void (*test)(Graph*))
+{
+    Graph *g = Graph_CreateGraph();
+    assert(g != NULL);
+    Counters_Reset();
+    test(g);
+    Graph_FreeGraph(g);
+}
+
+TEST _Counters_VertexDegree_CountsQueriesAndEdgesScanned(Graph *g)
+{
+    // Arrange
+    for (int i = 0; i < 3; i++)
+    {
+        Graph_AddVertex(g);
+    }
+    Graph_AddEdge(g, 0, 1);
+    Graph_AddEdge(g, 1, 2);
+    Graph_AddEdge(g, 2, 0);
+    
+    // Act
+    Graph_VertexDegree(g, 0);
+    Graph_VertexDegree(g, 1);
+    
+    // Assert
+    assert(Counters_Get(COUNTER_DEGREE_QUERIES) == 2);
+    assert(Counters_Get(COUNTER_DEGREE_EDGES_SCANNED) == 6);
+    assert(Counters_Get(COUNTER_BYTES_GRAPH) > 0);
+}
+COUNTERS_TEST_CASE(Counters_VertexDegree_CountsQueriesAndEdgesScanned)
+
+TEST _Counters_Write_WritesEveryCounterAndAverage(Graph *g)
+{
+    // Arrange
+    Graph_AddVertex(g);
+    Graph_AddVertex(g);
+    Graph_AddEdge(g, 0, 1);
+    Graph_VertexDegree(g, 0);
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Counters_Write(sink);
+    
+    // Assert
+    for (int kind = 0; kind < COUNTER_KIND_COUNT; kind++)
+    {
+        assert(strstr(sink->Buffer, Counters_Name(kind)) != NULL);
+    }
+    assert(strstr(sink->Buffer, "degree_queries 1\n") != NULL);
+    assert(strstr(sink->Buffer, "degree_edges_per_query 1.00\n") != NULL);
+    assert(strstr(sink->Buffer, "bvh_nodes_per_query 0.00\n") != NULL);
+    OutputSink_FreeOutputSink(sink);
+}
+COUNTERS_TEST_CASE(Counters_Write_WritesEveryCounterAndAverage)
+
+#endif /* CountersTests_h */
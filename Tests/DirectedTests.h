@@ -0,0 +1,210 @@
+//
+//  DirectedTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef DirectedTests_h
+#define DirectedTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Directed.h"
+#include "AllPairs.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define DIRECTED_TEST_CASE(name) TEST name(void) { _Setup_Directed_Tests(_##name); }
+
+static void _Setup_Directed_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 17, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 50 };
+    test(&options);
+}
+
+TEST _Directed_StronglyConnectedComponents_MatchesMutualReachability(GeneratorOptions *options)
+{
+    // Arrange, sparse enough for a mix of cycles and vertices outside of them
+    EdgeList *el = Generators_RandomEdges(300, 330, options);
+    Csr *csr = Csr_FromEdgeList(el);
+    const unsigned int n = csr->Vertices;
+    uint64_t *rows = malloc(n * ALL_PAIRS_ROW_WORDS(n) * sizeof(uint64_t));
+    uint32_t *components = malloc(n * sizeof(uint32_t));
+    AllPairs_TransitiveClosure(csr, rows);
+
+    // Act
+    unsigned int count = Directed_StronglyConnectedComponents(csr, components);
+    Csr *condensation = Directed_Condensation(csr, components, count);
+
+    // Assert, two vertices share a component exactly when each reaches the other
+    for (VertexIndex u = 0; u < n; u++)
+    {
+        assert(components[u] < count);
+        for (VertexIndex v = 0; v < n; v++)
+        {
+            bool isMutual = u == v || (AllPairs_IsReachable(rows, n, u, v) && AllPairs_IsReachable(rows, n, v, u));
+            assert((components[u] == components[v]) == isMutual);
+        }
+    }
+
+    // Every edge between components leads forward, and the condensation keeps the heaviest of each pair once
+    assert(condensation->Vertices == count);
+    bool *isJoined = calloc((size_t) count * count, sizeof(bool));
+    for (VertexIndex c = 0; c < count; c++)
+    {
+        for (uint64_t i = condensation->Offsets[c]; i < condensation->Offsets[c + 1]; i++)
+        {
+            const VertexIndex d = condensation->Targets[i];
+            const uint32_t e = condensation->Edges[i];
+            assert(c < d && !isJoined[c * count + d]);
+            isJoined[c * count + d] = true;
+            assert(components[el->Sources[e]] == c && components[el->Targets[e]] == d);
+            assert(condensation->Weights[i] == el->Weights[e]);
+        }
+    }
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        const uint32_t c = components[el->Sources[e]];
+        const uint32_t d = components[el->Targets[e]];
+        assert(c <= d && (c == d || isJoined[c * count + d]));
+        for (uint64_t i = condensation->Offsets[c]; c != d && i < condensation->Offsets[c + 1]; i++)
+        {
+            if (condensation->Targets[i] == d) assert(condensation->Weights[i] >= el->Weights[e]);
+        }
+    }
+
+    free(isJoined);
+    free(rows);
+    free(components);
+    Csr_FreeCsr(condensation);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+DIRECTED_TEST_CASE(Directed_StronglyConnectedComponents_MatchesMutualReachability)
+
+
+TEST _Directed_CriticalPath_MatchesTheHeaviestPathByBruteForce(GeneratorOptions *options)
+{
+    // Arrange, a random graph with every edge leading from a lower to a higher position of a shuffled order
+    const unsigned int n = 200;
+    EdgeList *random = Generators_RandomEdges(n, 800, options);
+    EdgeList *el = EdgeList_CreateEdgeList(n, random->Count);
+    VertexIndex *positions = malloc(n * sizeof(VertexIndex));
+    for (VertexIndex v = 0; v < n; v++) positions[v] = (v * 83) % n;
+    for (size_t e = 0; e < random->Count; e++)
+    {
+        VertexIndex u = random->Sources[e], v = random->Targets[e];
+        if (u == v) continue;
+        if (u > v) { VertexIndex t = u; u = v; v = t; }
+        EdgeList_Add(el, positions[u], positions[v], random->Weights[e]);
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    VertexIndex *order = malloc(n * sizeof(VertexIndex));
+    uint64_t *lengths = malloc(n * sizeof(uint64_t));
+    VertexIndex *predecessors = malloc(n * sizeof(VertexIndex));
+    uint32_t *edges = malloc(n * sizeof(uint32_t));
+
+    // The heaviest path ending at each vertex, relaxing every edge until nothing changes
+    uint64_t *expected = calloc(n, sizeof(uint64_t));
+    for (bool isChanged = true; isChanged;)
+    {
+        isChanged = false;
+        for (size_t e = 0; e < el->Count; e++)
+        {
+            uint64_t length = expected[el->Sources[e]] + el->Weights[e];
+            if (length > expected[el->Targets[e]]) expected[el->Targets[e]] = length, isChanged = true;
+        }
+    }
+
+    // Act
+    bool isAcyclic = Directed_TopologicalSort(csr, order);
+    VertexIndex end = Directed_CriticalPath(csr, order, lengths, predecessors, edges);
+
+    // Assert, every edge leads forward in the order and the path back from the end adds up to its length
+    assert(isAcyclic);
+    for (size_t k = 0; k < n; k++) positions[order[k]] = (VertexIndex) k;
+    for (size_t e = 0; e < el->Count; e++) assert(positions[el->Sources[e]] < positions[el->Targets[e]]);
+    assert(memcmp(lengths, expected, n * sizeof(uint64_t)) == 0);
+    for (VertexIndex v = 0; v < n; v++) assert(lengths[v] <= lengths[end]);
+    uint64_t total = 0;
+    for (VertexIndex v = end; edges[v] != DIRECTED_NO_EDGE; v = predecessors[v])
+    {
+        assert(el->Targets[edges[v]] == v && el->Sources[edges[v]] == predecessors[v]);
+        total += el->Weights[edges[v]];
+    }
+    assert(total == lengths[end]);
+
+    // A single edge back makes a cycle
+    EdgeList_Add(el, el->Targets[0], el->Sources[0], 1);
+    Csr *cyclic = Csr_FromEdgeList(el);
+    assert(!Directed_TopologicalSort(cyclic, order));
+
+    free(positions);
+    free(order);
+    free(lengths);
+    free(predecessors);
+    free(edges);
+    free(expected);
+    Csr_FreeCsr(csr);
+    Csr_FreeCsr(cyclic);
+    EdgeList_FreeEdgeList(el);
+    EdgeList_FreeEdgeList(random);
+}
+DIRECTED_TEST_CASE(Directed_CriticalPath_MatchesTheHeaviestPathByBruteForce)
+
+
+TEST _Directed_StronglyConnectedComponents_SearchesACycleOfAMillionVertices(GeneratorOptions *_)
+{
+    // Arrange, deeper than any call stack, first as a path and then closed into a cycle
+    const unsigned int n = 1000000;
+    EdgeList *el = EdgeList_CreateEdgeList(n, n);
+    for (VertexIndex v = 1; v < n; v++) EdgeList_Add(el, v, v - 1, 1);
+    Csr *path = Csr_FromEdgeList(el);
+    EdgeList_Add(el, 0, n - 1, 1);
+    Csr *cycle = Csr_FromEdgeList(el);
+    uint32_t *components = malloc(n * sizeof(uint32_t));
+
+    // Act, Assert, each vertex of the path is its own component, in the order of the path
+    assert(Directed_StronglyConnectedComponents(path, components) == n);
+    for (VertexIndex v = 0; v < n; v++) assert(components[v] == n - 1 - v);
+    assert(Directed_StronglyConnectedComponents(cycle, components) == 1);
+    for (VertexIndex v = 0; v < n; v++) assert(components[v] == 0);
+
+    free(components);
+    Csr_FreeCsr(path);
+    Csr_FreeCsr(cycle);
+    EdgeList_FreeEdgeList(el);
+}
+DIRECTED_TEST_CASE(Directed_StronglyConnectedComponents_SearchesACycleOfAMillionVertices)
+
+
+TEST _Graph_CriticalPath_FollowsTheDirectionOfEachEdge(GeneratorOptions *_)
+{
+    // Arrange
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 4; i++) Graph_AddVertex(g);
+    Graph_AddEdgeWeighted(g, 0, 1, 2);
+    Graph_AddEdgeWeighted(g, 1, 3, 2);
+    Graph_AddEdgeWeighted(g, 0, 2, 1);
+    Graph_AddEdgeWeighted(g, 2, 3, 5);
+    EdgeIndex path[GRAPH_MAX_SIZE];
+    unsigned int components[GRAPH_MAX_SIZE];
+    unsigned long long weight;
+
+    // Act, Assert
+    assert(Graph_StronglyConnectedComponents(g, components) == 4);
+    assert(Graph_CriticalPath(g, path, &weight));
+    assert(weight == 6 && path[0] == 2 && path[1] == 3 && path[2] == MST_NO_EDGE);
+
+    // An edge back from 3 joins every vertex into one component
+    Graph_AddEdgeWeighted(g, 3, 0, 1);
+    assert(Graph_StronglyConnectedComponents(g, components) == 1);
+    assert(!Graph_CriticalPath(g, path, &weight));
+    assert(weight == 0 && path[0] == MST_NO_EDGE);
+
+    Graph_FreeGraph(g);
+}
+DIRECTED_TEST_CASE(Graph_CriticalPath_FollowsTheDirectionOfEachEdge)
+
+#endif /* DirectedTests_h */
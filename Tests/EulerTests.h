@@ -0,0 +1,176 @@
+//
+//  EulerTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef EulerTests_h
+#define EulerTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Euler.h"
+
+#define TEST static inline void
+#define EULER_TEST_CASE(name) TEST name(void) { _Setup_Euler_Tests(_##name); }
+
+/// A random walk, so every closed part of it is a circuit, with repeated vertices, parallel edges and self loops
+static void _Setup_Euler_Tests(void (*test)(EdgeList*))
+{
+    const unsigned int n = 40;
+    EdgeList *el = EdgeList_CreateEdgeList(n, 0);
+    srand(23);
+    VertexIndex v = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        VertexIndex w = rand() % 8 == 0 ? v : (VertexIndex) (rand() % n);
+        EdgeList_Add(el, v, w, 1);
+        v = w;
+    }
+    EdgeList_Add(el, v, 0, 1);
+    test(el);
+    EdgeList_FreeEdgeList(el);
+}
+
+/// Checks the trail takes every edge of the list once, each from the vertex the one before it ended at
+static void _Euler_AssertWalk(const EdgeList *el, const uint32_t *trail, size_t length, VertexIndex start, bool isDirected,
+                              EulerKind kind)
+{
+    bool *isTaken = calloc(el->Count, sizeof(bool));
+    VertexIndex at = start;
+    for (size_t i = 0; i < length; i++)
+    {
+        const uint32_t e = trail[i];
+        assert(e < el->Count && !isTaken[e]);
+        isTaken[e] = true;
+        if (el->Sources[e] == at) at = el->Targets[e];
+        else
+        {
+            assert(!isDirected && el->Targets[e] == at);
+            at = el->Sources[e];
+        }
+    }
+    assert(length == el->Count);
+    assert((at == start) == (kind == EULER_CIRCUIT) || el->Count == 0);
+    free(isTaken);
+}
+
+TEST _Euler_Trail_WalksEveryEdgeOfAMultigraphOnce(EdgeList *el)
+{
+    // Arrange
+    Csr *out = Csr_FromEdgeList(el);
+    Csr *in = Csr_Transpose(out);
+    uint32_t *trail = malloc(el->Count * sizeof(uint32_t));
+    VertexIndex start;
+
+    // Act, Assert, the closed walk is a circuit either way
+    assert(Euler_Trail(out, NULL, trail, &start) == EULER_CIRCUIT);
+    _Euler_AssertWalk(el, trail, el->Count, start, true, EULER_CIRCUIT);
+    assert(Euler_Trail(out, in, trail, &start) == EULER_CIRCUIT);
+    _Euler_AssertWalk(el, trail, el->Count, start, false, EULER_CIRCUIT);
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(in);
+
+    // Without its last edge it is a trail, unless the walk was already back at 0
+    assert(el->Sources[el->Count - 1] != 0);
+    el->Count--;
+    out = Csr_FromEdgeList(el);
+    in = Csr_Transpose(out);
+    assert(Euler_Trail(out, NULL, trail, &start) == EULER_TRAIL);
+    assert(start == el->Targets[el->Count]);
+    _Euler_AssertWalk(el, trail, el->Count, start, true, EULER_TRAIL);
+    assert(Euler_Trail(out, in, trail, &start) == EULER_TRAIL);
+    _Euler_AssertWalk(el, trail, el->Count, start, false, EULER_TRAIL);
+
+    // An edge between two other vertices leaves four unbalanced, with an odd degree
+    VertexIndex end = el->Sources[el->Count];
+    VertexIndex x = end == 1 ? 3 : 1;
+    VertexIndex y = end == 2 ? 3 : 2;
+    EdgeList_Add(el, x, y, 1);
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(in);
+    out = Csr_FromEdgeList(el);
+    in = Csr_Transpose(out);
+    assert(Euler_Trail(out, NULL, trail, &start) == EULER_NONE);
+    assert(Euler_Trail(out, in, trail, &start) == EULER_NONE);
+
+    free(trail);
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(in);
+}
+EULER_TEST_CASE(Euler_Trail_WalksEveryEdgeOfAMultigraphOnce)
+
+
+TEST _Euler_Trail_FindsNoWalkAcrossComponents(EdgeList *_)
+{
+    // Arrange, two triangles with every degree even, and a self loop on its own
+    EdgeList *el = EdgeList_CreateEdgeList(7, 0);
+    for (VertexIndex v = 0; v < 3; v++) EdgeList_Add(el, v, (v + 1) % 3, 1);
+    Csr *out = Csr_FromEdgeList(el);
+    for (VertexIndex v = 0; v < 3; v++) EdgeList_Add(el, 3 + v, 3 + (v + 1) % 3, 1);
+    Csr *twoTriangles = Csr_FromEdgeList(el);
+    el->Count = 0;
+    EdgeList_Add(el, 6, 6, 1);
+    Csr *loop = Csr_FromEdgeList(el);
+    uint32_t trail[6];
+    VertexIndex start;
+
+    // Act, Assert
+    assert(Euler_Trail(out, NULL, trail, &start) == EULER_CIRCUIT && start == 0);
+    assert(Euler_Trail(twoTriangles, NULL, trail, &start) == EULER_NONE);
+    assert(Euler_Trail(loop, NULL, trail, &start) == EULER_CIRCUIT && start == 6 && trail[0] == 0);
+
+    Csr_FreeCsr(out);
+    Csr_FreeCsr(twoTriangles);
+    Csr_FreeCsr(loop);
+    EdgeList_FreeEdgeList(el);
+}
+EULER_TEST_CASE(Euler_Trail_FindsNoWalkAcrossComponents)
+
+
+TEST _Euler_Trail_WalksACycleOfAMillionVertices(EdgeList *_)
+{
+    // Arrange, deeper than any call stack
+    const unsigned int n = 1000000;
+    EdgeList *el = EdgeList_CreateEdgeList(n, n);
+    for (VertexIndex v = 0; v < n; v++) EdgeList_Add(el, v, (v + 1) % n, 1);
+    Csr *out = Csr_FromEdgeList(el);
+    uint32_t *trail = malloc(n * sizeof(uint32_t));
+    VertexIndex start;
+
+    // Act
+    EulerKind kind = Euler_Trail(out, NULL, trail, &start);
+
+    // Assert
+    assert(kind == EULER_CIRCUIT && start == 0);
+    for (uint32_t i = 0; i < n; i++) assert(trail[i] == i);
+
+    free(trail);
+    Csr_FreeCsr(out);
+    EdgeList_FreeEdgeList(el);
+}
+EULER_TEST_CASE(Euler_Trail_WalksACycleOfAMillionVertices)
+
+
+TEST _Graph_EulerTrail_WalksEdgesEitherWayUnlessDirected(EdgeList *_)
+{
+    // Arrange, a path whose middle edge points back
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 4; i++) Graph_AddVertex(g);
+    Graph_AddEdge(g, 0, 1);
+    Graph_AddEdge(g, 2, 1);
+    Graph_AddEdge(g, 2, 3);
+    EdgeIndex trail[GRAPH_MAX_SIZE + 1];
+    VertexIndex start;
+
+    // Act, Assert
+    assert(Graph_EulerTrail(g, true, trail, &start) == EULER_NONE && trail[0] == MST_NO_EDGE);
+    assert(Graph_EulerTrail(g, false, trail, &start) == EULER_TRAIL);
+    assert(start == 0 && trail[0] == 0 && trail[1] == 1 && trail[2] == 2 && trail[3] == MST_NO_EDGE);
+
+    Graph_FreeGraph(g);
+}
+EULER_TEST_CASE(Graph_EulerTrail_WalksEdgesEitherWayUnlessDirected)
+
+#endif /* EulerTests_h */
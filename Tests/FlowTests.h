@@ -0,0 +1,211 @@
+//
+//  FlowTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef FlowTests_h
+#define FlowTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Flow.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define FLOW_TEST_CASE(name) TEST name(void) { _Setup_Flow_Tests(_##name); }
+
+static void _Setup_Flow_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 41, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1,
+                                 .MaxWeight = 20 };
+    test(&options);
+}
+
+/// Checks no arc carries more than its capacity and every vertex but the source and target passes on all it takes in
+/// - Returns: The flow into the target
+static uint64_t _Flow_AssertValid(const FlowNetwork *n, const Csr *csr, VertexIndex source, VertexIndex target)
+{
+    int64_t *balances = calloc(n->Vertices, sizeof(int64_t));
+    uint64_t edges = 0;
+    for (VertexIndex u = 0; u < n->Vertices; u++)
+    {
+        for (uint64_t a = n->Offsets[u]; a < n->Offsets[u + 1]; a++)
+        {
+            if (n->Edges[a] == FLOW_NO_EDGE) continue;
+            const uint64_t flow = n->Residuals[n->Reverses[a]];
+            assert(n->Heads[n->Reverses[a]] == u && n->Edges[n->Reverses[a]] == FLOW_NO_EDGE);
+            balances[u] -= flow;
+            balances[n->Heads[a]] += flow;
+            edges++;
+        }
+    }
+    assert(edges == csr->Count);
+
+    // Each edge keeps its capacity split between its arc and the reverse
+    uint64_t *capacities = calloc(csr->Count, sizeof(uint64_t));
+    for (uint64_t a = 0; a < n->Count; a++)
+    {
+        if (n->Edges[a] != FLOW_NO_EDGE) capacities[n->Edges[a]] = n->Residuals[a] + n->Residuals[n->Reverses[a]];
+    }
+    for (uint64_t i = 0; i < csr->Count; i++) assert(capacities[csr->Edges[i]] == csr->Weights[i]);
+
+    for (VertexIndex v = 0; v < n->Vertices; v++) assert(v == source || v == target || balances[v] == 0);
+    assert(balances[source] == -balances[target]);
+    const uint64_t flow = balances[target];
+    free(capacities);
+    free(balances);
+    return flow;
+}
+
+/// - Returns: The total capacity of the edges from the side of the source to the other
+static uint64_t _Flow_CutCapacity(const Csr *csr, const bool *isSourceSide)
+{
+    uint64_t capacity = 0;
+    for (VertexIndex u = 0; u < csr->Vertices; u++)
+    {
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            if (isSourceSide[u] && !isSourceSide[csr->Targets[i]]) capacity += csr->Weights[i];
+        }
+    }
+    return capacity;
+}
+
+TEST _Flow_PushRelabel_MatchesTryingEveryCut(GeneratorOptions *options)
+{
+    for (int trial = 0; trial < 30; trial++)
+    {
+        // Arrange
+        options->Seed = trial;
+        const unsigned int n = 10;
+        EdgeList *el = Generators_ErdosRenyi(n, 0.15 + trial % 5 * 0.1, options);
+        Csr *csr = Csr_FromEdgeList(el);
+        FlowNetwork *network = Flow_CreateNetwork(csr);
+        const VertexIndex source = trial % n, target = (trial * 7 + 3) % n;
+
+        // The lightest cut of every set of vertices holding the source and not the target
+        uint64_t expected = UINT64_MAX;
+        for (unsigned int set = 0; set < 1u << n; set++)
+        {
+            if (!(set >> source & 1) || set >> target & 1) continue;
+            bool isSourceSide[10];
+            for (VertexIndex v = 0; v < n; v++) isSourceSide[v] = set >> v & 1;
+            uint64_t capacity = _Flow_CutCapacity(csr, isSourceSide);
+            if (capacity < expected) expected = capacity;
+        }
+
+        // Act, Assert, both algorithms leave a valid maximum flow and a cut of its value
+        bool isSourceSide[10];
+        assert(Flow_PushRelabel(network, source, target) == expected);
+        assert(_Flow_AssertValid(network, csr, source, target) == expected);
+        assert(Flow_MinCut(network, source, isSourceSide) >= 1 && isSourceSide[source] && !isSourceSide[target]);
+        assert(_Flow_CutCapacity(csr, isSourceSide) == expected);
+
+        Flow_Reset(network);
+        assert(_Flow_AssertValid(network, csr, source, target) == 0);
+        assert(Flow_Dinic(network, source, target) == expected);
+        assert(_Flow_AssertValid(network, csr, source, target) == expected);
+        Flow_MinCut(network, source, isSourceSide);
+        assert(_Flow_CutCapacity(csr, isSourceSide) == expected);
+
+        Flow_FreeNetwork(network);
+        Csr_FreeCsr(csr);
+        EdgeList_FreeEdgeList(el);
+    }
+}
+FLOW_TEST_CASE(Flow_PushRelabel_MatchesTryingEveryCut)
+
+
+TEST _Flow_Dinic_CountsEdgeDisjointPaths(GeneratorOptions *_)
+{
+    // Arrange, the source joined to 5 vertices, each joined to the same 3, each joined to the target
+    EdgeList *el = EdgeList_CreateEdgeList(10, 0);
+    for (VertexIndex a = 1; a <= 5; a++)
+    {
+        EdgeList_Add(el, 0, a, 1);
+        for (VertexIndex b = 6; b <= 8; b++) EdgeList_Add(el, a, b, 1);
+    }
+    for (VertexIndex b = 6; b <= 8; b++) EdgeList_Add(el, b, 9, 1);
+    EdgeList_Add(el, 9, 0, 1);
+    Csr *csr = Csr_FromEdgeList(el);
+    FlowNetwork *network = Flow_CreateNetwork(csr);
+    bool isSourceSide[10];
+
+    // Act, Assert
+    assert(network->IsUnitCapacity);
+    assert(Flow_Dinic(network, 0, 9) == 3);
+    assert(_Flow_AssertValid(network, csr, 0, 9) == 3);
+    assert(Flow_MinCut(network, 0, isSourceSide) == 9 && !isSourceSide[9]);
+    Flow_Reset(network);
+    assert(Flow_PushRelabel(network, 0, 9) == 3);
+    Flow_Reset(network);
+    assert(Flow_Dinic(network, 9, 5) == 1);
+    Flow_Reset(network);
+    assert(Flow_PushRelabel(network, 9, 0) == 1);
+    assert(Flow_MinCut(network, 9, isSourceSide) == 1);
+
+    Flow_FreeNetwork(network);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+FLOW_TEST_CASE(Flow_Dinic_CountsEdgeDisjointPaths)
+
+
+TEST _Flow_PushRelabel_AgreesWithDinicOnALargeNetwork(GeneratorOptions *options)
+{
+    // Arrange, a sparse network with many paths of many lengths between the two, and weights far apart
+    options->MaxWeight = 1000;
+    const unsigned int n = 20000;
+    EdgeList *el = Generators_ErdosRenyi(n, 6.0 / n, options);
+    Csr *csr = Csr_FromEdgeList(el);
+    FlowNetwork *network = Flow_CreateNetwork(csr);
+    bool *isSourceSide = malloc(n * sizeof(bool));
+
+    // Act
+    uint64_t pushed = Flow_PushRelabel(network, 0, n - 1);
+    uint64_t valid = _Flow_AssertValid(network, csr, 0, n - 1);
+    Flow_MinCut(network, 0, isSourceSide);
+    uint64_t cut = _Flow_CutCapacity(csr, isSourceSide);
+    Flow_Reset(network);
+    uint64_t layered = Flow_Dinic(network, 0, n - 1);
+
+    // Assert
+    assert(pushed > 0 && pushed == valid && pushed == cut && pushed == layered);
+    assert(_Flow_AssertValid(network, csr, 0, n - 1) == layered);
+
+    free(isSourceSide);
+    Flow_FreeNetwork(network);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+FLOW_TEST_CASE(Flow_PushRelabel_AgreesWithDinicOnALargeNetwork)
+
+
+TEST _Graph_MinCut_CutsTheLightestEdgesInTheirDirection(GeneratorOptions *_)
+{
+    // Arrange, two routes from 0 to 3, through 1 with a light edge and through 2 with a heavy one, and an edge back
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 5; i++) Graph_AddVertex(g);
+    Graph_AddEdgeWeighted(g, 0, 1, 5);
+    EdgeIndex e13 = Graph_AddEdgeWeighted(g, 1, 3, 2);
+    EdgeIndex e02 = Graph_AddEdgeWeighted(g, 0, 2, 3);
+    Graph_AddEdgeWeighted(g, 2, 3, 4);
+    Graph_AddEdgeWeighted(g, 3, 0, 9);
+    EdgeIndex cut[GRAPH_MAX_SIZE + 1];
+    unsigned long long flow = 0;
+
+    // Act, Assert
+    assert(Graph_MinCut(g, 0, 3, cut, &flow) == 2 && flow == 5);
+    assert((cut[0] == e13 && cut[1] == e02) || (cut[0] == e02 && cut[1] == e13));
+    assert(cut[2] == MST_NO_EDGE);
+    assert(Graph_MinCut(g, 3, 0, cut, &flow) == 1 && flow == 9 && cut[1] == MST_NO_EDGE);
+    assert(Graph_MinCut(g, 0, 4, cut, &flow) == 0 && flow == 0 && cut[0] == MST_NO_EDGE);
+    assert(Graph_MinCut(g, 1, 0, cut, &flow) == 1 && flow == 2 && cut[0] == e13);
+
+    Graph_FreeGraph(g);
+}
+FLOW_TEST_CASE(Graph_MinCut_CutsTheLightestEdgesInTheirDirection)
+
+#endif /* FlowTests_h */
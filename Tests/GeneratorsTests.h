@@ -0,0 +1,158 @@
+//
+//  GeneratorsTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef GeneratorsTests_h
+#define GeneratorsTests_h
+
+#include <assert.h>
+#include <string.h>
+#include "Generators.h"
+
+#define TEST static inline void
+#define GENERATORS_TEST_CASE(name) TEST name(void) { _Setup_Generators_Tests(_##name); }
+
+static void _Setup_Generators_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = {.Seed = 42};
+    test(&options);
+}
+
+/// - Returns: If no pair of vertices is joined twice in either direction, and there are no self loops
+static bool _Generators_IsSimple(const EdgeList *el)
+{
+    bool *seen = calloc((size_t) el->Vertices * el->Vertices, sizeof(bool));
+    bool isSimple = true;
+    for (size_t e = 0; e < el->Count && isSimple; e++)
+    {
+        VertexIndex u = el->Sources[e] < el->Targets[e] ? el->Sources[e] : el->Targets[e];
+        VertexIndex v = el->Sources[e] < el->Targets[e] ? el->Targets[e] : el->Sources[e];
+        isSimple = u != v && v < el->Vertices && !seen[(size_t) u * el->Vertices + v];
+        seen[(size_t) u * el->Vertices + v] = true;
+    }
+    free(seen);
+    return isSimple;
+}
+
+TEST _Generators_ErdosRenyi_IsReproducibleAndNearTheExpectedSize(GeneratorOptions *options)
+{
+    // Act
+    EdgeList *a = Generators_ErdosRenyi(2000, 0.01, options);
+    EdgeList *b = Generators_ErdosRenyi(2000, 0.01, options);
+    options->Seed++;
+    EdgeList *c = Generators_ErdosRenyi(2000, 0.01, options);
+    
+    // Assert
+    assert(a->Count == b->Count);
+    assert(memcmp(a->Sources, b->Sources, a->Count * sizeof(VertexIndex)) == 0);
+    assert(memcmp(a->Targets, b->Targets, a->Count * sizeof(VertexIndex)) == 0);
+    assert(a->Count != c->Count || memcmp(a->Targets, c->Targets, a->Count * sizeof(VertexIndex)) != 0);
+    
+    // 19990 expected, with a standard deviation near 140
+    assert(a->Count > 19000 && a->Count < 21000);
+    assert(_Generators_IsSimple(a));
+    for (size_t e = 0; e < a->Count; e++) assert(a->Sources[e] < a->Targets[e] && a->Weights[e] == 1);
+    
+    EdgeList_FreeEdgeList(a);
+    EdgeList_FreeEdgeList(b);
+    EdgeList_FreeEdgeList(c);
+    
+    // Directed pairs go both ways
+    options->IsDirected = true;
+    options->Weights = GENERATOR_WEIGHTS_UNIFORM;
+    options->MinWeight = 3;
+    options->MaxWeight = 5;
+    EdgeList *d = Generators_ErdosRenyi(300, 0.5, options);
+    size_t backwards = 0;
+    for (size_t e = 0; e < d->Count; e++)
+    {
+        assert(d->Sources[e] != d->Targets[e]);
+        assert(d->Weights[e] >= 3 && d->Weights[e] <= 5);
+        backwards += d->Sources[e] > d->Targets[e];
+    }
+    assert(d->Count > 43000 && d->Count < 46700);
+    assert(backwards > d->Count / 3);
+    EdgeList_FreeEdgeList(d);
+}
+GENERATORS_TEST_CASE(Generators_ErdosRenyi_IsReproducibleAndNearTheExpectedSize)
+
+
+TEST _Generators_StructuredGraphs_HaveTheirExactEdgeCounts(GeneratorOptions *options)
+{
+    // Arrange
+    GeneratorPoint positions[64];
+    options->Positions = positions;
+    
+    // Act, Assert
+    EdgeList *el = Generators_Grid(4, 5, options);
+    assert(el->Vertices == 20 && el->Count == 4 * 4 + 3 * 5 && _Generators_IsSimple(el));
+    assert(positions[6].X == 1.5f / 5 && positions[6].Y == 1.5f / 4);
+    EdgeList_FreeEdgeList(el);
+    
+    el = Generators_Complete(10, options);
+    assert(el->Count == 45 && _Generators_IsSimple(el));
+    EdgeList_FreeEdgeList(el);
+    
+    el = Generators_CompleteBipartite(3, 4, options);
+    assert(el->Vertices == 7 && el->Count == 12 && _Generators_IsSimple(el));
+    for (size_t e = 0; e < el->Count; e++) assert(el->Sources[e] < 3 && el->Targets[e] >= 3);
+    EdgeList_FreeEdgeList(el);
+    
+    el = Generators_BarabasiAlbert(64, 3, options);
+    assert(el->Count == 3 + 60 * 3 && _Generators_IsSimple(el));
+    EdgeList_FreeEdgeList(el);
+    
+    el = Generators_WattsStrogatz(64, 6, 0.3, options);
+    assert(el->Count == 64 * 3 && _Generators_IsSimple(el));
+    EdgeList_FreeEdgeList(el);
+    
+    // Both below and above half of the pairs
+    el = Generators_RandomEdges(64, 100, options);
+    assert(el->Count == 100 && _Generators_IsSimple(el));
+    EdgeList_FreeEdgeList(el);
+    el = Generators_RandomEdges(64, 2000, options);
+    assert(el->Count == 2000 && _Generators_IsSimple(el));
+    EdgeList_FreeEdgeList(el);
+}
+GENERATORS_TEST_CASE(Generators_StructuredGraphs_HaveTheirExactEdgeCounts)
+
+
+TEST _Generators_RandomGeometric_JoinsExactlyThePointsWithinRadius(GeneratorOptions *options)
+{
+    // Arrange
+    GeneratorPoint positions[500];
+    options->Positions = positions;
+    
+    // Act
+    EdgeList *el = Generators_RandomGeometric(500, 0.08, options);
+    
+    // Assert, against every pair
+    size_t expected = 0;
+    for (VertexIndex u = 0; u < 500; u++)
+    {
+        for (VertexIndex v = u + 1; v < 500; v++)
+        {
+            double dx = positions[u].X - positions[v].X;
+            double dy = positions[u].Y - positions[v].Y;
+            expected += dx * dx + dy * dy <= 0.08 * 0.08;
+        }
+    }
+    assert(el->Count == expected && _Generators_IsSimple(el));
+    
+    // Small enough for the sketchpad graph
+    EdgeList *small = Generators_Grid(3, 3, options);
+    Graph *g = Graph_FromEdgeList(small);
+    assert(g != NULL && g->Vertices == 9 && g->Edges == 12);
+    assert(Graph_IsAdjacent(g, 4, 5) && Graph_IsAdjacent(g, 4, 7));
+    assert(Graph_FromEdgeList(el) == NULL);
+    
+    Graph_FreeGraph(g);
+    EdgeList_FreeEdgeList(small);
+    EdgeList_FreeEdgeList(el);
+}
+GENERATORS_TEST_CASE(Generators_RandomGeometric_JoinsExactlyThePointsWithinRadius)
+
+#endif /* GeneratorsTests_h */
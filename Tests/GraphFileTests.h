@@ -0,0 +1,116 @@
+//
+//  GraphFileTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef GraphFileTests_h
+#define GraphFileTests_h
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <unistd.h>
+#include "GraphFile.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define GRAPH_FILE_TEST_CASE(name) TEST name(void) { _Setup_GraphFile_Tests(_##name); }
+
+static void _Setup_GraphFile_Tests(void (*test)(const char*))
+{
+    char path[] = "/tmp/GraphFileTestsXXXXXX";
+    close(mkstemp(path));
+    test(path);
+    unlink(path);
+}
+
+TEST _GraphFile_Open_ReadsTheRowsInPlace(const char *path)
+{
+    // Arrange
+    GeneratorOptions options = { .Seed = 3, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 50 };
+    EdgeList *el = Generators_BarabasiAlbert(5000, 3, &options);
+    Csr *csr = Csr_FromEdgeList(el);
+    GraphLoadError error = {0};
+    
+    // Act
+    assert(GraphFile_Write(path, csr, NULL, true));
+    GraphFile *file = GraphFile_Open(path, &error);
+    
+    // Assert
+    assert(file != NULL && GraphFile_Verify(file, &error));
+    assert(file->Csr.Vertices == csr->Vertices && file->Csr.Count == csr->Count && !file->Csr.IsOwned);
+    assert(memcmp(file->Csr.Offsets, csr->Offsets, (csr->Vertices + 1) * sizeof(uint64_t)) == 0);
+    assert(memcmp(file->Csr.Targets, csr->Targets, csr->Count * sizeof(VertexIndex)) == 0);
+    assert((uintptr_t) file->Csr.Targets % GRAPH_FILE_ALIGNMENT == 0 && (uintptr_t) file->Csr.Edges % GRAPH_FILE_ALIGNMENT == 0);
+    assert(file->Sketch.Positions == NULL && file->Sketch.Colors == NULL && file->Sketch.Labels == NULL);
+    
+    // The rows give back the list in its order
+    EdgeList *read = EdgeList_FromCsr(&file->Csr);
+    assert(read->Count == el->Count && read->Vertices == el->Vertices);
+    assert(memcmp(read->Sources, el->Sources, el->Count * sizeof(VertexIndex)) == 0);
+    assert(memcmp(read->Targets, el->Targets, el->Count * sizeof(VertexIndex)) == 0);
+    assert(memcmp(read->Weights, el->Weights, el->Count * sizeof(unsigned int)) == 0);
+    
+    EdgeList_FreeEdgeList(read);
+    GraphFile_Close(file);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+GRAPH_FILE_TEST_CASE(GraphFile_Open_ReadsTheRowsInPlace)
+
+
+TEST _GraphFile_Verify_RejectsCorruptFiles(const char *path)
+{
+    // Arrange
+    GeneratorOptions options = { .Seed = 3 };
+    EdgeList *el = Generators_Grid(20, 20, &options);
+    Csr *csr = Csr_FromEdgeList(el);
+    assert(GraphFile_Write(path, csr, NULL, true));
+    GraphLoadError error = {0};
+    
+    // Act, flip a byte of the targets
+    FILE *file = fopen(path, "r+b");
+    GraphFileHeader header;
+    assert(fread(&header, sizeof(header), 1, file) == 1);
+    fseek(file, (long) header.Sections[GRAPH_FILE_TARGETS].Offset + 5, SEEK_SET);
+    fputc(0x40, file);
+    fclose(file);
+    
+    // Assert
+    GraphFile *corrupt = GraphFile_Open(path, &error);
+    assert(corrupt != NULL);
+    assert(!GraphFile_Verify(corrupt, &error) && strcmp(error.Message, "checksum mismatch") == 0);
+    GraphFile_Close(corrupt);
+    
+    // Without a checksum only the rows are checked
+    assert(GraphFile_Write(path, csr, NULL, false));
+    file = fopen(path, "r+b");
+    fseek(file, (long) header.Sections[GRAPH_FILE_TARGETS].Offset + 3, SEEK_SET);
+    fputc(0x40, file);
+    fclose(file);
+    corrupt = GraphFile_Open(path, &error);
+    assert(!GraphFile_Verify(corrupt, &error) && strcmp(error.Message, "malformed rows") == 0);
+    GraphFile_Close(corrupt);
+    
+    // A truncated file is refused before any section is read
+    assert(truncate(path, (off_t) header.Sections[GRAPH_FILE_EDGES].Offset) == 0);
+    assert(GraphFile_Open(path, &error) == NULL && strcmp(error.Message, "truncated or malformed graph file") == 0);
+    
+    // A file written on a host of the other byte order is refused
+    assert(GraphFile_Write(path, csr, NULL, false));
+    uint16_t swapped = __builtin_bswap16(GRAPH_FILE_BYTE_ORDER);
+    file = fopen(path, "r+b");
+    fseek(file, (long) offsetof(GraphFileHeader, ByteOrder), SEEK_SET);
+    fwrite(&swapped, sizeof(swapped), 1, file);
+    fclose(file);
+    assert(GraphFile_Open(path, &error) == NULL && strcmp(error.Message, "graph file of the other byte order") == 0);
+    
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+GRAPH_FILE_TEST_CASE(GraphFile_Verify_RejectsCorruptFiles)
+
+#endif /* GraphFileTests_h */
@@ -9,7 +9,10 @@
 #define GraphSketchTests_h
 
 #include <assert.h>
+#include <string.h>
+#include <unistd.h>
 #include "../Graph Theorist Sketchpad/GraphSketch/GraphSketch.h"
+#include "Util/Counters.h"
 
 #define SCENE_BOUNDING_BOX ((Rectangle) {.x = 0, .y = 0, .width = 800, .height = 450})
 #define NO_COLLISION -1
@@ -29,6 +32,16 @@ bool CheckCollisionRecs(Rectangle a, Rectangle b)
 
 void DrawRectangleRec(Rectangle _, Color __) {}
 
+int ColorToInt(Color color)
+{
+    return (int) (((unsigned int) color.r << 24) | ((unsigned int) color.g << 16) | ((unsigned int) color.b << 8) | color.a);
+}
+
+Color GetColor(unsigned int hex)
+{
+    return (Color) {.r = hex >> 24 & 0xFF, .g = hex >> 16 & 0xFF, .b = hex >> 8 & 0xFF, .a = hex & 0xFF};
+}
+
 static void _Setup_GraphSketch_Tests(void (*test)(GraphSketch*))
 {
     GraphSketch *gs = GraphSketch_CreateGraphSketch();
@@ -117,4 +130,154 @@ TEST _GraphSketch_BvhTreeCollision_DoesNotCollideOutsideScene(GraphSketch *gs)
 }
 GRAPH_SKETCH_TEST_CASE(GraphSketch_BvhTreeCollision_DoesNotCollideOutsideScene)
 
+
+TEST _GraphSketch_BvhTreeCollision_CountsNodesVisitedAndPrimitiveTests(GraphSketch *gs)
+{
+    // Arrange
+    for (int i = 0; i < 8; i++)
+    {
+        GraphSketch_AddVertex(gs, (Vector2) {50 + i * 60, 100}, RED, SCENE_BOUNDING_BOX);
+    }
+    Counters_Reset();
+    _checkCollisionRecsCallCount = 0;
+    
+    // Act
+    int collision = BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[5].BoundingBox);
+    
+    // Assert
+    assert(collision == 5);
+    assert(Counters_Get(COUNTER_BVH_QUERIES) == 1);
+    assert(Counters_Get(COUNTER_BVH_PRIMITIVE_TESTS) > 0);
+    
+    // Every node and every primitive visited is tested once
+    assert(Counters_Get(COUNTER_BVH_NODES_VISITED) + Counters_Get(COUNTER_BVH_PRIMITIVE_TESTS) == _checkCollisionRecsCallCount);
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_BvhTreeCollision_CountsNodesVisitedAndPrimitiveTests)
+
+
+TEST _GraphSketch_AddManyVertices_EveryVertexCollidesWithItsOwnBoundingBox(GraphSketch *gs)
+{
+    // Arrange
+    for (int i = 0; i < 40; i++)
+    {
+        GraphSketch_AddVertex(gs, (Vector2) {30 + (i % 8) * 60, 30 + (i / 8) * 60}, RED, SCENE_BOUNDING_BOX);
+    }
+    
+    // Assert
+    for (VertexIndex vi = 0; vi < gs->Graph->Vertices; vi++)
+    {
+        assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[vi].BoundingBox) == vi);
+    }
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_AddManyVertices_EveryVertexCollidesWithItsOwnBoundingBox)
+
+
+TEST _GraphSketch_MoveVertex_CollidesOnlyAtNewPosition(GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = GraphSketch_AddVertex(gs, (Vector2) {100, 100}, RED, SCENE_BOUNDING_BOX);
+    GraphSketch_AddVertex(gs, (Vector2) {300, 100}, RED, SCENE_BOUNDING_BOX);
+    GraphSketch_AddVertex(gs, (Vector2) {100, 300}, RED, SCENE_BOUNDING_BOX);
+    Rectangle old = gs->IndexToPrimitiveMap[v1].BoundingBox;
+    
+    // Act
+    GraphSketch_MoveVertex(gs, v1, (Vector2) {500, 400});
+    
+    // Assert
+    assert(BvhTree_CheckCollision(gs->BvhTree, old) == NO_COLLISION);
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v1].BoundingBox) == v1);
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_MoveVertex_CollidesOnlyAtNewPosition)
+
+
+TEST _GraphSketch_RemoveLastVertexAndEdge_RevertsGraphAndBvhTree(GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = GraphSketch_AddVertex(gs, (Vector2) {100, 100}, RED, SCENE_BOUNDING_BOX);
+    VertexIndex v2 = GraphSketch_AddVertex(gs, (Vector2) {300, 100}, RED, SCENE_BOUNDING_BOX);
+    GraphSketch_AddEdge(gs, v1, v2, 1);
+    Rectangle removed = gs->IndexToPrimitiveMap[v2].BoundingBox;
+    
+    // Act
+    GraphSketch_RemoveLastEdge(gs, false);
+    GraphSketch_RemoveLastVertex(gs);
+    
+    // Assert
+    assert(gs->Graph->Vertices == 1 && gs->Graph->Edges == 0);
+    assert(Graph_IsNotAdjacent(gs->Graph, v1, v2));
+    assert(gs->VertexIndexToDegreeMap[v1] == 0 && gs->VertexIndexToDegreeMap[v2] == 0);
+    assert(BvhTree_CheckCollision(gs->BvhTree, removed) == NO_COLLISION);
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v1].BoundingBox) == v1);
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_RemoveLastVertexAndEdge_RevertsGraphAndBvhTree)
+
+
+TEST _GraphSketch_AddEdgeList_PlacesEveryVertexInTheScene(GraphSketch *gs)
+{
+    // Arrange
+    GeneratorPoint positions[16];
+    GeneratorOptions options = {.Seed = 7, .Positions = positions};
+    EdgeList *el = Generators_Grid(4, 4, &options);
+    GraphSketch_AddVertex(gs, (Vector2) {400, 400}, RED, SCENE_BOUNDING_BOX);
+    Counters_Reset();
+    
+    // Act
+    GraphSketch_AddEdgeList(gs, el, positions, BLUE, SCENE_BOUNDING_BOX);
+    
+    // Assert
+    assert(gs->Graph->Vertices == 17 && gs->Graph->Edges == 24);
+    assert(Graph_IsAdjacent(gs->Graph, 1, 2) && Graph_IsAdjacent(gs->Graph, 1, 5));
+    assert(Counters_Get(COUNTER_BVH_REBUILDS) == 1);
+    for (VertexIndex v = 1; v < 17; v++)
+    {
+        Vector2 centroid = gs->IndexToPrimitiveMap[v].Centroid;
+        assert(centroid.x >= GRAPH_VERTEX_RADIUS && centroid.x <= SCENE_BOUNDING_BOX.width - GRAPH_VERTEX_RADIUS);
+        assert(centroid.y >= GRAPH_VERTEX_RADIUS && centroid.y <= SCENE_BOUNDING_BOX.height - GRAPH_VERTEX_RADIUS);
+        assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v].BoundingBox) == v);
+    }
+    EdgeList_FreeEdgeList(el);
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_AddEdgeList_PlacesEveryVertexInTheScene)
+
+TEST _GraphSketch_Open_RestoresTheSavedSketch(GraphSketch *gs)
+{
+    // Arrange
+    char path[] = "/tmp/GraphSketchTestsXXXXXX";
+    close(mkstemp(path));
+    GraphSketch_AddVertex(gs, (Vector2) {100, 120}, RED, SCENE_BOUNDING_BOX);
+    GraphSketch_AddVertex(gs, (Vector2) {300, 200}, BLUE, SCENE_BOUNDING_BOX);
+    GraphSketch_AddVertex(gs, (Vector2) {200, 400}, RED, SCENE_BOUNDING_BOX);
+    GraphSketch_AddEdge(gs, 1, 0, 7);
+    GraphSketch_AddEdge(gs, 0, 1, 1);
+    GraphSketch_AddEdge(gs, 2, 2, 3);
+    strcpy(gs->IndexToDrawableVertexMap[2].Label, "hub");
+    GraphSketch *opened = GraphSketch_CreateGraphSketch();
+    GraphLoadError error = {0};
+    
+    // Act
+    assert(GraphSketch_Save(gs, path));
+    assert(GraphSketch_Open(opened, path, WHITE, SCENE_BOUNDING_BOX, &error));
+    
+    // Assert, edges keep their index, direction and weight
+    assert(opened->Graph->Vertices == 3 && opened->Graph->Edges == 3);
+    for (VertexIndex v = 0; v < 3; v++)
+    {
+        assert(opened->IndexToPrimitiveMap[v].Centroid.x == gs->IndexToPrimitiveMap[v].Centroid.x);
+        assert(opened->IndexToPrimitiveMap[v].Centroid.y == gs->IndexToPrimitiveMap[v].Centroid.y);
+        assert(ColorToInt(opened->IndexToDrawableVertexMap[v].Color) == ColorToInt(gs->IndexToDrawableVertexMap[v].Color));
+        assert(strcmp(opened->IndexToDrawableVertexMap[v].Label, gs->IndexToDrawableVertexMap[v].Label) == 0);
+        assert(opened->VertexIndexToDegreeMap[v] == gs->VertexIndexToDegreeMap[v]);
+        for (EdgeIndex e = 0; e < 3; e++)
+        {
+            assert(opened->Graph->IncidenceMatrix[v][e] == gs->Graph->IncidenceMatrix[v][e]);
+        }
+    }
+    assert(opened->DrawableEdgeList[1].Curvature == gs->DrawableEdgeList[1].Curvature);
+    assert(BvhTree_CheckCollision(opened->BvhTree, opened->IndexToPrimitiveMap[1].BoundingBox) == 1);
+    
+    GraphSketch_FreeGraphSketch(opened);
+    unlink(path);
+}
+GRAPH_SKETCH_TEST_CASE(GraphSketch_Open_RestoresTheSavedSketch)
+
 #endif /* GraphSketchTests_h */
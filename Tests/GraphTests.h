@@ -13,6 +13,7 @@
 #include <assert.h>
 #include <sys/types.h>
 #include <stdbool.h>
+#include <string.h>
 #include "Graph.h"
 
 #define TEST static inline void
@@ -269,4 +270,285 @@ TEST _Graph_KruskalsAlgorithmWithNoEdges_NoMST(Graph *g)
 GRAPH_TEST_CASE(Graph_KruskalsAlgorithmWithNoEdges_NoMST)
 
 
+TEST _Graph_WriteAdjMatrixDense_WritesEveryEntry(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    VertexIndex v3 = Graph_AddVertex(g);
+    Graph_AddEdge(g, v1, v2);
+    Graph_AddEdge(g, v3, v3);
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Graph_WriteAdjMatrix(g, sink, GRAPH_DUMP_DENSE);
+    
+    // Assert
+    assert(strcmp(sink->Buffer, "0 1 0\n0 0 0\n0 0 1\n") == 0);
+    assert(sink->Cursor == strlen(sink->Buffer));
+    OutputSink_FreeOutputSink(sink);
+}
+GRAPH_TEST_CASE(Graph_WriteAdjMatrixDense_WritesEveryEntry)
+
+
+TEST _Graph_WriteIncidenceMatrixSparse_WritesOnlyNonZeroEntries(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    Graph_AddEdgeWeighted(g, v1, v2, 250);
+    Graph_AddEdge(g, v2, v2);
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Graph_WriteIncidenceMatrix(g, sink, GRAPH_DUMP_SPARSE);
+    
+    // Assert
+    assert(strcmp(sink->Buffer, "0 0 250\n1 0 -1\n1 1 1\n") == 0);
+    OutputSink_FreeOutputSink(sink);
+}
+GRAPH_TEST_CASE(Graph_WriteIncidenceMatrixSparse_WritesOnlyNonZeroEntries)
+
+
+TEST _Graph_WriteAdjMatrixSparse_WritesEachEntryOnceInRowOrder(Graph *g)
+{
+    // Arrange, edges out of order with a parallel edge
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    VertexIndex v3 = Graph_AddVertex(g);
+    Graph_AddEdge(g, v3, v1);
+    Graph_AddEdge(g, v1, v3);
+    Graph_AddEdge(g, v1, v2);
+    Graph_AddEdge(g, v1, v3);
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Graph_WriteAdjMatrix(g, sink, GRAPH_DUMP_SPARSE);
+    
+    // Assert
+    assert(strcmp(sink->Buffer, "0 1 1\n0 2 1\n2 0 1\n") == 0);
+    OutputSink_FreeOutputSink(sink);
+}
+GRAPH_TEST_CASE(Graph_WriteAdjMatrixSparse_WritesEachEntryOnceInRowOrder)
+
+
+TEST _Graph_WriteIncidenceMatrixRunLength_CollapsesRuns(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    Graph_AddEdge(g, v1, v2);
+    Graph_AddEdge(g, v1, v2);
+    Graph_AddEdge(g, v1, v2);
+    Graph_AddEdge(g, v2, v2);
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Graph_WriteIncidenceMatrix(g, sink, GRAPH_DUMP_RUN_LENGTH);
+    
+    // Assert
+    assert(strcmp(sink->Buffer, "1*3 0\n-1*3 1\n") == 0);
+    OutputSink_FreeOutputSink(sink);
+}
+GRAPH_TEST_CASE(Graph_WriteIncidenceMatrixRunLength_CollapsesRuns)
+
+
+TEST _Graph_DumpIncidenceMatrixLargerThanBuffer_TruncatesWithoutOverflow(Graph *g)
+{
+    // Arrange
+    for (int i = 0; i < GRAPH_MAX_SIZE; i++)
+    {
+        Graph_AddVertex(g);
+    }
+    for (int i = 0; i + 1 < GRAPH_MAX_SIZE; i++)
+    {
+        Graph_AddEdgeWeighted(g, i, i + 1, 1000);
+    }
+    StringBuffer buffer;
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    
+    // Act
+    Graph_DumpIncidenceMatrix(g, buffer);
+    Graph_WriteIncidenceMatrix(g, sink, GRAPH_DUMP_DENSE);
+    
+    // Assert
+    assert(strlen(buffer) == sizeof(StringBuffer) - 1);
+    assert(strncmp(buffer, sink->Buffer, sizeof(StringBuffer) - 1) == 0);
+    assert(sink->Cursor > sizeof(StringBuffer));
+    OutputSink_FreeOutputSink(sink);
+}
+GRAPH_TEST_CASE(Graph_DumpIncidenceMatrixLargerThanBuffer_TruncatesWithoutOverflow)
+
+
+TEST _Graph_AddVertexAndEdge_IncrementsVersionAndLogsChanges(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    
+    // Act
+    EdgeIndex e1 = Graph_AddEdge(g, v1, v2);
+    const GraphChange *vertexChange = Graph_ChangeAt(g, 2);
+    const GraphChange *edgeChange = Graph_ChangeAt(g, 3);
+    
+    // Assert
+    assert(g->Version == 3);
+    assert(vertexChange->Kind == GRAPH_CHANGE_ADD_VERTEX && vertexChange->V1 == v2);
+    assert(edgeChange->Kind == GRAPH_CHANGE_ADD_EDGE && edgeChange->V1 == v1 && edgeChange->V2 == v2 && edgeChange->E == e1);
+    assert(Graph_ChangeAt(g, 0) == NULL);
+    assert(Graph_ChangeAt(g, 4) == NULL);
+}
+GRAPH_TEST_CASE(Graph_AddVertexAndEdge_IncrementsVersionAndLogsChanges)
+
+
+TEST _Graph_ChangeAt_OlderThanChangeLogIsNull(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    for (int i = 0; i < GRAPH_CHANGE_LOG_SIZE; i++)
+    {
+        Graph_AddEdge(g, v1, v1);
+    }
+    
+    // Assert
+    assert(Graph_ChangeAt(g, 1) == NULL);
+    assert(Graph_ChangeAt(g, 2) != NULL);
+    assert(Graph_ChangeAt(g, g->Version)->E == GRAPH_CHANGE_LOG_SIZE - 1);
+}
+GRAPH_TEST_CASE(Graph_ChangeAt_OlderThanChangeLogIsNull)
+
+
+TEST _Graph_SnapshotThenMutate_SnapshotIsUnchanged(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    Graph_AddEdge(g, v1, v2);
+    Graph *snapshot = Graph_Snapshot(g);
+    
+    // Act
+    EdgeIndex e2 = Graph_AddEdge(g, v2, v1);
+    VertexIndex v3 = Graph_AddVertex(g);
+    Graph_AddEdgeWeighted(g, v3, v1, 5);
+    
+    // Assert
+    assert(snapshot->Vertices == 2 && snapshot->Edges == 1 && snapshot->Version == 3);
+    assert(snapshot->AdjMatrix[v1][v2]);
+    assert(!snapshot->AdjMatrix[v2][v1]);
+    assert(snapshot->IncidenceMatrix[v2][e2] == INCIDENCE_MATRIX_NO_VALUE);
+    assert(g->AdjMatrix[v2][v1]);
+    assert(g->IncidenceMatrix[v3][g->Edges - 1] == 5);
+    Graph_FreeGraph(snapshot);
+}
+GRAPH_TEST_CASE(Graph_SnapshotThenMutate_SnapshotIsUnchanged)
+
+
+TEST _Graph_SnapshotThenMutate_CopiesOnlyTheTouchedChunk(Graph *g)
+{
+    // Arrange
+    VertexIndex first = Graph_AddVertex(g);
+    VertexIndex last = first;
+    while (last / GRAPH_CHUNK_ROWS == first / GRAPH_CHUNK_ROWS)
+    {
+        last = Graph_AddVertex(g);
+    }
+    Graph_AddEdge(g, first, last);
+    Graph_AddEdge(g, last, first);
+    Graph *snapshot = Graph_Snapshot(g);
+    
+    // Act
+    Graph_AddEdge(g, last, last);
+    
+    // Assert
+    assert(g->AdjMatrix[first] == snapshot->AdjMatrix[first]);
+    assert(g->AdjMatrix[last] != snapshot->AdjMatrix[last]);
+    assert(g->IncidenceMatrix[first] == snapshot->IncidenceMatrix[first]);
+    assert(g->IncidenceMatrix[last] != snapshot->IncidenceMatrix[last]);
+    assert(!snapshot->AdjMatrix[last][last]);
+    Graph_FreeGraph(snapshot);
+}
+GRAPH_TEST_CASE(Graph_SnapshotThenMutate_CopiesOnlyTheTouchedChunk)
+
+
+TEST _Graph_FreeGraph_SnapshotOutlivesGraph(Graph *g)
+{
+    // Arrange
+    Graph *live = Graph_CreateGraph();
+    VertexIndex v1 = Graph_AddVertex(live);
+    EdgeIndex e1 = Graph_AddEdgeWeighted(live, v1, v1, 3);
+    Graph *snapshot = Graph_Snapshot(live);
+    
+    // Act
+    Graph_FreeGraph(live);
+    
+    // Assert
+    assert(snapshot->AdjMatrix[v1][v1]);
+    assert(snapshot->IncidenceMatrix[v1][e1] == 3);
+    Graph_FreeGraph(snapshot);
+}
+GRAPH_TEST_CASE(Graph_FreeGraph_SnapshotOutlivesGraph)
+
+
+TEST _Graph_ReadEdgeList_AddsVerticesAndWeightedEdges(Graph *_)
+{
+    // Arrange
+    char text[] = "# comment\n0 1\n\n1 2 7\n3 3\n";
+    FILE *file = fmemopen(text, strlen(text), "r");
+    
+    // Act
+    Graph *g = Graph_ReadEdgeList(file, NULL);
+    fclose(file);
+    
+    // Assert
+    assert(g != NULL);
+    assert(g->Vertices == 4 && g->Edges == 3);
+    assert(Graph_IsAdjacent(g, 0, 1) && Graph_IsAdjacent(g, 1, 2) && Graph_IsAdjacent(g, 3, 3));
+    assert(g->IncidenceMatrix[1][1] == 7);
+    Graph_FreeGraph(g);
+}
+GRAPH_TEST_CASE(Graph_ReadEdgeList_AddsVerticesAndWeightedEdges)
+
+
+TEST _Graph_ReadEdgeListMalformed_ReportsTheLine(Graph *_)
+{
+    // Arrange
+    char text[] = "0 1\n1 x\n";
+    FILE *file = fmemopen(text, strlen(text), "r");
+    GraphLoadError error = {};
+    
+    // Act
+    Graph *g = Graph_ReadEdgeList(file, &error);
+    fclose(file);
+    
+    // Assert
+    assert(g == NULL);
+    assert(error.Line == 2);
+    assert(error.Message != NULL);
+}
+GRAPH_TEST_CASE(Graph_ReadEdgeListMalformed_ReportsTheLine)
+
+
+TEST _Graph_ConnectedComponents_IgnoresDirection(Graph *g)
+{
+    // Arrange
+    VertexIndex v1 = Graph_AddVertex(g);
+    VertexIndex v2 = Graph_AddVertex(g);
+    VertexIndex v3 = Graph_AddVertex(g);
+    VertexIndex v4 = Graph_AddVertex(g);
+    Graph_AddEdge(g, v2, v1);
+    Graph_AddEdge(g, v2, v3);
+    Graph_AddEdge(g, v4, v4);
+    unsigned int components[GRAPH_MAX_SIZE];
+    
+    // Act
+    unsigned int count = Graph_ConnectedComponents(g, components);
+    
+    // Assert
+    assert(count == 2);
+    assert(components[v1] == components[v2] && components[v2] == components[v3]);
+    assert(components[v4] != components[v1]);
+}
+GRAPH_TEST_CASE(Graph_ConnectedComponents_IgnoresDirection)
+
+
 #endif /* GraphTests_h */
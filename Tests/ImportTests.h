@@ -0,0 +1,154 @@
+//
+//  ImportTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ImportTests_h
+#define ImportTests_h
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Import.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define IMPORT_TEST_CASE(name) TEST name(void) { _Setup_Import_Tests(_##name); }
+
+static void _Setup_Import_Tests(void (*test)(GraphLoadError*))
+{
+    GraphLoadError error = {};
+    test(&error);
+}
+
+static EdgeList *_Import_ReadString(const char *text, ImportFormat format, GraphLoadError *error)
+{
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    fputs(text, file);
+    rewind(file);
+    EdgeList *el = Import_Read(file, format, error);
+    fclose(file);
+    return el;
+}
+
+static bool _Import_HasEdges(const EdgeList *el, const VertexIndex (*edges)[3], size_t count)
+{
+    if (el->Count != count) return false;
+    for (size_t e = 0; e < count; e++)
+    {
+        if (el->Sources[e] != edges[e][0] || el->Targets[e] != edges[e][1] || el->Weights[e] != edges[e][2]) return false;
+    }
+    return true;
+}
+
+TEST _Import_Read_ParsesEveryFormat(GraphLoadError *error)
+{
+    // Arrange, the same weighted triangle and isolated vertex in each format
+    const VertexIndex triangle[][3] = { { 0, 1, 4 }, { 1, 2, 1 }, { 2, 0, 7 } };
+    const char *edgeList = "# triangle\n0 1 4\r\n\n  1\t2\n% trailing comment\n2 0 7";
+    const char *dimacs = "c triangle\np sp 4 3\na 1 2 4\na 2 3\na 3 1 7\n";
+    const char *matrixMarket = "%%MatrixMarket matrix coordinate real general\n% triangle\n4 4 3\n1 2 4.2\n2 3 0.1\n3 1 -6.5e0\n";
+    const char *metis = "% triangle\n4 3 1\n2 4 3 7\n1 4 3 1\n1 7 2 1\n\n";
+    
+    // Act, Assert
+    EdgeList *el = _Import_ReadString(edgeList, IMPORT_EDGE_LIST, error);
+    assert(el != NULL && el->Vertices == 3 && _Import_HasEdges(el, triangle, 3));
+    EdgeList_FreeEdgeList(el);
+    
+    el = _Import_ReadString(dimacs, IMPORT_DIMACS, error);
+    assert(el != NULL && el->Vertices == 4 && _Import_HasEdges(el, triangle, 3));
+    EdgeList_FreeEdgeList(el);
+    
+    el = _Import_ReadString(matrixMarket, IMPORT_MATRIX_MARKET, error);
+    assert(el != NULL && el->Vertices == 4 && _Import_HasEdges(el, triangle, 3));
+    EdgeList_FreeEdgeList(el);
+    
+    // METIS lists each edge from both ends, and keeps it from the smaller
+    const VertexIndex metisTriangle[][3] = { { 0, 1, 4 }, { 0, 2, 7 }, { 1, 2, 1 } };
+    el = _Import_ReadString(metis, IMPORT_METIS, error);
+    assert(el != NULL && el->Vertices == 4 && _Import_HasEdges(el, metisTriangle, 3));
+    EdgeList_FreeEdgeList(el);
+    
+    assert(Import_FormatOfPath("roads.gr") == IMPORT_DIMACS);
+    assert(Import_FormatOfPath("data/web.MTX") == IMPORT_MATRIX_MARKET);
+    assert(Import_FormatOfPath("mesh.graph") == IMPORT_METIS);
+    assert(Import_FormatOfPath("v1.0/edges") == IMPORT_EDGE_LIST);
+}
+IMPORT_TEST_CASE(Import_Read_ParsesEveryFormat)
+
+
+TEST _Import_Read_ReportsTheLineOfMalformedInput(GraphLoadError *error)
+{
+    // Act, Assert
+    assert(_Import_ReadString("0 1\n\n1 x\n", IMPORT_EDGE_LIST, error) == NULL);
+    assert(error->Line == 3 && strcmp(error->Message, "expected \"v1 v2 [weight]\"") == 0);
+    
+    assert(_Import_ReadString("0 1 0\n", IMPORT_EDGE_LIST, error) == NULL);
+    assert(error->Line == 1 && strcmp(error->Message, "weights must be between 1 and INT_MAX") == 0);
+    
+    assert(_Import_ReadString("p edge 3 1\ne 0 1\n", IMPORT_DIMACS, error) == NULL);
+    assert(error->Line == 2 && strcmp(error->Message, "vertices are numbered from 1") == 0);
+    
+    assert(_Import_ReadString("%%MatrixMarket matrix array real general\n", IMPORT_MATRIX_MARKET, error) == NULL);
+    assert(error->Line == 1 && strcmp(error->Message, "only coordinate matrices are supported") == 0);
+    
+    assert(_Import_ReadString("%%MatrixMarket matrix coordinate pattern symmetric\n", IMPORT_MATRIX_MARKET, error) == NULL);
+    assert(error->Line == 1 && strcmp(error->Message, "expected \"rows columns entries\"") == 0);
+    
+    assert(_Import_ReadString("2 1\n2\n1\n1\n", IMPORT_METIS, error) == NULL);
+    assert(error->Line == 4 && strcmp(error->Message, "more vertex lines than vertices") == 0);
+}
+IMPORT_TEST_CASE(Import_Read_ReportsTheLineOfMalformedInput)
+
+
+TEST _Import_ReadParallel_MatchesTheStreamedRead(GraphLoadError *error)
+{
+    // Arrange, several read buffers of edges
+    GeneratorOptions options = { .Seed = 7, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 1000 };
+    EdgeList *generated = Generators_RandomEdges(100000, 300000, &options);
+    char path[] = "/tmp/ImportTestsXXXXXX";
+    FILE *file = fdopen(mkstemp(path), "w+");
+    assert(file != NULL);
+    fputs("# generated\n", file);
+    OutputSink *sink = OutputSink_CreateFileSink(file);
+    EdgeList_Write(generated, sink);
+    OutputSink_FreeOutputSink(sink);
+    fflush(file);
+    assert(ftell(file) > 3 * IMPORT_BUFFER_SIZE);
+    rewind(file);
+    
+    // Act
+    EdgeList *streamed = Import_Read(file, IMPORT_EDGE_LIST, error);
+    EdgeList *parallel = Import_ReadParallel(path, IMPORT_EDGE_LIST, 4, error);
+    
+    // Assert
+    assert(streamed != NULL && parallel != NULL);
+    const EdgeList *lists[] = { streamed, parallel };
+    for (int i = 0; i < 2; i++)
+    {
+        assert(lists[i]->Count == generated->Count && lists[i]->Vertices <= generated->Vertices);
+        assert(memcmp(lists[i]->Sources, generated->Sources, generated->Count * sizeof(VertexIndex)) == 0);
+        assert(memcmp(lists[i]->Targets, generated->Targets, generated->Count * sizeof(VertexIndex)) == 0);
+        assert(memcmp(lists[i]->Weights, generated->Weights, generated->Count * sizeof(unsigned int)) == 0);
+    }
+    
+    // Errors in a later part are reported with the line counted from the start of the file
+    fseek(file, 0, SEEK_END);
+    fputs("1 2 3 4\n", file);
+    fflush(file);
+    assert(Import_ReadParallel(path, IMPORT_EDGE_LIST, 4, error) == NULL);
+    assert(error->Line == generated->Count + 2);
+    
+    fclose(file);
+    unlink(path);
+    EdgeList_FreeEdgeList(generated);
+    EdgeList_FreeEdgeList(streamed);
+    EdgeList_FreeEdgeList(parallel);
+}
+IMPORT_TEST_CASE(Import_ReadParallel_MatchesTheStreamedRead)
+
+#endif /* ImportTests_h */
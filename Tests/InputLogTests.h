@@ -0,0 +1,111 @@
+//
+//  InputLogTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef InputLogTests_h
+#define InputLogTests_h
+
+#include <assert.h>
+#include <stdio.h>
+#include "../Graph Theorist Sketchpad/InputLog/InputLog.h"
+
+#define TEST static inline void
+#define INPUT_LOG_TEST_CASE(name) TEST name(void) { _Setup_InputLog_Tests(_##name); }
+
+static void _Setup_InputLog_Tests(void (*test)(InputLog*))
+{
+    InputLog *log = InputLog_CreateInputLog();
+    assert(log != NULL);
+    test(log);
+    InputLog_FreeInputLog(log);
+}
+
+/// Reads the log back after writing it to a temporary file
+static InputLog *_InputLog_RoundTrip(InputLog *log)
+{
+    FILE *file = tmpfile();
+    assert(file != NULL);
+    assert(InputLog_Write(log, file));
+    rewind(file);
+    InputLog *read = InputLog_Read(file);
+    fclose(file);
+    return read;
+}
+
+TEST _InputLog_WriteThenRead_RestoresEveryEvent(InputLog *log)
+{
+    // Arrange
+    InputLog_BeginFrame(log, 1000);
+    InputLog_Record(log, INPUT_EVENT_MODES, 0, 0, 0x1C1, 1000);
+    InputLog_Record(log, INPUT_EVENT_COLOR, 0, 0, 0xF5F5F5FF, 1010);
+    InputLog_BeginFrame(log, 17000);
+    InputLog_Record(log, INPUT_EVENT_MOUSE_MOVE, -3, 599, 0, 17020);
+    InputLog_Record(log, INPUT_EVENT_MOUSE_PRESS, -3, 599, 0, 17030);
+    InputLog_Record(log, INPUT_EVENT_MATRIX_ZOOM, 640, 80, 0x3F800000, 17040);
+    for (int i = 0; i < 200; i++) InputLog_BeginFrame(log, 17000 + i * 16000);
+    InputLog_Record(log, INPUT_EVENT_UNDO, 0, 0, 0, 5000000);
+    InputLog_Record(log, INPUT_EVENT_OPEN, 0, 0, 0, 5000000);
+    InputLog_Record(log, INPUT_EVENT_END, 0, 0, 0, 5000001);
+    
+    // Act
+    InputLog *read = _InputLog_RoundTrip(log);
+    
+    // Assert
+    assert(read != NULL);
+    assert(read->Count == log->Count);
+    for (size_t i = 0; i < log->Count; i++)
+    {
+        assert(read->Events[i].Kind == log->Events[i].Kind);
+        assert(read->Events[i].Frame == log->Events[i].Frame);
+        assert(read->Events[i].Time == log->Events[i].Time);
+        assert(read->Events[i].X == log->Events[i].X);
+        assert(read->Events[i].Y == log->Events[i].Y);
+        assert(read->Events[i].Value == log->Events[i].Value);
+    }
+    assert(read->Events[5].Frame == 201 && read->Events[5].Time == 4999000);
+    
+    // A truncated log is not read
+    FILE *file = tmpfile();
+    InputLog_Write(log, file);
+    long size = ftell(file);
+    rewind(file);
+    char bytes[64];
+    assert(size <= (long) sizeof(bytes));
+    assert(fread(bytes, 1, size, file) == (size_t) size);
+    fclose(file);
+    file = tmpfile();
+    fwrite(bytes, 1, size - 1, file);
+    rewind(file);
+    assert(InputLog_Read(file) == NULL);
+    fclose(file);
+    
+    InputLog_FreeInputLog(read);
+}
+INPUT_LOG_TEST_CASE(InputLog_WriteThenRead_RestoresEveryEvent)
+
+TEST _InputLog_Next_HandsOutTheEventsOfEachFrameInOrder(InputLog *log)
+{
+    // Arrange
+    InputLog_BeginFrame(log, 0);
+    InputLog_Record(log, INPUT_EVENT_MOUSE_MOVE, 10, 20, 0, 1);
+    InputLog_Record(log, INPUT_EVENT_MOUSE_PRESS, 10, 20, 0, 2);
+    InputLog_BeginFrame(log, 3);
+    InputLog_BeginFrame(log, 4);
+    InputLog_Record(log, INPUT_EVENT_CLEAR, 10, 20, 0, 5);
+    
+    // Act, Assert
+    assert(InputLog_Next(log, 0)->Kind == INPUT_EVENT_MOUSE_MOVE);
+    assert(InputLog_Next(log, 0)->Kind == INPUT_EVENT_MOUSE_PRESS);
+    assert(InputLog_Next(log, 0) == NULL);
+    assert(InputLog_Next(log, 1) == NULL);
+    assert(!InputLog_IsFinished(log));
+    assert(InputLog_Next(log, 2)->Kind == INPUT_EVENT_CLEAR);
+    assert(InputLog_IsFinished(log));
+    assert(InputLog_Next(log, 3) == NULL);
+}
+INPUT_LOG_TEST_CASE(InputLog_Next_HandsOutTheEventsOfEachFrameInOrder)
+
+#endif /* InputLogTests_h */
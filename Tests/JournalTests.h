@@ -0,0 +1,166 @@
+//
+//  JournalTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef JournalTests_h
+#define JournalTests_h
+
+#include <assert.h>
+#include "../Graph Theorist Sketchpad/Journal/Journal.h"
+
+#define TEST static inline void
+#define JOURNAL_TEST_CASE(name) TEST name(void) { _Setup_Journal_Tests(_##name); }
+
+static void _Setup_Journal_Tests(void (*test)(Journal*, GraphSketch*))
+{
+    Journal *j = Journal_CreateJournal(SCENE_BOUNDING_BOX);
+    GraphSketch *gs = GraphSketch_CreateGraphSketch();
+    assert(j != NULL);
+    test(j, gs);
+    Journal_FreeJournal(j);
+    GraphSketch_FreeGraphSketch(gs);
+}
+
+TEST _Journal_UndoAddVertexAndEdge_RevertsInReverseOrder(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    VertexIndex v2 = Journal_AddVertex(j, gs, (Vector2) {300, 100}, RED);
+    Journal_AddEdge(j, gs, v1, v2, 1);
+    Journal_AddEdge(j, gs, v1, v2, 1);
+    
+    // Act
+    const JournalRecord *parallel = Journal_Undo(j, gs);
+    
+    // Assert
+    assert(parallel->Kind == JOURNAL_ADD_EDGE);
+    assert(gs->Graph->Edges == 1 && Graph_IsAdjacent(gs->Graph, v1, v2));
+    
+    // Act
+    Journal_Undo(j, gs);
+    Journal_Undo(j, gs);
+    
+    // Assert
+    assert(gs->Graph->Vertices == 1 && gs->Graph->Edges == 0);
+    assert(Graph_IsNotAdjacent(gs->Graph, v1, v2));
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v2].BoundingBox) == NO_COLLISION);
+}
+JOURNAL_TEST_CASE(Journal_UndoAddVertexAndEdge_RevertsInReverseOrder)
+
+
+TEST _Journal_UndoThenRedo_RestoresEveryEdit(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    VertexIndex v2 = Journal_AddVertex(j, gs, (Vector2) {300, 100}, BLUE);
+    Journal_AddEdge(j, gs, v2, v1, 4);
+    while (Journal_Undo(j, gs) != NULL);
+    
+    // Act
+    while (Journal_Redo(j, gs) != NULL);
+    
+    // Assert
+    assert(gs->Graph->Vertices == 2 && gs->Graph->Edges == 1);
+    assert(gs->Graph->IncidenceMatrix[v2][0] == 4);
+    assert(gs->IndexToDrawableVertexMap[v2].Color.b == BLUE.b);
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v2].BoundingBox) == v2);
+}
+JOURNAL_TEST_CASE(Journal_UndoThenRedo_RestoresEveryEdit)
+
+
+TEST _Journal_MoveVertexDrag_CoalescesIntoOneRecord(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    
+    // Act
+    for (int x = 110; x <= 200; x += 10)
+    {
+        Journal_MoveVertex(j, gs, v1, (Vector2) {x, 100});
+    }
+    Journal_EndMove(j);
+    Journal_MoveVertex(j, gs, v1, (Vector2) {200, 200});
+    
+    // Assert
+    assert(j->Count == 3);
+    Journal_Undo(j, gs);
+    assert(gs->IndexToPrimitiveMap[v1].Centroid.x == 200 && gs->IndexToPrimitiveMap[v1].Centroid.y == 100);
+    Journal_Undo(j, gs);
+    assert(gs->IndexToPrimitiveMap[v1].Centroid.x == 100);
+    assert(BvhTree_CheckCollision(gs->BvhTree, gs->IndexToPrimitiveMap[v1].BoundingBox) == v1);
+}
+JOURNAL_TEST_CASE(Journal_MoveVertexDrag_CoalescesIntoOneRecord)
+
+
+TEST _Journal_UndoClear_SwapsTheClearedSketchBack(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    Journal_AddEdge(j, gs, v1, v1, 1);
+    Graph *cleared = gs->Graph;
+    Journal_Clear(j, gs);
+    assert(gs->Graph->Vertices == 0 && gs->BvhTree == NULL);
+    
+    // Act
+    Journal_Undo(j, gs);
+    
+    // Assert
+    assert(gs->Graph == cleared);
+    assert(gs->VertexIndexToDegreeMap[v1] == 2);
+    
+    // Act
+    Journal_Redo(j, gs);
+    
+    // Assert
+    assert(gs->Graph->Vertices == 0 && gs->VertexIndexToDegreeMap[v1] == 0);
+}
+JOURNAL_TEST_CASE(Journal_UndoClear_SwapsTheClearedSketchBack)
+
+
+TEST _Journal_EditAfterUndo_DropsRedo(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    Journal_Clear(j, gs);
+    Journal_Undo(j, gs);
+    
+    // Act
+    Journal_AddVertex(j, gs, (Vector2) {300, 100}, RED);
+    
+    // Assert
+    assert(j->Count == 2);
+    assert(Journal_Redo(j, gs) == NULL);
+    assert(gs->Graph->Vertices == 2);
+}
+JOURNAL_TEST_CASE(Journal_EditAfterUndo_DropsRedo)
+
+
+TEST _Journal_UndoRecolor_BringsEveryColorBack(Journal *j, GraphSketch *gs)
+{
+    // Arrange
+    VertexIndex v1 = Journal_AddVertex(j, gs, (Vector2) {100, 100}, RED);
+    VertexIndex v2 = Journal_AddVertex(j, gs, (Vector2) {300, 100}, BLUE);
+    const Color colors[] = { GREEN, YELLOW };
+    
+    // Act
+    Journal_Recolor(j, gs, colors);
+    Journal_Undo(j, gs);
+    
+    // Assert
+    assert(j->Count == 3);
+    assert(ColorToInt(gs->IndexToDrawableVertexMap[v1].Color) == ColorToInt(RED));
+    assert(ColorToInt(gs->IndexToDrawableVertexMap[v2].Color) == ColorToInt(BLUE));
+    
+    // Act
+    Journal_Redo(j, gs);
+    
+    // Assert
+    assert(ColorToInt(gs->IndexToDrawableVertexMap[v1].Color) == ColorToInt(GREEN));
+    assert(ColorToInt(gs->IndexToDrawableVertexMap[v2].Color) == ColorToInt(YELLOW));
+}
+JOURNAL_TEST_CASE(Journal_UndoRecolor_BringsEveryColorBack)
+
+#endif /* JournalTests_h */
@@ -0,0 +1,243 @@
+//
+//  MatchingTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef MatchingTests_h
+#define MatchingTests_h
+
+#include <assert.h>
+#include <stdlib.h>
+#include "Matching.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define MATCHING_TEST_CASE(name) TEST name(void) { _Setup_Matching_Tests(_##name); }
+
+static void _Setup_Matching_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 43, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 9 };
+    test(&options);
+}
+
+/// Checks every vertex and its mate are matched to each other by an edge between them
+/// - Returns: The total weight of the matched edges
+static uint64_t _Matching_AssertValid(const EdgeList *el, const uint32_t *mates, const uint32_t *edges, unsigned int count)
+{
+    unsigned int matched = 0;
+    uint64_t weight = 0;
+    for (VertexIndex v = 0; v < el->Vertices; v++)
+    {
+        if (mates[v] == MATCHING_UNMATCHED)
+        {
+            assert(edges[v] == MATCHING_UNMATCHED);
+            continue;
+        }
+        const uint32_t e = edges[v];
+        assert(mates[mates[v]] == v && edges[mates[v]] == e && mates[v] != v);
+        assert((el->Sources[e] == v && el->Targets[e] == mates[v]) || (el->Targets[e] == v && el->Sources[e] == mates[v]));
+        matched++;
+        if (v < mates[v]) weight += el->Weights[e];
+    }
+    assert(matched == 2 * count);
+    return weight;
+}
+
+/// The most edges no two of which share a vertex, and the least weight of so many, trying every edge at the lowest vertex
+/// left in turn
+static void _Matching_Best(const EdgeList *el, uint32_t left, unsigned int *count, uint64_t *weight)
+{
+    *count = 0;
+    *weight = 0;
+    if (left == 0) return;
+    const VertexIndex v = __builtin_ctz(left);
+
+    // Leaving the vertex unmatched
+    _Matching_Best(el, left & ~(1u << v), count, weight);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        VertexIndex w = el->Sources[e] == v ? el->Targets[e] : el->Targets[e] == v ? el->Sources[e] : v;
+        if (w == v || !(left >> w & 1)) continue;
+        unsigned int rest;
+        uint64_t restWeight;
+        _Matching_Best(el, left & ~(1u << v) & ~(1u << w), &rest, &restWeight);
+        if (rest + 1 > *count || (rest + 1 == *count && restWeight + el->Weights[e] < *weight))
+        {
+            *count = rest + 1;
+            *weight = restWeight + el->Weights[e];
+        }
+    }
+}
+
+TEST _Matching_Blossom_MatchesTryingEveryMatching(GeneratorOptions *options)
+{
+    for (int trial = 0; trial < 40; trial++)
+    {
+        // Arrange, half the trials on two sides
+        options->Seed = trial;
+        const unsigned int n = 11;
+        EdgeList *el = trial % 2 == 0 ? Generators_ErdosRenyi(n, 0.15 + trial % 4 * 0.1, options) :
+                                        Generators_CompleteBipartite(5, 6, options);
+        if (trial % 2 == 1)
+        {
+            // Thinned to a random part, keeping every weight
+            size_t kept = 0;
+            for (size_t e = 0; e < el->Count; e++)
+            {
+                if ((e * 7 + trial) % 3 == 0) continue;
+                el->Sources[kept] = el->Sources[e];
+                el->Targets[kept] = el->Targets[e];
+                el->Weights[kept++] = el->Weights[e];
+            }
+            el->Count = kept;
+        }
+        Csr *csr = Csr_FromEdgeList(el);
+        unsigned int expected;
+        uint64_t expectedWeight;
+        _Matching_Best(el, (1u << n) - 1, &expected, &expectedWeight);
+        uint32_t mates[11], edges[11];
+        uint8_t sides[11];
+
+        // Act, Assert
+        unsigned int count = Matching_Blossom(csr, mates, edges);
+        assert(count == expected);
+        _Matching_AssertValid(el, mates, edges, count);
+        if (Matching_Bipartition(csr, sides))
+        {
+            for (size_t e = 0; e < el->Count; e++) assert(sides[el->Sources[e]] != sides[el->Targets[e]]);
+            assert(Matching_HopcroftKarp(csr, sides, mates, edges) == expected);
+            _Matching_AssertValid(el, mates, edges, expected);
+            uint64_t weight = 0;
+            assert(Matching_Assignment(csr, sides, mates, edges, &weight) == expected);
+            assert(_Matching_AssertValid(el, mates, edges, expected) == weight && weight == expectedWeight);
+        }
+        else assert(trial % 2 == 0);
+
+        Csr_FreeCsr(csr);
+        EdgeList_FreeEdgeList(el);
+    }
+}
+MATCHING_TEST_CASE(Matching_Blossom_MatchesTryingEveryMatching)
+
+
+TEST _Matching_Blossom_AugmentsThroughNestedBlossoms(GeneratorOptions *_)
+{
+    // Arrange, an outer 5 cycle, an inner pentagram and spokes, every augmenting path runs through odd cycles
+    EdgeList *el = EdgeList_CreateEdgeList(10, 0);
+    for (VertexIndex v = 0; v < 5; v++)
+    {
+        EdgeList_Add(el, v, (v + 1) % 5, 1);
+        EdgeList_Add(el, 5 + v, 5 + (v + 2) % 5, 1);
+        EdgeList_Add(el, v, 5 + v, 1);
+    }
+
+    // A self loop matches nothing
+    EdgeList_Add(el, 5, 5, 1);
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t mates[10], edges[10];
+    uint8_t sides[10];
+
+    // Act, Assert
+    assert(!Matching_Bipartition(csr, sides));
+    assert(Matching_Blossom(csr, mates, edges) == 5);
+    _Matching_AssertValid(el, mates, edges, 5);
+
+    // Two triangles joined by an edge and a lone vertex
+    EdgeList *triangles = EdgeList_CreateEdgeList(7, 0);
+    for (VertexIndex v = 0; v < 3; v++)
+    {
+        EdgeList_Add(triangles, v, (v + 1) % 3, 1);
+        EdgeList_Add(triangles, 3 + v, 3 + (v + 1) % 3, 1);
+    }
+    EdgeList_Add(triangles, 2, 3, 1);
+    Csr *trianglesCsr = Csr_FromEdgeList(triangles);
+    uint32_t triangleMates[7], triangleEdges[7];
+    assert(Matching_Blossom(trianglesCsr, triangleMates, triangleEdges) == 3);
+    assert(triangleMates[6] == MATCHING_UNMATCHED);
+
+    // A blossom shrunk into one through its inner vertices, whose path on to the base leaves it again, once greedily
+    // matched the only augmenting path runs 8 10 3 4 6 7 2 11
+    const VertexIndex nested[][2] =
+    {
+        {1, 0}, {2, 0}, {3, 0}, {4, 0}, {4, 3}, {4, 2}, {5, 2}, {5, 0}, {5, 3}, {6, 0}, {6, 2}, {6, 4}, {7, 6}, {7, 2},
+        {7, 4}, {8, 0}, {8, 2}, {8, 5}, {9, 5}, {9, 2}, {9, 0}, {10, 8}, {10, 5}, {10, 3}, {11, 5}, {11, 0}, {11, 2},
+    };
+    EdgeList *nestedEl = EdgeList_CreateEdgeList(12, 0);
+    for (size_t e = 0; e < sizeof(nested) / sizeof(nested[0]); e++) EdgeList_Add(nestedEl, nested[e][0], nested[e][1], 1);
+    Csr *nestedCsr = Csr_FromEdgeList(nestedEl);
+    uint32_t nestedMates[12], nestedEdges[12];
+    assert(Matching_Blossom(nestedCsr, nestedMates, nestedEdges) == 6);
+    _Matching_AssertValid(nestedEl, nestedMates, nestedEdges, 6);
+
+    Csr_FreeCsr(nestedCsr);
+    EdgeList_FreeEdgeList(nestedEl);
+    Csr_FreeCsr(trianglesCsr);
+    EdgeList_FreeEdgeList(triangles);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+}
+MATCHING_TEST_CASE(Matching_Blossom_AugmentsThroughNestedBlossoms)
+
+
+TEST _Matching_HopcroftKarp_AgreesWithBlossomOnALargeGraph(GeneratorOptions *options)
+{
+    // Arrange, a sparse graph across two sides of 20000 and 15000 vertices
+    const unsigned int a = 20000, b = 15000;
+    EdgeList *el = EdgeList_CreateEdgeList(a + b, 0);
+    GeneratorOptions unweighted = { .Seed = options->Seed };
+    EdgeList *random = Generators_RandomEdges(a + b, 3 * (a + b), &unweighted);
+    for (size_t e = 0; e < random->Count; e++)
+    {
+        VertexIndex u = random->Sources[e] % a, v = a + random->Targets[e] % b;
+        EdgeList_Add(el, u, v, 1);
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    uint32_t *mates = malloc((a + b) * sizeof(uint32_t));
+    uint32_t *edges = malloc((a + b) * sizeof(uint32_t));
+    uint8_t *sides = malloc(a + b);
+
+    // Act
+    bool isBipartite = Matching_Bipartition(csr, sides);
+    unsigned int layered = Matching_HopcroftKarp(csr, sides, mates, edges);
+    _Matching_AssertValid(el, mates, edges, layered);
+    unsigned int shrunk = Matching_Blossom(csr, mates, edges);
+    _Matching_AssertValid(el, mates, edges, shrunk);
+
+    // Assert
+    assert(isBipartite && layered == shrunk && layered > b * 9 / 10 && layered <= b);
+
+    free(mates);
+    free(edges);
+    free(sides);
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    EdgeList_FreeEdgeList(random);
+}
+MATCHING_TEST_CASE(Matching_HopcroftKarp_AgreesWithBlossomOnALargeGraph)
+
+
+TEST _Graph_MaximumMatching_AssignsTheLightestEdges(GeneratorOptions *_)
+{
+    // Arrange, a path 0 - 1 - 2 - 3 whose heavy middle edge is left out, then a triangle that makes it odd
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 4; i++) Graph_AddVertex(g);
+    EdgeIndex e01 = Graph_AddEdgeWeighted(g, 1, 0, 4);
+    Graph_AddEdgeWeighted(g, 1, 2, 1);
+    EdgeIndex e23 = Graph_AddEdgeWeighted(g, 2, 3, 5);
+    EdgeIndex matching[GRAPH_MAX_SIZE + 1];
+    bool isBipartite = false;
+    unsigned long long weight = 0;
+
+    // Act, Assert, the two outer edges are the only matching of 2 edges
+    assert(Graph_MaximumMatching(g, matching, &isBipartite, &weight) == 2 && isBipartite && weight == 9);
+    assert(matching[0] == e01 && matching[1] == e23 && matching[2] == MST_NO_EDGE);
+    Graph_AddEdgeWeighted(g, 0, 2, 2);
+    assert(Graph_MaximumMatching(g, matching, &isBipartite, NULL) == 2 && !isBipartite);
+
+    Graph_FreeGraph(g);
+}
+MATCHING_TEST_CASE(Graph_MaximumMatching_AssignsTheLightestEdges)
+
+#endif /* MatchingTests_h */
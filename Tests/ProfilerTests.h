@@ -0,0 +1,81 @@
+//
+//  ProfilerTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ProfilerTests_h
+#define ProfilerTests_h
+
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+#include "Util/Profiler.h"
+
+#define TEST static inline void
+#define PROFILER_TEST_CASE(name) TEST name(void) { _Setup_Profiler_Tests(_##name); }
+
+static void _Setup_Profiler_Tests(void (*test)(OutputSink*))
+{
+    OutputSink *sink = OutputSink_CreateGrowableBufferSink();
+    assert(sink != NULL);
+    test(sink);
+    OutputSink_FreeOutputSink(sink);
+}
+
+static void _ProfiledWork(void)
+{
+    PROFILE_ZONE("ProfilerTests_Inner");
+}
+
+static void *_ProfiledThread(void *_)
+{
+    PROFILE_ZONE("ProfilerTests_Thread");
+    return NULL;
+}
+
+TEST _Profiler_EndFrame_TotalsTheZonesOfTheFrame(OutputSink *_)
+{
+    // Act
+    PROFILE_BEGIN_FRAME();
+    {
+        PROFILE_ZONE("ProfilerTests_Outer");
+        _ProfiledWork();
+        _ProfiledWork();
+    }
+    PROFILE_END_FRAME();
+    
+    // Assert
+    const ProfilerFrames *frames = Profiler_Frames();
+    assert(frames->Count > 0);
+    assert(frames->ZoneCount == 2);
+    
+    // Nested zones are counted in their parents too
+    assert(strcmp(frames->Zones[0].Name, "ProfilerTests_Outer") == 0);
+    assert(strcmp(frames->Zones[1].Name, "ProfilerTests_Inner") == 0);
+    assert(frames->Zones[0].Total >= frames->Zones[1].Total);
+    assert(frames->Durations[(frames->Count - 1) % PROFILER_FRAME_HISTORY] >= frames->Zones[0].Total);
+}
+PROFILER_TEST_CASE(Profiler_EndFrame_TotalsTheZonesOfTheFrame)
+
+TEST _Profiler_WriteTrace_WritesTheZonesOfEveryThread(OutputSink *sink)
+{
+    // Arrange
+    pthread_t thread;
+    pthread_create(&thread, NULL, _ProfiledThread, NULL);
+    pthread_join(thread, NULL);
+    _ProfiledWork();
+    
+    // Act
+    Profiler_WriteTrace(sink);
+    
+    // Assert
+    assert(strncmp(sink->Buffer, "{\"traceEvents\": [", 17) == 0);
+    assert(strstr(sink->Buffer, "{\"name\": \"ProfilerTests_Thread\", \"ph\": \"X\"") != NULL);
+    assert(strstr(sink->Buffer, "{\"name\": \"ProfilerTests_Inner\", \"ph\": \"X\"") != NULL);
+    assert(strcmp(sink->Buffer + sink->BufferSize - 4, "\n]}\n") == 0);
+}
+PROFILER_TEST_CASE(Profiler_WriteTrace_WritesTheZonesOfEveryThread)
+
+#endif /* ProfilerTests_h */
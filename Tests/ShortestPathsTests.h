@@ -0,0 +1,142 @@
+//
+//  ShortestPathsTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef ShortestPathsTests_h
+#define ShortestPathsTests_h
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+#include "ShortestPaths.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define SHORTEST_PATHS_TEST_CASE(name) TEST name(void) { _Setup_ShortestPaths_Tests(_##name); }
+
+static void _Setup_ShortestPaths_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = { .Seed = 5, .IsDirected = true, .Weights = GENERATOR_WEIGHTS_UNIFORM, .MinWeight = 1, .MaxWeight = 100 };
+    test(&options);
+}
+
+/// Bellman-Ford, relaxing every edge until nothing changes
+static void _ShortestPaths_Reference(const EdgeList *el, VertexIndex source, uint64_t *distances)
+{
+    for (VertexIndex v = 0; v < el->Vertices; v++) distances[v] = SHORTEST_PATHS_UNREACHED;
+    distances[source] = 0;
+    for (bool isChanged = true; isChanged; )
+    {
+        isChanged = false;
+        for (size_t e = 0; e < el->Count; e++)
+        {
+            uint64_t from = distances[el->Sources[e]];
+            if (from == SHORTEST_PATHS_UNREACHED || from + el->Weights[e] >= distances[el->Targets[e]]) continue;
+            distances[el->Targets[e]] = from + el->Weights[e];
+            isChanged = true;
+        }
+    }
+}
+
+/// Every reached vertex other than the source is entered by its predecessor edge, along a shortest path
+static void _ShortestPaths_AssertPredecessors(const EdgeList *el, VertexIndex source, const uint64_t *distances,
+                                              const VertexIndex *predecessors, const uint32_t *edges)
+{
+    assert(predecessors[source] == source && edges[source] == SHORTEST_PATHS_NO_EDGE);
+    for (VertexIndex v = 0; v < el->Vertices; v++)
+    {
+        if (v == source) continue;
+        if (distances[v] == SHORTEST_PATHS_UNREACHED)
+        {
+            assert(predecessors[v] == v && edges[v] == SHORTEST_PATHS_NO_EDGE);
+            continue;
+        }
+        uint32_t e = edges[v];
+        assert(e < el->Count && el->Sources[e] == predecessors[v] && el->Targets[e] == v);
+        assert(distances[predecessors[v]] + el->Weights[e] == distances[v]);
+    }
+}
+
+TEST _ShortestPaths_DijkstraAndDeltaStepping_MatchBellmanFord(GeneratorOptions *options)
+{
+    // Arrange, a directed graph with vertices out of reach and a few heavier and lighter parallel edges
+    EdgeList *el = Generators_RandomEdges(3000, 9000, options);
+    for (size_t e = 0; e < 300; e++)
+    {
+        EdgeList_Add(el, el->Sources[e * 7], el->Targets[e * 7], e % 2 == 0 ? 1 : 500);
+    }
+    Csr *csr = Csr_FromEdgeList(el);
+    uint64_t *expected = malloc(el->Vertices * sizeof(uint64_t));
+    uint64_t *distances = malloc(el->Vertices * sizeof(uint64_t));
+    VertexIndex *predecessors = malloc(el->Vertices * sizeof(VertexIndex));
+    VertexIndex *firstPredecessors = malloc(el->Vertices * sizeof(VertexIndex));
+    uint32_t *edges = malloc(el->Vertices * sizeof(uint32_t));
+    _ShortestPaths_Reference(el, 0, expected);
+    
+    // Act, Assert
+    ShortestPaths_Dijkstra(csr, 0, distances, predecessors, edges);
+    assert(memcmp(distances, expected, el->Vertices * sizeof(uint64_t)) == 0);
+    _ShortestPaths_AssertPredecessors(el, 0, distances, predecessors, edges);
+    
+    const uint64_t deltas[] = { 0, 1, 37, 100000 };
+    const unsigned int threads[] = { 1, 4 };
+    for (int d = 0; d < 4; d++)
+    {
+        for (int t = 0; t < 2; t++)
+        {
+            memset(distances, 0, el->Vertices * sizeof(uint64_t));
+            ShortestPaths_DeltaStepping(csr, 0, deltas[d], threads[t], distances, predecessors, edges);
+            assert(memcmp(distances, expected, el->Vertices * sizeof(uint64_t)) == 0);
+            _ShortestPaths_AssertPredecessors(el, 0, distances, predecessors, edges);
+            
+            // Ties are broken the same way whatever the threads and delta
+            if (d == 0 && t == 0) memcpy(firstPredecessors, predecessors, el->Vertices * sizeof(VertexIndex));
+            assert(memcmp(firstPredecessors, predecessors, el->Vertices * sizeof(VertexIndex)) == 0);
+        }
+    }
+    
+    Csr_FreeCsr(csr);
+    EdgeList_FreeEdgeList(el);
+    free(expected);
+    free(distances);
+    free(predecessors);
+    free(firstPredecessors);
+    free(edges);
+}
+SHORTEST_PATHS_TEST_CASE(ShortestPaths_DijkstraAndDeltaStepping_MatchBellmanFord)
+
+
+TEST _Graph_ShortestPath_FollowsTheDirectionOfEachEdge(GeneratorOptions *_)
+{
+    // Arrange
+    Graph *g = Graph_CreateGraph();
+    for (int i = 0; i < 4; i++) Graph_AddVertex(g);
+    EdgeIndex e0 = Graph_AddEdgeWeighted(g, 0, 1, 5);
+    EdgeIndex e1 = Graph_AddEdgeWeighted(g, 1, 2, 1);
+    Graph_AddEdgeWeighted(g, 0, 2, 10);
+    EdgeIndex e3 = Graph_AddEdgeWeighted(g, 0, 2, 3);
+    EdgeIndex e4 = Graph_AddEdgeWeighted(g, 3, 0, 1);
+    Graph_AddEdgeWeighted(g, 2, 2, 1);
+    EdgeIndex path[GRAPH_MAX_SIZE];
+    
+    // Act, Assert, the lighter of the parallel edges
+    assert(Graph_ShortestPath(g, 0, 2, path));
+    assert(path[0] == e3 && path[1] == MST_NO_EDGE);
+    
+    assert(Graph_ShortestPath(g, 3, 1, path));
+    assert(path[0] == e4 && path[1] == e0 && path[2] == MST_NO_EDGE);
+    
+    // Edges are only followed from their source
+    assert(!Graph_ShortestPath(g, 2, 0, path) && path[0] == MST_NO_EDGE);
+    assert(!Graph_ShortestPath(g, 1, 3, path));
+    assert(Graph_ShortestPath(g, 1, 2, path) && path[0] == e1 && path[1] == MST_NO_EDGE);
+    assert(Graph_ShortestPath(g, 2, 2, path) && path[0] == MST_NO_EDGE);
+    
+    Graph_FreeGraph(g);
+}
+SHORTEST_PATHS_TEST_CASE(Graph_ShortestPath_FollowsTheDirectionOfEachEdge)
+
+#endif /* ShortestPathsTests_h */
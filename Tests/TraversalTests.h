@@ -0,0 +1,191 @@
+//
+//  TraversalTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef TraversalTests_h
+#define TraversalTests_h
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+#include "Traversal.h"
+#include "Generators.h"
+
+#define TEST static inline void
+#define TRAVERSAL_TEST_CASE(name) TEST name(void) { _Setup_Traversal_Tests(_##name); }
+
+static void _Setup_Traversal_Tests(void (*test)(GeneratorOptions*))
+{
+    GeneratorOptions options = {.Seed = 11};
+    test(&options);
+}
+
+/// - Returns: The list with every edge in both directions
+static EdgeList *_Traversal_Symmetric(const EdgeList *el)
+{
+    EdgeList *symmetric = EdgeList_CreateEdgeList(el->Vertices, el->Count * 2);
+    for (size_t e = 0; e < el->Count; e++)
+    {
+        EdgeList_Add(symmetric, el->Sources[e], el->Targets[e], el->Weights[e]);
+        EdgeList_Add(symmetric, el->Targets[e], el->Sources[e], el->Weights[e]);
+    }
+    return symmetric;
+}
+
+/// Breadth first search with a single queue, the source labelled with label and every vertex reached with the label of its
+/// parent plus step, so a step of 1 gives levels and 0 the component
+/// - Returns: The vertices reached
+static unsigned int _Traversal_ReferenceSearch(const Csr *csr, VertexIndex source, uint32_t *levels, uint32_t label, uint32_t step)
+{
+    VertexIndex *queue = malloc(csr->Vertices * sizeof(VertexIndex));
+    unsigned int head = 0, tail = 0;
+    levels[source] = label;
+    queue[tail++] = source;
+    while (head < tail)
+    {
+        VertexIndex u = queue[head++];
+        for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+        {
+            VertexIndex v = csr->Targets[i];
+            if (levels[v] != TRAVERSAL_UNREACHED) continue;
+            levels[v] = levels[u] + step;
+            queue[tail++] = v;
+        }
+    }
+    free(queue);
+    return tail;
+}
+
+static bool _Traversal_HasEdge(const Csr *csr, VertexIndex u, VertexIndex v)
+{
+    for (uint64_t i = csr->Offsets[u]; i < csr->Offsets[u + 1]; i++)
+    {
+        if (csr->Targets[i] == v) return true;
+    }
+    return false;
+}
+
+/// Searches from vertex 0 on 1 and 4 threads, top down only and switching direction, against the reference
+static void _Traversal_AssertBreadthFirst(const Csr *out)
+{
+    uint32_t *expected = malloc(out->Vertices * sizeof(uint32_t));
+    uint32_t *levels = malloc(out->Vertices * sizeof(uint32_t));
+    VertexIndex *parents = malloc(out->Vertices * sizeof(VertexIndex));
+    for (unsigned int v = 0; v < out->Vertices; v++) expected[v] = TRAVERSAL_UNREACHED;
+    unsigned int reached = _Traversal_ReferenceSearch(out, 0, expected, 0, 1);
+    
+    Csr *in = Csr_Transpose(out);
+    const Csr *ins[] = { NULL, in };
+    const unsigned int threads[] = { 1, 4 };
+    for (int i = 0; i < 2; i++)
+    {
+        for (int t = 0; t < 2; t++)
+        {
+            assert(Traversal_BreadthFirst(out, ins[i], 0, threads[t], levels, parents) == reached);
+            assert(memcmp(levels, expected, out->Vertices * sizeof(uint32_t)) == 0);
+            
+            // Any parent one level closer to the source is a correct one
+            assert(parents[0] == 0);
+            for (unsigned int v = 1; v < out->Vertices; v++)
+            {
+                if (levels[v] == TRAVERSAL_UNREACHED) continue;
+                assert(levels[parents[v]] + 1 == levels[v] && _Traversal_HasEdge(out, parents[v], v));
+            }
+        }
+    }
+    
+    Csr_FreeCsr(in);
+    free(expected);
+    free(levels);
+    free(parents);
+}
+
+TEST _Traversal_BreadthFirst_MatchesASingleQueue(GeneratorOptions *options)
+{
+    // Arrange, a sparse directed graph with vertices out of reach, and a dense undirected one that is searched bottom up
+    // until it narrows into a path, searched top down again
+    EdgeList *directed = Generators_RandomEdges(20000, 50000, options);
+    EdgeList *dense = Generators_ErdosRenyi(4000, 0.02, options);
+    EdgeList *undirected = _Traversal_Symmetric(dense);
+    undirected->Vertices += 100;
+    for (VertexIndex v = dense->Vertices; v < undirected->Vertices; v++)
+    {
+        EdgeList_Add(undirected, v - 1, v, 1);
+        EdgeList_Add(undirected, v, v - 1, 1);
+    }
+    Csr *sparseRows = Csr_FromEdgeList(directed);
+    Csr *denseRows = Csr_FromEdgeList(undirected);
+    
+    // Act, Assert
+    _Traversal_AssertBreadthFirst(sparseRows);
+    _Traversal_AssertBreadthFirst(denseRows);
+    
+    // A source without edges reaches only itself
+    uint32_t levels[3];
+    EdgeList *isolated = EdgeList_CreateEdgeList(3, 0);
+    EdgeList_Add(isolated, 0, 1, 1);
+    Csr *isolatedRows = Csr_FromEdgeList(isolated);
+    assert(Traversal_BreadthFirst(isolatedRows, NULL, 2, 2, levels, NULL) == 1);
+    assert(levels[0] == TRAVERSAL_UNREACHED && levels[1] == TRAVERSAL_UNREACHED && levels[2] == 0);
+    
+    Csr_FreeCsr(sparseRows);
+    Csr_FreeCsr(denseRows);
+    Csr_FreeCsr(isolatedRows);
+    EdgeList_FreeEdgeList(directed);
+    EdgeList_FreeEdgeList(dense);
+    EdgeList_FreeEdgeList(undirected);
+    EdgeList_FreeEdgeList(isolated);
+}
+TRAVERSAL_TEST_CASE(Traversal_BreadthFirst_MatchesASingleQueue)
+
+
+TEST _Traversal_ConnectedComponents_NumbersComponentsByTheirSmallestVertex(GeneratorOptions *options)
+{
+    // Arrange, fewer edges than vertices leaves thousands of components. Edges are directed, components ignore it.
+    EdgeList *el = Generators_RandomEdges(50000, 40000, options);
+    EdgeList *undirected = _Traversal_Symmetric(el);
+    Csr *csr = Csr_FromEdgeList(el);
+    Csr *symmetric = Csr_FromEdgeList(undirected);
+    
+    uint32_t *expected = malloc(csr->Vertices * sizeof(uint32_t));
+    uint32_t *components = malloc(csr->Vertices * sizeof(uint32_t));
+    for (unsigned int v = 0; v < csr->Vertices; v++) expected[v] = TRAVERSAL_UNREACHED;
+    uint32_t count = 0;
+    for (VertexIndex v = 0; v < csr->Vertices; v++)
+    {
+        if (expected[v] == TRAVERSAL_UNREACHED) _Traversal_ReferenceSearch(symmetric, v, expected, count++, 0);
+    }
+    
+    // Act, Assert
+    assert(count > 1000);
+    const unsigned int threads[] = { 1, 3, 8 };
+    for (int t = 0; t < 3; t++)
+    {
+        assert(Traversal_ConnectedComponents(csr, threads[t], components) == count);
+        assert(memcmp(components, expected, csr->Vertices * sizeof(uint32_t)) == 0);
+    }
+    
+    // The same numbering as the sketch graph
+    EdgeList *small = Generators_RandomEdges(GRAPH_MAX_SIZE, 90, options);
+    Graph *g = Graph_FromEdgeList(small);
+    Csr *smallRows = Csr_FromEdgeList(small);
+    unsigned int graphComponents[GRAPH_MAX_SIZE];
+    assert(Traversal_ConnectedComponents(smallRows, 4, components) == Graph_ConnectedComponents(g, graphComponents));
+    for (VertexIndex v = 0; v < GRAPH_MAX_SIZE; v++) assert(components[v] == graphComponents[v]);
+    
+    Graph_FreeGraph(g);
+    Csr_FreeCsr(csr);
+    Csr_FreeCsr(symmetric);
+    Csr_FreeCsr(smallRows);
+    EdgeList_FreeEdgeList(el);
+    EdgeList_FreeEdgeList(undirected);
+    EdgeList_FreeEdgeList(small);
+    free(expected);
+    free(components);
+}
+TRAVERSAL_TEST_CASE(Traversal_ConnectedComponents_NumbersComponentsByTheirSmallestVertex)
+
+#endif /* TraversalTests_h */
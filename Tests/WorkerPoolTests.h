@@ -0,0 +1,102 @@
+//
+//  WorkerPoolTests.h
+//  Tests
+//
+//  Created by Benjamin Schreiber on 10/19/26.
+//
+
+#ifndef WorkerPoolTests_h
+#define WorkerPoolTests_h
+
+#include <assert.h>
+#include <sched.h>
+#include "Util/WorkerPool.h"
+
+#define TEST static inline void
+#define WORKER_POOL_TEST_CASE(name) TEST name(void) { _Setup_WorkerPool_Tests(_##name); }
+
+static void _Setup_WorkerPool_Tests(void (*test)(WorkerPool*))
+{
+    WorkerPool *wp = WorkerPool_CreateWorkerPool(2);
+    assert(wp != NULL);
+    test(wp);
+    WorkerPool_FreeWorkerPool(wp);
+}
+
+static void _WaitForJob(WorkerJob *job)
+{
+    while (!WorkerJob_IsFinished(job))
+    {
+        sched_yield();
+    }
+}
+
+static void _IncrementCounter(WorkerJob *job)
+{
+    atomic_fetch_add((atomic_int *) job->Context, 1);
+}
+
+static void _WaitForRelease(WorkerJob *job)
+{
+    while (!atomic_load((atomic_bool *) job->Context))
+    {
+        sched_yield();
+    }
+}
+
+TEST _WorkerPool_Submit_RunsEveryJob(WorkerPool *wp)
+{
+    // Arrange
+    atomic_int counter = 0;
+    WorkerJob jobs[32];
+    
+    // Act
+    for (int i = 0; i < 32; i++)
+    {
+        jobs[i] = WorkerJob_CreateWorkerJob(_IncrementCounter, &counter);
+        WorkerPool_Submit(wp, &jobs[i]);
+    }
+    for (int i = 0; i < 32; i++)
+    {
+        _WaitForJob(&jobs[i]);
+    }
+    
+    // Assert
+    assert(atomic_load(&counter) == 32);
+    for (int i = 0; i < 32; i++)
+    {
+        assert(atomic_load(&jobs[i].State) == WORKER_JOB_DONE);
+    }
+}
+WORKER_POOL_TEST_CASE(WorkerPool_Submit_RunsEveryJob)
+
+
+TEST _WorkerPool_CancelQueuedJob_NeverRuns(WorkerPool *wp)
+{
+    // Arrange
+    atomic_bool release = false;
+    atomic_int counter = 0;
+    WorkerJob blockers[2] =
+    {
+        WorkerJob_CreateWorkerJob(_WaitForRelease, &release),
+        WorkerJob_CreateWorkerJob(_WaitForRelease, &release),
+    };
+    WorkerJob cancelled = WorkerJob_CreateWorkerJob(_IncrementCounter, &counter);
+    
+    // Act
+    WorkerPool_Submit(wp, &blockers[0]);
+    WorkerPool_Submit(wp, &blockers[1]);
+    WorkerPool_Submit(wp, &cancelled);
+    WorkerJob_Cancel(&cancelled);
+    atomic_store(&release, true);
+    _WaitForJob(&blockers[0]);
+    _WaitForJob(&blockers[1]);
+    _WaitForJob(&cancelled);
+    
+    // Assert
+    assert(atomic_load(&cancelled.State) == WORKER_JOB_CANCELLED);
+    assert(atomic_load(&counter) == 0);
+}
+WORKER_POOL_TEST_CASE(WorkerPool_CancelQueuedJob_NeverRuns)
+
+#endif /* WorkerPoolTests_h */
@@ -7,7 +7,34 @@
 
 #include <stdio.h>
 #include "GraphTests.h"
+#include "WorkerPoolTests.h"
+#include "CountersTests.h"
+#include "GeneratorsTests.h"
+#include "ImportTests.h"
+#include "GraphFileTests.h"
+#include "TraversalTests.h"
+#include "ShortestPathsTests.h"
+#include "AllPairsTests.h"
+#include "BiconnectedTests.h"
+#include "DirectedTests.h"
+#include "EulerTests.h"
+#include "ColoringTests.h"
+#include "CliqueTests.h"
+#include "FlowTests.h"
+#include "MatchingTests.h"
+
+// Compiled out zones record nothing to test
+#ifndef PROFILER_DISABLED
+#include "ProfilerTests.h"
+#endif
+
+// Without raylib headers only the graph library is tested
+#ifndef TESTS_GRAPH_ONLY
 #include "GraphSketchTests.h"
+#include "JournalTests.h"
+#include "InputLogTests.h"
+#include "CommandQueueTests.h"
+#endif
 
 int main(int argc, const char * argv[]) {
     
@@ -21,13 +48,148 @@ int main(int argc, const char * argv[]) {
     Graph_KruskalsAlgorithmWithWeights_CorrectlyDeterminesMST();
     Graph_KruskalsAlgorithmWithWeightsAndCycles_CorrectlyDeterminesMST();
     Graph_KruskalsAlgorithmWithNoEdges_NoMST();
+    Graph_WriteAdjMatrixDense_WritesEveryEntry();
+    Graph_WriteIncidenceMatrixSparse_WritesOnlyNonZeroEntries();
+    Graph_WriteAdjMatrixSparse_WritesEachEntryOnceInRowOrder();
+    Graph_WriteIncidenceMatrixRunLength_CollapsesRuns();
+    Graph_DumpIncidenceMatrixLargerThanBuffer_TruncatesWithoutOverflow();
+    Graph_AddVertexAndEdge_IncrementsVersionAndLogsChanges();
+    Graph_ChangeAt_OlderThanChangeLogIsNull();
+    Graph_SnapshotThenMutate_SnapshotIsUnchanged();
+    Graph_SnapshotThenMutate_CopiesOnlyTheTouchedChunk();
+    Graph_FreeGraph_SnapshotOutlivesGraph();
+    Graph_ReadEdgeList_AddsVerticesAndWeightedEdges();
+    Graph_ReadEdgeListMalformed_ReportsTheLine();
+    Graph_ConnectedComponents_IgnoresDirection();
+    
+    
+    // Worker Pool Tests
+    WorkerPool_Submit_RunsEveryJob();
+    WorkerPool_CancelQueuedJob_NeverRuns();
+    
+    
+    // Counters Tests
+    Counters_VertexDegree_CountsQueriesAndEdgesScanned();
+    Counters_Write_WritesEveryCounterAndAverage();
+    
+    
+    // Generators Tests
+    Generators_ErdosRenyi_IsReproducibleAndNearTheExpectedSize();
+    Generators_StructuredGraphs_HaveTheirExactEdgeCounts();
+    Generators_RandomGeometric_JoinsExactlyThePointsWithinRadius();
+    
+    
+    // Import Tests
+    Import_Read_ParsesEveryFormat();
+    Import_Read_ReportsTheLineOfMalformedInput();
+    Import_ReadParallel_MatchesTheStreamedRead();
+    
+    
+    // Graph File Tests
+    GraphFile_Open_ReadsTheRowsInPlace();
+    GraphFile_Verify_RejectsCorruptFiles();
+    
+    
+    // Traversal Tests
+    Traversal_BreadthFirst_MatchesASingleQueue();
+    Traversal_ConnectedComponents_NumbersComponentsByTheirSmallestVertex();
+    
+    
+    // Shortest Paths Tests
+    ShortestPaths_DijkstraAndDeltaStepping_MatchBellmanFord();
+    Graph_ShortestPath_FollowsTheDirectionOfEachEdge();
+    
+    
+    // All Pairs Tests
+    AllPairs_FloydWarshall_MatchesDijkstraFromEverySource();
+    AllPairs_TransitiveClosure_MatchesBreadthFirstReachability();
+    Graph_AllPairsShortestPaths_FollowsTheDirectionOfEachEdge();
+    
     
+    // Biconnected Tests
+    Biconnected_Components_SplitsAMultigraphAtItsCutVertices();
+    Biconnected_Components_MatchesRemovingEachVertexAndEdge();
+    Biconnected_Components_SearchesAPathOfAMillionVertices();
     
+    
+    // Directed Tests
+    Directed_StronglyConnectedComponents_MatchesMutualReachability();
+    Directed_CriticalPath_MatchesTheHeaviestPathByBruteForce();
+    Directed_StronglyConnectedComponents_SearchesACycleOfAMillionVertices();
+    Graph_CriticalPath_FollowsTheDirectionOfEachEdge();
+    
+    
+    // Euler Tests
+    Euler_Trail_WalksEveryEdgeOfAMultigraphOnce();
+    Euler_Trail_FindsNoWalkAcrossComponents();
+    Euler_Trail_WalksACycleOfAMillionVertices();
+    Graph_EulerTrail_WalksEdgesEitherWayUnlessDirected();
+    
+    
+    // Coloring Tests
+    Coloring_Chromatic_MatchesTryingEveryColoring();
+    Coloring_Chromatic_ColorsTheGrotzschGraphAndStopsWhenCancelled();
+    Graph_ChromaticNumber_IgnoresDirectionAndSelfLoops();
+    
+    
+    // Clique Tests
+    Clique_Maximal_MatchesTryingEverySet();
+    Clique_Maximal_StreamsTheCliquesOfAMoonMoserGraph();
+    Clique_DegeneracyOrder_LeavesFewNeighborsAfterEachVertex();
+    Graph_MaximumClique_IgnoresDirectionAndSelfLoops();
+    
+    
+    // Flow Tests
+    Flow_PushRelabel_MatchesTryingEveryCut();
+    Flow_Dinic_CountsEdgeDisjointPaths();
+    Flow_PushRelabel_AgreesWithDinicOnALargeNetwork();
+    Graph_MinCut_CutsTheLightestEdgesInTheirDirection();
+    
+    
+    // Matching Tests
+    Matching_Blossom_MatchesTryingEveryMatching();
+    Matching_Blossom_AugmentsThroughNestedBlossoms();
+    Matching_HopcroftKarp_AgreesWithBlossomOnALargeGraph();
+    Graph_MaximumMatching_AssignsTheLightestEdges();
+    
+    
+#ifndef PROFILER_DISABLED
+    // Profiler Tests
+    Profiler_EndFrame_TotalsTheZonesOfTheFrame();
+    Profiler_WriteTrace_WritesTheZonesOfEveryThread();
+#endif
+    
+    
+#ifndef TESTS_GRAPH_ONLY
     // Graph Sketch Tests
     GraphSketch_CreateNew_SetsGraphWithNoVerticesAndNullBvhTree();
     GraphSketch_AddVertex_CreatesNewGraphVertexAndBvhTreeAndPrimitiveAndDrawable();
     GraphSketch_BvhTreeCollision_DoesCollideWithItsOwnBoundingBox();
     GraphSketch_BvhTreeCollision_DoesNotCollideOutsideItsOwnBoundingBox();
+    GraphSketch_AddManyVertices_EveryVertexCollidesWithItsOwnBoundingBox();
+    GraphSketch_BvhTreeCollision_CountsNodesVisitedAndPrimitiveTests();
+    GraphSketch_MoveVertex_CollidesOnlyAtNewPosition();
+    GraphSketch_RemoveLastVertexAndEdge_RevertsGraphAndBvhTree();
+    GraphSketch_AddEdgeList_PlacesEveryVertexInTheScene();
+    GraphSketch_Open_RestoresTheSavedSketch();
+    
+    
+    // Journal Tests
+    Journal_UndoAddVertexAndEdge_RevertsInReverseOrder();
+    Journal_UndoThenRedo_RestoresEveryEdit();
+    Journal_MoveVertexDrag_CoalescesIntoOneRecord();
+    Journal_UndoClear_SwapsTheClearedSketchBack();
+    Journal_EditAfterUndo_DropsRedo();
+    Journal_UndoRecolor_BringsEveryColorBack();
+    
+    // Input Log Tests
+    InputLog_WriteThenRead_RestoresEveryEvent();
+    InputLog_Next_HandsOutTheEventsOfEachFrameInOrder();
+    
+    // Command Queue Tests
+    CommandQueue_ApplyBulkEdits_RebuildsTheBvhTreeOnce();
+    CommandQueue_MoveVertex_ReplacesTheQueuedMove();
+#endif
     
     return 0;
 }